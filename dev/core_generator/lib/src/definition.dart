@@ -961,6 +961,7 @@ class Definition {
           ? 'rive/generated/${definition.localCodeFilename}'
           : definition.concreteCodeFilename);
     }
+    includes.add('rive/core/core_arena.hpp');
     var includeList = includes.toList()..sort();
     for (final include in includeList) {
       ctxCode.writeln('#include "$include"');
@@ -979,6 +980,19 @@ class Definition {
     }
     ctxCode.writeln('} return nullptr; }');
 
+    ctxCode.writeln('static Core* cloneIntoArena(const Core* object, '
+        'CoreArena& arena) {'
+        'switch(object->coreType()) {');
+    for (final definition in runtimeDefinitions) {
+      if (definition._isAbstract) {
+        continue;
+      }
+      ctxCode.writeln('case ${definition.name}Base::typeKey:');
+      ctxCode.writeln('return arena.clone<${definition.name}, '
+          '${definition.name}Base>(object);');
+    }
+    ctxCode.writeln('} return nullptr; }');
+
     var usedFieldTypes = <FieldType, List<Property>>{};
     var getSetFieldTypes = <FieldType, List<Property>>{};
     for (final definition in runtimeDefinitions) {
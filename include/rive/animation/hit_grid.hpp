@@ -0,0 +1,77 @@
+#ifndef _RIVE_HIT_GRID_HPP_
+#define _RIVE_HIT_GRID_HPP_
+
+#include "rive/math/aabb.hpp"
+#include "rive/math/vec2d.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace rive
+{
+class Shape;
+
+/// Uniform grid over the world bounds of a state machine's hittable shapes.
+/// Lets pointer events find the shapes whose bounds contain the pointer
+/// without visiting every hit component. Entries are refit when their shape's
+/// world bounds version changes, so only moving shapes pay for updates.
+class HitGrid
+{
+public:
+    /// Adds shape to the grid and returns its entry, which stays valid until
+    /// clear().
+    uint32_t add(Shape* shape);
+    void clear();
+    size_t size() const { return m_entries.size(); }
+
+    /// Whether entries were added or cleared since the last update.
+    bool needsRebuild() const { return m_needsRebuild; }
+
+    /// Refits the entries whose shape's world bounds changed since the last
+    /// update, rebuilding the cells when a shape moves outside of them.
+    void update();
+
+    /// Marks every entry whose stored world bounds contain position (the same
+    /// test as Shape::hitTestAABB) and appends them to entries.
+    void query(Vec2D position, std::vector<uint32_t>& entries);
+
+    /// Whether entry was found by the most recent query.
+    bool wasQueried(uint32_t entry) const
+    {
+        return m_entries[entry].queryStamp == m_queryStamp;
+    }
+
+private:
+    struct Entry
+    {
+        Shape* shape;
+        uint32_t boundsVersion;
+        uint32_t queryStamp;
+        AABB bounds;
+        // Inclusive range of cells holding this entry, empty when the bounds
+        // are empty or unbounded.
+        IAABB cells;
+    };
+
+    void rebuild();
+    IAABB cellsFor(const AABB& bounds) const;
+    void insert(uint32_t entry);
+    void remove(uint32_t entry);
+    std::vector<uint32_t>& cell(int32_t x, int32_t y)
+    {
+        return m_cells[y * m_columns + x];
+    }
+
+    std::vector<Entry> m_entries;
+    std::vector<std::vector<uint32_t>> m_cells;
+    // Entries with non-finite bounds, tested on every query.
+    std::vector<uint32_t> m_unbounded;
+    AABB m_extent;
+    Vec2D m_inverseCellSize;
+    int32_t m_columns = 0;
+    int32_t m_rows = 0;
+    uint32_t m_queryStamp = 1;
+    bool m_needsRebuild = true;
+};
+} // namespace rive
+
+#endif
@@ -6,6 +6,7 @@ namespace rive
 {
 class Artboard;
 class KeyedProperty;
+struct ResolvedKeyedProperty;
 class KeyedCallbackReporter;
 class LinearAnimationInstance;
 class KeyedObject : public KeyedObjectBase
@@ -25,6 +26,10 @@ public:
                float time,
                float mix,
                const LinearAnimationInstance* context = nullptr);
+    /// Appends the keyed properties this object applies in artboard to
+    /// resolved.
+    void resolve(Artboard* artboard,
+                 std::vector<ResolvedKeyedProperty>& resolved);
 
     StatusCode import(ImportStack& importStack) override;
 
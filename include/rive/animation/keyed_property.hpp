@@ -4,9 +4,26 @@
 #include <vector>
 namespace rive
 {
+class InterpolatorHost;
 class KeyFrame;
 class KeyedCallbackReporter;
+class KeyedProperty;
 class LinearAnimationInstance;
+
+/// A KeyedProperty paired with the object it animates in one artboard
+/// instance. A LinearAnimationInstance resolves these once (see
+/// LinearAnimation::resolve) so applying it every frame is a walk over a flat
+/// list instead of a lookup per keyed object and property.
+struct ResolvedKeyedProperty
+{
+    KeyedProperty* property;
+    Core* object;
+    // InterpolatorHost::from(object), null for most objects.
+    InterpolatorHost* interpolatorHost;
+    // Where the previous apply found the property's keyframes.
+    int keyFrameCursor;
+};
+
 class KeyedProperty : public KeyedPropertyBase
 {
 public:
@@ -27,10 +44,30 @@ public:
     /// LinearAnimationInstance, propagated so scripted interpolators can vend
     /// per-(LAI, keyframe) stateful clones. Default-null keeps direct callers
     /// (tests, hold animations) source-compatible.
+    ///
+    /// `keyFrameCursor`, when provided, is the caller's per-instance record of
+    /// the keyframe index found on the previous apply. Playback usually stays
+    /// on the same keyframe span or moves to the next one, so the cursor
+    /// replaces the binary search with a check of one or two frame times.
     void apply(Core* object,
                float time,
                float mix,
-               const LinearAnimationInstance* context = nullptr);
+               const LinearAnimationInstance* context = nullptr,
+               int* keyFrameCursor = nullptr);
+
+    /// Apply to a property resolved with LinearAnimation::resolve.
+    static void apply(ResolvedKeyedProperty& resolved,
+                      float time,
+                      float mix,
+                      const LinearAnimationInstance* context)
+    {
+        resolved.property->apply(resolved.object,
+                                 resolved.interpolatorHost,
+                                 time,
+                                 mix,
+                                 context,
+                                 &resolved.keyFrameCursor);
+    }
 
     StatusCode import(ImportStack& importStack) override;
     KeyFrame* first() const
@@ -49,8 +86,20 @@ public:
     }
 
 private:
+    void apply(Core* object,
+               InterpolatorHost* interpolatorHost,
+               float time,
+               float mix,
+               const LinearAnimationInstance* context,
+               int* keyFrameCursor);
     int closestFrameIndex(float seconds, int exactOffset = 0) const;
+    // Same result as closestFrameIndex(seconds) but starts from (and updates)
+    // the index a previous call returned.
+    int closestFrameIndex(float seconds, int* cursor) const;
     std::vector<std::unique_ptr<KeyFrame>> m_keyFrames;
+    // The keyframes' seconds, contiguous so lookups don't chase a pointer per
+    // probed frame.
+    std::vector<float> m_keyFrameSeconds;
 };
 } // namespace rive
 
@@ -9,6 +9,7 @@ class Artboard;
 class KeyedObject;
 class KeyedCallbackReporter;
 class LinearAnimationInstance;
+struct ResolvedKeyedProperty;
 
 class LinearAnimation : public LinearAnimationBase
 {
@@ -33,6 +34,18 @@ public:
                float mix = 1.0f,
                const LinearAnimationInstance* context = nullptr) const;
 
+    /// Resolves the keyed properties this animation applies in artboard, in
+    /// the order apply() applies them.
+    std::vector<ResolvedKeyedProperty> resolve(Artboard* artboard) const;
+    /// Same as apply() on the artboard the properties were resolved in.
+    void apply(std::vector<ResolvedKeyedProperty>& resolved,
+               float time,
+               float mix = 1.0f,
+               const LinearAnimationInstance* context = nullptr) const;
+
+    /// Total number of keyed properties across the keyed objects.
+    size_t keyedPropertyCount() const;
+
     Loop loop() const { return (Loop)loopValue(); }
 
     StatusCode import(ImportStack& importStack) override;
@@ -1,6 +1,7 @@
 #ifndef _RIVE_LINEAR_ANIMATION_INSTANCE_HPP_
 #define _RIVE_LINEAR_ANIMATION_INSTANCE_HPP_
 
+#include "rive/animation/keyed_property.hpp"
 #include "rive/artboard.hpp"
 #include "rive/core/field_types/core_callback_type.hpp"
 #include "rive/nested_animation.hpp"
@@ -81,10 +82,7 @@ public:
     // Applies the animation instance to its artboard instance. The mix (a value
     // between 0 and 1) is the strength at which the animation is mixed with
     // other animations applied to the artboard.
-    void apply(float mix = 1.0f) const
-    {
-        m_animation->apply(m_artboardInstance, m_time, mix, this);
-    }
+    void apply(float mix = 1.0f) const;
 
     // Returns a per-(this LAI, keyframe) stateful clone of the given
     // ScriptedInterpolator, lazily creating it on first call. Returns nullptr
@@ -153,6 +151,12 @@ private:
     bool m_didLoop;
     int m_loopValue = -1;
 
+    // m_animation's keyed properties resolved against m_artboardInstance,
+    // built by the first apply(). Holds each property's keyframe cursor too,
+    // so it is `mutable` for the const apply(). Not copied by the copy ctor.
+    mutable std::vector<ResolvedKeyedProperty> m_resolvedProperties;
+    mutable bool m_isResolved = false;
+
     // Lazy outer pointer => the common case (no scripted interpolators) pays
     // one nullptr check on the apply hot path. Inner unique_ptr destroys the
     // cloned ScriptedInterpolator (and its Lua ref) when this LAI is
@@ -6,6 +6,7 @@
 #include <vector>
 #include <unordered_map>
 #include "rive/animation/gamepad_listener_group.hpp"
+#include "rive/animation/hit_grid.hpp"
 #include "rive/animation/keyboard_listener_group.hpp"
 #include "rive/animation/semantic_listener_group.hpp"
 #include "rive/animation/linear_animation_instance.hpp"
@@ -67,6 +68,7 @@ class StateMachineInstance : public Scene,
     friend class SMIInput;
     friend class KeyedProperty;
     friend class HitComponent;
+    friend class HitDrawable;
     friend class StateMachineLayerInstance;
 
 private:
@@ -82,6 +84,8 @@ private:
     void notifyEventListeners(const std::vector<EventReport>& events,
                               NestedArtboard* source);
     void sortHitComponents();
+    void buildHitGrid();
+    void updateHitGrid(Vec2D position) const;
     double randomValue();
     StateTransition* findRandomTransition(
         StateInstance* stateFromInstance,
@@ -403,6 +407,16 @@ private:
     size_t m_layerCount;
     StateMachineLayerInstance* m_layers;
     std::vector<std::unique_ptr<HitComponent>> m_hitComponents;
+    // Uniform grid over the world bounds of the hit components targeting
+    // shapes, so pointer events only hit test the shapes under the pointer.
+    // Queried once per pointer event, see updateHitGrid.
+    mutable HitGrid m_hitGrid;
+    mutable uint32_t m_worldBoundsChangeCounter = 0;
+    mutable std::vector<uint32_t> m_hitGridCandidates;
+    // Hit component of each grid entry.
+    std::vector<HitComponent*> m_hitGridComponents;
+    // Hit components that aren't in the grid and are always tested.
+    std::vector<HitComponent*> m_ungriddedHitComponents;
     std::vector<std::unique_ptr<ListenerGroup>> m_listenerGroups;
     StateMachineInstance* m_parentStateMachineInstance = nullptr;
     NestedArtboard* m_parentNestedArtboard = nullptr;
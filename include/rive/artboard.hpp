@@ -6,6 +6,7 @@
 #include "rive/animation/linear_animation.hpp"
 #include "rive/animation/state_machine.hpp"
 #include "rive/core_context.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/data_bind/data_context.hpp"
 #include "rive/data_bind/data_bind_container.hpp"
 #include "rive/viewmodel/viewmodel_instance_value.hpp"
@@ -24,6 +25,8 @@
 #include "rive/semantic/semantic_node.hpp"
 #include "rive/scripting_slots.hpp"
 
+#include <atomic>
+#include <memory>
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
@@ -60,6 +63,20 @@ class FocusManager;
 class SemanticManager;
 class SemanticNode;
 
+/// Where Artboard::instance() allocates an instance's cloned objects.
+enum class InstanceAllocation : uint8_t
+{
+    /// Arena when instanced while an arena backed instance is being cloned
+    /// (i.e. for its nested artboards), otherwise Heap.
+    Inherit,
+    /// Each object is allocated separately on the heap.
+    Heap,
+    /// Objects are cloned into one arena owned by the instance and freed with
+    /// it. Objects that need more than a shallow copy to clone (or that are
+    /// reference counted), and anything objects allocate, stay on the heap.
+    Arena,
+};
+
 #ifdef WITH_RIVE_TOOLS
 typedef void (*ArtboardCallback)(void*);
 typedef uint8_t (*TestBoundsCallback)(void*, float, float, bool);
@@ -78,6 +95,9 @@ class Artboard : public ArtboardBase,
     friend class Component;
 
 private:
+    // Declared first so it is released after everything else; the objects
+    // cloned into it are destroyed in ~Artboard.
+    std::unique_ptr<CoreArena> m_instanceArena;
     std::vector<Core*> m_Objects;
     std::vector<Core*> m_invalidObjects;
     std::vector<LinearAnimation*> m_Animations;
@@ -100,6 +120,9 @@ private:
     bool m_JoysticksApplyBeforeUpdate = true;
 
     unsigned int m_DirtDepth = 0;
+    // One bit per component in m_DependencyOrder, set by onComponentDirty so
+    // updateComponents only visits components that may have dirt.
+    std::vector<uint64_t> m_dirtyComponents;
     Factory* m_Factory = nullptr;
     Drawable* m_FirstDrawable = nullptr;
     bool m_IsInstance = false;
@@ -122,9 +145,26 @@ private:
 #endif
     static uint64_t sm_frameId;
     bool sharesLayoutWithHost() const;
-    void cloneObjectDataBinds(const Core* object,
+    void cloneObjectDataBinds(size_t objectIndex,
                               Core* clone,
                               Artboard* artboard) const;
+    // The data binds to clone for each object when instancing, grouped by the
+    // index of their target in m_Objects (in dataBinds() order within a
+    // group), so instancing doesn't rescan every data bind per object. Built
+    // when a source artboard initializes.
+    std::vector<DataBind*> m_instanceDataBinds;
+    std::vector<uint32_t> m_instanceDataBindOffsets;
+    void buildInstanceDataBindsIndex();
+    // Bytes the last arena backed instance used, so the next one can reserve
+    // its arena in a single block.
+    mutable std::atomic<size_t> m_instanceArenaSize{0};
+    std::unique_ptr<CoreArena> makeInstanceArena(
+        InstanceAllocation allocation) const;
+    static bool canCloneIntoArena(const Core* object);
+    // Clones every object (and its data binds) into artboardClone, placing
+    // them in an arena it owns when allocation calls for one.
+    void cloneObjects(Artboard* artboardClone,
+                      InstanceAllocation allocation) const;
     // Lazily-built index of this artboard's data binds that target keyframes,
     // keyed by the (shared) keyframe. Keyframe binds live in dataBinds() but
     // are never applied directly (keyframes aren't Components); instead a
@@ -142,6 +182,11 @@ private:
     // state machine controllers to sort their hittable components when they are
     // out of sync
     uint8_t m_drawOrderChangeCounter = 0;
+    // Bumped whenever a shape's world bounds are marked dirty. State machines
+    // compare it against the value they last saw to know when to refit their
+    // hit test grids. Wide enough that it won't wrap between two pointer
+    // events.
+    uint32_t m_worldBoundsChangeCounter = 0;
 #ifdef WITH_RIVE_TOOLS
     uint16_t m_artboardId = 0;
 #endif
@@ -321,6 +366,9 @@ public:
 
     /// Update components that depend on each other in DAG order.
     bool updateComponents();
+    // Index of the first component at or after from with its dirty bit set,
+    // or the component count when there are none.
+    size_t nextDirtyComponent(size_t from) const;
 
     // Update layouts and components. Returns true if it updated something.
     bool updatePass(bool isRoot);
@@ -357,11 +405,17 @@ public:
                                               AdvanceFlags::NewFrame);
     void reset() override;
     uint8_t drawOrderChangeCounter() { return m_drawOrderChangeCounter; }
+    uint32_t worldBoundsChangeCounter() const
+    {
+        return m_worldBoundsChangeCounter;
+    }
+    void markWorldBoundsChanged() { m_worldBoundsChangeCounter++; }
     Drawable* firstDrawable() { return m_FirstDrawable; };
     void addScriptedObject(ScriptedObject* object);
 
     /// Poll async work (image decodes, etc.) so promises resolve before
-    /// script callbacks run. Called at the top of advance().
+    /// script callbacks run. Called at the top of advance(). A no-op on
+    /// BatchAdvancer threads, which poll once before advancing.
     void pollAsyncWork();
 
     void drawInternal(Renderer* renderer);
@@ -564,9 +618,13 @@ public:
 
     /// Make an instance of this artboard. A non null factory reroutes the
     /// instance's render resource creation (a deferred session facade);
-    /// nested instances inherit it.
+    /// nested instances inherit it. InstanceAllocation::Arena clones the
+    /// objects into a single allocation, which is much cheaper when instancing
+    /// the same artboard many times (e.g. list items).
     template <typename T = ArtboardInstance>
-    std::unique_ptr<T> instance(Factory* factory = nullptr) const
+    std::unique_ptr<T> instance(
+        Factory* factory = nullptr,
+        InstanceAllocation allocation = InstanceAllocation::Inherit) const
     {
         std::unique_ptr<T> artboardClone(new T);
         artboardClone->copy(*this);
@@ -582,27 +640,7 @@ public:
 #endif
         artboardClone->m_artboardSource =
             isInstance() ? m_artboardSource : this;
-        cloneObjectDataBinds(this, artboardClone.get(), artboardClone.get());
-
-        std::vector<Core*>& cloneObjects = artboardClone->m_Objects;
-        cloneObjects.push_back(artboardClone.get());
-
-        if (!m_Objects.empty())
-        {
-            // Skip first object (artboard).
-            auto itr = m_Objects.begin();
-            while (++itr != m_Objects.end())
-            {
-                auto object = *itr;
-                cloneObjects.push_back(object == nullptr ? nullptr
-                                                         : object->clone());
-                // For each object, clone its data bind objects and target their
-                // clones
-                cloneObjectDataBinds(object,
-                                     cloneObjects.back(),
-                                     artboardClone.get());
-            }
-        }
+        cloneObjects(artboardClone.get(), allocation);
 
         for (auto animation : m_Animations)
         {
@@ -635,6 +673,10 @@ public:
     /// Returns true if the artboard is an instance of another
     bool isInstance() const { return m_IsInstance; }
 
+    /// The arena this instance's objects were cloned into, or null if they
+    /// were allocated on the heap.
+    const CoreArena* instanceArena() const { return m_instanceArena.get(); }
+
     /// Returns true when the artboard will shift the origin from the top
     /// left to the relative width/height of the artboard itself. This is
     /// what the editor does visually when you change the origin value to
@@ -9,9 +9,11 @@
 #include <atomic>
 #include <deque>
 #include <cstdint>
+#include <functional>
 
 #ifdef WITH_RIVE_THREADING
 #include <thread>
+#include <memory>
 #include <mutex>
 #include <condition_variable>
 #include <vector>
@@ -24,24 +26,63 @@ namespace rive
 /// A pool that executes WorkTasks.
 ///
 /// WITH_RIVE_THREADING: spawns worker threads; submit() queues work;
-/// pollCompletedWork() delivers callbacks on the main thread.
+/// pollCompletedWork() delivers callbacks on the main thread. Each worker owns
+/// a deque per WorkPriority. Tasks submitted from the main thread are spread
+/// round-robin across the workers, and tasks submitted from a worker go on its
+/// own deque. An idle worker takes its own highest priority task first, but
+/// steals higher priority work from the other workers before it starts on
+/// anything lower priority of its own.
 ///
 /// Without threading: submit() just enqueues; pollCompletedWork() dequeues,
 /// calls execute() synchronously, then delivers callbacks — all on the main
 /// thread.
+///
+/// In both modes, higher priority tasks have their callbacks delivered first.
 class WorkPool : public RefCnt<WorkPool>
 {
 public:
-    WorkPool();
+    /// Passed to pollCompletedWork() to deliver every task that has completed
+    /// so far.
+    constexpr static uint32_t kPollAll = UINT32_MAX;
+
+    /// Thread count used when none is requested: the hardware concurrency,
+    /// capped at 4.
+    static uint32_t defaultThreadCount();
+
+    /// A threadCount of 0 uses defaultThreadCount(). Ignored without
+    /// threading.
+    explicit WorkPool(uint32_t threadCount = 0);
     ~WorkPool();
 
-    /// Submit a task for execution.  Returns a nonzero handle on success.
+    /// Number of worker threads (0 without threading).
+    uint32_t threadCount() const;
+
+    /// Submit a task for execution at task->priority().  Returns a nonzero
+    /// handle on success.
     uint64_t submit(rcp<WorkTask> task);
 
-    /// Process up to maxCallbacks completed tasks on the main thread.
-    /// Returns the number of tasks processed.
+    /// Calls fn(i) for every i in [0, count) and returns once every call has.
+    /// The calling thread claims indices alongside up to maxHelpers of the
+    /// pool's workers, so callers should post a few coarse chunks per thread.
+    /// The helpers jump the queues at high priority and deliver no callbacks.
+    /// A worker busy with a long task just doesn't help, and anything no
+    /// helper claims runs on the calling thread, so this may be called from a
+    /// worker too. Without threading every call runs inline.
+    void parallelFor(size_t count,
+                     const std::function<void(size_t)>& fn,
+                     uint32_t maxHelpers = UINT32_MAX);
+
+    /// Process up to maxCallbacks completed tasks on the main thread, highest
+    /// priority first. Tasks that complete while callbacks are being delivered
+    /// wait for the next call. Returns the number of tasks processed.
     uint32_t pollCompletedWork(uint32_t maxCallbacks = 16);
 
+    /// The maxCallbacks rive_pollAsyncWork() uses for this pool. Defaults to
+    /// kPollAll with threading, where callbacks are all that is left to do on
+    /// the main thread, and to 16 without, where polling also runs execute().
+    uint32_t pollBudget() const { return m_pollBudget; }
+    void setPollBudget(uint32_t maxCallbacks) { m_pollBudget = maxCallbacks; }
+
     /// Returns true if any tasks are queued, running, or
     /// completed-but-unpolled.
     bool hasPendingWork() const;
@@ -53,28 +94,50 @@ public:
     static uint64_t nextOwnerId();
 
 private:
-    std::deque<rcp<WorkTask>> m_workQueue;
-
-#ifdef WITH_RIVE_THREADING
-    std::deque<rcp<WorkTask>> m_completedQueue;
+#ifndef WITH_RIVE_THREADING
+    std::deque<rcp<WorkTask>> m_workQueues[kWorkPriorityCount];
+#else
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<rcp<WorkTask>> queues[kWorkPriorityCount];
+    };
+
+    void workerLoop(uint32_t workerIndex);
+    // Pops the highest priority task available to the given worker, stealing
+    // from the other workers if need be. Returns null if every queue is empty.
+    rcp<WorkTask> popOrSteal(uint32_t workerIndex);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
     std::vector<std::thread> m_threads;
-    std::mutex m_queueMutex;
-    std::mutex m_completedMutex;
+    std::atomic<uint32_t> m_nextWorker{0};
+
+    // Workers sleep on m_haveWork while m_queuedCount is 0.
+    std::mutex m_sleepMutex;
     std::condition_variable m_haveWork;
+    std::atomic<int> m_queuedCount{0};
+    std::atomic<int> m_inFlightCount{0};
+    std::atomic<bool> m_shutdown{false};
+
+    std::mutex m_completedMutex;
+    std::deque<rcp<WorkTask>> m_completedQueues[kWorkPriorityCount];
+
     // Maps ownerId → cancel generation. A task is owner-cancelled only if
     // its submit generation is less than the owner's cancel generation.
+    std::mutex m_cancelMutex;
     std::unordered_map<uint64_t, uint64_t> m_cancelledOwners;
-    std::atomic<int> m_inFlightCount{0};
     uint64_t m_cancelGeneration = 0;
-    bool m_shutdown = false;
-
-    void workerLoop();
 #endif
 
-    uint64_t m_nextHandle = 1;
+    uint32_t m_pollBudget;
+    std::atomic<uint64_t> m_nextHandle{1};
     static std::atomic<uint64_t> s_nextOwnerId;
 };
 
+/// Sets the thread count the global WorkPool is created with. Has no effect
+/// once getGlobalWorkPool() has been called.
+void setGlobalWorkPoolThreadCount(uint32_t threadCount);
+
 /// Returns the process-global WorkPool singleton. Creates it on first call.
 rcp<WorkPool>& getGlobalWorkPool();
 
@@ -21,6 +21,16 @@ enum class WorkStatus : uint8_t
     Cancelled
 };
 
+/// Scheduling priority of a WorkTask. Higher priority tasks are started, and
+/// have their callbacks delivered, before lower priority ones.
+enum class WorkPriority : uint8_t
+{
+    High,   // e.g. decoding an image that is currently visible
+    Normal, // the default
+    Low,    // e.g. prefetching
+};
+constexpr static int kWorkPriorityCount = 3;
+
 /// Base class for a unit of async work.
 ///
 /// With WITH_RIVE_THREADING, execute() runs on a worker thread and
@@ -48,6 +58,10 @@ public:
     /// Called when the task is cancelled (e.g. Lua state closing).
     virtual void onCancel() {}
 
+    /// Tasks with nothing to report can return false to be dropped once
+    /// execute() returns, rather than waiting for pollCompletedWork().
+    virtual bool deliversCallbacks() const { return true; }
+
     WorkStatus status() const { return m_status; }
     void setStatus(WorkStatus s) { m_status = s; }
 
@@ -65,6 +79,10 @@ public:
     uint64_t submitGeneration() const { return m_submitGeneration; }
     void setSubmitGeneration(uint64_t gen) { m_submitGeneration = gen; }
 
+    /// Must be set before the task is submitted.
+    WorkPriority priority() const { return m_priority; }
+    void setPriority(WorkPriority priority) { m_priority = priority; }
+
 protected:
     std::string m_errorMessage;
 
@@ -73,6 +91,7 @@ private:
     std::atomic<bool> m_cancelled{false};
     uint64_t m_ownerId = 0;
     uint64_t m_submitGeneration = 0;
+    WorkPriority m_priority = WorkPriority::Normal;
 };
 
 } // namespace rive
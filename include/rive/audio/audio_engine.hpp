@@ -4,9 +4,11 @@
 
 #include "rive/refcnt.hpp"
 #include "rive/span.hpp"
+#include "rive/audio/decoded_audio_cache.hpp"
 #include <vector>
 #include <stdio.h>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 
 typedef struct ma_engine ma_engine;
@@ -21,6 +23,7 @@ class AudioSound;
 class AudioSource;
 class LevelsNode;
 class Artboard;
+class AudioStreamFiller;
 class AudioEngine : public RefCnt<AudioEngine>
 {
     friend class AudioSound;
@@ -58,6 +61,19 @@ public:
 
     static rcp<AudioEngine> RuntimeEngine(bool makeWhenNecessary = true);
 
+    // Clips that decode to at most decodedClipLimit() bytes at the engine's
+    // format are decoded once and shared by every sound playing them, through
+    // a cache holding at most decodedCacheBudget() bytes. Longer clips (and
+    // clips whose length is unknown) stream through a small ring buffer that
+    // is decoded off the audio thread.
+    static const size_t defaultDecodedClipLimit = 2 * 1024 * 1024;
+    static const size_t defaultDecodedCacheBudget = 16 * 1024 * 1024;
+
+    size_t decodedClipLimit() const { return m_decodedClipLimit; }
+    void decodedClipLimit(size_t bytes) { m_decodedClipLimit = bytes; }
+    size_t decodedCacheBudget();
+    void decodedCacheBudget(size_t bytes);
+
 #ifdef EXTERNAL_RIVE_AUDIO_ENGINE
     bool readAudioFrames(float* frames,
                          uint64_t numFrames,
@@ -78,6 +94,8 @@ public:
 #ifdef TESTING
     size_t playingSoundCount();
     rcp<AudioSound> playingSoundsHead();
+    const DecodedAudioCache& decodedCache() const { return m_decodedCache; }
+    size_t streamingSoundCount();
 #endif
 private:
     AudioEngine(ma_engine* engine, ma_context* context);
@@ -94,6 +112,13 @@ private:
     void soundCompleted(rcp<AudioSound> sound);
     void unlinkSound(rcp<AudioSound> sound);
     rcp<AudioSound> initializeAudioSound(rcp<AudioSound>);
+    // Returns source decoded at the engine's format, from the cache when it
+    // is there. Only the cache is touched under m_mutex, not the decode.
+    rcp<DecodedAudio> decodedAudio(AudioSource* source);
+
+    size_t m_decodedClipLimit = defaultDecodedClipLimit;
+    DecodedAudioCache m_decodedCache;
+    std::unique_ptr<AudioStreamFiller> m_streamFiller;
 
     std::vector<rcp<AudioSound>> m_completedSounds;
     rcp<AudioSound> m_playingSoundsHead;
@@ -5,6 +5,7 @@
 #include "rive/span.hpp"
 #include "rive/simple_array.hpp"
 #include "rive/audio/audio_format.hpp"
+#include <cstdint>
 
 namespace rive
 {
@@ -42,6 +43,11 @@ public:
     uint32_t sampleRate();
 #ifdef WITH_RIVE_AUDIO
     float duration();
+    // Length at sampleRate(), 0 if the decoder can't tell.
+    uint64_t lengthInFrames();
+    // Unique per source for the life of the process; keys the engine's
+    // decoded audio cache.
+    uint64_t id() const { return m_id; }
 #else
     float duration() { return 0; }
 #endif
@@ -67,9 +73,17 @@ public:
 
 private:
 #ifdef WITH_RIVE_AUDIO
+    // Decodes the header once to learn channels, sample rate, length and
+    // format. Returns false if the bytes don't decode.
+    bool probe();
+
+    uint64_t m_id;
     bool m_isBuffered;
+    bool m_probed = false;
     uint32_t m_channels;
     uint32_t m_sampleRate;
+    uint64_t m_lengthInFrames = 0;
+    AudioFormat m_format = AudioFormat::unknown;
     float m_duration;
     rive::Span<uint8_t> m_fileBytes;
     rive::SimpleArray<uint8_t> m_ownedBytes;
@@ -0,0 +1,180 @@
+#ifdef WITH_RIVE_AUDIO
+#ifndef _RIVE_AUDIO_STREAM_HPP_
+#define _RIVE_AUDIO_STREAM_HPP_
+
+#include "miniaudio.h"
+#include "rive/refcnt.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define RIVE_AUDIO_STREAM_THREAD
+#include <thread>
+#endif
+
+namespace rive
+{
+class AudioSource;
+
+// Plays a clip by decoding it a block at a time into a small ring, so a long
+// track costs the ring rather than its whole PCM. fill() decodes on whichever
+// thread owns the stream's decoder (an AudioStreamFiller); the data source
+// side only copies out of the ring and never decodes on the audio thread.
+//
+// Blocks are tagged with the seek epoch they were decoded for. A seek on the
+// audio thread bumps the epoch and the reader drops blocks from before it
+// until the filler catches up, so the ring stays single producer, single
+// consumer with no locks on either side.
+class AudioStream : public RefCnt<AudioStream>
+{
+public:
+    static constexpr uint32_t kBlockFrames = 1024;
+    static constexpr uint32_t kBlockCount = 16;
+
+    // Returns null if the source's bytes fail to decode. Reading ends at
+    // endFrame, in frames at sampleRate.
+    static rcp<AudioStream> Make(rcp<AudioSource> source,
+                                 uint32_t channels,
+                                 uint32_t sampleRate,
+                                 uint64_t endFrame);
+    ~AudioStream();
+
+    ma_data_source* dataSource() { return &m_dataSource.base; }
+
+    // Positions the decoder at startFrame and fills the ring on the calling
+    // thread. Only valid before the stream is handed to a filler.
+    void prime(uint64_t startFrame);
+
+    // Decodes into every free block. Filler side.
+    void fill();
+
+    // The sound playing this stream is gone; the filler drops it.
+    void close() { m_closed.store(true, std::memory_order_release); }
+    bool closed() const { return m_closed.load(std::memory_order_acquire); }
+
+    // Reads that found the ring empty and played silence instead.
+    uint64_t underruns() const
+    {
+        return m_underruns.load(std::memory_order_relaxed);
+    }
+    size_t ringSizeInBytes() const { return m_ring.size() * sizeof(float); }
+    // Blocks decoded and not yet played through, counting a partly read one.
+    uint32_t bufferedBlocks() const
+    {
+        return m_writeIndex.load(std::memory_order_acquire) -
+               m_readIndex.load(std::memory_order_acquire);
+    }
+
+private:
+    AudioStream(rcp<AudioSource> source,
+                uint32_t channels,
+                uint32_t sampleRate,
+                uint64_t endFrame);
+
+    struct Block
+    {
+        uint32_t epoch;
+        uint32_t frames;
+        bool last;
+    };
+    struct DataSource
+    {
+        ma_data_source_base base;
+        AudioStream* stream;
+    };
+
+    float* blockSamples(uint32_t index)
+    {
+        return m_ring.data() +
+               (size_t)(index % kBlockCount) * kBlockFrames * m_channels;
+    }
+
+    // Audio thread.
+    ma_result read(float* out, ma_uint64 frameCount, ma_uint64* framesRead);
+    void seek(uint64_t frame);
+
+    static ma_result Read(ma_data_source* dataSource,
+                          void* framesOut,
+                          ma_uint64 frameCount,
+                          ma_uint64* framesRead);
+    static ma_result Seek(ma_data_source* dataSource, ma_uint64 frameIndex);
+    static ma_result GetDataFormat(ma_data_source* dataSource,
+                                   ma_format* format,
+                                   ma_uint32* channels,
+                                   ma_uint32* sampleRate,
+                                   ma_channel* channelMap,
+                                   size_t channelMapCap);
+    static ma_result GetCursor(ma_data_source* dataSource, ma_uint64* cursor);
+    static ma_result GetLength(ma_data_source* dataSource, ma_uint64* length);
+    static ma_data_source_vtable s_vtable;
+
+    DataSource m_dataSource;
+    // Keeps the encoded bytes alive while the decoder reads them.
+    rcp<AudioSource> m_source;
+    ma_decoder m_decoder;
+    bool m_hasDecoder = false;
+    const uint32_t m_channels;
+    const uint32_t m_sampleRate;
+    const uint64_t m_endFrame;
+    uint64_t m_lengthInFrames = 0;
+
+    std::vector<float> m_ring;
+    Block m_blocks[kBlockCount] = {};
+    // Monotonic block counts; the slot is the count modulo kBlockCount.
+    std::atomic<uint32_t> m_readIndex{0};
+    std::atomic<uint32_t> m_writeIndex{0};
+    // Written by the audio thread on seek, read by the filler.
+    std::atomic<uint32_t> m_seekEpoch{0};
+    std::atomic<uint64_t> m_seekFrame{0};
+
+    // Filler side.
+    uint32_t m_fillEpoch = 0;
+    uint64_t m_fillFrame = 0;
+    bool m_fillDone = false;
+
+    // Audio thread side.
+    uint32_t m_readEpoch = 0;
+    uint32_t m_blockOffset = 0;
+    bool m_readDone = false;
+    std::atomic<uint64_t> m_cursor{0};
+    std::atomic<uint64_t> m_underruns{0};
+
+    std::atomic<bool> m_closed{false};
+};
+
+// Owns the decode side of an engine's streams. With threads, a single worker
+// tops every open stream's ring up every few milliseconds; without them,
+// pump() does it on the calling thread.
+class AudioStreamFiller
+{
+public:
+    AudioStreamFiller() = default;
+    ~AudioStreamFiller();
+
+    void add(rcp<AudioStream> stream);
+    // Fills every open stream inline when there is no worker thread to do
+    // it; a no-op otherwise.
+    void pump();
+    size_t streamCount();
+
+private:
+    void fillOpenStreams();
+#ifdef RIVE_AUDIO_STREAM_THREAD
+    void threadLoop();
+    std::thread m_thread;
+    std::condition_variable m_wake;
+    bool m_shutdown = false;
+#endif
+    std::mutex m_mutex;
+    std::vector<rcp<AudioStream>> m_streams;
+    // Streams being filled, copied out so the lock is not held while
+    // decoding.
+    std::vector<rcp<AudioStream>> m_filling;
+};
+} // namespace rive
+
+#endif
+#endif
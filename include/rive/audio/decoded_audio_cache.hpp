@@ -0,0 +1,86 @@
+#ifdef WITH_RIVE_AUDIO
+#ifndef _RIVE_DECODED_AUDIO_CACHE_HPP_
+#define _RIVE_DECODED_AUDIO_CACHE_HPP_
+
+#include "rive/refcnt.hpp"
+#include "rive/span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace rive
+{
+// A clip fully decoded to interleaved f32 PCM at an engine's channel count and
+// sample rate. Sounds playing it hold a ref, so an entry evicted from the
+// cache stays valid until the last of them is disposed.
+class DecodedAudio : public RefCnt<DecodedAudio>
+{
+public:
+    DecodedAudio(std::vector<float> samples, uint32_t channels) :
+        m_samples(std::move(samples)), m_channels(channels)
+    {}
+
+    Span<const float> samples() const
+    {
+        return Span<const float>(m_samples.data(), m_samples.size());
+    }
+    uint32_t channels() const { return m_channels; }
+    uint64_t lengthInFrames() const
+    {
+        return m_channels == 0 ? 0 : m_samples.size() / m_channels;
+    }
+    size_t sizeInBytes() const { return m_samples.size() * sizeof(float); }
+
+private:
+    std::vector<float> m_samples;
+    uint32_t m_channels;
+};
+
+// Least recently used decoded clips keyed by AudioSource::id(), held under a
+// byte budget. Not thread safe; the AudioEngine guards it with its mutex.
+class DecodedAudioCache
+{
+public:
+    explicit DecodedAudioCache(size_t budget) : m_budget(budget) {}
+
+    // Returns the clip decoded for sourceId and marks it most recently used,
+    // or null.
+    rcp<DecodedAudio> find(uint64_t sourceId);
+
+    // Caches audio for sourceId, evicting the least recently used clips until
+    // it fits. A clip larger than the whole budget is not cached.
+    void insert(uint64_t sourceId, rcp<DecodedAudio> audio);
+
+    size_t budget() const { return m_budget; }
+    // Shrinking the budget evicts immediately.
+    void budget(size_t bytes);
+
+    size_t sizeInBytes() const { return m_bytes; }
+    size_t count() const { return m_entries.size(); }
+    uint64_t hits() const { return m_hits; }
+    uint64_t misses() const { return m_misses; }
+
+    void clear();
+
+private:
+    struct Entry
+    {
+        uint64_t sourceId;
+        rcp<DecodedAudio> audio;
+    };
+    void evictToFit(size_t bytes);
+
+    // Front is most recently used.
+    std::list<Entry> m_entries;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_lookup;
+    size_t m_budget;
+    size_t m_bytes = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+};
+} // namespace rive
+
+#endif
+#endif
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#ifndef _RIVE_BATCH_ADVANCER_HPP_
+#define _RIVE_BATCH_ADVANCER_HPP_
+
+#include "rive/advance_flags.hpp"
+#include "rive/span.hpp"
+#include <cstdint>
+#include <functional>
+
+namespace rive
+{
+class ArtboardInstance;
+class Scene;
+
+/// Advances a batch of independent scenes or artboard instances concurrently.
+/// The calling thread takes part in the work, and advance() returns once every
+/// item has been advanced.
+///
+/// The other threads are the global WorkPool's workers, borrowed through
+/// WorkPool::parallelFor(), so batches share cores with the renderer's
+/// parallel work instead of competing with it. Without WITH_RIVE_THREADING
+/// the pool has no workers and every item is advanced on the calling thread.
+///
+/// Each item is advanced exactly as it would be serially
+/// (Scene::advanceAndApply, or Artboard::advance), so the results are the
+/// same as advancing the items one after another, in any order.
+///
+/// Threading contract:
+///  - The items in a batch must be independent: no two may share an
+///    ArtboardInstance, a StateMachineInstance, a bound ViewModelInstance or a
+///    scripting VM. Instances created from the same File are independent as
+///    long as they are bound to their own view model instances; global view
+///    model instances must not be bound to more than one item in a batch.
+///  - The File the items were instanced from is only read while advancing and
+///    may be shared freely.
+///  - Advancing calls these Factory methods, from several workers at once:
+///    makeRenderPath(), makeEmptyRenderPath(), makeRenderPaint(),
+///    makeLinearGradient() and makeRadialGradient() (text, paths and
+///    gradients rebuild their render objects while updating). They must be
+///    thread safe; RiveRenderFactory's (and so the RenderContext's) and
+///    NoOpFactory's are.
+///  - Render buffers and images are only made while drawing or loading
+///    assets, never while advancing, since backends like GL can't make them
+///    off their own thread. Scripts that make them from an advance callback
+///    can't be batch advanced.
+///  - rive_pollAsyncWork() is main-thread only. advance() polls it once, on
+///    the calling thread, before the batch starts. Artboard::pollAsyncWork()
+///    is a no-op on the workers, so async completions can't race the batch.
+///  - advance() must not be called again until it returns, and items must not
+///    be touched by other threads while it runs.
+class BatchAdvancer
+{
+public:
+    /// Thread count used when none is requested: the hardware concurrency.
+    static uint32_t defaultThreadCount();
+
+    /// Returns true when called from a thread that is advancing a batch item,
+    /// including the calling thread while it helps.
+    static bool isAdvancingThread();
+
+    /// A threadCount of 0 uses defaultThreadCount(). The calling thread counts
+    /// as one of the threads, and the rest are borrowed from the global
+    /// WorkPool, so the count is capped at its workers plus one. The pool is
+    /// created here if it doesn't exist yet; size it with
+    /// setGlobalWorkPoolThreadCount() first to run on more threads than its
+    /// default.
+    explicit BatchAdvancer(uint32_t threadCount = 0);
+
+    BatchAdvancer(const BatchAdvancer&) = delete;
+    BatchAdvancer& operator=(const BatchAdvancer&) = delete;
+
+    /// The most threads a batch runs on, after the cap above.
+    uint32_t threadCount() const { return m_threadCount; }
+
+    /// Calls advanceAndApply(elapsedSeconds) on every scene. If keepGoing is
+    /// not null it receives each scene's result and must hold scenes.size()
+    /// entries. Returns true if any scene wants to keep going.
+    bool advance(Span<Scene* const> scenes,
+                 float elapsedSeconds,
+                 bool* keepGoing = nullptr);
+
+    /// Calls advance(elapsedSeconds, flags) on every artboard. If didUpdate is
+    /// not null it receives each artboard's result and must hold
+    /// artboards.size() entries. Returns true if any artboard updated.
+    bool advance(Span<ArtboardInstance* const> artboards,
+                 float elapsedSeconds,
+                 bool* didUpdate = nullptr,
+                 AdvanceFlags flags = AdvanceFlags::AdvanceNested |
+                                      AdvanceFlags::Animate |
+                                      AdvanceFlags::NewFrame);
+
+private:
+    // Runs advanceOne(i) for every i in [0, count), returning true if any call
+    // did.
+    bool run(size_t count, const std::function<bool(size_t)>& advanceOne);
+
+    const uint32_t m_threadCount;
+};
+} // namespace rive
+
+#endif
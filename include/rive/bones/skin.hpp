@@ -8,6 +8,7 @@
 
 namespace rive
 {
+class CubicVertex;
 class Tendon;
 class Vertex;
 class Skinnable;
@@ -15,6 +16,7 @@ class Skinnable;
 class Skin : public SkinBase
 {
     friend class Tendon;
+    friend class Skinnable;
 
 public:
     ~Skin() override;
@@ -25,6 +27,25 @@ private:
     float* m_BoneTransforms = nullptr;
     Skinnable* m_Skinnable;
 
+    // The points deform() writes, flattened from the skinnable's vertices:
+    // each weighted vertex's translation, followed by the in and out handles
+    // of the cubic ones. Weights are decoded up front into 4 floats and 4
+    // offsets into m_BoneTransforms per point, so a deform is one branch-free
+    // pass over flat arrays instead of a virtual call and a weight decode per
+    // vertex. A skin only ever deforms its own skinnable, which flags them
+    // dirty (Skinnable::skinnedVerticesChanged) when its vertices change.
+    bool m_skinnedPointsDirty = true;
+    std::vector<Vertex*> m_skinnedVertices;
+    std::vector<CubicVertex*> m_skinnedCubicVertices;
+    std::vector<Vec2D> m_restPoints;
+    std::vector<float> m_pointWeights;
+    std::vector<uint32_t> m_pointBoneOffsets;
+    std::vector<Vec2D*> m_deformedPoints;
+    void buildSkinnedPoints(Span<Vertex*> vertices);
+    void addSkinnedPoint(unsigned int indices,
+                         unsigned int values,
+                         Vec2D* deformed);
+
 protected:
     void addTendon(Tendon* tendon);
 
@@ -32,6 +53,19 @@ public:
     StatusCode onAddedDirty(CoreContext* context) override;
     void buildDependencies() override;
     void deform(Span<Vertex*> vertices);
+
+    /// Skins count points: deformed[i] = blend(bones) * (world * rest[i]),
+    /// where point i blends the 4 bone matrices at boneOffsets[i * 4 + j]
+    /// (float offsets into boneTransforms) by weights[i * 4 + j]. Unused
+    /// influences must have a weight of 0 and a valid offset. Matches
+    /// Weight::deform for each point.
+    static void deformPoints(const Mat2D& world,
+                             const float* boneTransforms,
+                             const Vec2D* rest,
+                             const float* weights,
+                             const uint32_t* boneOffsets,
+                             Vec2D* const* deformed,
+                             size_t count);
     void onDirty(ComponentDirt dirt) override;
     void update(ComponentDirt value) override;
 
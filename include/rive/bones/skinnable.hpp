@@ -24,6 +24,10 @@ public:
     Skin* skin() const { return m_Skin; }
     virtual void markSkinDirty() = 0;
 
+    /// Call when vertices are added to or removed from the skinnable, so its
+    /// skin gathers them again before its next deform.
+    void skinnedVerticesChanged();
+
     static Skinnable* from(Component* component);
 };
 } // namespace rive
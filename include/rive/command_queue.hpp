@@ -6,11 +6,13 @@
 
 #include "rive/object_stream.hpp"
 #include "rive/refcnt.hpp"
+#include "rive/spsc_ring_buffer.hpp"
 #include "rive/math/vec2d.hpp"
 #include "rive/viewmodel/runtime/viewmodel_runtime.hpp"
 #include "rive/animation/semantic_listener_group.hpp"
 #include "rive/semantic/semantic_snapshot.hpp"
 
+#include <atomic>
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
@@ -424,9 +426,39 @@ public:
         {}
     };
 
-    CommandQueue();
+    // How recorded commands travel from this queue to its CommandServer.
+    enum class Transport
+    {
+        // Commands are written directly into streams shared with the server,
+        // under a mutex, and the server is notified after every command.
+        lockedStreams,
+        // Commands are recorded into client-owned streams without locking and
+        // handed to the server in whole batches through a bounded, lock-free
+        // single-producer/single-consumer ring. Batches are recycled back to
+        // the client so their capacity is reused. Only one thread may record
+        // commands in this mode.
+        spscRing,
+    };
+
+    CommandQueue(Transport = Transport::lockedStreams);
     ~CommandQueue();
 
+    Transport transport() const { return m_transport; }
+
+    // Commands recorded between beginBatch() and the matching endBatch() are
+    // published to the server together, as a single batch. Batches may nest.
+    // These are no-ops with Transport::lockedStreams.
+    void beginBatch();
+    void endBatch();
+
+    // Publishes any commands recorded but not yet published. Commands are
+    // normally published automatically at the end of each command (or of the
+    // outermost batch), but stay client-side if the ring is full; they are
+    // retried on the next publish. Returns false if there were commands to
+    // publish and the ring was still full. Always returns true with
+    // Transport::lockedStreams.
+    bool publishCommands();
+
     FileHandle loadFile(
         std::vector<uint8_t> rivBytes,
         FileListener* listener = nullptr,
@@ -1208,21 +1240,56 @@ private:
     uint64_t m_currentStateMachineHandleIdx = 0;
     uint64_t m_currentDrawKeyIdx = 0;
 
-    std::mutex m_commandMutex;
-    std::condition_variable m_commandConditionVariable;
-    PODStream m_commandStream;
-    ObjectStream<rcp<RenderImage>> m_externalImages;
-    ObjectStream<rcp<AudioSource>> m_externalAudioSources;
-    ObjectStream<rcp<Font>> m_externalFonts;
-    ObjectStream<rcp<BlobAsset>> m_externalBlobs;
-    ObjectStream<std::vector<uint8_t>> m_byteVectors;
+    // Every stream a command may write into. Commands must be read back in
+    // the order they were written, so all of a command's data lives in the
+    // same CommandStreams.
+    struct CommandStreams
+    {
+        bool empty() const { return commandStream.empty(); }
+        void swap(CommandStreams&);
+
+        PODStream commandStream;
+        ObjectStream<rcp<RenderImage>> externalImages;
+        ObjectStream<rcp<AudioSource>> externalAudioSources;
+        ObjectStream<rcp<Font>> externalFonts;
+        ObjectStream<rcp<BlobAsset>> externalBlobs;
+        ObjectStream<std::vector<uint8_t>> byteVectors;
 #ifdef WITH_RIVE_SCRIPTING
-    ObjectStream<ScriptingContextFactory> m_scriptingContextFactories;
+        ObjectStream<ScriptingContextFactory> scriptingContextFactories;
 #endif
-    ObjectStream<PointerEvent> m_pointerEvents;
-    ObjectStream<std::string> m_names;
-    ObjectStream<CommandServerCallback> m_callbacks;
-    ObjectStream<CommandServerDrawCallback> m_drawCallbacks;
+        ObjectStream<PointerEvent> pointerEvents;
+        ObjectStream<std::string> names;
+        ObjectStream<CommandServerCallback> callbacks;
+        ObjectStream<CommandServerDrawCallback> drawCallbacks;
+    };
+
+    // Locks (or, with Transport::spscRing, publishes) around the recording of
+    // a single command.
+    class AutoLockAndNotify;
+
+    const Transport m_transport;
+
+    std::mutex m_commandMutex;
+    std::condition_variable m_commandConditionVariable;
+
+    // With Transport::lockedStreams these are shared with the server and
+    // guarded by m_commandMutex. With Transport::spscRing they are only ever
+    // touched by the client thread, and get swapped into a batch on publish.
+    CommandStreams m_commandStreams;
+
+    // Transport::spscRing state. Published batches go client -> server, and
+    // drained batches go server -> client to be recorded into again.
+    constexpr static uint32_t kCommandRingCapacity = 64;
+    SPSCRingBuffer<std::unique_ptr<CommandStreams>, kCommandRingCapacity>
+        m_publishedCommands;
+    SPSCRingBuffer<std::unique_ptr<CommandStreams>, kCommandRingCapacity>
+        m_recycledCommands;
+    // Batch we failed to publish because the ring was full (client only).
+    std::unique_ptr<CommandStreams> m_unpublishedBatch;
+    // Set by the server while it sleeps on m_commandConditionVariable, so the
+    // client only takes m_commandMutex when there is someone to wake.
+    std::atomic<bool> m_serverWaitingForCommands{false};
+    int m_batchDepth = 0;
 
     // Messages streams
     std::mutex m_messageMutex;
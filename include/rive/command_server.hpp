@@ -98,6 +98,12 @@ public:
 private:
     friend class CommandQueue;
 
+    // Executes commands from the given streams until a commandLoopBreak. Must
+    // be called with the lock held; returns with it released. Returns false if
+    // a disconnect was received.
+    bool processCommandStreams(CommandQueue::CommandStreams&,
+                               std::unique_lock<std::mutex>&);
+
     template <typename HandleType> class ErrorReporter
     {
     public:
@@ -249,6 +255,10 @@ private:
 
     std::unordered_map<DrawKey, CommandServerDrawCallback> m_uniqueDraws;
 
+    // CommandQueue::Transport::spscRing batch that was interrupted by an
+    // explicit commandLoopBreak, and still has commands left to process.
+    std::unique_ptr<CommandQueue::CommandStreams> m_partialCommandBatch;
+
     class CommandFileAssetLoader;
     rcp<CommandFileAssetLoader> m_fileAssetLoader;
 };
@@ -19,11 +19,14 @@ class Component : public ComponentBase,
                   public DependencyHelper<Artboard, Component, Component>
 {
     friend class Artboard;
+    friend class DependencySorter;
 
 private:
     ContainerComponent* m_Parent = nullptr;
 
     unsigned int m_GraphOrder;
+    // Generation stamp DependencySorter marks visits with.
+    uint32_t m_sortMark = 0;
     Artboard* m_Artboard = nullptr;
     LazyVector<DataBind*> m_collapsables;
 
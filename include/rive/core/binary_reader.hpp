@@ -3,6 +3,7 @@
 #define _RIVE_CORE_BINARY_READER_HPP_
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "rive/span.hpp"
 #include "rive/core/type_conversions.hpp"
@@ -32,6 +33,9 @@ public:
 
     std::string readString();
     std::string readString(size_t length);
+    /// Reads a length prefixed string without copying it. The view points
+    /// into the reader's bytes and is only valid while they are.
+    std::string_view readStringView();
     Span<const uint8_t> readBytes();
     Span<const uint8_t> readBytes(size_t length);
     float readFloat32();
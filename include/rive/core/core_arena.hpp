@@ -0,0 +1,90 @@
+#ifndef _RIVE_CORE_CORE_ARENA_HPP_
+#define _RIVE_CORE_CORE_ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace rive
+{
+class Core;
+
+/// Bump allocator an artboard instance clones its objects into (see
+/// InstanceAllocation::Arena), so they share one contiguous block that is
+/// freed at once.
+///
+/// Only objects explicitly placed with clone() live in the arena; everything
+/// else, including whatever those objects allocate, stays on the heap. Arena
+/// objects are destroyed in place by their owner (never deleted), and the
+/// arena must outlive them.
+class CoreArena
+{
+public:
+    /// Reserves initialCapacity bytes up front. Allocations that don't fit
+    /// spill into additional blocks.
+    explicit CoreArena(size_t initialCapacity);
+    ~CoreArena();
+
+    CoreArena(const CoreArena&) = delete;
+    CoreArena& operator=(const CoreArena&) = delete;
+
+    void* allocate(size_t size);
+
+    /// Returns true if object was allocated in this arena.
+    bool owns(const void* object) const;
+
+    /// Shallow copies object, a T, into the arena the way TBase::clone()
+    /// copies it onto the heap. Returns null, allocating nothing, when T
+    /// overrides clone() to do more than that; clone those on the heap.
+    template <typename T, typename TBase> Core* clone(const Core* object)
+    {
+        if constexpr (ClonesShallow<T, TBase>::value)
+        {
+            auto cloned = new (allocate(sizeof(T))) T();
+            cloned->copy(*static_cast<const TBase*>(object));
+            return cloned;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    /// Bytes handed out by allocate(), including alignment padding.
+    size_t bytesUsed() const { return m_bytesUsed; }
+    /// Number of blocks backing the arena (1 when it was sized correctly).
+    size_t blockCount() const { return m_blocks.size(); }
+
+private:
+    // True when T's clone() is the one TBase generates. Types that override
+    // it (publicly or not) don't qualify.
+    template <typename T, typename TBase, typename = void>
+    struct ClonesShallow : std::false_type
+    {};
+    template <typename T, typename TBase>
+    struct ClonesShallow<
+        T,
+        TBase,
+        typename std::enable_if<std::is_same<decltype(&T::clone),
+                                             Core* (TBase::*)() const>::value>::
+            type> : std::true_type
+    {};
+
+    void addBlock(size_t minSize);
+
+    struct Block
+    {
+        uint8_t* data;
+        size_t size;
+    };
+    std::vector<Block> m_blocks;
+    uint8_t* m_cursor = nullptr;
+    uint8_t* m_end = nullptr;
+    size_t m_nextBlockSize;
+    size_t m_bytesUsed = 0;
+};
+} // namespace rive
+
+#endif
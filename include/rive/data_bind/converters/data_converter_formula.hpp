@@ -8,8 +8,10 @@
 #include "rive/viewmodel/viewmodel_value_dependent.hpp"
 #include <stdio.h>
 #include <unordered_map>
+#include <vector>
 namespace rive
 {
+class FormulaTokenValue;
 
 class DataConverterFormula : public DataConverterFormulaBase,
                              public ViewModelValueDependent
@@ -33,16 +35,52 @@ protected:
     void unbind() override;
 
 private:
+    // One step of the compiled formula, run against a value stack.
+    struct Instruction
+    {
+        enum class Op : uint8_t
+        {
+            pushConstant,
+            pushInput,
+            // A token whose value is data bound, read when evaluating.
+            pushToken,
+            operation,
+            function,
+        };
+        Op op;
+        // Arguments a function pops (never more than the stack holds).
+        uint16_t argumentsCount;
+        // ArithmeticOperation or FunctionType.
+        int type;
+        union
+        {
+            float value;
+            const FormulaTokenValue* token;
+        };
+    };
+
     int getPrecedence(FormulaToken*);
     float getRandom(int);
     float applyOperation(float left, float right, int operationType);
-    float applyFunction(std::vector<float>& stack,
+    // arguments points at the bottom of the totalArguments values on the
+    // stack (the first argument).
+    float applyFunction(const float* arguments,
                         int functionTypeIndex,
                         int totalArguments);
+    // Compiles m_outputQueue into m_program: constant subexpressions are
+    // folded, malformed operations dropped (they never ran), and the stack
+    // depth is worked out so evaluating doesn't allocate.
+    void compileProgram();
     std::vector<FormulaToken*> m_tokens;
     std::vector<FormulaToken*> m_outputQueue;
     std::vector<float> m_randoms;
     std::unordered_map<FormulaToken*, int> m_argumentsCount;
+    std::vector<Instruction> m_program;
+    std::vector<float> m_stack;
+    // Whether the program leaves exactly one value, otherwise the input is
+    // returned unchanged.
+    bool m_programIsWellFormed = false;
+    bool m_programDirty = true;
     bool m_isInstance = false;
     rcp<ViewModelInstanceValue> m_source = nullptr;
 };
@@ -122,6 +122,13 @@ private:
     }
     DataBind* m_nextObserver = nullptr;
 
+    // Slots in the owning DataBindContainer's lists, so it can remove us in
+    // constant time. Only meaningful while the matching membership is set.
+    friend class DataBindContainer;
+    uint32_t m_dataBindIndex = 0;
+    uint32_t m_persistingIndex = 0;
+    uint32_t m_dirtyIndex = 0;
+
 protected:
     ComponentDirt m_Dirt = ComponentDirt::None;
     Core* m_target = nullptr;
@@ -18,7 +18,7 @@ public:
     // value is current regardless of where the batched updateDataBinds() falls
     // in the frame. A no-op when the bind is not dirty.
     void flushDataBind(DataBind* dataBind) { updateDataBind(dataBind, false); }
-    const std::vector<DataBind*> dataBinds() const { return m_dataBinds; }
+    const std::vector<DataBind*> dataBinds() const;
     virtual void addDirtyDataBind(DataBind* dataBind);
     virtual void rebind() {};
     virtual void relinkDataContext() {};
@@ -33,8 +33,15 @@ protected:
 
 private:
     void updateDataBind(DataBind* dataBind, bool applyTargetToSource);
+    // Removing a bind nulls out its slot in each list it's in (found through
+    // the indices it keeps), so removal is O(1) and the order of the rest is
+    // kept. The nulls are compacted out before the next pass over the list.
+    void compactDataBinds();
+    void compactPersistingDataBinds();
     std::vector<DataBind*> m_dataBinds;
     std::vector<DataBind*> m_persistingDataBinds;
+    size_t m_removedDataBindCount = 0;
+    size_t m_removedPersistingDataBindCount = 0;
     // Push-driven toSource binds waiting to apply target → source. Kept
     // separate from m_dirtyDataBinds so updateDataBinds can run the
     // target→source pass *before* the source→target pass. Without this, a
@@ -1,7 +1,8 @@
 #ifndef _RIVE_DEPENDENCYSORTER_HPP_
 #define _RIVE_DEPENDENCYSORTER_HPP_
 
-#include <unordered_set>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace rive
@@ -10,14 +11,27 @@ class Component;
 class DependencySorter
 {
 private:
-    std::unordered_set<Component*> m_Perm;
-    std::unordered_set<Component*> m_Temp;
+    // Each sorter claims its own generation of stamps, marking components in
+    // place instead of tracking them in sets.
+    const uint32_t m_visiting;
+    const uint32_t m_sorted;
+
+    struct Frame
+    {
+        Component* component;
+        size_t nextDependent;
+    };
+    std::vector<Frame> m_stack;
 
 public:
+    DependencySorter();
+
     void sort(Component* root, std::vector<Component*>& order);
     void sort(std::vector<Component*> roots, std::vector<Component*>& order);
+    /// Appends component and everything depending on it to order in
+    /// post-order, dependents first. sort() reverses the result.
     bool visit(Component* component, std::vector<Component*>& order);
 };
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
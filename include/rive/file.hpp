@@ -33,8 +33,11 @@ namespace rive
 #ifdef WITH_RIVE_TOOLS
 class ViewModelInstance;
 #endif
+class ArtboardReferencer;
 class BinaryReader;
+class Core;
 class DataBind;
+class ImportStack;
 class RuntimeHeader;
 class Factory;
 class ScrollPhysics;
@@ -128,12 +131,33 @@ public:
                             rcp<FileAssetLoader> assetLoader,
                             ScriptingVM* vm = nullptr);
 
+    ///
+    /// Imports a Rive file without reading its artboards up front. Artboard
+    /// boundaries are indexed in a single pass and each artboard's objects
+    /// are read the first time it's accessed, so artboards that are never
+    /// used cost next to nothing. Everything else is read as in import().
+    /// @param data the raw data of the file, which must outlive the returned
+    /// File (a memory mapped .riv for example).
+    /// @returns a pointer to the file, or null on failure.
+    static rcp<File> importLazy(Span<const uint8_t> data,
+                                Factory*,
+                                ImportResult* result = nullptr,
+                                rcp<FileAssetLoader> assetLoader = nullptr,
+                                ScriptingVM* vm = nullptr);
+
     /// @returns the file's backboard. All files have exactly one backboard.
     Backboard* backboard() const { return m_backboard; }
 
     /// @returns the number of artboards in the file.
     size_t artboardCount() const { return m_artboards.size(); }
     std::string artboardNameAt(size_t index) const;
+    /// @returns the index of the first artboard bound to the view model, or
+    /// -1 if there isn't one. Like artboardNameAt(), this doesn't load any
+    /// deferred artboards.
+    int artboardIndexForViewModel(uint32_t viewModelId) const;
+    /// @returns whether the objects of the artboard at index have been read.
+    /// Always true unless the file was imported with importLazy().
+    bool artboardLoaded(size_t index) const;
 
     Span<const rcp<FileAsset>> assets() const;
 
@@ -215,7 +239,7 @@ public:
     const std::vector<DataEnum*>& enums() const;
     rcp<FileAsset> asset(size_t index);
 
-    std::vector<Artboard*> artboards() { return m_artboards; };
+    std::vector<Artboard*> artboards();
 
     bool hasAudio() const { return m_hasAudio; };
     void addFileViewModelInstance(ViewModelInstance* viewModelInstance);
@@ -277,7 +301,26 @@ public:
 #endif
 
 private:
+    static rcp<File> importBytes(Span<const uint8_t> data,
+                                 Factory*,
+                                 ImportResult* result,
+                                 rcp<FileAssetLoader> assetLoader,
+                                 ScriptingVM* vm,
+                                 bool lazy);
     ImportResult read(BinaryReader&, const RuntimeHeader&);
+    ImportResult readObjects(BinaryReader&,
+                             const RuntimeHeader&,
+                             ImportStack&,
+                             Core* lastBindableObject);
+    /// Lazy import: skips the reader past the artboard's objects and records
+    /// them for later. Returns false if the artboard has to be read now.
+    bool deferArtboard(Artboard* artboard, BinaryReader& reader);
+    /// Reads the artboard's objects if they were deferred. Returns null if
+    /// they couldn't be read.
+    Artboard* loadArtboard(Artboard* artboard) const;
+    bool readDeferredArtboard(Artboard* artboard, Span<const uint8_t> bytes);
+    void loadReferencedArtboards(
+        const std::vector<ArtboardReferencer*>& artboardReferencers) const;
     std::unique_ptr<ArtboardInstance> instanceArtboard(Artboard* ab) const;
 
     /// The file's backboard. All Rive files have a single backboard
@@ -375,6 +418,9 @@ private:
     rcp<FileAsset> m_manifest = nullptr;
 
     bool m_hasAudio = false;
+
+    struct LazyArtboards;
+    std::unique_ptr<LazyArtboards> m_lazyArtboards;
 };
 } // namespace rive
 #endif
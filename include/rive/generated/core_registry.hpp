@@ -152,6 +152,7 @@
 #include "rive/constraints/transform_space_constraint.hpp"
 #include "rive/constraints/translation_constraint.hpp"
 #include "rive/container_component.hpp"
+#include "rive/core/core_arena.hpp"
 #include "rive/custom_property.hpp"
 #include "rive/custom_property_boolean.hpp"
 #include "rive/custom_property_color.hpp"
@@ -942,6 +943,792 @@ public:
         }
         return nullptr;
     }
+    static Core* cloneIntoArena(const Core* object, CoreArena& arena)
+    {
+        switch (object->coreType())
+        {
+            case ViewModelInstanceListItemBase::typeKey:
+                return arena.clone<ViewModelInstanceListItem,
+                                   ViewModelInstanceListItemBase>(object);
+            case ViewModelComponentBase::typeKey:
+                return arena.clone<ViewModelComponent,
+                                   ViewModelComponentBase>(object);
+            case ViewModelPropertyBase::typeKey:
+                return arena.clone<ViewModelProperty,
+                                   ViewModelPropertyBase>(object);
+            case ViewModelPropertyArtboardBase::typeKey:
+                return arena.clone<ViewModelPropertyArtboard,
+                                   ViewModelPropertyArtboardBase>(object);
+            case ViewModelInstanceValueBase::typeKey:
+                return arena.clone<ViewModelInstanceValue,
+                                   ViewModelInstanceValueBase>(object);
+            case ViewModelInstanceColorBase::typeKey:
+                return arena.clone<ViewModelInstanceColor,
+                                   ViewModelInstanceColorBase>(object);
+            case ViewModelPropertyEnumBase::typeKey:
+                return arena.clone<ViewModelPropertyEnum,
+                                   ViewModelPropertyEnumBase>(object);
+            case ViewModelPropertyEnumCustomBase::typeKey:
+                return arena.clone<ViewModelPropertyEnumCustom,
+                                   ViewModelPropertyEnumCustomBase>(object);
+            case DataEnumBase::typeKey:
+                return arena.clone<DataEnum, DataEnumBase>(object);
+            case DataEnumCustomBase::typeKey:
+                return arena.clone<DataEnumCustom, DataEnumCustomBase>(object);
+            case ViewModelPropertyNumberBase::typeKey:
+                return arena.clone<ViewModelPropertyNumber,
+                                   ViewModelPropertyNumberBase>(object);
+            case ViewModelInstanceEnumBase::typeKey:
+                return arena.clone<ViewModelInstanceEnum,
+                                   ViewModelInstanceEnumBase>(object);
+            case ViewModelPropertySymbolListIndexBase::typeKey:
+                return arena.clone<ViewModelPropertySymbolListIndex,
+                                   ViewModelPropertySymbolListIndexBase>(
+                    object);
+            case ViewModelInstanceAssetBase::typeKey:
+                return arena.clone<ViewModelInstanceAsset,
+                                   ViewModelInstanceAssetBase>(object);
+            case ViewModelInstanceAssetBlobBase::typeKey:
+                return arena.clone<ViewModelInstanceAssetBlob,
+                                   ViewModelInstanceAssetBlobBase>(object);
+            case ViewModelInstanceArtboardBase::typeKey:
+                return arena.clone<ViewModelInstanceArtboard,
+                                   ViewModelInstanceArtboardBase>(object);
+            case ViewModelInstanceStringBase::typeKey:
+                return arena.clone<ViewModelInstanceString,
+                                   ViewModelInstanceStringBase>(object);
+            case ViewModelPropertyListBase::typeKey:
+                return arena.clone<ViewModelPropertyList,
+                                   ViewModelPropertyListBase>(object);
+            case ViewModelPropertyEnumSystemBase::typeKey:
+                return arena.clone<ViewModelPropertyEnumSystem,
+                                   ViewModelPropertyEnumSystemBase>(object);
+            case ViewModelBase::typeKey:
+                return arena.clone<ViewModel, ViewModelBase>(object);
+            case ViewModelPropertyAssetBase::typeKey:
+                return arena.clone<ViewModelPropertyAsset,
+                                   ViewModelPropertyAssetBase>(object);
+            case DataEnumSystemBase::typeKey:
+                return arena.clone<DataEnumSystem, DataEnumSystemBase>(object);
+            case ViewModelPropertyAssetFontBase::typeKey:
+                return arena.clone<ViewModelPropertyAssetFont,
+                                   ViewModelPropertyAssetFontBase>(object);
+            case ViewModelPropertyViewModelBase::typeKey:
+                return arena.clone<ViewModelPropertyViewModel,
+                                   ViewModelPropertyViewModelBase>(object);
+            case ViewModelInstanceBase::typeKey:
+                return arena.clone<ViewModelInstance,
+                                   ViewModelInstanceBase>(object);
+            case ViewModelPropertyAssetBlobBase::typeKey:
+                return arena.clone<ViewModelPropertyAssetBlob,
+                                   ViewModelPropertyAssetBlobBase>(object);
+            case ViewModelPropertyBooleanBase::typeKey:
+                return arena.clone<ViewModelPropertyBoolean,
+                                   ViewModelPropertyBooleanBase>(object);
+            case ViewModelPropertyColorBase::typeKey:
+                return arena.clone<ViewModelPropertyColor,
+                                   ViewModelPropertyColorBase>(object);
+            case ViewModelPropertyAssetImageBase::typeKey:
+                return arena.clone<ViewModelPropertyAssetImage,
+                                   ViewModelPropertyAssetImageBase>(object);
+            case ViewModelInstanceBooleanBase::typeKey:
+                return arena.clone<ViewModelInstanceBoolean,
+                                   ViewModelInstanceBooleanBase>(object);
+            case ViewModelInstanceListBase::typeKey:
+                return arena.clone<ViewModelInstanceList,
+                                   ViewModelInstanceListBase>(object);
+            case ViewModelInstanceNumberBase::typeKey:
+                return arena.clone<ViewModelInstanceNumber,
+                                   ViewModelInstanceNumberBase>(object);
+            case ViewModelInstanceTriggerBase::typeKey:
+                return arena.clone<ViewModelInstanceTrigger,
+                                   ViewModelInstanceTriggerBase>(object);
+            case ViewModelInstanceSymbolListIndexBase::typeKey:
+                return arena.clone<ViewModelInstanceSymbolListIndex,
+                                   ViewModelInstanceSymbolListIndexBase>(
+                    object);
+            case ViewModelInstanceAssetFontBase::typeKey:
+                return arena.clone<ViewModelInstanceAssetFont,
+                                   ViewModelInstanceAssetFontBase>(object);
+            case ViewModelPropertyStringBase::typeKey:
+                return arena.clone<ViewModelPropertyString,
+                                   ViewModelPropertyStringBase>(object);
+            case ViewModelInstanceViewModelBase::typeKey:
+                return arena.clone<ViewModelInstanceViewModel,
+                                   ViewModelInstanceViewModelBase>(object);
+            case ViewModelPropertyTriggerBase::typeKey:
+                return arena.clone<ViewModelPropertyTrigger,
+                                   ViewModelPropertyTriggerBase>(object);
+            case ViewModelInstanceAssetImageBase::typeKey:
+                return arena.clone<ViewModelInstanceAssetImage,
+                                   ViewModelInstanceAssetImageBase>(object);
+            case DataEnumValueBase::typeKey:
+                return arena.clone<DataEnumValue, DataEnumValueBase>(object);
+            case CustomPropertyTriggerBase::typeKey:
+                return arena.clone<CustomPropertyTrigger,
+                                   CustomPropertyTriggerBase>(object);
+            case ScriptInputTriggerBase::typeKey:
+                return arena.clone<ScriptInputTrigger,
+                                   ScriptInputTriggerBase>(object);
+            case DrawTargetBase::typeKey:
+                return arena.clone<DrawTarget, DrawTargetBase>(object);
+            case CustomPropertyNumberBase::typeKey:
+                return arena.clone<CustomPropertyNumber,
+                                   CustomPropertyNumberBase>(object);
+            case ScriptInputViewModelPropertyBase::typeKey:
+                return arena.clone<ScriptInputViewModelProperty,
+                                   ScriptInputViewModelPropertyBase>(object);
+            case DistanceConstraintBase::typeKey:
+                return arena.clone<DistanceConstraint,
+                                   DistanceConstraintBase>(object);
+            case FollowPathConstraintBase::typeKey:
+                return arena.clone<FollowPathConstraint,
+                                   FollowPathConstraintBase>(object);
+            case ListFollowPathConstraintBase::typeKey:
+                return arena.clone<ListFollowPathConstraint,
+                                   ListFollowPathConstraintBase>(object);
+            case IKConstraintBase::typeKey:
+                return arena.clone<IKConstraint, IKConstraintBase>(object);
+            case TranslationConstraintBase::typeKey:
+                return arena.clone<TranslationConstraint,
+                                   TranslationConstraintBase>(object);
+            case ClampedScrollPhysicsBase::typeKey:
+                return arena.clone<ClampedScrollPhysics,
+                                   ClampedScrollPhysicsBase>(object);
+            case ScrollConstraintBase::typeKey:
+                return arena.clone<ScrollConstraint,
+                                   ScrollConstraintBase>(object);
+            case ElasticScrollPhysicsBase::typeKey:
+                return arena.clone<ElasticScrollPhysics,
+                                   ElasticScrollPhysicsBase>(object);
+            case ScrollBarConstraintBase::typeKey:
+                return arena.clone<ScrollBarConstraint,
+                                   ScrollBarConstraintBase>(object);
+            case TransformConstraintBase::typeKey:
+                return arena.clone<TransformConstraint,
+                                   TransformConstraintBase>(object);
+            case ScaleConstraintBase::typeKey:
+                return arena.clone<ScaleConstraint,
+                                   ScaleConstraintBase>(object);
+            case RotationConstraintBase::typeKey:
+                return arena.clone<RotationConstraint,
+                                   RotationConstraintBase>(object);
+            case NodeBase::typeKey:
+                return arena.clone<Node, NodeBase>(object);
+            case ForegroundLayoutDrawableBase::typeKey:
+                return arena.clone<ForegroundLayoutDrawable,
+                                   ForegroundLayoutDrawableBase>(object);
+            case NestedArtboardBase::typeKey:
+                return arena.clone<NestedArtboard, NestedArtboardBase>(object);
+            case ArtboardComponentListBase::typeKey:
+                return arena.clone<ArtboardComponentList,
+                                   ArtboardComponentListBase>(object);
+            case CustomPropertyColorBase::typeKey:
+                return arena.clone<CustomPropertyColor,
+                                   CustomPropertyColorBase>(object);
+            case SoloBase::typeKey:
+                return arena.clone<Solo, SoloBase>(object);
+            case ScriptedDrawableBase::typeKey:
+                return arena.clone<ScriptedDrawable,
+                                   ScriptedDrawableBase>(object);
+            case ScriptedDataConverterBase::typeKey:
+                return arena.clone<ScriptedDataConverter,
+                                   ScriptedDataConverterBase>(object);
+            case ScriptedInterpolatorBase::typeKey:
+                return arena.clone<ScriptedInterpolator,
+                                   ScriptedInterpolatorBase>(object);
+            case ScriptedLayoutBase::typeKey:
+                return arena.clone<ScriptedLayout, ScriptedLayoutBase>(object);
+            case ScriptedPathEffectBase::typeKey:
+                return arena.clone<ScriptedPathEffect,
+                                   ScriptedPathEffectBase>(object);
+            case ScriptInputNumberBase::typeKey:
+                return arena.clone<ScriptInputNumber,
+                                   ScriptInputNumberBase>(object);
+            case NestedArtboardLayoutBase::typeKey:
+                return arena.clone<NestedArtboardLayout,
+                                   NestedArtboardLayoutBase>(object);
+            case NSlicerTileModeBase::typeKey:
+                return arena.clone<NSlicerTileMode,
+                                   NSlicerTileModeBase>(object);
+            case GridTrackBase::typeKey:
+                return arena.clone<GridTrack, GridTrackBase>(object);
+            case GridItemPlacementBase::typeKey:
+                return arena.clone<GridItemPlacement,
+                                   GridItemPlacementBase>(object);
+            case LayoutNodeStyleBase::typeKey:
+                return arena.clone<LayoutNodeStyle,
+                                   LayoutNodeStyleBase>(object);
+            case LayoutParticipantBase::typeKey:
+                return arena.clone<LayoutParticipant,
+                                   LayoutParticipantBase>(object);
+            case AxisYBase::typeKey:
+                return arena.clone<AxisY, AxisYBase>(object);
+            case LayoutComponentStyleBase::typeKey:
+                return arena.clone<LayoutComponentStyle,
+                                   LayoutComponentStyleBase>(object);
+            case AxisXBase::typeKey:
+                return arena.clone<AxisX, AxisXBase>(object);
+            case NSlicerBase::typeKey:
+                return arena.clone<NSlicer, NSlicerBase>(object);
+            case NSlicedNodeBase::typeKey:
+                return arena.clone<NSlicedNode, NSlicedNodeBase>(object);
+            case ArtboardComponentListOverrideBase::typeKey:
+                return arena.clone<ArtboardComponentListOverride,
+                                   ArtboardComponentListOverrideBase>(object);
+            case ComponentOriginBase::typeKey:
+                return arena.clone<ComponentOrigin,
+                                   ComponentOriginBase>(object);
+            case ListenerFireEventBase::typeKey:
+                return arena.clone<ListenerFireEvent,
+                                   ListenerFireEventBase>(object);
+            case TransitionSelfComparatorBase::typeKey:
+                return arena.clone<TransitionSelfComparator,
+                                   TransitionSelfComparatorBase>(object);
+            case StateMachineFireTriggerBase::typeKey:
+                return arena.clone<StateMachineFireTrigger,
+                                   StateMachineFireTriggerBase>(object);
+            case TransitionValueTriggerComparatorBase::typeKey:
+                return arena.clone<TransitionValueTriggerComparator,
+                                   TransitionValueTriggerComparatorBase>(
+                    object);
+            case KeyFrameUintBase::typeKey:
+                return arena.clone<KeyFrameUint, KeyFrameUintBase>(object);
+            case NestedSimpleAnimationBase::typeKey:
+                return arena.clone<NestedSimpleAnimation,
+                                   NestedSimpleAnimationBase>(object);
+            case AnimationStateBase::typeKey:
+                return arena.clone<AnimationState, AnimationStateBase>(object);
+            case FocusActionClearBase::typeKey:
+                return arena.clone<FocusActionClear,
+                                   FocusActionClearBase>(object);
+            case NestedTriggerBase::typeKey:
+                return arena.clone<NestedTrigger, NestedTriggerBase>(object);
+            case ScriptedListenerActionBase::typeKey:
+                return arena.clone<ScriptedListenerAction,
+                                   ScriptedListenerActionBase>(object);
+            case KeyedObjectBase::typeKey:
+                return arena.clone<KeyedObject, KeyedObjectBase>(object);
+            case AnimationBase::typeKey:
+                return arena.clone<Animation, AnimationBase>(object);
+            case KeyFrameIntBase::typeKey:
+                return arena.clone<KeyFrameInt, KeyFrameIntBase>(object);
+            case BlendAnimationDirectBase::typeKey:
+                return arena.clone<BlendAnimationDirect,
+                                   BlendAnimationDirectBase>(object);
+            case StateMachineNumberBase::typeKey:
+                return arena.clone<StateMachineNumber,
+                                   StateMachineNumberBase>(object);
+            case StateMachineListenerBase::typeKey:
+                return arena.clone<StateMachineListener,
+                                   StateMachineListenerBase>(object);
+            case StateMachineListenerSingleBase::typeKey:
+                return arena.clone<StateMachineListenerSingle,
+                                   StateMachineListenerSingleBase>(object);
+            case CubicValueInterpolatorBase::typeKey:
+                return arena.clone<CubicValueInterpolator,
+                                   CubicValueInterpolatorBase>(object);
+            case TransitionTriggerConditionBase::typeKey:
+                return arena.clone<TransitionTriggerCondition,
+                                   TransitionTriggerConditionBase>(object);
+            case KeyedPropertyBase::typeKey:
+                return arena.clone<KeyedProperty, KeyedPropertyBase>(object);
+            case TransitionPropertyArtboardComparatorBase::typeKey:
+                return arena.clone<TransitionPropertyArtboardComparator,
+                                   TransitionPropertyArtboardComparatorBase>(
+                    object);
+            case TransitionPropertyViewModelComparatorBase::typeKey:
+                return arena.clone<TransitionPropertyViewModelComparator,
+                                   TransitionPropertyViewModelComparatorBase>(
+                    object);
+            case KeyFrameIdBase::typeKey:
+                return arena.clone<KeyFrameId, KeyFrameIdBase>(object);
+            case KeyFrameBoolBase::typeKey:
+                return arena.clone<KeyFrameBool, KeyFrameBoolBase>(object);
+            case ListenerBoolChangeBase::typeKey:
+                return arena.clone<ListenerBoolChange,
+                                   ListenerBoolChangeBase>(object);
+            case ListenerAlignTargetBase::typeKey:
+                return arena.clone<ListenerAlignTarget,
+                                   ListenerAlignTargetBase>(object);
+            case ScriptedTransitionConditionBase::typeKey:
+                return arena.clone<ScriptedTransitionCondition,
+                                   ScriptedTransitionConditionBase>(object);
+            case TransitionViewModelConditionBase::typeKey:
+                return arena.clone<TransitionViewModelCondition,
+                                   TransitionViewModelConditionBase>(object);
+            case TransitionFocusConditionBase::typeKey:
+                return arena.clone<TransitionFocusCondition,
+                                   TransitionFocusConditionBase>(object);
+            case TransitionNumberConditionBase::typeKey:
+                return arena.clone<TransitionNumberCondition,
+                                   TransitionNumberConditionBase>(object);
+            case TransitionValueBooleanComparatorBase::typeKey:
+                return arena.clone<TransitionValueBooleanComparator,
+                                   TransitionValueBooleanComparatorBase>(
+                    object);
+            case TransitionArtboardConditionBase::typeKey:
+                return arena.clone<TransitionArtboardCondition,
+                                   TransitionArtboardConditionBase>(object);
+            case AnyStateBase::typeKey:
+                return arena.clone<AnyState, AnyStateBase>(object);
+            case BlendState1DInputBase::typeKey:
+                return arena.clone<BlendState1DInput,
+                                   BlendState1DInputBase>(object);
+            case CubicInterpolatorComponentBase::typeKey:
+                return arena.clone<CubicInterpolatorComponent,
+                                   CubicInterpolatorComponentBase>(object);
+            case StateMachineLayerBase::typeKey:
+                return arena.clone<StateMachineLayer,
+                                   StateMachineLayerBase>(object);
+            case KeyFrameStringBase::typeKey:
+                return arena.clone<KeyFrameString, KeyFrameStringBase>(object);
+            case ListenerNumberChangeBase::typeKey:
+                return arena.clone<ListenerNumberChange,
+                                   ListenerNumberChangeBase>(object);
+            case FocusActionTargetBase::typeKey:
+                return arena.clone<FocusActionTarget,
+                                   FocusActionTargetBase>(object);
+            case CubicEaseInterpolatorBase::typeKey:
+                return arena.clone<CubicEaseInterpolator,
+                                   CubicEaseInterpolatorBase>(object);
+            case TransitionValueIdComparatorBase::typeKey:
+                return arena.clone<TransitionValueIdComparator,
+                                   TransitionValueIdComparatorBase>(object);
+            case StateTransitionBase::typeKey:
+                return arena.clone<StateTransition,
+                                   StateTransitionBase>(object);
+            case NestedBoolBase::typeKey:
+                return arena.clone<NestedBool, NestedBoolBase>(object);
+            case KeyFrameDoubleBase::typeKey:
+                return arena.clone<KeyFrameDouble, KeyFrameDoubleBase>(object);
+            case KeyFrameColorBase::typeKey:
+                return arena.clone<KeyFrameColor, KeyFrameColorBase>(object);
+            case FocusActionTraversalBase::typeKey:
+                return arena.clone<FocusActionTraversal,
+                                   FocusActionTraversalBase>(object);
+            case StateMachineBase::typeKey:
+                return arena.clone<StateMachine, StateMachineBase>(object);
+            case StateMachineFireEventBase::typeKey:
+                return arena.clone<StateMachineFireEvent,
+                                   StateMachineFireEventBase>(object);
+            case EntryStateBase::typeKey:
+                return arena.clone<EntryState, EntryStateBase>(object);
+            case LinearAnimationBase::typeKey:
+                return arena.clone<LinearAnimation,
+                                   LinearAnimationBase>(object);
+            case StateMachineTriggerBase::typeKey:
+                return arena.clone<StateMachineTrigger,
+                                   StateMachineTriggerBase>(object);
+            case TransitionValueColorComparatorBase::typeKey:
+                return arena.clone<TransitionValueColorComparator,
+                                   TransitionValueColorComparatorBase>(object);
+            case ListenerTriggerChangeBase::typeKey:
+                return arena.clone<ListenerTriggerChange,
+                                   ListenerTriggerChangeBase>(object);
+            case BlendStateDirectBase::typeKey:
+                return arena.clone<BlendStateDirect,
+                                   BlendStateDirectBase>(object);
+            case ListenerViewModelChangeBase::typeKey:
+                return arena.clone<ListenerViewModelChange,
+                                   ListenerViewModelChangeBase>(object);
+            case TransitionValueNumberComparatorBase::typeKey:
+                return arena.clone<TransitionValueNumberComparator,
+                                   TransitionValueNumberComparatorBase>(object);
+            case TransitionPropertyComponentComparatorBase::typeKey:
+                return arena.clone<TransitionPropertyComponentComparator,
+                                   TransitionPropertyComponentComparatorBase>(
+                    object);
+            case NestedStateMachineBase::typeKey:
+                return arena.clone<NestedStateMachine,
+                                   NestedStateMachineBase>(object);
+            case ElasticInterpolatorBase::typeKey:
+                return arena.clone<ElasticInterpolator,
+                                   ElasticInterpolatorBase>(object);
+            case ListenerInputTypeBase::typeKey:
+                return arena.clone<ListenerInputType,
+                                   ListenerInputTypeBase>(object);
+            case ListenerInputTypeEventBase::typeKey:
+                return arena.clone<ListenerInputTypeEvent,
+                                   ListenerInputTypeEventBase>(object);
+            case ListenerInputTypeGamepadBase::typeKey:
+                return arena.clone<ListenerInputTypeGamepad,
+                                   ListenerInputTypeGamepadBase>(object);
+            case ListenerInputTypeKeyboardBase::typeKey:
+                return arena.clone<ListenerInputTypeKeyboard,
+                                   ListenerInputTypeKeyboardBase>(object);
+            case ListenerInputTypeTextBase::typeKey:
+                return arena.clone<ListenerInputTypeText,
+                                   ListenerInputTypeTextBase>(object);
+            case ListenerInputTypeSemanticBase::typeKey:
+                return arena.clone<ListenerInputTypeSemantic,
+                                   ListenerInputTypeSemanticBase>(object);
+            case ListenerInputTypeViewModelBase::typeKey:
+                return arena.clone<ListenerInputTypeViewModel,
+                                   ListenerInputTypeViewModelBase>(object);
+            case ExitStateBase::typeKey:
+                return arena.clone<ExitState, ExitStateBase>(object);
+            case NestedNumberBase::typeKey:
+                return arena.clone<NestedNumber, NestedNumberBase>(object);
+            case TransitionValueEnumComparatorBase::typeKey:
+                return arena.clone<TransitionValueEnumComparator,
+                                   TransitionValueEnumComparatorBase>(object);
+            case KeyFrameCallbackBase::typeKey:
+                return arena.clone<KeyFrameCallback,
+                                   KeyFrameCallbackBase>(object);
+            case TransitionValueArtboardComparatorBase::typeKey:
+                return arena.clone<TransitionValueArtboardComparator,
+                                   TransitionValueArtboardComparatorBase>(
+                    object);
+            case TransitionValueStringComparatorBase::typeKey:
+                return arena.clone<TransitionValueStringComparator,
+                                   TransitionValueStringComparatorBase>(object);
+            case NestedRemapAnimationBase::typeKey:
+                return arena.clone<NestedRemapAnimation,
+                                   NestedRemapAnimationBase>(object);
+            case TransitionValueAssetComparatorBase::typeKey:
+                return arena.clone<TransitionValueAssetComparator,
+                                   TransitionValueAssetComparatorBase>(object);
+            case TransitionBoolConditionBase::typeKey:
+                return arena.clone<TransitionBoolCondition,
+                                   TransitionBoolConditionBase>(object);
+            case BlendState1DViewModelBase::typeKey:
+                return arena.clone<BlendState1DViewModel,
+                                   BlendState1DViewModelBase>(object);
+            case BlendStateTransitionBase::typeKey:
+                return arena.clone<BlendStateTransition,
+                                   BlendStateTransitionBase>(object);
+            case StateMachineBoolBase::typeKey:
+                return arena.clone<StateMachineBool,
+                                   StateMachineBoolBase>(object);
+            case BlendAnimation1DBase::typeKey:
+                return arena.clone<BlendAnimation1D,
+                                   BlendAnimation1DBase>(object);
+            case GroupEffectBase::typeKey:
+                return arena.clone<GroupEffect, GroupEffectBase>(object);
+            case TargetEffectBase::typeKey:
+                return arena.clone<TargetEffect, TargetEffectBase>(object);
+            case DashPathBase::typeKey:
+                return arena.clone<DashPath, DashPathBase>(object);
+            case LinearGradientBase::typeKey:
+                return arena.clone<LinearGradient, LinearGradientBase>(object);
+            case RadialGradientBase::typeKey:
+                return arena.clone<RadialGradient, RadialGradientBase>(object);
+            case DashBase::typeKey:
+                return arena.clone<Dash, DashBase>(object);
+            case StrokeBase::typeKey:
+                return arena.clone<Stroke, StrokeBase>(object);
+            case SolidColorBase::typeKey:
+                return arena.clone<SolidColor, SolidColorBase>(object);
+            case GradientStopBase::typeKey:
+                return arena.clone<GradientStop, GradientStopBase>(object);
+            case FeatherBase::typeKey:
+                return arena.clone<Feather, FeatherBase>(object);
+            case TrimPathBase::typeKey:
+                return arena.clone<TrimPath, TrimPathBase>(object);
+            case FillBase::typeKey:
+                return arena.clone<Fill, FillBase>(object);
+            case MeshVertexBase::typeKey:
+                return arena.clone<MeshVertex, MeshVertexBase>(object);
+            case ShapeBase::typeKey:
+                return arena.clone<Shape, ShapeBase>(object);
+            case StraightVertexBase::typeKey:
+                return arena.clone<StraightVertex, StraightVertexBase>(object);
+            case CubicAsymmetricVertexBase::typeKey:
+                return arena.clone<CubicAsymmetricVertex,
+                                   CubicAsymmetricVertexBase>(object);
+            case MeshBase::typeKey:
+                return arena.clone<Mesh, MeshBase>(object);
+            case PointsPathBase::typeKey:
+                return arena.clone<PointsPath, PointsPathBase>(object);
+            case ContourMeshVertexBase::typeKey:
+                return arena.clone<ContourMeshVertex,
+                                   ContourMeshVertexBase>(object);
+            case RectangleBase::typeKey:
+                return arena.clone<Rectangle, RectangleBase>(object);
+            case CubicMirroredVertexBase::typeKey:
+                return arena.clone<CubicMirroredVertex,
+                                   CubicMirroredVertexBase>(object);
+            case TriangleBase::typeKey:
+                return arena.clone<Triangle, TriangleBase>(object);
+            case EllipseBase::typeKey:
+                return arena.clone<Ellipse, EllipseBase>(object);
+            case ListPathBase::typeKey:
+                return arena.clone<ListPath, ListPathBase>(object);
+            case ClippingShapeBase::typeKey:
+                return arena.clone<ClippingShape, ClippingShapeBase>(object);
+            case PolygonBase::typeKey:
+                return arena.clone<Polygon, PolygonBase>(object);
+            case StarBase::typeKey:
+                return arena.clone<Star, StarBase>(object);
+            case ImageBase::typeKey:
+                return arena.clone<Image, ImageBase>(object);
+            case CubicDetachedVertexBase::typeKey:
+                return arena.clone<CubicDetachedVertex,
+                                   CubicDetachedVertexBase>(object);
+            case CustomPropertyGroupBase::typeKey:
+                return arena.clone<CustomPropertyGroup,
+                                   CustomPropertyGroupBase>(object);
+            case EventBase::typeKey:
+                return arena.clone<Event, EventBase>(object);
+            case FocusDataBase::typeKey:
+                return arena.clone<FocusData, FocusDataBase>(object);
+            case CustomPropertyBooleanBase::typeKey:
+                return arena.clone<CustomPropertyBoolean,
+                                   CustomPropertyBooleanBase>(object);
+            case ScriptInputBooleanBase::typeKey:
+                return arena.clone<ScriptInputBoolean,
+                                   ScriptInputBooleanBase>(object);
+            case ScriptInputColorBase::typeKey:
+                return arena.clone<ScriptInputColor,
+                                   ScriptInputColorBase>(object);
+            case DrawRulesBase::typeKey:
+                return arena.clone<DrawRules, DrawRulesBase>(object);
+            case LayoutComponentBase::typeKey:
+                return arena.clone<LayoutComponent,
+                                   LayoutComponentBase>(object);
+            case ArtboardBase::typeKey:
+                return arena.clone<Artboard, ArtboardBase>(object);
+            case JoystickBase::typeKey:
+                return arena.clone<Joystick, JoystickBase>(object);
+            case BackboardBase::typeKey:
+                return arena.clone<Backboard, BackboardBase>(object);
+            case OpenUrlEventBase::typeKey:
+                return arena.clone<OpenUrlEvent, OpenUrlEventBase>(object);
+            case SemanticDataBase::typeKey:
+                return arena.clone<SemanticData, SemanticDataBase>(object);
+            case CustomPropertyStringBase::typeKey:
+                return arena.clone<CustomPropertyString,
+                                   CustomPropertyStringBase>(object);
+            case ScriptInputStringBase::typeKey:
+                return arena.clone<ScriptInputString,
+                                   ScriptInputStringBase>(object);
+            case BindablePropertyArtboardBase::typeKey:
+                return arena.clone<BindablePropertyArtboard,
+                                   BindablePropertyArtboardBase>(object);
+            case DataBindPathBase::typeKey:
+                return arena.clone<DataBindPath, DataBindPathBase>(object);
+            case BindablePropertyIntegerBase::typeKey:
+                return arena.clone<BindablePropertyInteger,
+                                   BindablePropertyIntegerBase>(object);
+            case BindablePropertyTriggerBase::typeKey:
+                return arena.clone<BindablePropertyTrigger,
+                                   BindablePropertyTriggerBase>(object);
+            case BindablePropertyBooleanBase::typeKey:
+                return arena.clone<BindablePropertyBoolean,
+                                   BindablePropertyBooleanBase>(object);
+            case DataBindBase::typeKey:
+                return arena.clone<DataBind, DataBindBase>(object);
+            case BindablePropertyAssetBase::typeKey:
+                return arena.clone<BindablePropertyAsset,
+                                   BindablePropertyAssetBase>(object);
+            case DataConverterNumberToListBase::typeKey:
+                return arena.clone<DataConverterNumberToList,
+                                   DataConverterNumberToListBase>(object);
+            case DataConverterFormulaBase::typeKey:
+                return arena.clone<DataConverterFormula,
+                                   DataConverterFormulaBase>(object);
+            case DataConverterToNumberBase::typeKey:
+                return arena.clone<DataConverterToNumber,
+                                   DataConverterToNumberBase>(object);
+            case DataConverterOperationBase::typeKey:
+                return arena.clone<DataConverterOperation,
+                                   DataConverterOperationBase>(object);
+            case DataConverterOperationValueBase::typeKey:
+                return arena.clone<DataConverterOperationValue,
+                                   DataConverterOperationValueBase>(object);
+            case DataConverterSystemDegsToRadsBase::typeKey:
+                return arena.clone<DataConverterSystemDegsToRads,
+                                   DataConverterSystemDegsToRadsBase>(object);
+            case DataConverterRangeMapperBase::typeKey:
+                return arena.clone<DataConverterRangeMapper,
+                                   DataConverterRangeMapperBase>(object);
+            case DataConverterInterpolatorBase::typeKey:
+                return arena.clone<DataConverterInterpolator,
+                                   DataConverterInterpolatorBase>(object);
+            case DataConverterSystemNormalizerBase::typeKey:
+                return arena.clone<DataConverterSystemNormalizer,
+                                   DataConverterSystemNormalizerBase>(object);
+            case DataConverterListToLengthBase::typeKey:
+                return arena.clone<DataConverterListToLength,
+                                   DataConverterListToLengthBase>(object);
+            case DataConverterGroupItemBase::typeKey:
+                return arena.clone<DataConverterGroupItem,
+                                   DataConverterGroupItemBase>(object);
+            case DataConverterGroupBase::typeKey:
+                return arena.clone<DataConverterGroup,
+                                   DataConverterGroupBase>(object);
+            case DataConverterStringRemoveZerosBase::typeKey:
+                return arena.clone<DataConverterStringRemoveZeros,
+                                   DataConverterStringRemoveZerosBase>(object);
+            case DataConverterRounderBase::typeKey:
+                return arena.clone<DataConverterRounder,
+                                   DataConverterRounderBase>(object);
+            case DataConverterStringPadBase::typeKey:
+                return arena.clone<DataConverterStringPad,
+                                   DataConverterStringPadBase>(object);
+            case DataConverterTriggerBase::typeKey:
+                return arena.clone<DataConverterTrigger,
+                                   DataConverterTriggerBase>(object);
+            case DataConverterStringTrimBase::typeKey:
+                return arena.clone<DataConverterStringTrim,
+                                   DataConverterStringTrimBase>(object);
+            case FormulaTokenBase::typeKey:
+                return arena.clone<FormulaToken, FormulaTokenBase>(object);
+            case FormulaTokenArgumentSeparatorBase::typeKey:
+                return arena.clone<FormulaTokenArgumentSeparator,
+                                   FormulaTokenArgumentSeparatorBase>(object);
+            case FormulaTokenParenthesisBase::typeKey:
+                return arena.clone<FormulaTokenParenthesis,
+                                   FormulaTokenParenthesisBase>(object);
+            case FormulaTokenParenthesisCloseBase::typeKey:
+                return arena.clone<FormulaTokenParenthesisClose,
+                                   FormulaTokenParenthesisCloseBase>(object);
+            case FormulaTokenOperationBase::typeKey:
+                return arena.clone<FormulaTokenOperation,
+                                   FormulaTokenOperationBase>(object);
+            case FormulaTokenFunctionBase::typeKey:
+                return arena.clone<FormulaTokenFunction,
+                                   FormulaTokenFunctionBase>(object);
+            case FormulaTokenValueBase::typeKey:
+                return arena.clone<FormulaTokenValue,
+                                   FormulaTokenValueBase>(object);
+            case FormulaTokenParenthesisOpenBase::typeKey:
+                return arena.clone<FormulaTokenParenthesisOpen,
+                                   FormulaTokenParenthesisOpenBase>(object);
+            case FormulaTokenInputBase::typeKey:
+                return arena.clone<FormulaTokenInput,
+                                   FormulaTokenInputBase>(object);
+            case DataConverterOperationViewModelBase::typeKey:
+                return arena.clone<DataConverterOperationViewModel,
+                                   DataConverterOperationViewModelBase>(object);
+            case DataConverterBooleanNegateBase::typeKey:
+                return arena.clone<DataConverterBooleanNegate,
+                                   DataConverterBooleanNegateBase>(object);
+            case DataConverterToStringBase::typeKey:
+                return arena.clone<DataConverterToString,
+                                   DataConverterToStringBase>(object);
+            case DataBindContextBase::typeKey:
+                return arena.clone<DataBindContext,
+                                   DataBindContextBase>(object);
+            case BindablePropertyListBase::typeKey:
+                return arena.clone<BindablePropertyList,
+                                   BindablePropertyListBase>(object);
+            case BindablePropertyStringBase::typeKey:
+                return arena.clone<BindablePropertyString,
+                                   BindablePropertyStringBase>(object);
+            case BindablePropertyNumberBase::typeKey:
+                return arena.clone<BindablePropertyNumber,
+                                   BindablePropertyNumberBase>(object);
+            case BindablePropertyEnumBase::typeKey:
+                return arena.clone<BindablePropertyEnum,
+                                   BindablePropertyEnumBase>(object);
+            case BindablePropertyColorBase::typeKey:
+                return arena.clone<BindablePropertyColor,
+                                   BindablePropertyColorBase>(object);
+            case BindablePropertyViewModelBase::typeKey:
+                return arena.clone<BindablePropertyViewModel,
+                                   BindablePropertyViewModelBase>(object);
+            case NestedArtboardLeafBase::typeKey:
+                return arena.clone<NestedArtboardLeaf,
+                                   NestedArtboardLeafBase>(object);
+            case WeightBase::typeKey:
+                return arena.clone<Weight, WeightBase>(object);
+            case BoneBase::typeKey:
+                return arena.clone<Bone, BoneBase>(object);
+            case RootBoneBase::typeKey:
+                return arena.clone<RootBone, RootBoneBase>(object);
+            case SkinBase::typeKey:
+                return arena.clone<Skin, SkinBase>(object);
+            case TendonBase::typeKey:
+                return arena.clone<Tendon, TendonBase>(object);
+            case CubicWeightBase::typeKey:
+                return arena.clone<CubicWeight, CubicWeightBase>(object);
+            case TextModifierRangeBase::typeKey:
+                return arena.clone<TextModifierRange,
+                                   TextModifierRangeBase>(object);
+            case TextFollowPathModifierBase::typeKey:
+                return arena.clone<TextFollowPathModifier,
+                                   TextFollowPathModifierBase>(object);
+            case TextInputCursorBase::typeKey:
+                return arena.clone<TextInputCursor,
+                                   TextInputCursorBase>(object);
+            case TextInputTextBase::typeKey:
+                return arena.clone<TextInputText, TextInputTextBase>(object);
+            case TextStyleFeatureBase::typeKey:
+                return arena.clone<TextStyleFeature,
+                                   TextStyleFeatureBase>(object);
+            case TextStyleBackgroundBase::typeKey:
+                return arena.clone<TextStyleBackground,
+                                   TextStyleBackgroundBase>(object);
+            case TextVariationModifierBase::typeKey:
+                return arena.clone<TextVariationModifier,
+                                   TextVariationModifierBase>(object);
+            case TextModifierGroupBase::typeKey:
+                return arena.clone<TextModifierGroup,
+                                   TextModifierGroupBase>(object);
+            case TextStyleBase::typeKey:
+                return arena.clone<TextStyle, TextStyleBase>(object);
+            case TextStylePaintBase::typeKey:
+                return arena.clone<TextStylePaint, TextStylePaintBase>(object);
+            case TextInputSelectedTextBase::typeKey:
+                return arena.clone<TextInputSelectedText,
+                                   TextInputSelectedTextBase>(object);
+            case TextInputBase::typeKey:
+                return arena.clone<TextInput, TextInputBase>(object);
+            case TextStyleAxisBase::typeKey:
+                return arena.clone<TextStyleAxis, TextStyleAxisBase>(object);
+            case TextInputSelectionBase::typeKey:
+                return arena.clone<TextInputSelection,
+                                   TextInputSelectionBase>(object);
+            case TextBase::typeKey:
+                return arena.clone<Text, TextBase>(object);
+            case TextValueRunBase::typeKey:
+                return arena.clone<TextValueRun, TextValueRunBase>(object);
+            case ArtboardListMapRuleBase::typeKey:
+                return arena.clone<ArtboardListMapRule,
+                                   ArtboardListMapRuleBase>(object);
+            case CustomPropertyEnumBase::typeKey:
+                return arena.clone<CustomPropertyEnum,
+                                   CustomPropertyEnumBase>(object);
+            case BlobAssetBase::typeKey:
+                return arena.clone<BlobAsset, BlobAssetBase>(object);
+            case FolderBase::typeKey:
+                return arena.clone<Folder, FolderBase>(object);
+            case ScriptAssetBase::typeKey:
+                return arena.clone<ScriptAsset, ScriptAssetBase>(object);
+            case ManifestAssetBase::typeKey:
+                return arena.clone<ManifestAsset, ManifestAssetBase>(object);
+            case ImageAssetBase::typeKey:
+                return arena.clone<ImageAsset, ImageAssetBase>(object);
+            case ShaderAssetBase::typeKey:
+                return arena.clone<ShaderAsset, ShaderAssetBase>(object);
+            case FontAssetBase::typeKey:
+                return arena.clone<FontAsset, FontAssetBase>(object);
+            case AudioAssetBase::typeKey:
+                return arena.clone<AudioAsset, AudioAssetBase>(object);
+            case FileAssetContentsBase::typeKey:
+                return arena.clone<FileAssetContents,
+                                   FileAssetContentsBase>(object);
+            case ScriptModuleAssetBase::typeKey:
+                return arena.clone<ScriptModuleAsset,
+                                   ScriptModuleAssetBase>(object);
+            case AudioEventBase::typeKey:
+                return arena.clone<AudioEvent, AudioEventBase>(object);
+            case UserInputBase::typeKey:
+                return arena.clone<UserInput, UserInputBase>(object);
+            case GamepadInputBase::typeKey:
+                return arena.clone<GamepadInput, GamepadInputBase>(object);
+            case KeyboardInputBase::typeKey:
+                return arena.clone<KeyboardInput, KeyboardInputBase>(object);
+            case SemanticInputBase::typeKey:
+                return arena.clone<SemanticInput, SemanticInputBase>(object);
+            case ScriptInputArtboardBase::typeKey:
+                return arena.clone<ScriptInputArtboard,
+                                   ScriptInputArtboardBase>(object);
+        }
+        return nullptr;
+    }
     static void setUint(Core* object, int propertyKey, uint32_t value)
     {
         switch (propertyKey)
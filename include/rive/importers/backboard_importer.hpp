@@ -5,6 +5,7 @@
 #include "rive/animation/keyframe_interpolator.hpp"
 #include "rive/refcnt.hpp"
 #include "rive/file.hpp"
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -56,6 +57,16 @@ public:
     std::vector<rcp<FileAsset>>* assets() { return &m_FileAssets; }
     void file(File* value);
     File* file() { return m_file; };
+    Artboard* artboard(int artboardId) const;
+    const std::vector<ArtboardReferencer*>& artboardReferencers() const
+    {
+        return m_ArtboardsReferencers;
+    }
+
+    /// Makes an importer for objects read after this one has resolved, like a
+    /// lazily loaded artboard's. It shares this importer's artboards, assets,
+    /// converters, interpolators and physics, but none of its referencers.
+    std::unique_ptr<BackboardImporter> makeDeferred() const;
 
     StatusCode resolve() override;
     const Backboard* backboard() const { return m_Backboard; }
@@ -37,6 +37,18 @@ RIVE_ALWAYS_INLINE static int clz64(uint64_t x)
 #endif
 }
 
+// Attempt to generate a "ctz" assembly instruction.
+RIVE_ALWAYS_INLINE static int ctz64(uint64_t x)
+{
+    assert(x != 0);
+#if __has_builtin(__builtin_ctzll)
+    return __builtin_ctzll(x);
+#else
+    // Isolate the lowest set bit and count the zeros above it.
+    return 63 - clz64(x & (~x + 1));
+#endif
+}
+
 // Returns the 1-based index of the most significat bit in x.
 //
 //   0    -> 0
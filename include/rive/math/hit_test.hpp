@@ -15,6 +15,7 @@
 
 namespace rive
 {
+class RawPath;
 
 class HitTester
 {
@@ -52,5 +53,61 @@ public:
                          Span<uint16_t> indices);
 };
 
+// Flattened polylines of one or more paths, kept in the space they were added
+// in so repeated hit tests can skip walking and flattening the curves again.
+// Curves are flattened into the same segments HitTester would use, and test()
+// rasterizes the edges into the same delta-winding grid, so both agree.
+//
+// Committed edges are sorted by their top and stored four at a time as
+// {x0[4], y0[4], x1[4], y1[4]}, so whole blocks that miss the hit area are
+// rejected with a few SIMD compares and the scan stops at the first block
+// below it.
+class HitTestPolylines
+{
+public:
+    // Cap on the bytes of a single cache's edges.
+    static constexpr size_t kMaxBytes = 64 * 1024;
+    // Cap on the edges held by every cache in the process.
+    static constexpr size_t kBudgetBytes = 4 * 1024 * 1024;
+
+    HitTestPolylines() = default;
+    HitTestPolylines(const HitTestPolylines&) = delete;
+    HitTestPolylines& operator=(const HitTestPolylines&) = delete;
+    ~HitTestPolylines();
+
+    // Adds each contour of path, transformed by xform, as a closed polyline.
+    void addPath(const RawPath& path, const Mat2D& xform);
+
+    // Claims the memory of the added edges from the process-wide budget.
+    // Returns false, dropping the edges, if they exceed either cap. Edges
+    // can't be added once committed.
+    bool commit();
+
+    size_t edgeCount() const { return m_edgeCount; }
+    size_t byteSize() const { return m_blocks.capacity() * sizeof(float); }
+
+    bool test(const IAABB& area, FillRule = rive::FillRule::nonZero) const;
+
+    // Bytes currently claimed by committed caches.
+    static size_t BudgetBytesUsed();
+
+private:
+    void addEdge(Vec2D p0, Vec2D p1);
+    void addCubic(Vec2D a, Vec2D b, Vec2D c, Vec2D d, int count);
+    void release();
+
+    struct Edge
+    {
+        Vec2D p0, p1;
+    };
+    // Edges added since the last commit.
+    std::vector<Edge> m_edges;
+    std::vector<float> m_blocks;
+    size_t m_edgeCount = 0;
+    size_t m_claimedBytes = 0;
+    // Set when addPath() hits kMaxBytes and stops recording edges.
+    bool m_overflowed = false;
+};
+
 } // namespace rive
 #endif
@@ -6,8 +6,11 @@
 
 #include "rive/refcnt.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <deque>
+#include <vector>
 
 namespace rive
 {
@@ -32,6 +35,8 @@ public:
         return *this;
     }
 
+    void swap(ObjectStream& other) { m_stream.swap(other.m_stream); }
+
 private:
     std::deque<T> m_stream;
 };
@@ -39,17 +44,22 @@ private:
 // Stream for recording objects of any trivially-copyable type, using C++-style
 // "<<" ">>" operators. Object types must be read back in the same order they
 // were writen.
+//
+// Bytes are stored in a contiguous, power-of-two ring that only grows. Reads
+// and writes are memcpys (split in two at most when they wrap), and capacity is
+// retained once the stream drains, so steady-state recording doesn't allocate.
 class PODStream
 {
 public:
-    bool empty() const { return m_byteStream.empty(); }
+    bool empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+    size_t capacity() const { return m_ring.size(); }
 
     template <typename T> PODStream& operator<<(T obj)
     {
         static_assert(std::is_trivial<T>() && std::is_standard_layout<T>(),
                       "PODStream only accepts plain-old-data types");
-        const char* data = reinterpret_cast<const char*>(&obj);
-        m_byteStream.insert(m_byteStream.end(), data, data + sizeof(T));
+        write(&obj, sizeof(T));
         return *this;
     }
 
@@ -57,11 +67,7 @@ public:
     {
         static_assert(std::is_trivial<T>() && std::is_standard_layout<T>(),
                       "PODStream only accepts plain-old-data types");
-        assert(m_byteStream.size() >= sizeof(T));
-        char* data = reinterpret_cast<char*>(&dst);
-        std::copy(m_byteStream.begin(), m_byteStream.begin() + sizeof(T), data);
-        m_byteStream.erase(m_byteStream.begin(),
-                           m_byteStream.begin() + sizeof(T));
+        read(&dst, sizeof(T));
         return *this;
     }
 
@@ -78,7 +84,64 @@ public:
         return *this;
     }
 
+    void swap(PODStream& other)
+    {
+        m_ring.swap(other.m_ring);
+        std::swap(m_head, other.m_head);
+        std::swap(m_size, other.m_size);
+    }
+
 private:
-    std::deque<char> m_byteStream;
+    void write(const void* src, size_t n)
+    {
+        if (m_size + n > m_ring.size())
+        {
+            grow(m_size + n);
+        }
+        size_t mask = m_ring.size() - 1;
+        size_t tail = (m_head + m_size) & mask;
+        size_t firstChunk = std::min(n, m_ring.size() - tail);
+        memcpy(m_ring.data() + tail, src, firstChunk);
+        memcpy(m_ring.data(),
+               static_cast<const char*>(src) + firstChunk,
+               n - firstChunk);
+        m_size += n;
+    }
+
+    void read(void* dst, size_t n)
+    {
+        assert(m_size >= n);
+        size_t firstChunk = std::min(n, m_ring.size() - m_head);
+        memcpy(dst, m_ring.data() + m_head, firstChunk);
+        memcpy(static_cast<char*>(dst) + firstChunk,
+               m_ring.data(),
+               n - firstChunk);
+        m_head = (m_head + n) & (m_ring.size() - 1);
+        m_size -= n;
+    }
+
+    // Reallocates the ring with at least minCapacity bytes, unwrapping the
+    // existing contents to the front of the new allocation.
+    void grow(size_t minCapacity)
+    {
+        size_t newCapacity = std::max<size_t>(m_ring.size(), 256);
+        while (newCapacity < minCapacity)
+        {
+            newCapacity <<= 1;
+        }
+        std::vector<char> newRing(newCapacity);
+        size_t size = m_size;
+        if (size != 0)
+        {
+            read(newRing.data(), size);
+        }
+        m_ring.swap(newRing);
+        m_head = 0;
+        m_size = size;
+    }
+
+    std::vector<char> m_ring;
+    size_t m_head = 0;
+    size_t m_size = 0;
 };
 }; // namespace rive
@@ -26,6 +26,10 @@ public:
 
     void pathCollapseChanged();
 
+    // Whether the last path update was deferred (see
+    // Shape::canDeferPathUpdate), leaving the world bounds stale.
+    bool hasDeferredPathDirt() const { return m_deferredPathDirt; }
+
 private:
     Shape* m_shape;
     ShapePaintPath m_localPath;
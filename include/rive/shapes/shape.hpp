@@ -14,6 +14,7 @@ namespace rive
 class Path;
 class PathComposer;
 class HitTester;
+class HitTestPolylines;
 class RenderPathDeformer;
 
 class Shape : public ShapeBase, public ShapePaintContainer
@@ -22,11 +23,28 @@ private:
     PathComposer m_PathComposer;
     std::vector<Path*> m_Paths;
     AABB m_WorldBounds;
+    uint32_t m_worldBoundsVersion = 0;
     float m_WorldLength = -1;
 
     bool m_WantDifferencePath = false;
     RenderPathDeformer* m_deformer = nullptr;
 
+    // Hit tests flatten the paths directly the first time the shape is
+    // tested after its bounds change, and only cache the flattened
+    // polylines when it's tested again before they change. Shapes that
+    // animate under the pointer don't pay for building caches they'd
+    // drop the next frame.
+    enum class HitCacheState : uint8_t
+    {
+        untested,
+        tested,
+        cached,
+        rejected,
+    };
+    HitCacheState m_hitCacheState = HitCacheState::untested;
+    std::unique_ptr<HitTestPolylines> m_hitPolylines;
+    const HitTestPolylines* hitPolylines();
+
     // Scale-to-fit and the memoized intrinsic bounds live on the
     // LayoutParticipant, not here: only a participant uses them, and it is
     // already allocated for exactly that case — so a plain Shape carries none
@@ -39,6 +57,7 @@ private:
 
 public:
     Shape();
+    ~Shape() override;
     void buildDependencies() override;
     bool collapse(bool value) override;
     bool canDeferPathUpdate();
@@ -83,20 +102,10 @@ public:
         }
         return m_WorldBounds;
     }
-    void markBoundsDirty()
-    {
-        drawableFlags(drawableFlags() & ~static_cast<unsigned short>(
-                                            DrawableFlag::WorldBoundsClean));
-        m_WorldLength = -1;
-#ifdef WITH_RIVE_LAYOUT
-        // A participant's intrinsic bounds drive its layout slot, so
-        // re-measure/re-solve when they change.
-        if (auto* participant = layoutParticipant())
-        {
-            participant->markLayoutNodeDirty();
-        }
-#endif
-    }
+    void markBoundsDirty();
+    // Bumped every time the world bounds are marked dirty, so hit test
+    // indices can tell which shapes need refitting.
+    uint32_t worldBoundsVersion() const { return m_worldBoundsVersion; }
 
     AABB computeWorldBounds(const Mat2D* xform = nullptr) const;
     AABB computeLocalBounds() const;
@@ -46,6 +46,9 @@ private:
 
     // Copy the member (non-render) buffers into the render buffers.
     void updateBuffers();
+    // Set by update() and cleared by draw(), which makes and fills the render
+    // buffers, so updating doesn't call into the factory.
+    bool m_buffersDirty = false;
 
     static const uint16_t triangulation[];
     static const Corner patchCorners[];
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace rive
+{
+// Bounded, lock-free ring buffer with exactly one producer thread and exactly
+// one consumer thread.
+//
+// The producer may push several elements and make them visible to the
+// consumer all at once with publish(), so a batch costs a single release store
+// no matter how many elements it contains. Likewise the consumer may pop
+// several elements and hand their slots back to the producer with a single
+// release().
+//
+// Capacity must be a power of two.
+template <typename T, uint32_t Capacity> class SPSCRingBuffer
+{
+public:
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                  "SPSCRingBuffer capacity must be a power of two");
+
+    SPSCRingBuffer() = default;
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+    constexpr static uint32_t capacity() { return Capacity; }
+
+    // Producer: stages an element without making it visible to the consumer.
+    // Returns false, and leaves value untouched, if the ring is full (counting
+    // staged elements).
+    bool tryPush(T&& value)
+    {
+        if (m_pendingTail - m_cachedHead == Capacity)
+        {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (m_pendingTail - m_cachedHead == Capacity)
+            {
+                return false;
+            }
+        }
+        m_slots[m_pendingTail & (Capacity - 1)] = std::move(value);
+        ++m_pendingTail;
+        return true;
+    }
+
+    // Producer: makes every element staged since the last publish() visible to
+    // the consumer.
+    void publish() { m_tail.store(m_pendingTail, std::memory_order_release); }
+
+    // Producer: tryPush() + publish().
+    bool tryPushAndPublish(T&& value)
+    {
+        if (!tryPush(std::move(value)))
+        {
+            return false;
+        }
+        publish();
+        return true;
+    }
+
+    // Consumer: number of published elements that have not been popped yet.
+    uint32_t readable()
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+        return m_cachedTail - m_pendingHead;
+    }
+
+    // Consumer: pops the next published element without returning its slot to
+    // the producer. Returns false if there is nothing published to pop.
+    bool tryPop(T& dst)
+    {
+        if (m_pendingHead == m_cachedTail && readable() == 0)
+        {
+            return false;
+        }
+        dst = std::move(m_slots[m_pendingHead & (Capacity - 1)]);
+        ++m_pendingHead;
+        return true;
+    }
+
+    // Consumer: returns the slots of every element popped since the last
+    // release() to the producer.
+    void release() { m_head.store(m_pendingHead, std::memory_order_release); }
+
+    // Consumer: tryPop() + release().
+    bool tryPopAndRelease(T& dst)
+    {
+        if (!tryPop(dst))
+        {
+            return false;
+        }
+        release();
+        return true;
+    }
+
+private:
+    // Separate the producer- and consumer-owned indices onto their own cache
+    // lines so the two threads don't false share.
+    constexpr static size_t kCacheLineSize = 64;
+
+    alignas(kCacheLineSize) std::atomic<uint32_t> m_tail{0};
+    uint32_t m_pendingTail = 0; // Producer only.
+    uint32_t m_cachedHead = 0;  // Producer only.
+
+    alignas(kCacheLineSize) std::atomic<uint32_t> m_head{0};
+    uint32_t m_pendingHead = 0; // Consumer only.
+    uint32_t m_cachedTail = 0;  // Consumer only.
+
+    alignas(kCacheLineSize) T m_slots[Capacity];
+};
+} // namespace rive
@@ -5,6 +5,7 @@
 #include "rive/text/utf.hpp"
 #include "rive/text_engine.hpp"
 #include "rive/text/glyph_lookup.hpp"
+#include <vector>
 
 namespace rive
 {
@@ -48,13 +49,58 @@ public:
                TextOverflow overflow,
                float paragraphSpacing);
 
+    // Same result as shape() with the run spanning all of text, but only
+    // shapes and line breaks the paragraphs (text up to and including each
+    // '\n') that changed since the last call. The rest are spliced back in,
+    // shifted to where they moved in the text. Everything is shaped again if
+    // the run's font or styling changed, and everything is line broken again
+    // if the wrap width did.
+    void reshape(Span<const Unichar> text,
+                 const TextRun& run,
+                 TextSizing sizing,
+                 float maxWidth,
+                 float maxHeight,
+                 TextAlign alignment,
+                 TextWrap wrap,
+                 TextOrigin origin,
+                 TextOverflow overflow,
+                 float paragraphSpacing);
+
+    // How many paragraphs the last reshape() had to shape.
+    uint32_t reshapedParagraphCount() const { return m_reshapedParagraphCount; }
+
 private:
+    // Builds the ordered lines and bounds from the paragraphs and their lines.
+    void layoutLines(TextSizing sizing,
+                     float maxWidth,
+                     float maxHeight,
+                     TextOrigin origin,
+                     TextOverflow overflow,
+                     float paragraphSpacing);
+
     SimpleArray<Paragraph> m_paragraphs;
     SimpleArray<SimpleArray<GlyphLine>> m_paragraphLines;
     std::vector<OrderedLine> m_orderedLines;
     GlyphLookup m_glyphLookup;
     GlyphRun m_ellipsisRun;
     AABB m_bounds;
+
+    // What reshape() last shaped, so the next call can tell which paragraphs
+    // it can reuse. Each chunk is a '\n' terminated range of m_shapedText and
+    // the paragraphs it shaped into.
+    struct ShapedChunk
+    {
+        uint32_t textStart;
+        uint32_t textLength;
+        uint32_t paragraphCount;
+    };
+    std::vector<Unichar> m_shapedText;
+    std::vector<ShapedChunk> m_shapedChunks;
+    TextRun m_shapedRun = {};
+    Font::FallbackProc m_shapedFallbackProc = nullptr;
+    bool m_shapedFallbackProcEnabled = false;
+    float m_shapedBreakWidth = 0.0f;
+    uint32_t m_reshapedParagraphCount = 0;
 };
 } // namespace rive
 
@@ -0,0 +1,59 @@
+#ifndef _RIVE_TEXT_SHAPED_PARAGRAPH_CACHE_HPP_
+#define _RIVE_TEXT_SHAPED_PARAGRAPH_CACHE_HPP_
+
+#include "rive/text_engine.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace rive
+{
+/// Process-wide, size-bounded LRU cache of shaped paragraphs. Identical labels
+/// (e.g. across the items of a list), and the repeated shaping of the same
+/// text by Text's measure/fit/modifier passes, share one shaping result.
+///
+/// Results are keyed by the unichars and every field of every TextRun. Fonts
+/// are matched by instance, and since a Font's variations and features are
+/// fixed when it's made (see Font::withOptions()), that covers them too. The
+/// current fallback proc is part of the key as well.
+///
+/// Entries don't hold refs on their fonts, so the cache never keeps a File's
+/// fonts alive: a Font purges the entries that use it when it's destroyed.
+/// For the same reason, results that needed a fallback font (one none of the
+/// runs use) aren't cached.
+///
+/// Thread safe. Shaping on a miss happens outside the lock.
+class ShapedParagraphCache
+{
+public:
+    static constexpr size_t kDefaultBudgetInBytes = 4 * 1024 * 1024;
+
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t entryCount = 0;
+        size_t bytesUsed = 0;
+    };
+
+    /// Same result as runs[0].font->shapeText(text, runs).
+    static SimpleArray<Paragraph> shapeText(Span<const Unichar> text,
+                                            Span<const TextRun> runs);
+
+    /// Evicts least recently used results until the cache fits. 0 disables
+    /// caching.
+    static void setBudgetInBytes(size_t);
+    static size_t budgetInBytes();
+
+    static Stats stats();
+    static void resetStats();
+
+    /// Drops every cached result.
+    static void clear();
+
+    /// Drops every cached result shaped with font. Called by ~Font().
+    static void purgeFont(const Font* font);
+};
+} // namespace rive
+
+#endif
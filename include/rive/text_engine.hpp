@@ -11,6 +11,10 @@
 #include "rive/span.hpp"
 #include "rive/simple_array.hpp"
 
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace rive
@@ -85,9 +89,94 @@ using GlyphID = uint16_t;
 
 struct TextRun;
 struct GlyphRun;
+class Font;
 
 bool isWhiteSpace(Unichar c);
 
+// LRU cache of one font's glyph outlines, bounded by a byte budget. Each Font
+// owns one, and since variations are baked into a Font when it's made (see
+// Font::withOptions()), that makes it per variation instance too.
+//
+// Instances advanced on different threads (see BatchAdvancer) share their
+// File's fonts, so every access is made under the cache's lock. Paths are only
+// handed out to a callback that runs while it's held.
+class GlyphPathCache
+{
+public:
+    static constexpr size_t kDefaultBudgetInBytes = 1024 * 1024;
+
+    struct Stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    // Calls fn(const RawPath&) with font->getPath(glyph), extracting it only
+    // if it isn't cached. The path must not be kept past the call, and fn must
+    // not reenter this cache.
+    template <typename Fn> void visit(const Font* font, GlyphID glyph, Fn&& fn)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        fn(get(font, glyph));
+    }
+
+    // Evicts least recently used outlines until the cache fits. 0 disables
+    // caching.
+    void setBudgetInBytes(size_t);
+    size_t budgetInBytes() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_budgetInBytes;
+    }
+    size_t bytesUsed() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_bytesUsed;
+    }
+    size_t glyphCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+    Stats stats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+    void resetStats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats = Stats();
+    }
+
+    void clear();
+
+private:
+    // Callers hold m_mutex. The reference is valid until the next call.
+    const RawPath& get(const Font* font, GlyphID glyph);
+
+    struct Entry
+    {
+        GlyphID glyph;
+        RawPath path;
+        size_t sizeInBytes;
+    };
+
+    void evictDownTo(size_t budgetInBytes);
+
+    size_t m_budgetInBytes = kDefaultBudgetInBytes;
+    size_t m_bytesUsed = 0;
+    // Most recently used at the front.
+    std::list<Entry> m_lru;
+    std::unordered_map<GlyphID, std::list<Entry>::iterator> m_entries;
+    // Where get() returns a path from when caching is disabled.
+    RawPath m_uncachedPath;
+    Stats m_stats;
+    mutable std::mutex m_mutex;
+};
+
 // Direction a paragraph or run flows in.
 enum class TextDirection : uint8_t
 {
@@ -187,7 +276,7 @@ struct Paragraph
 class Font : public RefCnt<Font>
 {
 public:
-    virtual ~Font() {}
+    virtual ~Font();
 
     struct LineMetrics
     {
@@ -276,6 +365,25 @@ public:
     //
     virtual RawPath getPath(GlyphID) const = 0;
 
+    // Same as getPath(), but served from this font's GlyphPathCache so text
+    // that gets laid out again doesn't re-extract its outlines. fn is called
+    // with the outline while the cache is locked, so it may run on any thread
+    // but must not keep the path or ask this font for another glyph.
+    template <typename Fn> void visitGlyphPath(GlyphID glyph, Fn&& fn) const
+    {
+        m_glyphPathCache.visit(this, glyph, std::forward<Fn>(fn));
+    }
+
+    // A copy of the cached outline, for callers that need to keep it.
+    RawPath glyphPath(GlyphID glyph) const
+    {
+        RawPath path;
+        visitGlyphPath(glyph, [&path](const RawPath& cached) { path = cached; });
+        return path;
+    }
+
+    GlyphPathCache& glyphPathCache() const { return m_glyphPathCache; }
+
     // Color glyph (emoji) support via COLR/CPAL tables.
 
     // A single layer of a color glyph, with its own path and fill.
@@ -363,6 +471,8 @@ protected:
 private:
     /// The font specified line metrics (automatic line metrics).
     const LineMetrics m_lineMetrics;
+
+    mutable GlyphPathCache m_glyphPathCache;
 };
 
 // A user defined styling guide for a set of unicode codepoints within a larger
@@ -19,7 +19,9 @@
 #include "rive/viewmodel/runtime/viewmodel_instance_asset_blob_runtime.hpp"
 #include "rive/viewmodel/runtime/viewmodel_instance_artboard_runtime.hpp"
 #include "rive/viewmodel/runtime/viewmodel_instance_list_index_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_property_handle.hpp"
 #include "rive/refcnt.hpp"
+#include "rive/span.hpp"
 
 namespace rive
 {
@@ -67,6 +69,50 @@ public:
     rcp<ViewModelInstance> instance() { return m_viewModelInstance; };
     std::vector<PropertyData> properties() const;
 
+    // Resolve a property's path once, for setting it many times. The handle
+    // is empty if the path doesn't lead to a property of that type.
+    ViewModelNumberHandle numberHandle(const std::string& path) const;
+    ViewModelStringHandle stringHandle(const std::string& path) const;
+    ViewModelBooleanHandle booleanHandle(const std::string& path) const;
+    ViewModelColorHandle colorHandle(const std::string& path) const;
+    ViewModelEnumHandle enumHandle(const std::string& path) const;
+    ViewModelTriggerHandle triggerHandle(const std::string& path) const;
+
+    // Whether the handle was resolved by this runtime, and no view model
+    // instance has been replaced through it since.
+    template <typename T>
+    bool isValid(const ViewModelPropertyHandle<T>& handle) const
+    {
+        return handle.m_property != nullptr && handle.m_ownerId == m_id &&
+               handle.m_generation == m_replaceCount->value;
+    }
+
+    // Set a property through its handle. Returns false, without setting
+    // anything, if the handle isn't valid.
+    bool setValue(const ViewModelNumberHandle& handle, float value) const;
+    bool setValue(const ViewModelStringHandle& handle,
+                  const std::string& value) const;
+    bool setValue(const ViewModelBooleanHandle& handle, bool value) const;
+    bool setValue(const ViewModelColorHandle& handle, int value) const;
+    // Sets the enum by the index of its value.
+    bool setValue(const ViewModelEnumHandle& handle, uint32_t value) const;
+    bool fire(const ViewModelTriggerHandle& handle) const;
+
+    // Bulk versions of setValue(). Updates with invalid handles are skipped.
+    // Returns how many were set.
+    size_t setValues(Span<const ViewModelNumberUpdate> updates) const;
+    size_t setValues(Span<const ViewModelStringUpdate> updates) const;
+    size_t setValues(Span<const ViewModelBooleanUpdate> updates) const;
+    size_t setValues(Span<const ViewModelColorUpdate> updates) const;
+    size_t setValues(Span<const ViewModelEnumUpdate> updates) const;
+
+    // See ViewModelInstance::beginTransaction().
+    void beginTransaction() const { m_viewModelInstance->beginTransaction(); }
+    void commitTransaction() const
+    {
+        m_viewModelInstance->commitTransaction();
+    }
+
 private:
     rcp<ViewModelInstance> m_viewModelInstance = nullptr;
     std::string getPropertyNameFromPath(const std::string& path) const;
@@ -107,6 +153,28 @@ private:
         }
         return nullptr;
     };
+
+    // Restamped whenever a view model instance is replaced through a
+    // runtime, or any of the nested runtimes it created, which share it.
+    // Handles remember the stamp they were resolved at. Stamps and ids come
+    // from one process wide counter, so neither is ever reused.
+    struct ReplaceCount : public RefCnt<ReplaceCount>
+    {
+        uint64_t value;
+    };
+    static uint64_t NextHandleStamp();
+    const uint64_t m_id;
+    rcp<ReplaceCount> m_replaceCount;
+
+    template <typename T>
+    ViewModelPropertyHandle<T> makeHandle(T* property) const
+    {
+        return ViewModelPropertyHandle<T>(property,
+                                          m_id,
+                                          m_replaceCount->value);
+    }
+    template <typename T, typename V>
+    size_t setValuesImpl(Span<const ViewModelPropertyUpdate<T, V>>) const;
 };
 } // namespace rive
 #endif
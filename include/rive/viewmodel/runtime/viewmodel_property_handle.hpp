@@ -0,0 +1,80 @@
+#ifndef _RIVE_VIEW_MODEL_PROPERTY_HANDLE_HPP_
+#define _RIVE_VIEW_MODEL_PROPERTY_HANDLE_HPP_
+
+#include <string>
+#include <stdint.h>
+#include "rive/viewmodel/runtime/viewmodel_instance_boolean_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_color_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_enum_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_number_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_string_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_trigger_runtime.hpp"
+
+namespace rive
+{
+class ViewModelInstanceRuntime;
+
+/// A typed property of a ViewModelInstanceRuntime, resolved from its path
+/// once so it can be set over and over without any string work. Handles are
+/// only good with the ViewModelInstanceRuntime that resolved them, and only
+/// until a view model instance is replaced through it (or through a nested
+/// runtime it created), since the path may lead somewhere else after that.
+template <typename T> class ViewModelPropertyHandle
+{
+public:
+    ViewModelPropertyHandle() = default;
+
+    /// The property as it was resolved, or null if the path didn't lead to a
+    /// property of this type.
+    T* property() const { return m_property; }
+
+    explicit operator bool() const { return m_property != nullptr; }
+
+private:
+    friend class ViewModelInstanceRuntime;
+
+    ViewModelPropertyHandle(T* property,
+                            uint64_t ownerId,
+                            uint64_t generation) :
+        m_property(property), m_ownerId(ownerId), m_generation(generation)
+    {}
+
+    T* m_property = nullptr;
+    // Both are unique for the life of the process, so a handle can't be
+    // mistaken for one of a runtime that reuses a freed one's address.
+    uint64_t m_ownerId = 0;
+    uint64_t m_generation = 0;
+};
+
+using ViewModelNumberHandle =
+    ViewModelPropertyHandle<ViewModelInstanceNumberRuntime>;
+using ViewModelStringHandle =
+    ViewModelPropertyHandle<ViewModelInstanceStringRuntime>;
+using ViewModelBooleanHandle =
+    ViewModelPropertyHandle<ViewModelInstanceBooleanRuntime>;
+using ViewModelColorHandle =
+    ViewModelPropertyHandle<ViewModelInstanceColorRuntime>;
+using ViewModelEnumHandle =
+    ViewModelPropertyHandle<ViewModelInstanceEnumRuntime>;
+using ViewModelTriggerHandle =
+    ViewModelPropertyHandle<ViewModelInstanceTriggerRuntime>;
+
+/// One (handle, value) pair for ViewModelInstanceRuntime::setValues().
+template <typename T, typename V> struct ViewModelPropertyUpdate
+{
+    ViewModelPropertyHandle<T> handle;
+    V value;
+};
+
+using ViewModelNumberUpdate =
+    ViewModelPropertyUpdate<ViewModelInstanceNumberRuntime, float>;
+using ViewModelStringUpdate =
+    ViewModelPropertyUpdate<ViewModelInstanceStringRuntime, std::string>;
+using ViewModelBooleanUpdate =
+    ViewModelPropertyUpdate<ViewModelInstanceBooleanRuntime, bool>;
+using ViewModelColorUpdate =
+    ViewModelPropertyUpdate<ViewModelInstanceColorRuntime, int>;
+using ViewModelEnumUpdate =
+    ViewModelPropertyUpdate<ViewModelInstanceEnumRuntime, uint32_t>;
+} // namespace rive
+#endif
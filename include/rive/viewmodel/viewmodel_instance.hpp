@@ -23,9 +23,14 @@ private:
     std::vector<DataBindContainer*> m_dependents;
     std::unordered_map<SymbolType, ViewModelInstanceValue*> m_propertySymbols;
     ViewModel* m_ViewModel;
+    uint32_t m_transactionDepth = 0;
+    std::vector<ViewModelInstanceValue*> m_deferredValues;
     void rebindDependents();
     void rebindProperties();
 
+    friend class ViewModelInstanceValue;
+    void deferDirt(ViewModelInstanceValue* value, ComponentDirt dirt);
+
 public:
     static uint32_t pointerKey(const ViewModelInstance* instance)
     {
@@ -68,11 +73,42 @@ public:
     bool hasParents() const { return !m_parents.empty(); }
     void addDependent(DataBindContainer*);
     void removeDependent(DataBindContainer*);
+
+    // Holds back the dirt this instance's values send their data binds until
+    // the matching commitTransaction(), so setting many values (or one value
+    // many times) marks each affected bind once. Values still change right
+    // away; only the binds hear about it late. Transactions nest, and the
+    // outermost commit flushes. Values of nested view model instances are not
+    // included; they have transactions of their own.
+    void beginTransaction() { m_transactionDepth++; }
+    void commitTransaction();
+    bool inTransaction() const { return m_transactionDepth != 0; }
 #ifdef TESTING
     std::vector<DataBindContainer*> dependents() { return m_dependents; }
     std::vector<ViewModelInstance*> parents() { return m_parents; }
 #endif
 };
+
+// Keeps a transaction open on a ViewModelInstance for the scope of this
+// object.
+class ViewModelTransaction
+{
+public:
+    explicit ViewModelTransaction(ViewModelInstance* instance) :
+        m_instance(instance)
+    {
+        m_instance->beginTransaction();
+    }
+
+    ~ViewModelTransaction() { m_instance->commitTransaction(); }
+
+    // Each transaction commits exactly once.
+    ViewModelTransaction(const ViewModelTransaction&) = delete;
+    ViewModelTransaction& operator=(const ViewModelTransaction&) = delete;
+
+private:
+    ViewModelInstance* m_instance = nullptr;
+};
 } // namespace rive
 
 #endif
\ No newline at end of file
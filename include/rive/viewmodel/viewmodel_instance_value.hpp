@@ -36,11 +36,14 @@ class ViewModelInstanceValue : public ViewModelInstanceValueBase,
                                public Triggerable
 {
     friend class SuppressDelegation;
+    friend class ViewModelInstance;
 
 private:
     ViewModelProperty* m_ViewModelProperty = nullptr;
     static std::string defaultName;
     ValueFlags m_changeFlags = ValueFlags::none;
+    // Dirt held back by an open ViewModelInstance transaction.
+    ComponentDirt m_deferredDirt = ComponentDirt::None;
     LazyVector<ViewModelInstanceValueDelegate*> m_delegates;
     LazyVector<ViewModelInstanceValueDelegate*> m_delegatesCopy;
     void registerSymbol();
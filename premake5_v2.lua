@@ -74,6 +74,12 @@ filter({ 'options:with_rive_layout' })
 do
     defines({ 'WITH_RIVE_LAYOUT' })
 end
+filter({ 'options:with_rive_threading' })
+do
+    -- Runs WorkPool tasks on worker threads instead of inline from
+    -- pollCompletedWork().
+    defines({ 'WITH_RIVE_THREADING' })
+end
 filter({})
 
 dependencies = path.getabsolute('dependencies/')
@@ -370,6 +376,11 @@ newoption({
     description = 'Compiles in layout features.',
 })
 
+newoption({
+    trigger = 'with_rive_threading',
+    description = 'Runs async work (image decodes, etc.) on a thread pool.',
+})
+
 newoption({
     trigger = 'with_rive_canvas',
     description = 'Compiles in RenderCanvas and Ore GPU abstraction layer.',
@@ -62,6 +62,17 @@ public:
         return Span<const uint8_t>(m_blobs.data(), m_blobs.size());
     }
 
+    // Hand the recorded bytes over by exchanging storage with the caller's
+    // vectors, whose old contents are dropped. The stream keeps recording
+    // into the caller's allocation, so buffers passed back in frame after
+    // frame stop allocating and nothing is copied.
+    void swapBytes(std::vector<uint8_t>& commands, std::vector<uint8_t>& blobs)
+    {
+        m_commands.swap(commands);
+        m_blobs.swap(blobs);
+        clearBytes();
+    }
+
 protected:
     // Appends are the hottest thing recording does, and vector::insert drags
     // its general mid-range machinery through every one of them.
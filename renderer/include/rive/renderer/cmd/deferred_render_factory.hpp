@@ -86,7 +86,8 @@ public:
         return make_rcp<DeferredRenderPath>(a.id,
                                             a.generation,
                                             &m_buffer,
-                                            &m_pathIds);
+                                            &m_pathIds,
+                                            &path);
     }
 
     rcp<RenderPath> makeEmptyRenderPath() override
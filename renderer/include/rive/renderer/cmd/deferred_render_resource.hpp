@@ -14,6 +14,7 @@
 #include "rive/renderer/cmd/id_allocator.hpp"
 #include "rive/renderer/cmd/live_recorder_registry.hpp"
 #include <cstdio>
+#include <cstring>
 #include <memory>
 #include <mutex>
 
@@ -147,7 +148,7 @@ public:
 
     void style(RenderPaintStyle v) override
     {
-        if (absorbed(m_state.style, static_cast<uint8_t>(v)))
+        if (absorbed<PaintU8POD>(m_state.style, static_cast<uint8_t>(v)))
         {
             return;
         }
@@ -155,10 +156,11 @@ public:
     }
     void color(ColorInt v) override
     {
-        if (absorbed(m_state.color, v) && m_colorKnown)
+        if (m_colorKnown && absorbed<PaintColorPOD>(m_state.color, v))
         {
             return;
         }
+        m_state.color = v;
         m_colorKnown = true;
         bump();
         m_buffer->append(t(RenderCmd::paintColor),
@@ -166,7 +168,7 @@ public:
     }
     void thickness(float v) override
     {
-        if (absorbed(m_state.thickness, v))
+        if (absorbed<PaintFloatPOD>(m_state.thickness, v))
         {
             return;
         }
@@ -174,7 +176,7 @@ public:
     }
     void join(StrokeJoin v) override
     {
-        if (absorbed(m_state.join, static_cast<uint8_t>(v)))
+        if (absorbed<PaintU8POD>(m_state.join, static_cast<uint8_t>(v)))
         {
             return;
         }
@@ -182,7 +184,7 @@ public:
     }
     void cap(StrokeCap v) override
     {
-        if (absorbed(m_state.cap, static_cast<uint8_t>(v)))
+        if (absorbed<PaintU8POD>(m_state.cap, static_cast<uint8_t>(v)))
         {
             return;
         }
@@ -190,7 +192,7 @@ public:
     }
     void feather(float v) override
     {
-        if (absorbed(m_state.feather, v))
+        if (absorbed<PaintFloatPOD>(m_state.feather, v))
         {
             return;
         }
@@ -198,7 +200,8 @@ public:
     }
     void blendMode(BlendMode v) override
     {
-        if (absorbed(m_state.blendMode, static_cast<uint8_t>(v)))
+        if (absorbed<PaintU8POD>(m_state.blendMode,
+                                 static_cast<uint8_t>(v)))
         {
             return;
         }
@@ -214,6 +217,7 @@ public:
         // must not drag a version bump and a state rewrite behind it.
         if (m_strokeInvalidated)
         {
+            noteElided(sizeof(ResIdPOD));
             return;
         }
         m_strokeInvalidated = true;
@@ -242,16 +246,23 @@ private:
 
     static uint8_t t(RenderCmd c) { return static_cast<uint8_t>(c); }
     // Absorbs the new value into the shadow; true when the consumer already
-    // has it and the append can be skipped.
-    template <typename T> bool absorbed(T& field, T v)
+    // has it and the append of POD can be skipped.
+    template <typename POD, typename T> bool absorbed(T& field, T v)
     {
         if (field == v)
         {
+            noteElided(sizeof(POD));
             return true;
         }
         field = v;
         return false;
     }
+    void noteElided(size_t podSize)
+    {
+        ElisionStats& stats = m_buffer->elisionStats();
+        stats.paintSets++;
+        stats.bytes += 1 + podSize;
+    }
     void emitU8(RenderCmd c, uint8_t v)
     {
         bump();
@@ -276,28 +287,36 @@ class DeferredRenderPath
       public VersionedDeferredResource
 {
 public:
+    // created is the geometry the create command carried; null for an empty
+    // path.
     DeferredRenderPath(RenderHandle id,
                        uint32_t generation,
                        RenderCommandBuffer* buffer,
-                       IdAllocator<RenderHandle>* allocator) :
+                       IdAllocator<RenderHandle>* allocator,
+                       const RawPath* created = nullptr) :
         VersionedDeferredResource(ResourceKind::path,
                                   id,
                                   generation,
                                   buffer,
-                                  allocator)
+                                  allocator),
+        m_content(created != nullptr ? *created : RawPath())
     {}
 
+    // Shapes rewind and rebuild their paths every frame they are dirty, most
+    // often to the same geometry. So a rewind records nothing yet: the
+    // rebuild collects in m_rebuild until the path is next used, and is only
+    // recorded if it differs from what replay already holds.
     void rewind() override
     {
-        bump();
         m_scratch.rewind(); // discards any pending per-verb geometry
+        m_rebuild.rewind();
+        m_rebuilding = true;
 #ifdef WITH_RIVE_PATH_QUERY
         if (m_query != nullptr)
         {
             m_query->rewind();
         }
 #endif
-        m_buffer->append(t(RenderCmd::pathRewind), ResIdPOD{m_id});
     }
     void fillRule(FillRule v) override
     {
@@ -305,6 +324,9 @@ public:
         // set must not bump a drawn path to a new version.
         if (m_haveFillRule && v == m_fillRule)
         {
+            ElisionStats& stats = m_buffer->elisionStats();
+            stats.pathSets++;
+            stats.bytes += 1 + sizeof(PathFillRulePOD);
             return;
         }
         m_haveFillRule = true;
@@ -343,9 +365,11 @@ public:
 
     void addRenderPath(const RenderPath* path, const Mat2D& m) override
     {
-        bump();
         flushScratch();
         flushScratchOf(path); // src geometry must be complete in the stream
+        bump();
+        // Geometry replay builds from another path is not tracked here.
+        m_contentKnown = false;
         RenderHandle src = idOfPath(path);
         m_buffer->append(t(RenderCmd::pathAddRenderPath),
                          PathAddPathPOD{m_id,
@@ -379,7 +403,7 @@ public:
     }
     void addRawPath(const RawPath& path) override
     {
-        flushScratch(); // preserve order: pending per-verb before this bulk add
+        appendScratch(); // preserve order: pending per-verb before this add
         recordAddRawPath(path);
         queryMirror([&](RawPath& q) { q.addPath(path); });
     }
@@ -404,16 +428,16 @@ public:
     const RawPath* queryRawPath() const { return m_query.get(); }
 #endif
 
-    // Emit any pending per verb geometry as one addRawPath. Public so the
-    // renderer can flush before a draw or clip.
+    // Emit any pending per verb geometry as one addRawPath, and settle a
+    // pending rebuild. Public so the renderer can flush before a draw or
+    // clip.
     void flushScratch()
     {
-        if (m_scratch.empty())
+        appendScratch();
+        if (m_rebuilding)
         {
-            return;
+            commitRebuild();
         }
-        recordAddRawPath(m_scratch);
-        m_scratch.rewind();
     }
     static void flushScratchOf(const RenderPath* p)
     {
@@ -453,10 +477,80 @@ private:
             path.cubic(p1, p2, p3);
         }
     }
+    void appendScratch()
+    {
+        if (m_scratch.empty())
+        {
+            return;
+        }
+        recordAddRawPath(m_scratch);
+        m_scratch.rewind();
+    }
+
+    void recordAddRawPath(const RawPath& path)
+    {
+        if (m_rebuilding)
+        {
+            m_rebuild.addPath(path);
+            return;
+        }
+        // Appended onto geometry replay already has; the result is only
+        // known again after the next rewind.
+        m_contentKnown = false;
+        emitAddRawPath(path);
+    }
+
+    // A rebuild to the geometry replay holds is dropped whole, rewind
+    // included. A recorded rebuild becomes the held geometry by swapping
+    // buffers, so neither side is copied.
+    void commitRebuild()
+    {
+        m_rebuilding = false;
+        if (m_contentKnown && sameGeometry(m_rebuild, m_content))
+        {
+            ElisionStats& stats = m_buffer->elisionStats();
+            stats.pathRebuilds++;
+            stats.bytes += 1 + sizeof(ResIdPOD);
+            if (!m_rebuild.empty())
+            {
+                stats.bytes += 1 + sizeof(PathRawPOD) +
+                               m_rebuild.verbs().size() * sizeof(PathVerb) +
+                               m_rebuild.points().size() * sizeof(Vec2D);
+            }
+            return;
+        }
+        bump();
+        m_buffer->append(t(RenderCmd::pathRewind), ResIdPOD{m_id});
+        if (!m_rebuild.empty())
+        {
+            emitAddRawPath(m_rebuild);
+        }
+        m_contentKnown = true;
+        m_content.swap(m_rebuild);
+    }
+
+    // Bitwise, so -0 and NaN coordinates only match themselves.
+    static bool sameGeometry(const RawPath& a, const RawPath& b)
+    {
+        auto verbsA = a.verbs();
+        auto verbsB = b.verbs();
+        auto pointsA = a.points();
+        auto pointsB = b.points();
+        return verbsA.size() == verbsB.size() &&
+               pointsA.size() == pointsB.size() &&
+               (verbsA.empty() ||
+                memcmp(verbsA.data(), verbsB.data(), verbsA.size_bytes()) ==
+                    0) &&
+               (pointsA.empty() ||
+                memcmp(pointsA.data(),
+                       pointsB.data(),
+                       pointsA.size_bytes()) == 0);
+    }
+
     // Replay seeds a bumped path version from the outgoing one, so appends
     // land on prior geometry and a rewind clears the seed via its own
     // recorded command.
-    void recordAddRawPath(const RawPath& path)
+    void emitAddRawPath(const RawPath& path)
     {
         bump();
         auto verbs = path.verbs();
@@ -489,14 +583,19 @@ private:
 #endif
 
     RawPath m_scratch; // pending CommandPath per-verb geometry
+    RawPath m_rebuild; // geometry added since an unrecorded rewind
+    RawPath m_content; // the geometry replay holds, when known
     FillRule m_fillRule = FillRule::nonZero;
     bool m_haveFillRule = false;
+    bool m_rebuilding = false;
+    bool m_contentKnown = true;
 };
 
 inline void DeferredRenderPaint::shader(rcp<RenderShader> s)
 {
     if (m_shader.get() == s.get())
     {
+        noteElided(sizeof(PaintShaderPOD));
         return;
     }
     m_shader = std::move(s);
@@ -11,6 +11,7 @@
 #include "rive/renderer/ore/cmd/ore_replay.hpp"
 #include "rive/renderer/render_context_impl.hpp"
 #include <algorithm>
+#include <cassert>
 #include <deque>
 #include <mutex>
 #include <unordered_map>
@@ -69,7 +70,8 @@ public:
 };
 
 // Immutable snapshot of one recorded frame so the producer can record the next
-// frame while this one replays on a render thread.
+// frame while this one replays on a render thread. Pooled frames are reused
+// once recycled, never while out for replay.
 struct DeferredFrame
 {
     std::vector<uint8_t> commands, blobs;       // 2D ordered stream
@@ -84,6 +86,17 @@ struct DeferredFrame
     ore::ReplayCaps oreCaps;
 };
 
+// Everything a frame holds besides its byte streams. Assigned rather than
+// constructed so a reused frame's containers keep their capacity.
+inline void snapshotFrameTables(DeferredSession& session, DeferredFrame& f)
+{
+    f.canvasImages = session.canvases().images();
+    f.contentCanvases = session.contentCanvases();
+    f.oreReals = session.oreContext().realResources();
+    f.segments = session.schedulerSegments();
+    f.oreCaps = session.oreContext().caps();
+}
+
 inline DeferredFrame snapshotFrame(DeferredSession& session)
 {
     // An errored script can leave a canvas range open; close it before the
@@ -97,11 +110,7 @@ inline DeferredFrame snapshotFrame(DeferredSession& session)
     f.blobs = copy(session.commandBuffer().blobBytes());
     f.oreCommands = copy(session.oreContext().stream().commandBytes());
     f.oreBlobs = copy(session.oreContext().stream().blobBytes());
-    f.canvasImages = session.canvases().images();
-    f.contentCanvases = session.contentCanvases();
-    f.oreReals = session.oreContext().realResources();
-    f.segments = session.schedulerSegments();
-    f.oreCaps = session.oreContext().caps();
+    snapshotFrameTables(session, f);
     return f;
 }
 
@@ -116,6 +125,90 @@ inline DeferredFrame takeFrame(DeferredSession& session)
     return frame;
 }
 
+// Zero copy form of the above: the session's streams swap into frame, and the
+// session records the next frame into the buffers frame held. Handing the
+// same frames back each time keeps every buffer's capacity, so steady state
+// frames neither copy nor allocate stream bytes.
+inline void takeFrame(DeferredSession& session, DeferredFrame& frame)
+{
+    session.closeOpenRange();
+    session.commandBuffer().swapBytes(frame.commands, frame.blobs);
+    session.oreContext().swapStreamBytes(frame.oreCommands, frame.oreBlobs);
+    snapshotFrameTables(session, frame);
+    session.resetFrame();
+}
+
+// N buffered frames cycled between a producer and a replay thread. The
+// producer takes each recorded frame into a free pooled frame and the replay
+// side recycles it once replayed, so the N frames and the session's own
+// buffers rotate without copying. Taking and recycling may run on different
+// threads; a taken frame belongs to its taker until recycled.
+class DeferredFramePool
+{
+public:
+    explicit DeferredFramePool(size_t frameCount = 2) : m_frames(frameCount)
+    {
+        assert(frameCount != 0);
+        m_free.reserve(frameCount);
+        for (DeferredFrame& frame : m_frames)
+        {
+            m_free.push_back(&frame);
+        }
+    }
+
+    DeferredFramePool(const DeferredFramePool&) = delete;
+    DeferredFramePool& operator=(const DeferredFramePool&) = delete;
+
+    // Take the session's recorded frame and reset the session. Null when
+    // every frame is still out for replay: the producer is N frames ahead and
+    // must wait, or fall back to the copying takeFrame.
+    DeferredFrame* takeFrame(DeferredSession& session)
+    {
+        DeferredFrame* frame = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_free.empty())
+            {
+                return nullptr;
+            }
+            frame = m_free.back();
+            m_free.pop_back();
+        }
+        cmd::takeFrame(session, *frame);
+        return frame;
+    }
+
+    // Hand a replayed frame back. Its resource references drop here rather
+    // than when the frame is next taken, so a frame sitting in the pool keeps
+    // nothing alive; its byte buffers keep their capacity for the session.
+    void recycle(DeferredFrame* frame)
+    {
+        assert(frame >= m_frames.data() &&
+               frame < m_frames.data() + m_frames.size());
+        frame->canvasImages.clear();
+        frame->contentCanvases.clear();
+        frame->oreReals.clear();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        assert(std::find(m_free.begin(), m_free.end(), frame) ==
+               m_free.end());
+        m_free.push_back(frame);
+    }
+
+    size_t frameCount() const { return m_frames.size(); }
+
+    size_t framesInFlight() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_frames.size() - m_free.size();
+    }
+
+private:
+    std::vector<DeferredFrame> m_frames; // never resized once built
+    // Most recently recycled last, so the warmest buffers are reused first.
+    std::vector<DeferredFrame*> m_free;
+    mutable std::mutex m_mutex;
+};
+
 class DeferredReplayer
 {
 public:
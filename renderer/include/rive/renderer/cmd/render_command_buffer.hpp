@@ -30,6 +30,17 @@
 namespace rive::cmd
 {
 
+// Mutations the deferred resources kept out of the stream because the
+// consumer already holds their result. Counts one frame; reset() clears it, so
+// read it before the frame boundary.
+struct ElisionStats
+{
+    uint32_t pathRebuilds = 0; // rewinds rebuilt to the geometry replay has
+    uint32_t pathSets = 0;     // fill rule sets to the current value
+    uint32_t paintSets = 0;    // paint sets to the current value
+    uint64_t bytes = 0;        // command and blob bytes not recorded
+};
+
 class RenderCommandBuffer : public CommandByteStream
 {
 public:
@@ -100,6 +111,7 @@ public:
     void reset()
     {
         clearBytes();
+        m_elision = ElisionStats{};
         m_frameId++;
     }
 
@@ -108,10 +120,14 @@ public:
     // mutation of a new frame reuses the live replay object in place.
     uint32_t frameId() const { return m_frameId; }
 
+    const ElisionStats& elisionStats() const { return m_elision; }
+    ElisionStats& elisionStats() { return m_elision; }
+
 private:
     RecordingThread m_recordingThread;
     std::mutex m_destroyMutex;
     std::vector<PendingDestroy> m_pendingDestroys;
+    ElisionStats m_elision;
     uint32_t m_frameId = 0;
 };
 
@@ -356,6 +356,12 @@ public:
                                       uint32_t* tessVertexCount,
                                       uint32_t* tessBaseVertex);
 
+    // Writes out the contours and cubics that LogicalFlush::
+    // pushTessellationData() laid out for this draw. Only reads state that was
+    // finalized when the draw was built, so the LogicalFlush may call it from
+    // a worker thread.
+    virtual void writeTessellationData(RenderContext::TessellationWriter*);
+
     void releaseRefs() override;
 
 protected:
@@ -372,6 +378,34 @@ protected:
     // the caller.
     void initForInteriorTriangulation(RenderContext*, GrInnerFanTriangulator*);
 
+    // Totals counted by initForMidpointFan(), alongside its arrays. They get
+    // stored in the TessellationCache along with the arrays.
+    struct MidpointFanCounts
+    {
+        size_t contourCount;
+        size_t chopCount;
+        size_t chopVertexCount;
+        size_t paddedCurveCount;
+        size_t paddedRotationCount;
+        size_t lineCount;
+        size_t unpaddedCurveCount;
+        size_t unpaddedRotationCount;
+        size_t emptyStrokeCountForCaps;
+        size_t tessVertexCount;
+    };
+
+    // Sets m_resourceCounts, and the debug consistency counters, once the
+    // midpoint-fan arrays are ready.
+    void finishMidpointFan(const MidpointFanCounts&);
+
+    // Copies this draw's midpoint-fan arrays into the TessellationCache, or
+    // back out of it into this frame's allocators.
+    void storeMidpointFanInCache(TessellationCache&,
+                                 const TessellationCache::Key&,
+                                 const MidpointFanCounts&,
+                                 double buildSeconds);
+    void restoreMidpointFanFromCache(RenderContext*, Span<const uint8_t>);
+
     uint32_t allocateTessellationVertices(RenderContext::LogicalFlush* flush,
                                           uint32_t tessVertexCount)
     {
@@ -389,8 +423,8 @@ protected:
         uint32_t tessLocation,
         gpu::ShaderMiscFlags = gpu::ShaderMiscFlags::none);
 
-    // Pushes TessVertexSpans that will tessellate this PathDraw at the given
-    // location.
+    // Lays out the forward and mirrored tessellations of this PathDraw at the
+    // given location, and hands them to LogicalFlush::pushTessellationData().
     void pushTessellationData(RenderContext::LogicalFlush*,
                               uint32_t tessVertexCount,
                               uint32_t tessLocation);
@@ -426,12 +460,12 @@ protected:
     uint32_t m_contourFlags = 0;
 
     // Only used when rendering coverage via the feather atlas.
-    gpu::AtlasTransform m_featherAtlasTransform;
+    gpu::AtlasTransform m_featherAtlasTransform = {};
     AABBu16 m_featherAtlasScissor; // Scissor rect when rendering to the atlas.
     bool m_featherAtlasScissorEnabled;
 
     // clockwiseAtomic only.
-    gpu::CoverageBufferRange m_coverageBufferRange;
+    gpu::CoverageBufferRange m_coverageBufferRange = {};
 
     GrInnerFanTriangulator* m_triangulator = nullptr;
     bool m_triangulatorReverseTriangles = false;
@@ -34,6 +34,9 @@ public:
 
     size_t pushCount() const { return m_end - m_array; }
 
+    // Everything pushed since the last rewind, in order.
+    const T* pushData() const { return m_array; }
+
     T& push_back()
     {
         assert(m_end < m_array + m_capacity);
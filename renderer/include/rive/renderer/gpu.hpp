@@ -1894,6 +1894,14 @@ public:
     }
     void skip_back() { push(); }
 
+    // Reserves the next "count" items and returns a separate block for just
+    // those items. Blocks reserved this way don't overlap, so they may be
+    // written from different threads.
+    WriteOnlyMappedMemory push_back_range(size_t count)
+    {
+        return WriteOnlyMappedMemory(push(count), count);
+    }
+
 private:
     RIVE_ALWAYS_INLINE T& push()
     {
@@ -461,6 +461,13 @@ public:
 
     const OreCommandBuffer& stream() const { return m_render; }
 
+    // Frame handoff only; see CommandByteStream::swapBytes.
+    void swapStreamBytes(std::vector<uint8_t>& commands,
+                         std::vector<uint8_t>& blobs)
+    {
+        m_render.swapBytes(commands, blobs);
+    }
+
 private:
     // The replay device's capabilities are the ones a recording script has to
     // see: it is the device the recorded branch will run on. Copied rather
@@ -14,6 +14,7 @@
 #include "rive/renderer/render_target.hpp"
 #include "rive/renderer/shader_compilation_mode.hpp"
 #include "rive/renderer/sk_rectanizer_skyline.hpp"
+#include "rive/renderer/tessellation_cache.hpp"
 #include "rive/renderer/trivial_block_allocator.hpp"
 #include "rive/renderer/triangulation_controller.hpp"
 #include "rive/shapes/paint/color.hpp"
@@ -158,6 +159,50 @@ public:
         return m_triangulationController;
     }
 
+    // Holds the tessellation counts of midpoint-fan paths across frames, so
+    // paths drawn the same way as last frame skip recounting. Its stats()
+    // report the hit rate and the CPU time hits have saved.
+    TessellationCache& tessellationCache() { return m_tessellationCache; }
+
+    // Maximum number of threads, including the one that calls flush(), that
+    // write out the tessellation data of a flush. When it's more than 1,
+    // PathDraws queue their tessellations as the draw list gets built, and
+    // each LogicalFlush writes them out in parallel chunks at the end of
+    // writeResources(), borrowing workers from the global WorkPool. The
+    // mapped buffers come out byte-for-byte the same either way. Defaults to 1.
+    //
+    // Requires WITH_RIVE_THREADING (premake --with_rive_threading): the count
+    // is capped at the global WorkPool's workers plus the calling thread, so
+    // without threading it stays at 1. Size the pool with
+    // setGlobalWorkPoolThreadCount() before calling this to go past its
+    // default thread count.
+    void setTessellationThreadCount(uint32_t);
+    uint32_t tessellationThreadCount() const
+    {
+        return m_tessellationThreadCount;
+    }
+
+    // TessVertexSpans thrown away, since this context was created, because a
+    // draw wrote more than the space reserved for it. This should always be 0;
+    // anything else is a bug in the upper bounds, and the affected paths were
+    // drawn with missing curves rather than writing past the buffer.
+    size_t droppedTessSpanCount() const { return m_droppedTessSpanCount; }
+
+#ifdef TESTING
+    // Replaces the upper bound on the span count of each pending tessellation
+    // (multithreaded tessellation only), so tests can write a tessellation
+    // right at, or past, its bound. 0 restores the real bounds.
+    void testing_overrideMaxTessSpanCount(size_t count)
+    {
+        m_testingMaxTessSpanCount = count;
+    }
+    // TessVertexSpans written by the last writePendingTessellations().
+    size_t testing_pendingTessSpanCount() const
+    {
+        return m_testingPendingTessSpanCount;
+    }
+#endif
+
     const FrameDescriptor& frameDescriptor() const
     {
         assert(m_didBeginFrame);
@@ -421,6 +466,7 @@ private:
     double m_lastResourceTrimTimeInSeconds;
 
     TriangulationController m_triangulationController;
+    TessellationCache m_tessellationCache;
 
     // Per-frame state.
     FrameDescriptor m_frameDescriptor;
@@ -460,10 +506,33 @@ private:
 
     // Used by LogicalFlushes for re-ordering high level draws.
     std::vector<DrawSortEntry> m_indirectDrawList;
+    std::vector<DrawSortEntry> m_indirectDrawListScratch;
     std::unique_ptr<IntersectionBoard> m_intersectionBoard;
     std::unordered_map<AABBu16, int16_t, ScissorAABBHasher> m_scissorIDLookup;
     int16_t m_prevScissorID = 0;
 
+    // A contiguous run of a LogicalFlush's pending tessellations. Each chunk
+    // writes its TessVertexSpans to its own staging buffer on one thread, then
+    // copies them into the range of m_tessSpanData reserved for it.
+    struct TessellationChunk
+    {
+        size_t firstTessellation;
+        size_t endTessellation;
+        size_t maxTessSpanCount;
+        size_t tessSpanCount;
+        size_t droppedTessSpanCount;
+        std::vector<gpu::TessVertexSpan> stagingTessSpans;
+        WriteOnlyMappedMemory<gpu::TessVertexSpan> mappedTessSpans;
+    };
+
+    uint32_t m_tessellationThreadCount = 1;
+    std::vector<TessellationChunk> m_tessellationChunks;
+    size_t m_droppedTessSpanCount = 0;
+#ifdef TESTING
+    size_t m_testingMaxTessSpanCount = 0;
+    size_t m_testingPendingTessSpanCount = 0;
+#endif
+
     WriteOnlyMappedMemory<gpu::FlushUniforms> m_flushUniformData;
     WriteOnlyMappedMemory<gpu::PathData> m_pathData;
     WriteOnlyMappedMemory<gpu::PaintData> m_paintData;
@@ -731,19 +800,20 @@ private:
         // pushMidpointFanDraw() or pushOuterCubicsDraw().
         [[nodiscard]] uint32_t pushPath(const PathDraw* draw);
 
-        // Pushes a contour record to the GPU that references the given path.
-        //
-        // "vertexIndex0" is the index within the tessellation where the first
-        // vertex of the contour resides. Shaders need this when the contour is
-        // closed.
+        // Reserves the given PathDraw's contour records and writes them out,
+        // along with the TessVertexSpans that tessellate it at the given
+        // locations. (See TessellationWriter.)
         //
-        // Returns a unique 16-bit "contourID" handle for this specific record.
-        // This ID may be or-ed with '*_CONTOUR_FLAG' bits from constants.glsl.
-        [[nodiscard]] uint32_t pushContour(uint32_t pathID,
-                                           Vec2D midpoint,
-                                           bool isStroke,
-                                           bool closed,
-                                           uint32_t vertexIndex0);
+        // If the context writes tessellation on multiple threads, the data
+        // doesn't get written until the end of writeResources(). Either way it
+        // lands at the same place in the mapped buffers.
+        void pushTessellationData(PathDraw*,
+                                  uint32_t pathID,
+                                  gpu::ContourDirections,
+                                  uint32_t forwardTessVertexCount,
+                                  uint32_t forwardTessLocation,
+                                  uint32_t mirroredTessVertexCount,
+                                  uint32_t mirroredTessLocation);
 
         // Writes padding vertices to the tessellation texture, with an invalid
         // contour ID that is guaranteed to not be the same ID as any neighbors.
@@ -827,6 +897,9 @@ private:
         // any reads that use it.
         void tightenClipBounds();
 
+        // Writes out m_pendingTessellations in parallel chunks.
+        void writePendingTessellations();
+
         // Adds a batch to the list of draws that use a dstBarrier.
         void addBatchToDstBarrierList(DrawBatch* batch)
         {
@@ -908,6 +981,25 @@ private:
         uint32_t m_featherAtlasMaxY = 0;
         std::vector<PathDraw*> m_pendingFeatherAtlasDraws;
 
+        // A tessellation laid out by pushTessellationData() whose data doesn't
+        // get written until writePendingTessellations(). (Multithreaded
+        // tessellation only.)
+        struct PendingTessellation
+        {
+            PathDraw* draw;
+            uint32_t pathID;
+            gpu::ContourDirections contourDirections;
+            uint32_t forwardTessVertexCount;
+            uint32_t forwardTessLocation;
+            uint32_t mirroredTessVertexCount;
+            uint32_t mirroredTessLocation;
+            uint32_t firstContourID;
+            WriteOnlyMappedMemory<gpu::ContourData> contourData;
+            // Upper bound on the number of TessVertexSpans it writes.
+            size_t maxTessSpanCount;
+        };
+        std::vector<PendingTessellation> m_pendingTessellations;
+
         // Total coverage allocated via allocateCoverageBufferRange().
         // (clockwiseAtomic mode only.)
         uint32_t m_coverageBufferLength = 0;
@@ -944,7 +1036,15 @@ private:
         // & mirroredTessVertexCount must both be equal, and
         // forwardTessLocation & mirroredTessLocation must both be valid.
         // Otherwise, one span or the other may be empty.
+        //
+        // TessVertexSpans get appended to tessSpanData. contourData is the
+        // block of contour records reserved for the path, whose first record
+        // has the ID firstContourID. Every record in it must get pushed.
         TessellationWriter(LogicalFlush* flush,
+                           WriteOnlyMappedMemory<gpu::TessVertexSpan>&
+                               tessSpanData,
+                           WriteOnlyMappedMemory<gpu::ContourData> contourData,
+                           uint32_t firstContourID,
                            uint32_t pathID,
                            gpu::ContourDirections,
                            uint32_t forwardTessVertexCount,
@@ -966,8 +1066,12 @@ private:
                        : m_pathMirroredTessLocation - 1;
         }
 
-        // Wrapper around LogicalFlush::pushContour(), with an additional
-        // padding option.
+        // Writes the next contour record, which references this writer's path.
+        // Its vertexIndex0 is nextVertexIndex(), which shaders need when the
+        // contour is closed.
+        //
+        // Returns a unique 16-bit "contourID" handle for this specific record.
+        // This ID may be or-ed with '*_CONTOUR_FLAG' bits from constants.glsl.
         //
         // The first curve of the contour will be pre-padded with
         // 'paddingVertexCount' tessellation vertices, colocated at T=0. The
@@ -1042,9 +1146,33 @@ private:
             uint32_t joinSegmentCount,
             uint32_t contourIDWithFlags);
 
+        // Spans that didn't fit in tessSpanData and were not written.
+        size_t droppedTessSpanCount() const { return m_droppedTessSpanCount; }
+
     private:
+        // Writes a TessVertexSpan if tessSpanData has room for it. Its size
+        // comes from upper bounds worked out before anything was written, so
+        // this is checked in release builds too: a wrong bound costs curves
+        // rather than memory past the end of the buffer.
+        template <typename... Args>
+        RIVE_ALWAYS_INLINE void pushTessSpan(Args&&... args)
+        {
+            if (m_tessSpanData.hasRoomFor(1))
+            {
+                m_tessSpanData.set_back(std::forward<Args>(args)...);
+            }
+            else
+            {
+                ++m_droppedTessSpanCount;
+            }
+        }
+
         LogicalFlush* const m_flush;
         WriteOnlyMappedMemory<gpu::TessVertexSpan>& m_tessSpanData;
+        size_t m_droppedTessSpanCount = 0;
+        WriteOnlyMappedMemory<gpu::ContourData> m_contourData;
+        // ID of the next contour record pushed.
+        uint32_t m_nextContourID;
         const uint32_t m_pathID;
         const gpu::ContourDirections m_contourDirections;
         uint32_t m_pathTessLocation;
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#pragma once
+
+#include "rive/span.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace rive::gpu
+{
+// Keeps the CPU-side tessellation counts of midpoint-fan PathDraws alive across
+// frames, so a path drawn the same way as in a previous frame can skip the
+// Wang's formula, chopping, and segment counting of initForMidpointFan().
+//
+// The cache only manages bytes; PathDraw decides what goes in them. Entries are
+// evicted least recently used first once they exceed budgetInBytes().
+//
+// Geometry is only cached the second frame in a row it gets drawn, so paths
+// that change every frame (animations, feathering copies, etc.) never churn
+// the cache or pay for copying their data into it.
+class TessellationCache
+{
+public:
+    constexpr static size_t kDefaultBudgetInBytes = 16 * 1024 * 1024;
+
+    // Everything initForMidpointFan() reads besides the path itself. The
+    // counts are translation-invariant, so only the 2x2 of the paint matrix
+    // participates.
+    struct Key
+    {
+        uint64_t rawPathMutationID;
+        float matrix2x2[4];
+        float strokeRadius;
+        float featherRadius;
+        uint8_t strokeJoin;
+        uint8_t strokeCap;
+
+        bool operator==(const Key&) const;
+    };
+
+    struct Stats
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t insertions = 0;
+        size_t evictions = 0;
+        // Sum of the time each hit's data originally took to build, i.e., the
+        // CPU time hits have saved over recomputing.
+        double secondsSaved = 0;
+
+        float hitRate() const
+        {
+            size_t lookups = hits + misses;
+            return lookups != 0 ? static_cast<float>(hits) / lookups : 0;
+        }
+    };
+
+    TessellationCache() = default;
+    TessellationCache(const TessellationCache&) = delete;
+    TessellationCache& operator=(const TessellationCache&) = delete;
+
+    // Evicts entries until the cache fits in the new budget. 0 disables
+    // caching.
+    void setBudgetInBytes(size_t);
+    size_t budgetInBytes() const { return m_budgetInBytes; }
+    size_t bytesUsed() const { return m_bytesUsed; }
+    size_t entryCount() const { return m_entries.size(); }
+
+    // Returns the data stored for key and marks it most recently used, or an
+    // empty span on a miss.
+    Span<const uint8_t> find(const Key&);
+
+    // Called after a miss. Returns whether the data about to be built for key
+    // should be timed and inserted.
+    bool shouldInsert(const Key&);
+
+    // Returns sizeInBytes of storage for key's data, which the caller fills
+    // in. buildSeconds is what a future hit will count as saved. Returns null
+    // if the data would not fit in the budget.
+    uint8_t* insert(const Key&, size_t sizeInBytes, double buildSeconds);
+
+    // Ages the sightings that shouldInsert() admits on.
+    void endFrame();
+
+    // Drops every entry. Stats are left alone.
+    void clear();
+
+    const Stats& stats() const { return m_stats; }
+    void resetStats() { m_stats = Stats(); }
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const Key&) const;
+    };
+
+    struct Entry
+    {
+        Key key;
+        std::unique_ptr<uint8_t[]> data;
+        size_t sizeInBytes;
+        double buildSeconds;
+    };
+
+    void evictDownTo(size_t budgetInBytes);
+
+    size_t m_budgetInBytes = kDefaultBudgetInBytes;
+    size_t m_bytesUsed = 0;
+
+    // Most recently used at the front.
+    std::list<Entry> m_lru;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_entries;
+
+    // Keys that missed this frame and the one before.
+    std::unordered_set<Key, KeyHash> m_sightings;
+    std::unordered_set<Key, KeyHash> m_prevSightings;
+
+    Stats m_stats;
+};
+} // namespace rive::gpu
@@ -16,6 +16,7 @@
 #include "shaders/constants.glsl"
 #include "rive/profiler/profiler_macros.h"
 #include <cmath>
+#include <iterator>
 
 namespace rive::gpu
 {
@@ -812,6 +813,30 @@ void PathDraw::initForMidpointFan(RenderContext* context,
         m_strokeCap = paint->getCap();
     }
 
+    // Everything below only depends on the path and the key, so if a previous
+    // frame drew this path the same way, copy out its results instead.
+    TessellationCache& tessCache = context->tessellationCache();
+    const TessellationCache::Key cacheKey = {
+        m_pathRef->getRawPathMutationID(),
+        {m_paintMatrix[0],
+         m_paintMatrix[1],
+         m_paintMatrix[2],
+         m_paintMatrix[3]},
+        m_strokeRadius,
+        m_featherRadius,
+        isStrokeOrFeather() ? static_cast<uint8_t>(m_strokeJoin) : uint8_t(0),
+        isStrokeOrFeather() ? static_cast<uint8_t>(m_strokeCap) : uint8_t(0),
+    };
+    Span<const uint8_t> cachedData = tessCache.find(cacheKey);
+    if (!cachedData.empty())
+    {
+        restoreMidpointFanFromCache(context, cachedData);
+        return;
+    }
+    const bool cacheAfterBuild = tessCache.shouldInsert(cacheKey);
+    const double buildStart =
+        cacheAfterBuild ? context->impl()->secondsNow() : 0;
+
     // Count up how much temporary storage this function will need to reserve in
     // CPU buffers.
     const RawPath& rawPath = m_pathRef->getRawPath();
@@ -1370,27 +1395,149 @@ void PathDraw::initForMidpointFan(RenderContext* context,
     }
 
     assert(contourFirstLineIdx == lineCount);
-    RIVE_DEBUG_CODE(m_pendingLineCount = lineCount);
-    RIVE_DEBUG_CODE(m_pendingCurveCount = unpaddedCurveCount);
-    RIVE_DEBUG_CODE(m_pendingRotationCount = unpaddedRotationCount);
-    RIVE_DEBUG_CODE(m_pendingEmptyStrokeCountForCaps = emptyStrokeCountForCaps);
+    const MidpointFanCounts counts = {
+        contourCount,
+        isStrokeOrFeather() ? m_numChops.pushCount() : 0,
+        isStrokeOrFeather() ? m_chopVertices.pushCount() : 0,
+        curveIdx,
+        rotationIdx,
+        lineCount,
+        unpaddedCurveCount,
+        unpaddedRotationCount,
+        emptyStrokeCountForCaps,
+        tessVertexCount,
+    };
+    finishMidpointFan(counts);
+
+    if (cacheAfterBuild)
+    {
+        storeMidpointFanInCache(tessCache,
+                                cacheKey,
+                                counts,
+                                context->impl()->secondsNow() - buildStart);
+    }
+}
+
+void PathDraw::finishMidpointFan(const MidpointFanCounts& counts)
+{
+    RIVE_DEBUG_CODE(m_pendingLineCount = counts.lineCount);
+    RIVE_DEBUG_CODE(m_pendingCurveCount = counts.unpaddedCurveCount);
+    RIVE_DEBUG_CODE(m_pendingRotationCount = counts.unpaddedRotationCount);
+    RIVE_DEBUG_CODE(m_pendingEmptyStrokeCountForCaps =
+                        counts.emptyStrokeCountForCaps);
 
-    if (tessVertexCount > 0)
+    if (counts.tessVertexCount > 0)
     {
         m_resourceCounts.pathCount = 1;
-        m_resourceCounts.contourCount = contourCount;
+        m_resourceCounts.contourCount = counts.contourCount;
         // maxTessellatedSegmentCount does not get doubled when we emit both
         // forward and mirrored contours because the forward and mirrored pair
         // both get packed into a single gpu::TessVertexSpan.
         m_resourceCounts.maxTessellatedSegmentCount =
-            lineCount + unpaddedCurveCount + emptyStrokeCountForCaps;
+            counts.lineCount + counts.unpaddedCurveCount +
+            counts.emptyStrokeCountForCaps;
         m_resourceCounts.midpointFanTessVertexCount =
             gpu::ContourDirectionsAreDoubleSided(m_contourDirections)
-                ? tessVertexCount * 2
-                : tessVertexCount;
+                ? counts.tessVertexCount * 2
+                : counts.tessVertexCount;
+    }
+}
+
+// Cached midpoint-fan data is laid out as a MidpointFanCounts header followed
+// by each of PathDraw's arrays, back to back, in the order below.
+//
+// NOTE: ContourInfo::endOfContour points into the path's RawPath. That stays
+// valid because a path can't mutate without getting a new mutation ID, and
+// mutation IDs never get reused.
+void PathDraw::storeMidpointFanInCache(TessellationCache& tessCache,
+                                       const TessellationCache::Key& cacheKey,
+                                       const MidpointFanCounts& counts,
+                                       double buildSeconds)
+{
+    const size_t sizes[] = {
+        sizeof(MidpointFanCounts),
+        sizeof(ContourInfo) * counts.contourCount,
+        sizeof(uint8_t) * counts.chopCount,
+        sizeof(Vec2D) * counts.chopVertexCount,
+        sizeof(*m_tangentPairs) * counts.paddedRotationCount,
+        sizeof(*m_polarSegmentCounts) * counts.paddedRotationCount,
+        sizeof(*m_parametricSegmentCounts) * counts.paddedCurveCount,
+    };
+    const void* sources[] = {
+        &counts,
+        m_contours,
+        m_numChops.pushData(),
+        m_chopVertices.pushData(),
+        m_tangentPairs,
+        m_polarSegmentCounts,
+        m_parametricSegmentCounts,
+    };
+    size_t totalSize = 0;
+    for (size_t size : sizes)
+    {
+        totalSize += size;
+    }
+    uint8_t* data = tessCache.insert(cacheKey, totalSize, buildSeconds);
+    if (data == nullptr)
+    {
+        return;
+    }
+    for (size_t i = 0; i < std::size(sizes); ++i)
+    {
+        if (sizes[i] != 0)
+        {
+            memcpy(data, sources[i], sizes[i]);
+            data += sizes[i];
+        }
     }
 }
 
+void PathDraw::restoreMidpointFanFromCache(RenderContext* context,
+                                           Span<const uint8_t> cachedData)
+{
+    const uint8_t* data = cachedData.data();
+    auto read = [&data](void* dst, size_t size) {
+        if (size != 0)
+        {
+            memcpy(dst, data, size);
+            data += size;
+        }
+    };
+
+    MidpointFanCounts counts;
+    read(&counts, sizeof(counts));
+
+    m_contours = reinterpret_cast<ContourInfo*>(
+        context->perFrameAllocator().alloc(sizeof(ContourInfo) *
+                                           counts.contourCount));
+    read(m_contours, sizeof(ContourInfo) * counts.contourCount);
+    if (isStrokeOrFeather())
+    {
+        m_numChops.reset(context->numChopsAllocator(), counts.chopCount);
+        read(m_numChops.push_back_n(counts.chopCount), counts.chopCount);
+        m_chopVertices.reset(context->chopVerticesAllocator(),
+                             counts.chopVertexCount);
+        read(m_chopVertices.push_back_n(counts.chopVertexCount),
+             sizeof(Vec2D) * counts.chopVertexCount);
+        m_tangentPairs =
+            context->tangentPairsAllocator().alloc(counts.paddedRotationCount);
+        read(m_tangentPairs,
+             sizeof(*m_tangentPairs) * counts.paddedRotationCount);
+        m_polarSegmentCounts = context->polarSegmentCountsAllocator().alloc(
+            counts.paddedRotationCount);
+        read(m_polarSegmentCounts,
+             sizeof(*m_polarSegmentCounts) * counts.paddedRotationCount);
+    }
+    m_parametricSegmentCounts =
+        context->parametricSegmentCountsAllocator().alloc(
+            counts.paddedCurveCount);
+    read(m_parametricSegmentCounts,
+         sizeof(*m_parametricSegmentCounts) * counts.paddedCurveCount);
+    assert(data == cachedData.data() + cachedData.size());
+
+    finishMidpointFan(counts);
+}
+
 void PathDraw::initForInteriorTriangulation(
     RenderContext* context,
     GrInnerFanTriangulator* triangulator)
@@ -1971,21 +2118,25 @@ void PathDraw::pushTessellationData(RenderContext::LogicalFlush* flush,
     }
 
     // Write out the TessVertexSpans and path contours.
-    RenderContext::TessellationWriter tessWriter(flush,
-                                                 m_pathID,
-                                                 m_contourDirections,
-                                                 forwardTessVertexCount,
-                                                 forwardTessLocation,
-                                                 mirroredTessVertexCount,
-                                                 mirroredTessLocation);
+    flush->pushTessellationData(this,
+                                m_pathID,
+                                m_contourDirections,
+                                forwardTessVertexCount,
+                                forwardTessLocation,
+                                mirroredTessVertexCount,
+                                mirroredTessLocation);
+}
 
+void PathDraw::writeTessellationData(
+    RenderContext::TessellationWriter* tessWriter)
+{
     if (m_triangulator != nullptr)
     {
-        iterateOuterCubics(&tessWriter);
+        iterateOuterCubics(tessWriter);
     }
     else
     {
-        pushMidpointFanTessellationData(&tessWriter);
+        pushMidpointFanTessellationData(tessWriter);
     }
 }
 
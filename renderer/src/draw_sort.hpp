@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <cstring>
+#include <utility>
+
+namespace rive::gpu
+{
+// Stable sort of entries by their signed 64-bit "sortKey", for reordering
+// draws. An LSD radix sort over 8-bit digits: one pass over the keys builds
+// the histograms of all 8 digits, then each digit whose keys aren't all the
+// same scatters the entries into scratch and back. Draw sort keys leave most
+// digits constant in a typical frame (scissor IDs, texture hashes, subpass
+// indices...), so only a few scatter passes run.
+//
+// Short lists go through an insertion sort instead, which is also stable.
+//
+// scratch must have room for count entries. The sorted entries end up in
+// entries.
+template <typename T>
+void RadixSortBySortKey(T* entries, T* scratch, size_t count)
+{
+    constexpr static size_t kInsertionSortMaxCount = 64;
+    if (count <= kInsertionSortMaxCount)
+    {
+        for (size_t i = 1; i < count; ++i)
+        {
+            T entry = entries[i];
+            size_t j = i;
+            for (; j > 0 && entries[j - 1].sortKey > entry.sortKey; --j)
+            {
+                entries[j] = entries[j - 1];
+            }
+            entries[j] = entry;
+        }
+        return;
+    }
+
+    // Flip the sign bit so the keys order the same as unsigned integers.
+    constexpr static uint64_t kSignBit = 1ull << 63;
+    auto unsignedKey = [](const T& entry) {
+        return static_cast<uint64_t>(entry.sortKey) ^ kSignBit;
+    };
+
+    uint32_t histograms[8][256];
+    memset(histograms, 0, sizeof(histograms));
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t key = unsignedKey(entries[i]);
+        for (int digit = 0; digit < 8; ++digit)
+        {
+            ++histograms[digit][(key >> (digit * 8)) & 0xff];
+        }
+    }
+
+    T* src = entries;
+    T* dst = scratch;
+    uint64_t firstKey = unsignedKey(entries[0]);
+    for (int digit = 0; digit < 8; ++digit)
+    {
+        uint32_t* histogram = histograms[digit];
+        const uint32_t shift = digit * 8;
+        if (histogram[(firstKey >> shift) & 0xff] == count)
+        {
+            // Every key has the same value in this digit.
+            continue;
+        }
+        // Turn the counts into the offset of each bucket.
+        uint32_t offset = 0;
+        for (uint32_t bucket = 0; bucket < 256; ++bucket)
+        {
+            uint32_t bucketCount = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucketCount;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[histogram[(unsignedKey(src[i]) >> shift) & 0xff]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != entries)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            entries[i] = src[i];
+        }
+    }
+}
+} // namespace rive::gpu
@@ -17,6 +17,7 @@
 #include "rive/gpu_texture_format.hpp"
 #include "rive/renderer/stack_vector.hpp"
 #include "rive/profiler/profiler_macros.h"
+#include "rive/async/work_pool.hpp"
 
 #include "shaders/constants.glsl"
 
@@ -32,6 +33,7 @@
 #include "rive/decoders/decode_ktx2.hpp"
 #endif
 
+#include "draw_sort.hpp"
 #include "sort_key_builder.hpp"
 
 namespace rive::gpu
@@ -170,6 +172,16 @@ const gpu::PlatformFeatures& RenderContext::platformFeatures() const
     return m_impl->platformFeatures();
 }
 
+void RenderContext::setTessellationThreadCount(uint32_t threadCount)
+{
+    assert(!m_didBeginFrame);
+    // Without helpers in the pool (no WITH_RIVE_THREADING), the chunks would
+    // all run on this thread anyway, so don't pay for staging them.
+    m_tessellationThreadCount =
+        std::min(std::max(threadCount, 1u),
+                 getGlobalWorkPool()->threadCount() + 1);
+}
+
 rcp<RenderBuffer> RenderContext::makeRenderBuffer(RenderBufferType type,
                                                   RenderBufferFlags flags,
                                                   size_t sizeInBytes)
@@ -269,6 +281,7 @@ void RenderContext::releaseResources()
 {
     assert(!m_didBeginFrame);
     resetContainers();
+    m_tessellationCache.clear();
     setResourceSizes(ResourceAllocationCounts());
     m_maxRecentResourceRequirements = ResourceAllocationCounts();
     m_lastResourceTrimTimeInSeconds = m_impl->secondsNow();
@@ -288,6 +301,10 @@ void RenderContext::resetContainers()
 
     m_indirectDrawList.clear();
     m_indirectDrawList.shrink_to_fit();
+    m_indirectDrawListScratch.clear();
+    m_indirectDrawListScratch.shrink_to_fit();
+    m_tessellationChunks.clear();
+    m_tessellationChunks.shrink_to_fit();
 
     m_intersectionBoard = nullptr;
 }
@@ -340,6 +357,7 @@ void RenderContext::LogicalFlush::rewind()
     m_featherAtlasMaxX = 0;
     m_featherAtlasMaxY = 0;
     m_pendingFeatherAtlasDraws.clear();
+    m_pendingTessellations.clear();
 
     m_coverageBufferLength = 0;
 
@@ -372,6 +390,9 @@ void RenderContext::LogicalFlush::resetContainers()
     m_pendingComplexGradDraws.shrink_to_fit();
     m_pendingComplexGradDraws.reserve(kDefaultComplexGradientCapacity);
 
+    m_pendingTessellations.clear();
+    m_pendingTessellations.shrink_to_fit();
+
     m_pendingFeatherAtlasDraws.clear();
     m_pendingFeatherAtlasDraws.shrink_to_fit();
     // Don't reserve any space in m_pendingFeatherAtlasDraws since there are
@@ -777,6 +798,7 @@ void RenderContext::flush(const FlushResources& flushResources)
            m_frameDescriptor.renderTargetHeight);
 
     m_triangulationController.endFrame();
+    m_tessellationCache.endFrame();
 
     m_clipContentID = 0;
 
@@ -1888,15 +1910,17 @@ void RenderContext::LogicalFlush::writeResources()
         }
         assert(indirectDrawList.size() == m_drawPassCount);
 
-        // Re-order the draws
+        // Re-order the draws. The sort is stable, so draws with matching keys
+        // stay in drawIndex order.
         // TODO: If we have any overlappable draws, then we will actually need
         // to sort using the draw index as well (negatively to go front-to-back
         // for pre-passes and positively for standard passes). Otherwise, the
         // order of draws *within* a given sorted key does not matter at all.
-        std::sort(
-            indirectDrawList.begin(),
-            indirectDrawList.end(),
-            [](const auto& a, const auto& b) { return a.sortKey < b.sortKey; });
+        auto& scratch = m_ctx->m_indirectDrawListScratch;
+        scratch.resize(indirectDrawList.size());
+        RadixSortBySortKey(indirectDrawList.data(),
+                           scratch.data(),
+                           indirectDrawList.size());
 
         assert(m_pendingBarriers == BarrierFlags::none);
         if (m_ctx->frameInterlockMode() == gpu::InterlockMode::atomics &&
@@ -2342,6 +2366,10 @@ void RenderContext::LogicalFlush::writeResources()
                m_pendingFeatherAtlasDraws.size());
     }
 
+    // Every tessellation has been laid out. If they were queued up for
+    // multiple threads, write them now.
+    writePendingTessellations();
+
     // Pad our buffers to 256-byte alignment.
     m_ctx->m_pathData.push_back_n(nullptr, m_pathPaddingCount);
     m_ctx->m_paintData.push_back_n(nullptr, m_paintPaddingCount);
@@ -3076,8 +3104,178 @@ uint32_t RenderContext::LogicalFlush::pushPath(const PathDraw* draw)
     return m_currentPathID;
 }
 
+void RenderContext::LogicalFlush::pushTessellationData(
+    PathDraw* draw,
+    uint32_t pathID,
+    gpu::ContourDirections contourDirections,
+    uint32_t forwardTessVertexCount,
+    uint32_t forwardTessLocation,
+    uint32_t mirroredTessVertexCount,
+    uint32_t mirroredTessLocation)
+{
+    RIVE_PROF_SCOPE_L(2)
+    assert(m_hasDoneLayout);
+
+    // Reserve the contour records now, so contourIDs come out in draw order
+    // no matter which thread writes them.
+    uint32_t contourCount = math::lossless_numeric_cast<uint32_t>(
+        draw->resourceCounts().contourCount);
+    uint32_t firstContourID = m_currentContourID + 1;
+    m_currentContourID += contourCount;
+    assert(m_currentContourID <= gpu::kMaxContourID);
+    WriteOnlyMappedMemory<gpu::ContourData> contourData =
+        m_ctx->m_contourData.push_back_range(contourCount);
+    assert(m_flushDesc.firstContour + m_currentContourID ==
+           m_ctx->m_contourData.elementsWritten());
+
+    if (m_ctx->m_tessellationThreadCount <= 1)
+    {
+        TessellationWriter tessWriter(this,
+                                      m_ctx->m_tessSpanData,
+                                      contourData,
+                                      firstContourID,
+                                      pathID,
+                                      contourDirections,
+                                      forwardTessVertexCount,
+                                      forwardTessLocation,
+                                      mirroredTessVertexCount,
+                                      mirroredTessLocation);
+        draw->writeTessellationData(&tessWriter);
+        m_ctx->m_droppedTessSpanCount += tessWriter.droppedTessSpanCount();
+        return;
+    }
+
+    // Each cubic writes one TessVertexSpan, plus one more every time it wraps
+    // onto the next row of the tessellation texture. (Double-sided spans wrap
+    // when either side does.)
+    size_t maxTessSpanCount =
+        draw->resourceCounts().maxTessellatedSegmentCount +
+        forwardTessVertexCount / kTessTextureWidth + 1 +
+        mirroredTessVertexCount / kTessTextureWidth + 1;
+#ifdef TESTING
+    if (m_ctx->m_testingMaxTessSpanCount != 0)
+    {
+        maxTessSpanCount = m_ctx->m_testingMaxTessSpanCount;
+    }
+#endif
+    m_pendingTessellations.push_back({draw,
+                                      pathID,
+                                      contourDirections,
+                                      forwardTessVertexCount,
+                                      forwardTessLocation,
+                                      mirroredTessVertexCount,
+                                      mirroredTessLocation,
+                                      firstContourID,
+                                      contourData,
+                                      maxTessSpanCount});
+}
+
+void RenderContext::LogicalFlush::writePendingTessellations()
+{
+    RIVE_PROF_SCOPE_L(2)
+    if (m_pendingTessellations.empty())
+    {
+        return;
+    }
+    uint32_t threadCount = m_ctx->m_tessellationThreadCount;
+    assert(threadCount > 1);
+    rcp<WorkPool>& workPool = getGlobalWorkPool();
+
+    // Split the tessellations into contiguous chunks of about the same size.
+    // Make a few chunks per thread so one large path doesn't hold up the rest.
+    size_t totalMaxTessSpanCount = 0;
+    for (const PendingTessellation& tess : m_pendingTessellations)
+    {
+        totalMaxTessSpanCount += tess.maxTessSpanCount;
+    }
+    size_t targetChunkCount =
+        std::min<size_t>(threadCount * 4, m_pendingTessellations.size());
+    size_t chunkTessSpanCount =
+        (totalMaxTessSpanCount + targetChunkCount - 1) / targetChunkCount;
+
+    std::vector<TessellationChunk>& chunks = m_ctx->m_tessellationChunks;
+    size_t chunkCount = 0;
+    for (size_t i = 0; i < m_pendingTessellations.size();)
+    {
+        if (chunkCount == chunks.size())
+        {
+            chunks.emplace_back();
+        }
+        TessellationChunk& chunk = chunks[chunkCount++];
+        chunk.firstTessellation = i;
+        chunk.maxTessSpanCount = 0;
+        do
+        {
+            chunk.maxTessSpanCount +=
+                m_pendingTessellations[i++].maxTessSpanCount;
+        } while (i < m_pendingTessellations.size() &&
+                 chunk.maxTessSpanCount < chunkTessSpanCount);
+        chunk.endTessellation = i;
+    }
+
+    // Write each chunk's contours straight to their reserved records, and its
+    // TessVertexSpans to a staging buffer, since we don't know how many spans
+    // each one writes until it's done.
+    auto writeChunk = [&](size_t chunkIdx) {
+        TessellationChunk& chunk = chunks[chunkIdx];
+        chunk.droppedTessSpanCount = 0;
+        if (chunk.stagingTessSpans.size() < chunk.maxTessSpanCount)
+        {
+            chunk.stagingTessSpans.resize(chunk.maxTessSpanCount);
+        }
+        WriteOnlyMappedMemory<gpu::TessVertexSpan> tessSpanData(
+            chunk.stagingTessSpans.data(),
+            chunk.maxTessSpanCount);
+        for (size_t i = chunk.firstTessellation; i < chunk.endTessellation;
+             ++i)
+        {
+            const PendingTessellation& tess = m_pendingTessellations[i];
+            TessellationWriter tessWriter(this,
+                                          tessSpanData,
+                                          tess.contourData,
+                                          tess.firstContourID,
+                                          tess.pathID,
+                                          tess.contourDirections,
+                                          tess.forwardTessVertexCount,
+                                          tess.forwardTessLocation,
+                                          tess.mirroredTessVertexCount,
+                                          tess.mirroredTessLocation);
+            tess.draw->writeTessellationData(&tessWriter);
+            chunk.droppedTessSpanCount += tessWriter.droppedTessSpanCount();
+        }
+        chunk.tessSpanCount = tessSpanData.elementsWritten();
+    };
+    workPool->parallelFor(chunkCount, writeChunk, threadCount - 1);
+
+    // Reserve each chunk's range of the mapped buffer in draw order (a prefix
+    // sum over the span counts), then copy the chunks over in parallel.
+#ifdef TESTING
+    m_ctx->m_testingPendingTessSpanCount = 0;
+#endif
+    for (size_t i = 0; i < chunkCount; ++i)
+    {
+        chunks[i].mappedTessSpans =
+            m_ctx->m_tessSpanData.push_back_range(chunks[i].tessSpanCount);
+        m_ctx->m_droppedTessSpanCount += chunks[i].droppedTessSpanCount;
+#ifdef TESTING
+        m_ctx->m_testingPendingTessSpanCount += chunks[i].tessSpanCount;
+#endif
+    }
+    auto copyChunk = [&](size_t chunkIdx) {
+        TessellationChunk& chunk = chunks[chunkIdx];
+        chunk.mappedTessSpans.push_back_n(chunk.stagingTessSpans.data(),
+                                          chunk.tessSpanCount);
+    };
+    workPool->parallelFor(chunkCount, copyChunk, threadCount - 1);
+
+    m_pendingTessellations.clear();
+}
+
 RenderContext::TessellationWriter::TessellationWriter(
     LogicalFlush* flush,
+    WriteOnlyMappedMemory<gpu::TessVertexSpan>& tessSpanData,
+    WriteOnlyMappedMemory<gpu::ContourData> contourData,
+    uint32_t firstContourID,
     uint32_t pathID,
     gpu::ContourDirections contourDirections,
     uint32_t forwardTessVertexCount,
@@ -3085,7 +3283,9 @@ RenderContext::TessellationWriter::TessellationWriter(
     uint32_t mirroredTessVertexCount,
     uint32_t mirroredTessLocation) :
     m_flush(flush),
-    m_tessSpanData(m_flush->m_ctx->m_tessSpanData),
+    m_tessSpanData(tessSpanData),
+    m_contourData(contourData),
+    m_nextContourID(firstContourID),
     m_pathID(pathID),
     m_contourDirections(contourDirections),
     m_pathTessLocation(forwardTessLocation),
@@ -3112,29 +3312,8 @@ RenderContext::TessellationWriter::~TessellationWriter()
 {
     assert(m_pathTessLocation == m_expectedPathTessEndLocation);
     assert(m_pathMirroredTessLocation == m_expectedPathMirroredTessEndLocation);
-}
-
-uint32_t RenderContext::LogicalFlush::pushContour(uint32_t pathID,
-                                                  Vec2D midpoint,
-                                                  bool isStroke,
-                                                  bool closed,
-                                                  uint32_t vertexIndex0)
-{
-    RIVE_PROF_SCOPE_L(2)
-    assert(pathID != 0);
-    assert(isStroke || closed);
-
-    if (isStroke)
-    {
-        midpoint.x = closed ? 1 : 0;
-    }
-    m_ctx->m_contourData.emplace_back(midpoint, pathID, vertexIndex0);
-
-    ++m_currentContourID;
-    assert(0 < m_currentContourID && m_currentContourID <= gpu::kMaxContourID);
-    assert(m_flushDesc.firstContour + m_currentContourID ==
-           m_ctx->m_contourData.elementsWritten());
-    return m_currentContourID;
+    // Every reserved contour record got written.
+    assert(!m_contourData.hasRoomFor(1));
 }
 
 uint32_t RenderContext::TessellationWriter::pushContour(
@@ -3150,11 +3329,17 @@ uint32_t RenderContext::TessellationWriter::pushContour(
     // patch size. (See math::padding_to_align_up().)
     m_nextCubicPaddingVertexCount = paddingVertexCount;
 
-    return m_flush->pushContour(m_pathID,
-                                midpoint,
-                                isStroke,
-                                closed,
-                                nextVertexIndex());
+    assert(m_pathID != 0);
+    assert(isStroke || closed);
+    if (isStroke)
+    {
+        midpoint.x = closed ? 1 : 0;
+    }
+    m_contourData.emplace_back(midpoint, m_pathID, nextVertexIndex());
+
+    uint32_t contourID = m_nextContourID++;
+    assert(0 < contourID && contourID <= gpu::kMaxContourID);
+    return contourID;
 }
 
 void RenderContext::TessellationWriter::pushCubic(
@@ -3172,7 +3357,7 @@ void RenderContext::TessellationWriter::pushCubic(
     assert(0 <= polarSegmentCount && polarSegmentCount <= kMaxPolarSegments);
     assert(joinSegmentCount > 0);
     assert((contourIDWithFlags & CONTOUR_ID_MASK) ==
-           (m_flush->m_currentContourID & CONTOUR_ID_MASK));
+           ((m_nextContourID - 1) & CONTOUR_ID_MASK));
     // contourID can't be zero.
     assert((contourIDWithFlags & CONTOUR_ID_MASK) != 0);
     // contourID can't be out of range in the contour buffer. (Contour buffer
@@ -3273,15 +3458,15 @@ RIVE_ALWAYS_INLINE void RenderContext::TessellationWriter::
     int32_t x1 = x0 + totalVertexCount;
     for (;;)
     {
-        m_tessSpanData.set_back(pts,
-                                joinTangent,
-                                static_cast<float>(y),
-                                x0,
-                                x1,
-                                parametricSegmentCount,
-                                polarSegmentCount,
-                                joinSegmentCount,
-                                contourIDWithFlags);
+        pushTessSpan(pts,
+                     joinTangent,
+                     static_cast<float>(y),
+                     x0,
+                     x1,
+                     parametricSegmentCount,
+                     polarSegmentCount,
+                     joinSegmentCount,
+                     contourIDWithFlags);
         if (x1 > static_cast<int32_t>(kTessTextureWidth))
         {
             // The span was too long to fit on the current line. Wrap and draw
@@ -3319,15 +3504,15 @@ RIVE_ALWAYS_INLINE void RenderContext::TessellationWriter::
 
     for (;;)
     {
-        m_tessSpanData.set_back(pts,
-                                joinTangent,
-                                static_cast<float>(reflectionY),
-                                reflectionX0,
-                                reflectionX1,
-                                parametricSegmentCount,
-                                polarSegmentCount,
-                                joinSegmentCount,
-                                contourIDWithFlags);
+        pushTessSpan(pts,
+                     joinTangent,
+                     static_cast<float>(reflectionY),
+                     reflectionX0,
+                     reflectionX1,
+                     parametricSegmentCount,
+                     polarSegmentCount,
+                     joinSegmentCount,
+                     contourIDWithFlags);
         if (reflectionX1 < 0)
         {
             --reflectionY;
@@ -3364,18 +3549,18 @@ RIVE_ALWAYS_INLINE void RenderContext::TessellationWriter::
 
     for (;;)
     {
-        m_tessSpanData.set_back(pts,
-                                joinTangent,
-                                static_cast<float>(y),
-                                x0,
-                                x1,
-                                static_cast<float>(reflectionY),
-                                reflectionX0,
-                                reflectionX1,
-                                parametricSegmentCount,
-                                polarSegmentCount,
-                                joinSegmentCount,
-                                contourIDWithFlags);
+        pushTessSpan(pts,
+                     joinTangent,
+                     static_cast<float>(y),
+                     x0,
+                     x1,
+                     static_cast<float>(reflectionY),
+                     reflectionX0,
+                     reflectionX1,
+                     parametricSegmentCount,
+                     polarSegmentCount,
+                     joinSegmentCount,
+                     contourIDWithFlags);
         if (x1 > static_cast<int32_t>(kTessTextureWidth) || reflectionX1 < 0)
         {
             // Either the span or its reflection was too long to fit on the
@@ -3410,6 +3595,9 @@ void RenderContext::LogicalFlush::pushPaddingVertices(uint32_t count,
 
     constexpr static Vec2D kEmptyCubic[4]{};
     TessellationWriter(this,
+                       m_ctx->m_tessSpanData,
+                       /*contourData=*/{},
+                       /*firstContourID=*/0,
                        /*pathID=*/0,
                        gpu::ContourDirections::forward,
                        count,
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "rive/renderer/tessellation_cache.hpp"
+
+#include "rive/math/math_types.hpp"
+#include <cassert>
+#include <functional>
+
+namespace rive::gpu
+{
+bool TessellationCache::Key::operator==(const Key& that) const
+{
+    // Compare floats bitwise so the lookup is exactly as strict as the
+    // computation it skips.
+    for (int i = 0; i < 4; ++i)
+    {
+        if (math::bit_cast<uint32_t>(matrix2x2[i]) !=
+            math::bit_cast<uint32_t>(that.matrix2x2[i]))
+        {
+            return false;
+        }
+    }
+    return rawPathMutationID == that.rawPathMutationID &&
+           math::bit_cast<uint32_t>(strokeRadius) ==
+               math::bit_cast<uint32_t>(that.strokeRadius) &&
+           math::bit_cast<uint32_t>(featherRadius) ==
+               math::bit_cast<uint32_t>(that.featherRadius) &&
+           strokeJoin == that.strokeJoin && strokeCap == that.strokeCap;
+}
+
+size_t TessellationCache::KeyHash::operator()(const Key& key) const
+{
+    size_t h = std::hash<uint64_t>()(key.rawPathMutationID);
+    auto combine = [&h](uint32_t bits) {
+        h ^= std::hash<uint32_t>()(bits) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    };
+    for (float m : key.matrix2x2)
+    {
+        combine(math::bit_cast<uint32_t>(m));
+    }
+    combine(math::bit_cast<uint32_t>(key.strokeRadius));
+    combine(math::bit_cast<uint32_t>(key.featherRadius));
+    combine(key.strokeJoin << 8 | key.strokeCap);
+    return h;
+}
+
+void TessellationCache::setBudgetInBytes(size_t budgetInBytes)
+{
+    m_budgetInBytes = budgetInBytes;
+    evictDownTo(m_budgetInBytes);
+}
+
+Span<const uint8_t> TessellationCache::find(const Key& key)
+{
+    auto iter = m_entries.find(key);
+    if (iter == m_entries.end())
+    {
+        ++m_stats.misses;
+        return {};
+    }
+    auto entry = iter->second;
+    m_lru.splice(m_lru.begin(), m_lru, entry);
+    ++m_stats.hits;
+    m_stats.secondsSaved += entry->buildSeconds;
+    return {entry->data.get(), entry->sizeInBytes};
+}
+
+bool TessellationCache::shouldInsert(const Key& key)
+{
+    if (m_budgetInBytes == 0)
+    {
+        return false;
+    }
+    m_sightings.insert(key);
+    return m_prevSightings.count(key) != 0;
+}
+
+uint8_t* TessellationCache::insert(const Key& key,
+                                   size_t sizeInBytes,
+                                   double buildSeconds)
+{
+    assert(m_entries.find(key) == m_entries.end());
+    if (sizeInBytes > m_budgetInBytes)
+    {
+        return nullptr;
+    }
+    evictDownTo(m_budgetInBytes - sizeInBytes);
+    m_lru.push_front({key,
+                      std::unique_ptr<uint8_t[]>(new uint8_t[sizeInBytes]),
+                      sizeInBytes,
+                      buildSeconds});
+    m_entries.emplace(key, m_lru.begin());
+    m_bytesUsed += sizeInBytes;
+    ++m_stats.insertions;
+    return m_lru.front().data.get();
+}
+
+void TessellationCache::endFrame()
+{
+    std::swap(m_sightings, m_prevSightings);
+    m_sightings.clear();
+}
+
+void TessellationCache::clear()
+{
+    m_entries.clear();
+    m_lru.clear();
+    m_bytesUsed = 0;
+    m_sightings.clear();
+    m_prevSightings.clear();
+}
+
+void TessellationCache::evictDownTo(size_t budgetInBytes)
+{
+    while (m_bytesUsed > budgetInBytes)
+    {
+        assert(!m_lru.empty());
+        const Entry& entry = m_lru.back();
+        m_bytesUsed -= entry.sizeInBytes;
+        m_entries.erase(entry.key);
+        m_lru.pop_back();
+        ++m_stats.evictions;
+    }
+}
+} // namespace rive::gpu
@@ -0,0 +1,250 @@
+#include "rive/animation/hit_grid.hpp"
+#include "rive/shapes/shape.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+using namespace rive;
+
+// Aim for a couple of entries per cell, capped so huge scenes don't allocate
+// unbounded cell arrays.
+static constexpr float kEntriesPerCell = 2.0f;
+static constexpr int32_t kMaxCellsPerAxis = 128;
+
+static bool neverHit(const AABB& bounds)
+{
+    // Inverse logic so NaN bounds, which contain no point, are caught too.
+    return !(bounds.minX <= bounds.maxX && bounds.minY <= bounds.maxY);
+}
+
+static bool isFinite(const AABB& bounds)
+{
+    return std::isfinite(bounds.minX) && std::isfinite(bounds.minY) &&
+           std::isfinite(bounds.maxX) && std::isfinite(bounds.maxY);
+}
+
+static const IAABB kNoCells = {0, 0, -1, -1};
+
+uint32_t HitGrid::add(Shape* shape)
+{
+    auto entry = static_cast<uint32_t>(m_entries.size());
+    m_entries.push_back({shape, 0, 0, AABB(), kNoCells});
+    m_needsRebuild = true;
+    return entry;
+}
+
+void HitGrid::clear()
+{
+    m_entries.clear();
+    m_cells.clear();
+    m_unbounded.clear();
+    m_columns = m_rows = 0;
+    m_needsRebuild = true;
+}
+
+void HitGrid::update()
+{
+    if (m_needsRebuild)
+    {
+        for (auto& entry : m_entries)
+        {
+            entry.boundsVersion = entry.shape->worldBoundsVersion();
+            entry.bounds = entry.shape->worldBounds();
+        }
+        rebuild();
+        return;
+    }
+    for (uint32_t i = 0, count = static_cast<uint32_t>(m_entries.size());
+         i < count;
+         i++)
+    {
+        Entry& entry = m_entries[i];
+        uint32_t version = entry.shape->worldBoundsVersion();
+        if (version == entry.boundsVersion)
+        {
+            continue;
+        }
+        entry.boundsVersion = version;
+        AABB bounds = entry.shape->worldBounds();
+        if (bounds == entry.bounds)
+        {
+            continue;
+        }
+        if (m_needsRebuild)
+        {
+            entry.bounds = bounds;
+            continue;
+        }
+        bool fitsExtent = bounds.minX >= m_extent.minX &&
+                          bounds.minY >= m_extent.minY &&
+                          bounds.maxX <= m_extent.maxX &&
+                          bounds.maxY <= m_extent.maxY;
+        if (neverHit(bounds) || !isFinite(bounds) || fitsExtent)
+        {
+            remove(i);
+            entry.bounds = bounds;
+            insert(i);
+        }
+        else
+        {
+            // Moved out of the cells, resize them around the new extent once
+            // every other change has been read.
+            entry.bounds = bounds;
+            m_needsRebuild = true;
+        }
+    }
+    if (m_needsRebuild)
+    {
+        rebuild();
+    }
+}
+
+void HitGrid::rebuild()
+{
+    m_needsRebuild = false;
+    m_unbounded.clear();
+    m_extent = AABB::forExpansion();
+    size_t boundedCount = 0;
+    for (auto& entry : m_entries)
+    {
+        entry.cells = kNoCells;
+        if (!neverHit(entry.bounds) && isFinite(entry.bounds))
+        {
+            m_extent.expand(entry.bounds);
+            boundedCount++;
+        }
+    }
+    if (boundedCount == 0)
+    {
+        m_extent = AABB();
+        m_columns = m_rows = 1;
+    }
+    else
+    {
+        // Split the cells proportionally to the extent's aspect ratio.
+        float cellCount = std::max(boundedCount / kEntriesPerCell, 1.0f);
+        float width = std::max(m_extent.width(), 1.0f);
+        float height = std::max(m_extent.height(), 1.0f);
+        float columns = std::sqrt(cellCount * width / height);
+        m_columns = std::clamp(static_cast<int32_t>(std::ceil(columns)),
+                               1,
+                               kMaxCellsPerAxis);
+        m_rows =
+            std::clamp(static_cast<int32_t>(std::ceil(cellCount / m_columns)),
+                       1,
+                       kMaxCellsPerAxis);
+    }
+    m_inverseCellSize =
+        Vec2D(m_extent.width() > 0 ? m_columns / m_extent.width() : 0.0f,
+              m_extent.height() > 0 ? m_rows / m_extent.height() : 0.0f);
+    m_cells.resize(m_columns * m_rows);
+    for (auto& cell : m_cells)
+    {
+        cell.clear();
+    }
+    for (uint32_t i = 0, count = static_cast<uint32_t>(m_entries.size());
+         i < count;
+         i++)
+    {
+        insert(i);
+    }
+}
+
+IAABB HitGrid::cellsFor(const AABB& bounds) const
+{
+    // The same mapping as query() so a point inside the bounds always lands in
+    // one of the returned cells, even on a cell edge.
+    auto column = [this](float x) {
+        return std::clamp(static_cast<int32_t>(std::floor(
+                              (x - m_extent.minX) * m_inverseCellSize.x)),
+                          0,
+                          m_columns - 1);
+    };
+    auto row = [this](float y) {
+        return std::clamp(static_cast<int32_t>(std::floor(
+                              (y - m_extent.minY) * m_inverseCellSize.y)),
+                          0,
+                          m_rows - 1);
+    };
+    return {column(bounds.minX),
+            row(bounds.minY),
+            column(bounds.maxX),
+            row(bounds.maxY)};
+}
+
+void HitGrid::insert(uint32_t index)
+{
+    Entry& entry = m_entries[index];
+    if (neverHit(entry.bounds))
+    {
+        entry.cells = kNoCells;
+        return;
+    }
+    if (!isFinite(entry.bounds))
+    {
+        entry.cells = kNoCells;
+        m_unbounded.push_back(index);
+        return;
+    }
+    entry.cells = cellsFor(entry.bounds);
+    for (int32_t y = entry.cells.top; y <= entry.cells.bottom; y++)
+    {
+        for (int32_t x = entry.cells.left; x <= entry.cells.right; x++)
+        {
+            cell(x, y).push_back(index);
+        }
+    }
+}
+
+void HitGrid::remove(uint32_t index)
+{
+    Entry& entry = m_entries[index];
+    if (entry.cells.left > entry.cells.right)
+    {
+        auto itr = std::find(m_unbounded.begin(), m_unbounded.end(), index);
+        if (itr != m_unbounded.end())
+        {
+            *itr = m_unbounded.back();
+            m_unbounded.pop_back();
+        }
+        return;
+    }
+    for (int32_t y = entry.cells.top; y <= entry.cells.bottom; y++)
+    {
+        for (int32_t x = entry.cells.left; x <= entry.cells.right; x++)
+        {
+            auto& entries = cell(x, y);
+            auto itr = std::find(entries.begin(), entries.end(), index);
+            assert(itr != entries.end());
+            *itr = entries.back();
+            entries.pop_back();
+        }
+    }
+    entry.cells = kNoCells;
+}
+
+void HitGrid::query(Vec2D position, std::vector<uint32_t>& entries)
+{
+    m_queryStamp++;
+    auto visit = [&](uint32_t index) {
+        Entry& entry = m_entries[index];
+        if (entry.queryStamp != m_queryStamp && entry.bounds.contains(position))
+        {
+            entry.queryStamp = m_queryStamp;
+            entries.push_back(index);
+        }
+    };
+    for (auto index : m_unbounded)
+    {
+        visit(index);
+    }
+    if (m_cells.empty() || !m_extent.contains(position))
+    {
+        return;
+    }
+    IAABB cells = cellsFor(AABB(position, position));
+    for (auto index : cell(cells.left, cells.top))
+    {
+        visit(index);
+    }
+}
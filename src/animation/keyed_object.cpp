@@ -1,5 +1,6 @@
 #include "rive/animation/keyed_object.hpp"
 #include "rive/animation/keyed_property.hpp"
+#include "rive/animation/keyframe_interpolator.hpp"
 #include "rive/animation/linear_animation.hpp"
 #include "rive/artboard.hpp"
 #include "rive/layout_component.hpp"
@@ -105,6 +106,25 @@ void KeyedObject::apply(Artboard* artboard,
     }
 }
 
+void KeyedObject::resolve(Artboard* artboard,
+                          std::vector<ResolvedKeyedProperty>& resolved)
+{
+    Core* object = artboard->resolve(objectId());
+    if (object == nullptr)
+    {
+        return;
+    }
+    auto interpolatorHost = InterpolatorHost::from(object);
+    for (std::unique_ptr<KeyedProperty>& property : m_keyedProperties)
+    {
+        if (CoreRegistry::isCallback(property->propertyKey()))
+        {
+            continue;
+        }
+        resolved.push_back({property.get(), object, interpolatorHost, 0});
+    }
+}
+
 StatusCode KeyedObject::import(ImportStack& importStack)
 {
     auto importer = importStack.latest<LinearAnimationImporter>(
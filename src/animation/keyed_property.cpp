@@ -14,6 +14,7 @@ KeyedProperty::~KeyedProperty() {}
 
 void KeyedProperty::addKeyFrame(std::unique_ptr<KeyFrame> keyframe)
 {
+    m_keyFrameSeconds.push_back(keyframe->seconds());
     m_keyFrames.push_back(std::move(keyframe));
 }
 
@@ -22,11 +23,11 @@ int KeyedProperty::closestFrameIndex(float seconds, int exactOffset) const
     int mid = 0;
     float closestSeconds = 0;
     int start = 0;
-    auto numKeyFrames = static_cast<int>(m_keyFrames.size());
+    auto numKeyFrames = static_cast<int>(m_keyFrameSeconds.size());
     int end = numKeyFrames - 1;
 
     // If it's the last keyframe, we skip the binary search
-    if (seconds > m_keyFrames[end]->seconds())
+    if (seconds > m_keyFrameSeconds[end])
     {
         return end + 1;
     }
@@ -34,7 +35,7 @@ int KeyedProperty::closestFrameIndex(float seconds, int exactOffset) const
     while (start <= end)
     {
         mid = (start + end) >> 1;
-        closestSeconds = m_keyFrames[mid]->seconds();
+        closestSeconds = m_keyFrameSeconds[mid];
         if (closestSeconds < seconds)
         {
             start = mid + 1;
@@ -51,6 +52,36 @@ int KeyedProperty::closestFrameIndex(float seconds, int exactOffset) const
     return start;
 }
 
+int KeyedProperty::closestFrameIndex(float seconds, int* cursor) const
+{
+    // closestFrameIndex(seconds) is the first frame at or after seconds (or
+    // the frame count when seconds is past the last frame), so idx is the
+    // answer when it sits between the frame before it and itself.
+    auto numKeyFrames = static_cast<int>(m_keyFrameSeconds.size());
+    auto isClosest = [&](int idx) {
+        return (idx == numKeyFrames || seconds <= m_keyFrameSeconds[idx]) &&
+               (idx == 0 || m_keyFrameSeconds[idx - 1] < seconds);
+    };
+    int idx = *cursor;
+    if (idx >= 0 && idx <= numKeyFrames)
+    {
+        if (isClosest(idx))
+        {
+            return idx;
+        }
+        // Playing forward moves onto the next frame, backward the previous.
+        if (idx < numKeyFrames && isClosest(idx + 1))
+        {
+            return *cursor = idx + 1;
+        }
+        if (idx > 0 && isClosest(idx - 1))
+        {
+            return *cursor = idx - 1;
+        }
+    }
+    return *cursor = closestFrameIndex(seconds);
+}
+
 void KeyedProperty::reportKeyedCallbacks(KeyedCallbackReporter* reporter,
                                          uint32_t objectId,
                                          float secondsFrom,
@@ -100,11 +131,26 @@ void KeyedProperty::reportKeyedCallbacks(KeyedCallbackReporter* reporter,
 void KeyedProperty::apply(Core* object,
                           float seconds,
                           float mix,
-                          const LinearAnimationInstance* context)
+                          const LinearAnimationInstance* context,
+                          int* keyFrameCursor)
+{
+    apply(object,
+          InterpolatorHost::from(object),
+          seconds,
+          mix,
+          context,
+          keyFrameCursor);
+}
+
+void KeyedProperty::apply(Core* object,
+                          InterpolatorHost* interpolatorHost,
+                          float seconds,
+                          float mix,
+                          const LinearAnimationInstance* context,
+                          int* keyFrameCursor)
 {
     assert(!m_keyFrames.empty());
 
-    auto interpolatorHost = InterpolatorHost::from(object);
     auto actualMix = mix;
     if (interpolatorHost != nullptr &&
         interpolatorHost->overridesKeyedInterpolation(propertyKey()))
@@ -112,7 +158,9 @@ void KeyedProperty::apply(Core* object,
         actualMix = 1.0f;
     }
 
-    int idx = closestFrameIndex(seconds);
+    int idx = keyFrameCursor == nullptr
+                  ? closestFrameIndex(seconds)
+                  : closestFrameIndex(seconds, keyFrameCursor);
     int pk = propertyKey();
 
     if (idx == 0)
@@ -173,12 +221,14 @@ StatusCode KeyedProperty::onAddedDirty(CoreContext* context)
 StatusCode KeyedProperty::onAddedClean(CoreContext* context)
 {
     StatusCode code;
-    for (auto& keyframe : m_keyFrames)
+    for (size_t i = 0; i < m_keyFrames.size(); i++)
     {
+        auto& keyframe = m_keyFrames[i];
         if ((code = keyframe->onAddedClean(context)) != StatusCode::Ok)
         {
             return code;
         }
+        m_keyFrameSeconds[i] = keyframe->seconds();
     }
     return StatusCode::Ok;
 }
@@ -1,5 +1,6 @@
 #include "rive/animation/linear_animation.hpp"
 #include "rive/animation/keyed_object.hpp"
+#include "rive/animation/keyed_property.hpp"
 #include "rive/animation/keyed_callback_reporter.hpp"
 #include "rive/artboard.hpp"
 #include "rive/importers/artboard_importer.hpp"
@@ -84,6 +85,44 @@ void LinearAnimation::apply(Artboard* artboard,
     }
 }
 
+std::vector<ResolvedKeyedProperty> LinearAnimation::resolve(
+    Artboard* artboard) const
+{
+    std::vector<ResolvedKeyedProperty> resolved;
+    resolved.reserve(keyedPropertyCount());
+    for (const auto& object : m_KeyedObjects)
+    {
+        object->resolve(artboard, resolved);
+    }
+    return resolved;
+}
+
+void LinearAnimation::apply(std::vector<ResolvedKeyedProperty>& resolved,
+                            float time,
+                            float mix,
+                            const LinearAnimationInstance* context) const
+{
+    if (quantize())
+    {
+        float ffps = (float)fps();
+        time = std::floor(time * ffps) / ffps;
+    }
+    for (ResolvedKeyedProperty& property : resolved)
+    {
+        KeyedProperty::apply(property, time, mix, context);
+    }
+}
+
+size_t LinearAnimation::keyedPropertyCount() const
+{
+    size_t count = 0;
+    for (const auto& object : m_KeyedObjects)
+    {
+        count += object->numKeyedProperties();
+    }
+    return count;
+}
+
 StatusCode LinearAnimation::import(ImportStack& importStack)
 {
     auto artboardImporter =
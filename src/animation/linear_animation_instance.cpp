@@ -283,6 +283,18 @@ ScriptedInterpolator* LinearAnimationInstance::statefulInterpolator(
     return raw;
 }
 
+void LinearAnimationInstance::apply(float mix) const
+{
+    // The artboard instance's objects don't change once it's been created, so
+    // the keyed objects only need resolving once.
+    if (!m_isResolved)
+    {
+        m_resolvedProperties = m_animation->resolve(m_artboardInstance);
+        m_isResolved = true;
+    }
+    m_animation->apply(m_resolvedProperties, m_time, mix, this);
+}
+
 bool LinearAnimationInstance::advanceAndApply(float seconds)
 {
     RIVE_PROF_SCOPE_L(1)
@@ -73,6 +73,7 @@
 #include "rive/viewmodel/viewmodel.hpp"
 #include "rive/file.hpp"
 #include "rive/data_bind/data_context.hpp"
+#include <algorithm>
 #include <array>
 #include <memory>
 #include <unordered_map>
@@ -708,6 +709,8 @@ public:
     bool hasDownListener = false;
     bool hasUpListener = false;
     bool isOpaque = false;
+    // Entry in the state machine's hit grid, or -1 when this isn't indexed.
+    int32_t hitGridEntry = -1;
     Drawable* m_drawable;
     std::vector<ListenerGroup*> listeners;
 
@@ -726,7 +729,13 @@ public:
 #endif
             return;
         }
-        isHovered = hitType != ListenerType::exit && hitTest(position);
+        // Indexed shapes can only be hit when the grid found their bounds
+        // under the pointer, which skips building their hit test paths.
+        isHovered = hitType != ListenerType::exit &&
+                    (hitGridEntry < 0 ||
+                     m_stateMachineInstance->m_hitGrid.wasQueried(
+                         hitGridEntry)) &&
+                    hitTest(position);
 
         // // iterate all listeners associated with this hit shape
         if (isHovered)
@@ -1503,6 +1512,7 @@ HitResult StateMachineInstance::updateListeners(Vec2D position,
     {
         listenerGroup.get()->reset(pointerId);
     }
+    updateHitGrid(position);
     // Next prepare the event to set the common hover status for each group
     for (const auto& hitShape : m_hitComponents)
     {
@@ -1560,10 +1570,18 @@ bool StateMachineInstance::hitTest(Vec2D position) const
         }
     }
 
-    for (const auto& hitShape : m_hitComponents)
+    // Only the grid's candidates can contain the pointer, the order doesn't
+    // matter here as any hit will do.
+    updateHitGrid(position);
+    for (auto entry : m_hitGridCandidates)
+    {
+        if (m_hitGridComponents[entry]->hitTest(position))
+        {
+            return true;
+        }
+    }
+    for (auto hitShape : m_ungriddedHitComponents)
     {
-        // TODO: quick reject.
-
         if (hitShape->hitTest(position))
         {
             return true;
@@ -1572,6 +1590,38 @@ bool StateMachineInstance::hitTest(Vec2D position) const
     return false;
 }
 
+void StateMachineInstance::buildHitGrid()
+{
+    // The grid entries were added as their shapes were registered, sort out
+    // everything else.
+    std::vector<HitComponent*> gridded(m_hitGridComponents);
+    std::sort(gridded.begin(), gridded.end());
+    m_ungriddedHitComponents.clear();
+    for (const auto& hitComponent : m_hitComponents)
+    {
+        if (!std::binary_search(gridded.begin(),
+                                gridded.end(),
+                                hitComponent.get()))
+        {
+            m_ungriddedHitComponents.push_back(hitComponent.get());
+        }
+    }
+}
+
+void StateMachineInstance::updateHitGrid(Vec2D position) const
+{
+    if (m_worldBoundsChangeCounter !=
+            m_artboardInstance->worldBoundsChangeCounter() ||
+        m_hitGrid.needsRebuild())
+    {
+        m_worldBoundsChangeCounter =
+            m_artboardInstance->worldBoundsChangeCounter();
+        m_hitGrid.update();
+    }
+    m_hitGridCandidates.clear();
+    m_hitGrid.query(position, m_hitGridCandidates);
+}
+
 HitResult StateMachineInstance::pointerMove(Vec2D position,
                                             float timeStamp,
                                             int id)
@@ -1665,6 +1715,8 @@ void StateMachineInstance::addToHitLookup(
             shape->addFlags(PathFlags::neverDeferUpdate);
             shape->addDirt(ComponentDirt::Path, true);
             auto hs = std::make_unique<HitExpandable>(shape, shape, this);
+            hs->hitGridEntry = static_cast<int32_t>(m_hitGrid.add(shape));
+            m_hitGridComponents.push_back(hs.get());
             hitLookup[target] = hitShape = hs.get();
             m_hitComponents.push_back(std::move(hs));
         }
@@ -2078,6 +2130,7 @@ StateMachineInstance::StateMachineInstance(const StateMachine* machine,
         m_listenerGroups.push_back(std::move(textInputGroup));
     }
 #endif
+    buildHitGrid();
 
     // Initialize local instances of ScriptedObjects
     for (auto& scriptedOb : machine->scriptedObjects())
@@ -17,6 +17,8 @@
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/custom_property_trigger.hpp"
 #include "rive/dependency_sorter.hpp"
+#include "rive/generated/core_registry.hpp"
+#include "rive/math/bitwise.hpp"
 #include "rive/data_bind/data_bind.hpp"
 #include "rive/data_bind/data_bind_context.hpp"
 #include "rive/draw_rules.hpp"
@@ -65,6 +67,7 @@
 #endif
 #endif
 #include "rive/async/work_pool.hpp"
+#include "rive/batch_advancer.hpp"
 
 #include <set>
 #include <unordered_map>
@@ -152,6 +155,17 @@ Artboard::~Artboard()
     auto isVmObject = [&](Core* object) -> bool {
         return vmObjects.count(object) != 0;
     };
+    auto deleteObject = [&](Core* object) {
+        if (m_instanceArena != nullptr && m_instanceArena->owns(object))
+        {
+            // Its memory is released with the arena.
+            object->~Core();
+        }
+        else
+        {
+            delete object;
+        }
+    };
 
     // Second pass: delete non-VM objects.
     for (auto object : m_Objects)
@@ -164,7 +178,7 @@ Artboard::~Artboard()
         {
             continue;
         }
-        delete object;
+        deleteObject(object);
     }
     for (auto object : m_invalidObjects)
     {
@@ -176,7 +190,7 @@ Artboard::~Artboard()
         {
             continue;
         }
-        delete object;
+        deleteObject(object);
     }
 
     // Now release deferred ViewModelInstances after hierarchy components have
@@ -614,6 +628,10 @@ StatusCode Artboard::initialize()
             m_DrawTargets.push_back(static_cast<DrawTarget*>(*itr++));
         }
     }
+    if (!isInstance())
+    {
+        buildInstanceDataBindsIndex();
+    }
     initScriptedObjects();
     return StatusCode::Ok;
 }
@@ -898,6 +916,13 @@ void Artboard::sortDependencies()
     {
         component->m_GraphOrder = graphOrder++;
     }
+    // Components start out filthy without reporting it, so mark every one.
+    size_t count = m_DependencyOrder.size();
+    m_dirtyComponents.assign((count + 63) / 64, ~uint64_t(0));
+    if (count % 64 != 0)
+    {
+        m_dirtyComponents.back() = (uint64_t(1) << (count % 64)) - 1;
+    }
     m_Dirt |= ComponentDirt::Components;
 }
 
@@ -936,7 +961,16 @@ void Artboard::initScriptedObjects()
     }
 }
 
-void Artboard::pollAsyncWork() { rive_pollAsyncWork(); }
+void Artboard::pollAsyncWork()
+{
+    // Async work is delivered on the main thread only; a BatchAdvancer polls
+    // once before its workers start.
+    if (BatchAdvancer::isAdvancingThread())
+    {
+        return;
+    }
+    rive_pollAsyncWork();
+}
 
 void Artboard::advanceScriptedViewModels()
 {
@@ -995,6 +1029,15 @@ void Artboard::onComponentDirty(Component* component)
     {
         m_DirtDepth = component->graphOrder();
     }
+
+    // Components outside of the dependency graph (and components marked
+    // before it's sorted) have no bit.
+    size_t order = component->graphOrder();
+    if (order < m_DependencyOrder.size() &&
+        m_DependencyOrder[order] == component)
+    {
+        m_dirtyComponents[order / 64] |= uint64_t(1) << (order % 64);
+    }
 }
 
 void Artboard::onDirty(ComponentDirt dirt)
@@ -1024,26 +1067,153 @@ bool Artboard::sharesLayoutWithHost() const
     return m_host != nullptr && m_host->isLayoutProvider();
 }
 
-void Artboard::cloneObjectDataBinds(const Core* object,
+static void cloneDataBind(const DataBind* dataBind,
+                          Core* clone,
+                          Artboard* artboard)
+{
+    auto dataBindClone = static_cast<DataBind*>(dataBind->clone());
+    dataBindClone->target(clone);
+    dataBindClone->file(dataBind->file());
+    dataBindClone->initialize();
+    if (dataBind->converter() != nullptr)
+    {
+        dataBindClone->converter(
+            dataBind->converter()->clone()->as<DataConverter>());
+    }
+    artboard->addDataBind(dataBindClone);
+}
+
+void Artboard::cloneObjectDataBinds(size_t objectIndex,
                                     Core* clone,
                                     Artboard* artboard) const
 {
+    if (objectIndex >= m_Objects.size())
+    {
+        return;
+    }
+    if (m_instanceDataBindOffsets.size() == m_Objects.size() + 1)
+    {
+        for (uint32_t i = m_instanceDataBindOffsets[objectIndex],
+                      end = m_instanceDataBindOffsets[objectIndex + 1];
+             i < end;
+             i++)
+        {
+            cloneDataBind(m_instanceDataBinds[i], clone, artboard);
+        }
+        return;
+    }
 
+    // No index (this is an instance being instanced again), scan them all.
+    const Core* object = m_Objects[objectIndex];
     for (auto dataBind : dataBinds())
     {
         if (dataBind->target() == object)
         {
-            auto dataBindClone = static_cast<DataBind*>(dataBind->clone());
-            dataBindClone->target(clone);
-            dataBindClone->file(dataBind->file());
-            dataBindClone->initialize();
-            if (dataBind->converter() != nullptr)
+            cloneDataBind(dataBind, clone, artboard);
+        }
+    }
+}
+
+void Artboard::buildInstanceDataBindsIndex()
+{
+    std::unordered_map<const Core*, std::vector<DataBind*>> bindsByTarget;
+    for (auto dataBind : dataBinds())
+    {
+        bindsByTarget[dataBind->target()].push_back(dataBind);
+    }
+    m_instanceDataBinds.clear();
+    m_instanceDataBindOffsets.clear();
+    m_instanceDataBindOffsets.reserve(m_Objects.size() + 1);
+    for (auto object : m_Objects)
+    {
+        m_instanceDataBindOffsets.push_back(
+            static_cast<uint32_t>(m_instanceDataBinds.size()));
+        auto itr = bindsByTarget.find(object);
+        if (itr != bindsByTarget.end())
+        {
+            m_instanceDataBinds.insert(m_instanceDataBinds.end(),
+                                       itr->second.begin(),
+                                       itr->second.end());
+        }
+    }
+    m_instanceDataBindOffsets.push_back(
+        static_cast<uint32_t>(m_instanceDataBinds.size()));
+}
+
+// Set while an arena backed instance clones its objects on this thread, so the
+// nested artboards they instance inherit arena allocation.
+static thread_local bool s_cloningIntoArena = false;
+
+std::unique_ptr<CoreArena> Artboard::makeInstanceArena(
+    InstanceAllocation allocation) const
+{
+    if (allocation == InstanceAllocation::Heap ||
+        (allocation == InstanceAllocation::Inherit && !s_cloningIntoArena))
+    {
+        return nullptr;
+    }
+    size_t capacity = m_instanceArenaSize.load(std::memory_order_relaxed);
+    if (capacity == 0)
+    {
+        // First arena instance of this artboard, guess; it records what it
+        // actually used so later ones fit in one block.
+        constexpr static size_t kEstimatedBytesPerObject = 256;
+        capacity = m_Objects.size() * kEstimatedBytesPerObject;
+    }
+    return std::make_unique<CoreArena>(capacity);
+}
+
+bool Artboard::canCloneIntoArena(const Core* object)
+{
+    // Reference counted objects can outlive the instance (and its arena).
+    return !object->is<ViewModelInstance>() &&
+           !object->is<ViewModelInstanceValue>();
+}
+
+void Artboard::cloneObjects(Artboard* artboardClone,
+                            InstanceAllocation allocation) const
+{
+    std::unique_ptr<CoreArena> arena = makeInstanceArena(allocation);
+    bool wasCloningIntoArena = s_cloningIntoArena;
+    s_cloningIntoArena = arena != nullptr;
+
+    cloneObjectDataBinds(0, artboardClone, artboardClone);
+
+    std::vector<Core*>& cloneObjects = artboardClone->m_Objects;
+    cloneObjects.reserve(m_Objects.size());
+    cloneObjects.push_back(artboardClone);
+
+    // Skip first object (artboard).
+    for (size_t i = 1; i < m_Objects.size(); i++)
+    {
+        auto object = m_Objects[i];
+        Core* clone = nullptr;
+        if (object != nullptr)
+        {
+            if (arena != nullptr && canCloneIntoArena(object))
+            {
+                clone = CoreRegistry::cloneIntoArena(object, *arena);
+            }
+            if (clone == nullptr)
             {
-                dataBindClone->converter(
-                    dataBind->converter()->clone()->as<DataConverter>());
+                clone = object->clone();
             }
-            artboard->addDataBind(dataBindClone);
         }
+        cloneObjects.push_back(clone);
+        // For each object, clone its data bind objects and target their
+        // clones
+        cloneObjectDataBinds(i, clone, artboardClone);
+    }
+    s_cloningIntoArena = wasCloningIntoArena;
+
+    if (arena != nullptr)
+    {
+        size_t arenaSize = arena->bytesUsed();
+        if (arenaSize > m_instanceArenaSize.load(std::memory_order_relaxed))
+        {
+            m_instanceArenaSize.store(arenaSize, std::memory_order_relaxed);
+        }
+        artboardClone->m_instanceArena = std::move(arena);
     }
 }
 
@@ -1249,13 +1419,19 @@ bool Artboard::updateComponents()
     {
         m_Dirt = m_Dirt & ~ComponentDirt::Components;
 
-        // Track dirt depth here so that if something else marks
+        // Only visit components flagged by onComponentDirty, in dependency
+        // order. Components dirtied ahead of us are picked up in this same
+        // pass. Track dirt depth here so that if something else marks
         // dirty, we restart.
-        for (unsigned int i = 0; i < count; i++)
+        for (size_t i = nextDirtyComponent(0); i < count;
+             i = nextDirtyComponent(i + 1))
         {
+            m_dirtyComponents[i / 64] &= ~(uint64_t(1) << (i % 64));
             auto component = m_DependencyOrder[i];
-            m_DirtDepth = i;
+            m_DirtDepth = static_cast<unsigned int>(i);
             auto d = component->m_Dirt;
+            // Collapsed components keep their dirt, collapse(false) flags
+            // them again.
             if (d == ComponentDirt::None ||
                 (d & ComponentDirt::Collapsed) == ComponentDirt::Collapsed)
             {
@@ -1277,6 +1453,25 @@ bool Artboard::updateComponents()
     return true;
 }
 
+size_t Artboard::nextDirtyComponent(size_t from) const
+{
+    size_t word = from / 64;
+    if (word >= m_dirtyComponents.size())
+    {
+        return m_DependencyOrder.size();
+    }
+    uint64_t bits = m_dirtyComponents[word] & (~uint64_t(0) << (from % 64));
+    while (bits == 0)
+    {
+        if (++word == m_dirtyComponents.size())
+        {
+            return m_DependencyOrder.size();
+        }
+        bits = m_dirtyComponents[word];
+    }
+    return word * 64 + math::ctz64(bits);
+}
+
 LayoutData* Artboard::takeLayoutData()
 {
 #ifdef WITH_RIVE_LAYOUT
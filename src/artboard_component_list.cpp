@@ -339,29 +339,27 @@ Artboard* ArtboardComponentList::findArtboard(
     {
         return artboard->second;
     }
-    auto artboards = m_file->artboards();
+    // Look the artboard up by index so only the one we use gets loaded.
     // Check if there is a special rule that maps the view model to a specific
     // artboard
     auto listRule = m_artboardMapRules.find(viewModelId);
-    if (listRule != m_artboardMapRules.end())
+    if (listRule != m_artboardMapRules.end() && listRule->second >= 0)
     {
-        auto artboardIndex = listRule->second;
-        if (artboardIndex < artboards.size())
+        auto artboard = m_file->artboard(static_cast<size_t>(listRule->second));
+        if (artboard != nullptr)
         {
-            auto artboard = artboards[artboardIndex];
             m_artboardsMap[viewModelId] = artboard;
             return artboard;
         }
     }
 
     // Search for the first artboard that is bound to this view model
-    for (auto& artboard : artboards)
+    int artboardIndex = m_file->artboardIndexForViewModel(viewModelId);
+    if (artboardIndex >= 0)
     {
-        if (artboard->viewModelId() == viewModelId)
-        {
-            m_artboardsMap[viewModelId] = artboard;
-            return artboard;
-        }
+        auto artboard = m_file->artboard(static_cast<size_t>(artboardIndex));
+        m_artboardsMap[viewModelId] = artboard;
+        return artboard;
     }
 
     return nullptr;
@@ -380,7 +378,9 @@ std::unique_ptr<ArtboardInstance> ArtboardComponentList::createArtboard(
     auto artboard = findArtboard(listItem);
     if (artboard != nullptr)
     {
-        auto inst = artboard->instance();
+        // List items instance the same few artboards over and over, clone
+        // each one into a single arena rather than allocating every object.
+        auto inst = artboard->instance(nullptr, InstanceAllocation::Arena);
         return inst;
     }
     return nullptr;
@@ -1849,21 +1849,10 @@ void ArtboardComponentList::attachArtboardOverride(
     {
         return;
     }
-    auto artboards = m_file->artboards();
-    int artboardIndex = -1;
-    for (auto& artboard : artboards)
-    {
-        artboardIndex++;
-
-        if (artboard->viewModelId() == viewModelInstance->viewModelId())
-        {
-            break;
-        }
-    }
-    if (artboardIndex < 0 && artboardIndex >= artboards.size())
-    {
-        return;
-    }
+    // -1 if no artboard is bound to the view model, which only matches
+    // overrides that apply to every artboard.
+    int artboardIndex =
+        m_file->artboardIndexForViewModel(viewModelInstance->viewModelId());
     ArtboardComponentListOverride* artboardOverride = nullptr;
     for (auto& child : children())
     {
@@ -16,13 +16,24 @@ uint64_t WorkPool::nextOwnerId()
     return s_nextOwnerId.fetch_add(1, std::memory_order_relaxed);
 }
 
+uint32_t WorkPool::defaultThreadCount()
+{
+#ifdef WITH_RIVE_THREADING
+    unsigned int n = std::max(std::thread::hardware_concurrency(), 1u);
+    // Cap at a reasonable number for image decode.
+    return std::min(n, 4u);
+#else
+    return 0;
+#endif
+}
+
 // ============================================================================
 // No-threading implementation
 // ============================================================================
 
 #ifndef WITH_RIVE_THREADING
 
-WorkPool::WorkPool() {}
+WorkPool::WorkPool(uint32_t threadCount) : m_pollBudget(16) {}
 
 WorkPool::~WorkPool()
 {
@@ -31,15 +42,30 @@ WorkPool::~WorkPool()
     // never cancelled are silently dropped — calling virtual callbacks
     // during destruction is unsafe if dependent state (e.g. Lua VM)
     // has already been torn down.
-    for (auto& task : m_workQueue)
+    for (auto& queue : m_workQueues)
     {
-        if (task->isCancelled())
+        for (auto& task : queue)
         {
-            task->setStatus(WorkStatus::Cancelled);
-            task->onCancel();
+            if (task->isCancelled())
+            {
+                task->setStatus(WorkStatus::Cancelled);
+                task->onCancel();
+            }
         }
+        queue.clear();
+    }
+}
+
+uint32_t WorkPool::threadCount() const { return 0; }
+
+void WorkPool::parallelFor(size_t count,
+                           const std::function<void(size_t)>& fn,
+                           uint32_t maxHelpers)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        fn(i);
     }
-    m_workQueue.clear();
 }
 
 uint64_t WorkPool::submit(rcp<WorkTask> task)
@@ -47,18 +73,33 @@ uint64_t WorkPool::submit(rcp<WorkTask> task)
     if (!task)
         return 0;
     task->setStatus(WorkStatus::Pending);
-    m_workQueue.push_back(std::move(task));
+    m_workQueues[static_cast<int>(task->priority())].push_back(
+        std::move(task));
     return m_nextHandle++;
 }
 
 uint32_t WorkPool::pollCompletedWork(uint32_t maxCallbacks)
 {
-    uint32_t processed = 0;
+    // Don't run tasks that get submitted by the callbacks below until the next
+    // poll.
+    size_t queuedCount = 0;
+    for (const auto& queue : m_workQueues)
+    {
+        queuedCount += queue.size();
+    }
+    maxCallbacks = static_cast<uint32_t>(
+        std::min<size_t>(maxCallbacks, queuedCount));
 
-    while (processed < maxCallbacks && !m_workQueue.empty())
+    uint32_t processed = 0;
+    while (processed < maxCallbacks)
     {
-        auto task = std::move(m_workQueue.front());
-        m_workQueue.pop_front();
+        auto queue = std::find_if(std::begin(m_workQueues),
+                                  std::end(m_workQueues),
+                                  [](const auto& q) { return !q.empty(); });
+        if (queue == std::end(m_workQueues))
+            break;
+        auto task = std::move(queue->front());
+        queue->pop_front();
 
         if (task->isCancelled())
         {
@@ -91,16 +132,27 @@ uint32_t WorkPool::pollCompletedWork(uint32_t maxCallbacks)
     return processed;
 }
 
-bool WorkPool::hasPendingWork() const { return !m_workQueue.empty(); }
+bool WorkPool::hasPendingWork() const
+{
+    for (const auto& queue : m_workQueues)
+    {
+        if (!queue.empty())
+            return true;
+    }
+    return false;
+}
 
 void WorkPool::cancelAllForOwner(uint64_t ownerId)
 {
     // Only set the cancel flag here. onCancel() is delivered once from
     // pollCompletedWork() when the task is dequeued, avoiding double-cancel.
-    for (auto& task : m_workQueue)
+    for (auto& queue : m_workQueues)
     {
-        if (task->ownerId() == ownerId)
-            task->cancel();
+        for (auto& task : queue)
+        {
+            if (task->ownerId() == ownerId)
+                task->cancel();
+        }
     }
 }
 
@@ -110,21 +162,101 @@ void WorkPool::cancelAllForOwner(uint64_t ownerId)
 
 #else // WITH_RIVE_THREADING
 
-WorkPool::WorkPool()
+// The pool and worker index of the current thread, if it is a worker.
+static thread_local WorkPool* t_workerPool = nullptr;
+static thread_local uint32_t t_workerIndex = 0;
+
+namespace
 {
-    unsigned int n = std::max(std::thread::hardware_concurrency(), 1u);
-    // Cap at a reasonable number for image decode.
-    n = std::min(n, 4u);
-    for (unsigned int i = 0; i < n; i++)
+// One parallelFor() call, shared with the helper tasks it submits. A helper
+// that only starts once every index has been claimed returns without touching
+// fn, which may be gone by then.
+class ParallelLoop : public RefCnt<ParallelLoop>
+{
+public:
+    ParallelLoop(size_t count, const std::function<void(size_t)>* fn) :
+        m_count(count), m_fn(fn)
+    {}
+
+    void drain()
     {
-        m_threads.emplace_back(&WorkPool::workerLoop, this);
+        for (;;)
+        {
+            size_t i = m_nextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (i >= m_count)
+            {
+                return;
+            }
+            (*m_fn)(i);
+            // The release orders this call's writes before the caller
+            // returns.
+            if (m_doneCount.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+                m_count)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done.notify_one();
+            }
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this] {
+            return m_doneCount.load(std::memory_order_acquire) == m_count;
+        });
+    }
+
+private:
+    const size_t m_count;
+    const std::function<void(size_t)>* const m_fn;
+    std::atomic<size_t> m_nextIndex{0};
+    std::atomic<size_t> m_doneCount{0};
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+};
+
+class ParallelLoopHelper : public WorkTask
+{
+public:
+    explicit ParallelLoopHelper(rcp<ParallelLoop> loop) :
+        m_loop(std::move(loop))
+    {
+        setPriority(WorkPriority::High);
+    }
+
+    bool execute() override
+    {
+        m_loop->drain();
+        return true;
+    }
+    bool deliversCallbacks() const override { return false; }
+
+private:
+    rcp<ParallelLoop> m_loop;
+};
+} // namespace
+
+WorkPool::WorkPool(uint32_t threadCount) : m_pollBudget(kPollAll)
+{
+    if (threadCount == 0)
+        threadCount = defaultThreadCount();
+    for (uint32_t i = 0; i < threadCount; i++)
+    {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+    // Start the threads only once every worker exists, since they steal from
+    // each other.
+    for (uint32_t i = 0; i < threadCount; i++)
+    {
+        m_threads.emplace_back(&WorkPool::workerLoop, this, i);
     }
 }
 
 WorkPool::~WorkPool()
 {
     {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
         m_shutdown = true;
     }
     m_haveWork.notify_all();
@@ -137,82 +269,173 @@ WorkPool::~WorkPool()
     // never polled. Tasks that were never cancelled are silently dropped —
     // calling virtual callbacks during destruction is unsafe if dependent
     // state (e.g. Lua VM) has already been torn down.
-    for (auto& task : m_completedQueue)
+    auto cancelQueue = [](std::deque<rcp<WorkTask>>& queue) {
+        for (auto& task : queue)
+        {
+            if (task->isCancelled())
+            {
+                task->setStatus(WorkStatus::Cancelled);
+                task->onCancel();
+            }
+        }
+        queue.clear();
+    };
+    for (auto& queue : m_completedQueues)
     {
-        if (task->isCancelled())
+        cancelQueue(queue);
+    }
+    for (auto& worker : m_workers)
+    {
+        for (auto& queue : worker->queues)
         {
-            task->setStatus(WorkStatus::Cancelled);
-            task->onCancel();
+            cancelQueue(queue);
         }
     }
-    m_completedQueue.clear();
-    for (auto& task : m_workQueue)
+}
+
+uint32_t WorkPool::threadCount() const
+{
+    return static_cast<uint32_t>(m_threads.size());
+}
+
+void WorkPool::parallelFor(size_t count,
+                           const std::function<void(size_t)>& fn,
+                           uint32_t maxHelpers)
+{
+    size_t helperCount = std::min<size_t>(
+        {count > 0 ? count - 1 : 0, m_threads.size(), maxHelpers});
+    if (helperCount == 0)
     {
-        if (task->isCancelled())
+        for (size_t i = 0; i < count; ++i)
         {
-            task->setStatus(WorkStatus::Cancelled);
-            task->onCancel();
+            fn(i);
         }
+        return;
+    }
+
+    auto loop = make_rcp<ParallelLoop>(count, &fn);
+    for (size_t i = 0; i < helperCount; ++i)
+    {
+        submit(make_rcp<ParallelLoopHelper>(loop));
     }
-    m_workQueue.clear();
+    loop->drain();
+    loop->wait();
 }
 
 uint64_t WorkPool::submit(rcp<WorkTask> task)
 {
     if (!task)
         return 0;
-    uint64_t handle;
+    task->setStatus(WorkStatus::Pending);
     {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        task->setStatus(WorkStatus::Pending);
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
         task->setSubmitGeneration(m_cancelGeneration);
-        handle = m_nextHandle++;
-        m_workQueue.push_back(std::move(task));
+    }
+    uint64_t handle = m_nextHandle.fetch_add(1, std::memory_order_relaxed);
+
+    // Keep work that a worker submits on that worker, for locality. Spread
+    // everything else round-robin.
+    uint32_t workerIndex =
+        t_workerPool == this
+            ? t_workerIndex
+            : m_nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                  static_cast<uint32_t>(m_workers.size());
+    {
+        Worker* worker = m_workers[workerIndex].get();
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->queues[static_cast<int>(task->priority())].push_back(
+            std::move(task));
+        m_queuedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    // Pass through m_sleepMutex so a worker that just saw m_queuedCount == 0
+    // is guaranteed to be waiting by the time we notify.
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
     }
     m_haveWork.notify_one();
     return handle;
 }
 
-void WorkPool::workerLoop()
+rcp<WorkTask> WorkPool::popOrSteal(uint32_t workerIndex)
 {
+    size_t workerCount = m_workers.size();
+    for (int priority = 0; priority < kWorkPriorityCount; ++priority)
+    {
+        // Check our own queue first, then everyone else's.
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            Worker* worker = m_workers[(workerIndex + i) % workerCount].get();
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            auto& queue = worker->queues[priority];
+            if (queue.empty())
+                continue;
+            // Take the oldest task from our own queue, and steal the newest
+            // from someone else's, so we don't fight its owner for the same
+            // end.
+            rcp<WorkTask> task;
+            if (i == 0)
+            {
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            else
+            {
+                task = std::move(queue.back());
+                queue.pop_back();
+            }
+            // Count the task as in flight before it stops counting as queued,
+            // so hasPendingWork() never sees it as neither.
+            m_inFlightCount.fetch_add(1, std::memory_order_relaxed);
+            m_queuedCount.fetch_sub(1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkPool::workerLoop(uint32_t workerIndex)
+{
+    t_workerPool = this;
+    t_workerIndex = workerIndex;
+
     while (true)
     {
-        rcp<WorkTask> task;
+        rcp<WorkTask> task = popOrSteal(workerIndex);
+        if (task == nullptr)
         {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
             m_haveWork.wait(lock, [this] {
-                return m_shutdown || !m_workQueue.empty();
+                return m_shutdown ||
+                       m_queuedCount.load(std::memory_order_relaxed) > 0;
             });
-            if (m_shutdown && m_workQueue.empty())
+            // Finish any queued work before shutting down.
+            if (m_shutdown && m_queuedCount.load() == 0)
                 return;
-            task = std::move(m_workQueue.front());
-            m_workQueue.pop_front();
+            continue;
         }
 
-        m_inFlightCount.fetch_add(1, std::memory_order_relaxed);
-
         if (task->isCancelled())
         {
             task->setStatus(WorkStatus::Cancelled);
-            std::lock_guard<std::mutex> lock(m_completedMutex);
-            m_completedQueue.push_back(std::move(task));
-            m_inFlightCount.fetch_sub(1, std::memory_order_relaxed);
-            continue;
         }
-
-        task->setStatus(WorkStatus::Running);
-        bool success = task->execute();
-
-        if (task->isCancelled())
-            task->setStatus(WorkStatus::Cancelled);
-        else if (success)
-            task->setStatus(WorkStatus::Completed);
         else
-            task->setStatus(WorkStatus::Failed);
+        {
+            task->setStatus(WorkStatus::Running);
+            bool success = task->execute();
+
+            if (task->isCancelled())
+                task->setStatus(WorkStatus::Cancelled);
+            else if (success)
+                task->setStatus(WorkStatus::Completed);
+            else
+                task->setStatus(WorkStatus::Failed);
+        }
 
+        if (task->deliversCallbacks())
         {
             std::lock_guard<std::mutex> lock(m_completedMutex);
-            m_completedQueue.push_back(std::move(task));
+            m_completedQueues[static_cast<int>(task->priority())].push_back(
+                std::move(task));
         }
         m_inFlightCount.fetch_sub(1, std::memory_order_relaxed);
     }
@@ -220,32 +443,43 @@ void WorkPool::workerLoop()
 
 uint32_t WorkPool::pollCompletedWork(uint32_t maxCallbacks)
 {
-    uint32_t processed = 0;
-
-    while (processed < maxCallbacks)
+    // Take the whole batch under a single lock, highest priority first.
+    std::vector<rcp<WorkTask>> tasks;
     {
-        rcp<WorkTask> task;
+        std::lock_guard<std::mutex> lock(m_completedMutex);
+        for (auto& queue : m_completedQueues)
         {
-            std::lock_guard<std::mutex> lock(m_completedMutex);
-            if (m_completedQueue.empty())
-                break;
-            task = std::move(m_completedQueue.front());
-            m_completedQueue.pop_front();
+            while (tasks.size() < maxCallbacks && !queue.empty())
+            {
+                tasks.push_back(std::move(queue.front()));
+                queue.pop_front();
+            }
         }
+    }
+    if (tasks.empty())
+        return 0;
 
-        bool ownerCancelled = false;
+    {
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
+        if (!m_cancelledOwners.empty())
         {
-            std::lock_guard<std::mutex> lock(m_queueMutex);
-            auto it = m_cancelledOwners.find(task->ownerId());
-            if (it != m_cancelledOwners.end())
+            for (auto& task : tasks)
             {
+                auto it = m_cancelledOwners.find(task->ownerId());
                 // Task is owner-cancelled only if it was submitted
                 // before the cancel call (submit gen < cancel gen).
-                ownerCancelled = task->submitGeneration() < it->second;
+                if (it != m_cancelledOwners.end() &&
+                    task->submitGeneration() < it->second)
+                {
+                    task->cancel();
+                }
             }
         }
+    }
 
-        if (!task->isCancelled() && !ownerCancelled)
+    for (auto& task : tasks)
+    {
+        if (!task->isCancelled())
         {
             if (task->status() == WorkStatus::Completed)
                 task->onComplete();
@@ -257,24 +491,20 @@ uint32_t WorkPool::pollCompletedWork(uint32_t maxCallbacks)
             task->setStatus(WorkStatus::Cancelled);
             task->onCancel();
         }
-        processed++;
     }
-    return processed;
+    return static_cast<uint32_t>(tasks.size());
 }
 
 bool WorkPool::hasPendingWork() const
 {
-    if (m_inFlightCount.load(std::memory_order_relaxed) > 0)
+    if (m_inFlightCount.load(std::memory_order_relaxed) > 0 ||
+        m_queuedCount.load(std::memory_order_relaxed) > 0)
         return true;
+    std::lock_guard<std::mutex> lock(
+        const_cast<std::mutex&>(m_completedMutex));
+    for (const auto& queue : m_completedQueues)
     {
-        std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(m_queueMutex));
-        if (!m_workQueue.empty())
-            return true;
-    }
-    {
-        std::lock_guard<std::mutex> lock(
-            const_cast<std::mutex&>(m_completedMutex));
-        if (!m_completedQueue.empty())
+        if (!queue.empty())
             return true;
     }
     return false;
@@ -288,25 +518,35 @@ void WorkPool::cancelAllForOwner(uint64_t ownerId)
     // The single onCancel() delivery happens from pollCompletedWork()
     // on the main thread when the task is dequeued.
     {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
+        std::lock_guard<std::mutex> lock(m_cancelMutex);
         // Bump the cancel generation so that tasks submitted after this
         // call are not treated as cancelled. In-flight worker tasks
         // submitted before this point have submitGeneration < cancelGen
         // and will be caught by pollCompletedWork.
         ++m_cancelGeneration;
         m_cancelledOwners[ownerId] = m_cancelGeneration;
-        for (auto& task : m_workQueue)
+    }
+    for (auto& worker : m_workers)
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        for (auto& queue : worker->queues)
         {
-            if (task->ownerId() == ownerId)
-                task->cancel();
+            for (auto& task : queue)
+            {
+                if (task->ownerId() == ownerId)
+                    task->cancel();
+            }
         }
     }
     {
         std::lock_guard<std::mutex> lock(m_completedMutex);
-        for (auto& task : m_completedQueue)
+        for (auto& queue : m_completedQueues)
         {
-            if (task->ownerId() == ownerId)
-                task->cancel();
+            for (auto& task : queue)
+            {
+                if (task->ownerId() == ownerId)
+                    task->cancel();
+            }
         }
     }
 }
@@ -323,12 +563,22 @@ static rcp<WorkPool>& globalWorkPoolStorage()
     return s_workPool;
 }
 
+static std::atomic<uint32_t> s_globalWorkPoolThreadCount{0};
+
+void setGlobalWorkPoolThreadCount(uint32_t threadCount)
+{
+    s_globalWorkPoolThreadCount.store(threadCount, std::memory_order_relaxed);
+}
+
 rcp<WorkPool>& getGlobalWorkPool()
 {
     // Thread-safe lazy initialization via std::call_once.
     static std::once_flag s_initFlag;
     auto& pool = globalWorkPoolStorage();
-    std::call_once(s_initFlag, [&pool] { pool = make_rcp<WorkPool>(); });
+    std::call_once(s_initFlag, [&pool] {
+        pool = make_rcp<WorkPool>(
+            s_globalWorkPoolThreadCount.load(std::memory_order_relaxed));
+    });
     return pool;
 }
 
@@ -339,7 +589,7 @@ void rive_pollAsyncWork()
     auto& pool = getGlobalWorkPoolIfExists();
     if (pool && pool->hasPendingWork())
     {
-        pool->pollCompletedWork(16);
+        pool->pollCompletedWork(pool->pollBudget());
     }
 }
 
@@ -5,9 +5,11 @@
 #include "rive/audio/audio_engine.hpp"
 #include "rive/audio/audio_sound.hpp"
 #include "rive/audio/audio_source.hpp"
+#include "rive/audio/audio_stream.hpp"
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 using namespace rive;
 
@@ -235,45 +237,155 @@ uint32_t AudioEngine::sampleRate() const
 }
 
 AudioEngine::AudioEngine(ma_engine* engine, ma_context* context) :
-    m_device(ma_engine_get_device(engine)), m_engine(engine), m_context(context)
+    m_device(ma_engine_get_device(engine)),
+    m_engine(engine),
+    m_context(context),
+    m_decodedCache(defaultDecodedCacheBudget),
+    m_streamFiller(new AudioStreamFiller())
 {}
 
+size_t AudioEngine::decodedCacheBudget()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_decodedCache.budget();
+}
+
+void AudioEngine::decodedCacheBudget(size_t bytes)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_decodedCache.budget(bytes);
+}
+
+rcp<DecodedAudio> AudioEngine::decodedAudio(AudioSource* source)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        rcp<DecodedAudio> cached = m_decodedCache.find(source->id());
+        if (cached != nullptr)
+        {
+            return cached;
+        }
+    }
+
+    uint32_t numChannels = channels();
+    ma_decoder decoder;
+    ma_decoder_config config =
+        ma_decoder_config_init(ma_format_f32, numChannels, sampleRate());
+    auto sourceBytes = source->bytes();
+    if (ma_decoder_init_memory(sourceBytes.data(),
+                               sourceBytes.size(),
+                               &config,
+                               &decoder) != MA_SUCCESS)
+    {
+        return nullptr;
+    }
+    // Reserve a chunk past the reported length so a resampler rounding up
+    // doesn't reallocate the whole clip for its last few frames.
+    const ma_uint64 chunkFrames = 4096;
+    ma_uint64 length = 0;
+    ma_decoder_get_length_in_pcm_frames(&decoder, &length);
+    std::vector<float> samples;
+    samples.reserve((size_t)(length + chunkFrames) * numChannels);
+    for (;;)
+    {
+        size_t offset = samples.size();
+        samples.resize(offset + (size_t)chunkFrames * numChannels);
+        ma_uint64 framesRead = 0;
+        ma_result result = ma_decoder_read_pcm_frames(&decoder,
+                                                      samples.data() + offset,
+                                                      chunkFrames,
+                                                      &framesRead);
+        samples.resize(offset + (size_t)framesRead * numChannels);
+        if (result != MA_SUCCESS || framesRead == 0)
+        {
+            break;
+        }
+    }
+    ma_decoder_uninit(&decoder);
+
+    auto decoded = make_rcp<DecodedAudio>(std::move(samples), numChannels);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_decodedCache.insert(source->id(), decoded);
+    return decoded;
+}
+
 rcp<AudioSound> AudioEngine::internalPlaySound(rcp<AudioSource> source,
                                                uint64_t duration,
                                                uint64_t endTime,
                                                uint64_t soundStartTime,
                                                Artboard* artboard)
 {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    // We have to dispose completed sounds out of the completed callback. So we
-    // do it on next play or at destruct.
-    for (auto sound : m_completedSounds)
     {
-        sound->dispose();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // We have to dispose completed sounds out of the completed callback.
+        // So we do it on next play or at destruct.
+        for (auto sound : m_completedSounds)
+        {
+            sound->dispose();
+        }
+        m_completedSounds.clear();
     }
-    m_completedSounds.clear();
+    // The rest runs unlocked: decoding a clip or priming a stream can take a
+    // while, and the audio thread takes m_mutex to report completed sounds.
 
     rcp<AudioSound> audioSound =
         rcp<AudioSound>(new AudioSound(this, source, artboard));
+
+    // Sources decoded up front play from a buffer; so do short clips, out of
+    // the decoded audio cache.
+    const float* bufferSamples = nullptr;
+    uint32_t bufferChannels = 0;
+    ma_uint64 sizeInFrames = 0;
+    ma_uint64 clippedFrames = std::numeric_limits<ma_uint64>::max();
     if (source->isBuffered())
     {
         rive::Span<float> samples = source->bufferedSamples();
-        ma_uint64 sizeInFrames = samples.size() / source->channels();
+        bufferSamples = samples.data();
+        bufferChannels = source->channels();
+        sizeInFrames = samples.size() / bufferChannels;
         if (endTime != 0)
         {
             float durationSeconds = duration / (float)sampleRate();
-            ma_uint64 clippedFrames =
+            clippedFrames =
                 (ma_uint64)std::round(durationSeconds * source->sampleRate());
-            if (clippedFrames < sizeInFrames)
+        }
+    }
+    else
+    {
+        uint64_t sourceFrames = source->lengthInFrames();
+        uint32_t sourceSampleRate = source->sampleRate();
+        uint64_t decodedBytes =
+            sourceSampleRate == 0
+                ? 0
+                : sourceFrames * sampleRate() / sourceSampleRate * channels() *
+                      sizeof(float);
+        if (sourceFrames != 0 && decodedBytes <= m_decodedClipLimit)
+        {
+            audioSound->m_decoded = decodedAudio(source.get());
+            if (audioSound->m_decoded == nullptr)
+            {
+                fprintf(stderr,
+                        "AudioSource::play - Failed to initialize decoder.\n");
+                return nullptr;
+            }
+            bufferSamples = audioSound->m_decoded->samples().data();
+            bufferChannels = audioSound->m_decoded->channels();
+            sizeInFrames = audioSound->m_decoded->lengthInFrames();
+            if (endTime != 0)
             {
-                sizeInFrames = clippedFrames;
+                clippedFrames = duration;
             }
         }
+    }
+
+    if (bufferSamples != nullptr)
+    {
+        sizeInFrames = std::min(sizeInFrames, clippedFrames);
         ma_audio_buffer_config config =
             ma_audio_buffer_config_init(ma_format_f32,
-                                        source->channels(),
+                                        bufferChannels,
                                         sizeInFrames,
-                                        (const void*)samples.data(),
+                                        (const void*)bufferSamples,
                                         nullptr);
         if (ma_audio_buffer_init(&config, audioSound->buffer()) != MA_SUCCESS)
         {
@@ -290,39 +402,33 @@ rcp<AudioSound> AudioEngine::internalPlaySound(rcp<AudioSource> source,
         {
             return nullptr;
         }
+        if (soundStartTime != 0)
+        {
+            audioSound->seek(soundStartTime);
+        }
     }
     else
     {
-        // We wrapped the miniaudio decoder with a custom data source "Clipped
-        // Decoder" which lets us ensure that the end callback for the sound is
-        // called when we reach the end of the clip. This won't happen when
-        // using ma_sound_set_stop_time_in_pcm_frames(audioSound->sound(),
-        // endTime); as this keeps the sound playing/ready to fade back in.
-        auto clip = audioSound->clippedDecoder();
-        ma_decoder_config config =
-            ma_decoder_config_init(ma_format_f32, channels(), sampleRate());
-        auto sourceBytes = source->bytes();
-        if (ma_decoder_init_memory(sourceBytes.data(),
-                                   sourceBytes.size(),
-                                   &config,
-                                   &clip->decoder) != MA_SUCCESS)
+        // The stream ends itself at the clip's end frame, so the sound's end
+        // callback fires there. That won't happen with
+        // ma_sound_set_stop_time_in_pcm_frames(audioSound->sound(), endTime);
+        // as that keeps the sound playing/ready to fade back in.
+        auto stream = AudioStream::Make(
+            source,
+            channels(),
+            sampleRate(),
+            endTime == 0 ? std::numeric_limits<uint64_t>::max() : duration);
+        if (stream == nullptr)
         {
             fprintf(stderr,
                     "AudioSource::play - Failed to initialize decoder.\n");
             return nullptr;
         }
-        clip->frameCursor = 0;
-        clip->endFrame =
-            endTime == 0 ? std::numeric_limits<uint64_t>::max() : duration;
-        ma_data_source_config baseConfig = ma_data_source_config_init();
-        baseConfig.vtable = &g_ma_end_clipped_decoder_vtable;
-        if (ma_data_source_init(&baseConfig, &clip->base) != MA_SUCCESS)
-        {
-            return nullptr;
-        }
-
+        // Prime from the start time here, rather than seeking the sound, so
+        // the first audio callback already has frames to play.
+        stream->prime(soundStartTime);
         if (ma_sound_init_from_data_source(m_engine,
-                                           audioSound->clippedDecoder(),
+                                           stream->dataSource(),
                                            MA_SOUND_FLAG_NO_PITCH |
                                                MA_SOUND_FLAG_NO_SPATIALIZATION,
                                            nullptr,
@@ -330,11 +436,8 @@ rcp<AudioSound> AudioEngine::internalPlaySound(rcp<AudioSource> source,
         {
             return nullptr;
         }
-    }
-
-    if (soundStartTime != 0)
-    {
-        audioSound->seek(soundStartTime);
+        audioSound->m_stream = stream;
+        m_streamFiller->add(std::move(stream));
     }
 
     ma_sound_set_end_callback(audioSound->sound(),
@@ -440,6 +543,11 @@ size_t AudioEngine::playingSoundCount()
 
 rcp<AudioSound> AudioEngine::playingSoundsHead() { return m_playingSoundsHead; }
 
+size_t AudioEngine::streamingSoundCount()
+{
+    return m_streamFiller->streamCount();
+}
+
 #endif
 
 void AudioEngine::stop(Artboard* artboard)
@@ -461,6 +569,9 @@ void AudioEngine::stop(Artboard* artboard)
 
 AudioEngine::~AudioEngine()
 {
+    // Stop decoding before the sounds reading the streams go away.
+    m_streamFiller.reset();
+
     auto sound = m_playingSoundsHead;
     while (sound != nullptr)
     {
@@ -547,6 +658,7 @@ bool AudioEngine::readAudioFrames(float* frames,
                                   uint64_t numFrames,
                                   uint64_t* framesRead)
 {
+    m_streamFiller->pump();
     return ma_engine_read_pcm_frames(m_engine,
                                      (void*)frames,
                                      (ma_uint64)numFrames,
@@ -554,6 +666,7 @@ bool AudioEngine::readAudioFrames(float* frames,
 }
 bool AudioEngine::sumAudioFrames(float* frames, uint64_t numFrames)
 {
+    m_streamFiller->pump();
     size_t numChannels = (size_t)channels();
     size_t count = (size_t)numFrames * numChannels;
 
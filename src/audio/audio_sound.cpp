@@ -9,7 +9,6 @@ using namespace rive;
 AudioSound::AudioSound(AudioEngine* engine,
                        rcp<AudioSource> source,
                        Artboard* artboard) :
-    m_decoder({}),
     m_buffer({}),
     m_sound({}),
     m_source(std::move(source)),
@@ -26,8 +25,13 @@ void AudioSound::dispose()
     }
     m_isDisposed = true;
     ma_sound_uninit(&m_sound);
-    ma_decoder_uninit(&m_decoder.decoder);
     ma_audio_buffer_uninit(&m_buffer);
+    m_decoded = nullptr;
+    if (m_stream != nullptr)
+    {
+        m_stream->close();
+        m_stream = nullptr;
+    }
 }
 
 float AudioSound::volume() { return ma_sound_get_volume(&m_sound); }
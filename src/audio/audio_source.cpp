@@ -3,53 +3,41 @@
 #include "rive/audio/audio_engine.hpp"
 #include "rive/audio/audio_sound.hpp"
 #include "rive/audio/audio_reader.hpp"
-#include "rive/audio/audio_reader.hpp"
+#include <atomic>
 #endif
 
 using namespace rive;
 
 #ifdef WITH_RIVE_AUDIO
+static std::atomic<uint64_t> s_nextAudioSourceId{1};
+
 // Both of these should be make_rcp but it is currently getting refed directy
 // somewhere else so until we refactor that we have to not ref here.
 rcp<AudioSource> AudioSource::MakeAudioSource(rive::Span<uint8_t> fileBytes)
 {
-    ma_decoder decoder;
-    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
-    if (ma_decoder_init_memory(fileBytes.data(),
-                               fileBytes.size(),
-                               &config,
-                               &decoder) != MA_SUCCESS)
+    auto source = rcp<AudioSource>(new AudioSource(std::move(fileBytes)));
+    if (!source->probe())
     {
         return nullptr;
     }
-    ma_decoder_uninit(&decoder);
-    return rcp<AudioSource>(new AudioSource(std::move(fileBytes)));
+    return source;
 }
 
 rcp<AudioSource> AudioSource::MakeAudioSource(
     rive::SimpleArray<uint8_t> fileBytes)
 {
-    ma_decoder decoder;
-    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
-    auto result = ma_decoder_init_memory(fileBytes.data(),
-                                         fileBytes.size(),
-                                         &config,
-                                         &decoder);
-    if (result != MA_SUCCESS)
+    auto source = rcp<AudioSource>(new AudioSource(std::move(fileBytes)));
+    if (!source->probe())
     {
-        fprintf(stderr,
-                "Failed to decode audio with error %s\n",
-                ma_result_description(result));
         return nullptr;
     }
-
-    ma_decoder_uninit(&decoder);
-    return rcp<AudioSource>(new AudioSource(std::move(fileBytes)));
+    return source;
 }
 
 AudioSource::AudioSource(rive::Span<float> samples,
                          uint32_t numChannels,
                          uint32_t sampleRate) :
+    m_id(s_nextAudioSourceId++),
     m_isBuffered(true),
     m_channels(numChannels),
     m_sampleRate(sampleRate),
@@ -61,6 +49,7 @@ AudioSource::AudioSource(rive::Span<float> samples,
 }
 
 AudioSource::AudioSource(rive::Span<uint8_t> fileBytes) :
+    m_id(s_nextAudioSourceId++),
     m_isBuffered(false),
     m_channels(0),
     m_sampleRate(0),
@@ -69,6 +58,7 @@ AudioSource::AudioSource(rive::Span<uint8_t> fileBytes) :
 {}
 
 AudioSource::AudioSource(rive::SimpleArray<uint8_t> fileBytes) :
+    m_id(s_nextAudioSourceId++),
     m_isBuffered(false),
     m_channels(0),
     m_sampleRate(0),
@@ -84,61 +74,87 @@ const rive::Span<float> AudioSource::bufferedSamples() const
                              m_ownedBytes.size() / sizeof(float));
 }
 
-class AudioSourceDecoder
+static AudioFormat encodingFormat(ma_decoder* decoder)
 {
-public:
-    AudioSourceDecoder(rive::Span<uint8_t> fileBytes) : m_decoder({})
+    ma_encoding_format encodingFormat;
+    if (ma_decoder_get_encoding_format(decoder, &encodingFormat) != MA_SUCCESS)
     {
-        ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
-        if (ma_decoder_init_memory(fileBytes.data(),
-                                   fileBytes.size(),
-                                   &config,
-                                   &m_decoder) != MA_SUCCESS)
-        {
-            fprintf(stderr,
-                    "AudioSourceDecoder - Failed to initialize decoder.\n");
-        }
+        return AudioFormat::unknown;
     }
-
-    ~AudioSourceDecoder() { ma_decoder_uninit(&m_decoder); }
-
-    uint32_t channels() { return (uint32_t)m_decoder.outputChannels; }
-
-    uint32_t sampleRate() { return (uint32_t)m_decoder.outputSampleRate; }
-
-    uint64_t lengthInFrames()
+    switch (encodingFormat)
     {
-        ma_uint64 length;
-        if (ma_data_source_get_length_in_pcm_frames(&m_decoder, &length) !=
-            MA_SUCCESS)
-        {
-            return 0;
-        }
-        return (uint64_t)length;
+        case ma_encoding_format_mp3:
+            return AudioFormat::mp3;
+        case ma_encoding_format_wav:
+            return AudioFormat::wav;
+        case ma_encoding_format_vorbis:
+            return AudioFormat::vorbis;
+        case ma_encoding_format_flac:
+            return AudioFormat::flac;
+        default:
+            return AudioFormat::unknown;
     }
+}
 
-private:
-    ma_decoder m_decoder;
-};
+bool AudioSource::probe()
+{
+    if (m_probed)
+    {
+        return m_channels != 0;
+    }
+    m_probed = true;
+    ma_decoder decoder;
+    ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
+    ma_result result = ma_decoder_init_memory(m_fileBytes.data(),
+                                              m_fileBytes.size(),
+                                              &config,
+                                              &decoder);
+    if (result != MA_SUCCESS)
+    {
+        fprintf(stderr,
+                "AudioSource - Failed to initialize decoder: %s\n",
+                ma_result_description(result));
+        return false;
+    }
+    m_channels = (uint32_t)decoder.outputChannels;
+    m_sampleRate = (uint32_t)decoder.outputSampleRate;
+    ma_uint64 length;
+    if (ma_data_source_get_length_in_pcm_frames(&decoder, &length) ==
+        MA_SUCCESS)
+    {
+        m_lengthInFrames = (uint64_t)length;
+    }
+    m_format = encodingFormat(&decoder);
+    ma_decoder_uninit(&decoder);
+    return m_channels != 0;
+}
 
 uint32_t AudioSource::channels()
 {
-    if (m_channels != 0)
+    if (!m_isBuffered)
     {
-        return m_channels;
+        probe();
     }
-    AudioSourceDecoder audioDecoder(m_fileBytes);
-    return m_channels = audioDecoder.channels();
+    return m_channels;
 }
 
 uint32_t AudioSource::sampleRate()
 {
-    if (m_sampleRate != 0)
+    if (!m_isBuffered)
+    {
+        probe();
+    }
+    return m_sampleRate;
+}
+
+uint64_t AudioSource::lengthInFrames()
+{
+    if (m_isBuffered)
     {
-        return m_sampleRate;
+        return m_channels == 0 ? 0 : bufferedSamples().size() / m_channels;
     }
-    AudioSourceDecoder audioDecoder(m_fileBytes);
-    return m_sampleRate = audioDecoder.sampleRate();
+    probe();
+    return m_lengthInFrames;
 }
 
 float AudioSource::duration()
@@ -147,23 +163,12 @@ float AudioSource::duration()
     {
         return m_duration;
     }
-    if (m_isBuffered)
-    {
-        uint32_t ch = channels();
-        uint32_t sr = sampleRate();
-        if (ch == 0 || sr == 0)
-        {
-            return m_duration = 0.0f;
-        }
-        return m_duration = (float)bufferedSamples().size() / (float)(ch * sr);
-    }
-    AudioSourceDecoder audioDecoder(m_fileBytes);
-    uint32_t sr = audioDecoder.sampleRate();
+    uint32_t sr = sampleRate();
     if (sr == 0)
     {
         return m_duration = 0.0f;
     }
-    return m_duration = (float)audioDecoder.lengthInFrames() / (float)sr;
+    return m_duration = (float)lengthInFrames() / (float)sr;
 }
 
 AudioFormat AudioSource::format() const
@@ -172,6 +177,10 @@ AudioFormat AudioSource::format() const
     {
         return AudioFormat::buffered;
     }
+    if (m_probed)
+    {
+        return m_format;
+    }
     ma_decoder decoder;
     ma_decoder_config config = ma_decoder_config_init(ma_format_f32, 0, 0);
     if (ma_decoder_init_memory(m_fileBytes.data(),
@@ -183,33 +192,8 @@ AudioFormat AudioSource::format() const
                 "AudioSource::format - Failed to initialize decoder.\n");
         return AudioFormat::unknown;
     }
-    ma_encoding_format encodingFormat;
-
-    AudioFormat format = AudioFormat::unknown;
-    if (ma_decoder_get_encoding_format(&decoder, &encodingFormat) == MA_SUCCESS)
-    {
-        switch (encodingFormat)
-        {
-            case ma_encoding_format_mp3:
-                format = AudioFormat::mp3;
-                break;
-            case ma_encoding_format_wav:
-                format = AudioFormat::wav;
-                break;
-            case ma_encoding_format_vorbis:
-                format = AudioFormat::vorbis;
-                break;
-            case ma_encoding_format_flac:
-                format = AudioFormat::flac;
-                break;
-            default:
-                format = AudioFormat::unknown;
-                break;
-        }
-    }
-
+    AudioFormat format = encodingFormat(&decoder);
     ma_decoder_uninit(&decoder);
-
     return format;
 }
 
@@ -0,0 +1,358 @@
+#ifdef WITH_RIVE_AUDIO
+#include "rive/audio/audio_stream.hpp"
+#include "rive/audio/audio_source.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+using namespace rive;
+
+// How often the filler tops rings up. A ring holds kBlockCount * kBlockFrames
+// frames, ~340ms at 48kHz, so this leaves plenty of headroom.
+static constexpr int kFillIntervalMs = 5;
+
+ma_data_source_vtable AudioStream::s_vtable = {AudioStream::Read,
+                                               AudioStream::Seek,
+                                               AudioStream::GetDataFormat,
+                                               AudioStream::GetCursor,
+                                               AudioStream::GetLength};
+
+rcp<AudioStream> AudioStream::Make(rcp<AudioSource> source,
+                                   uint32_t channels,
+                                   uint32_t sampleRate,
+                                   uint64_t endFrame)
+{
+    auto stream = rcp<AudioStream>(
+        new AudioStream(std::move(source), channels, sampleRate, endFrame));
+    if (!stream->m_hasDecoder)
+    {
+        return nullptr;
+    }
+    return stream;
+}
+
+AudioStream::AudioStream(rcp<AudioSource> source,
+                         uint32_t channels,
+                         uint32_t sampleRate,
+                         uint64_t endFrame) :
+    m_source(std::move(source)),
+    m_channels(channels),
+    m_sampleRate(sampleRate),
+    m_endFrame(endFrame),
+    m_ring((size_t)kBlockCount * kBlockFrames * channels)
+{
+    m_dataSource.stream = this;
+    ma_decoder_config config =
+        ma_decoder_config_init(ma_format_f32, channels, sampleRate);
+    auto bytes = m_source->bytes();
+    if (ma_decoder_init_memory(bytes.data(),
+                               bytes.size(),
+                               &config,
+                               &m_decoder) != MA_SUCCESS)
+    {
+        return;
+    }
+    ma_data_source_config baseConfig = ma_data_source_config_init();
+    baseConfig.vtable = &s_vtable;
+    if (ma_data_source_init(&baseConfig, &m_dataSource.base) != MA_SUCCESS)
+    {
+        ma_decoder_uninit(&m_decoder);
+        return;
+    }
+    m_hasDecoder = true;
+    ma_uint64 length = 0;
+    if (ma_decoder_get_length_in_pcm_frames(&m_decoder, &length) ==
+        MA_SUCCESS)
+    {
+        m_lengthInFrames = (uint64_t)length;
+    }
+}
+
+AudioStream::~AudioStream()
+{
+    if (m_hasDecoder)
+    {
+        ma_data_source_uninit(&m_dataSource.base);
+        ma_decoder_uninit(&m_decoder);
+    }
+}
+
+void AudioStream::prime(uint64_t startFrame)
+{
+    if (startFrame != 0 &&
+        ma_decoder_seek_to_pcm_frame(&m_decoder, startFrame) != MA_SUCCESS)
+    {
+        startFrame = 0;
+    }
+    m_fillFrame = startFrame;
+    m_cursor.store(startFrame, std::memory_order_relaxed);
+    fill();
+}
+
+void AudioStream::fill()
+{
+    bool seekFailed = false;
+    uint32_t epoch = m_seekEpoch.load(std::memory_order_acquire);
+    if (epoch != m_fillEpoch)
+    {
+        m_fillEpoch = epoch;
+        m_fillFrame = m_seekFrame.load(std::memory_order_relaxed);
+        m_fillDone = false;
+        seekFailed = ma_decoder_seek_to_pcm_frame(&m_decoder, m_fillFrame) !=
+                     MA_SUCCESS;
+    }
+
+    uint32_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    while (!m_fillDone &&
+           writeIndex - m_readIndex.load(std::memory_order_acquire) <
+               kBlockCount)
+    {
+        ma_uint64 framesRead = 0;
+        ma_result result = MA_AT_END;
+        if (!seekFailed && m_fillFrame < m_endFrame)
+        {
+            ma_uint64 frames =
+                std::min<uint64_t>(kBlockFrames, m_endFrame - m_fillFrame);
+            result = ma_decoder_read_pcm_frames(&m_decoder,
+                                                blockSamples(writeIndex),
+                                                frames,
+                                                &framesRead);
+        }
+        m_fillFrame += framesRead;
+
+        // A last block may be empty; it still tells the reader to end.
+        Block& block = m_blocks[writeIndex % kBlockCount];
+        block.epoch = m_fillEpoch;
+        block.frames = (uint32_t)framesRead;
+        block.last = result != MA_SUCCESS || framesRead == 0 ||
+                     m_fillFrame >= m_endFrame;
+        m_fillDone = block.last;
+        m_writeIndex.store(++writeIndex, std::memory_order_release);
+    }
+}
+
+ma_result AudioStream::read(float* out,
+                            ma_uint64 frameCount,
+                            ma_uint64* framesRead)
+{
+    ma_uint64 produced = 0;
+    while (produced < frameCount && !m_readDone)
+    {
+        uint32_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+        if (readIndex == m_writeIndex.load(std::memory_order_acquire))
+        {
+            break;
+        }
+        const Block& block = m_blocks[readIndex % kBlockCount];
+        if (block.epoch != m_readEpoch)
+        {
+            // Decoded before the last seek.
+            m_blockOffset = 0;
+            m_readIndex.store(readIndex + 1, std::memory_order_release);
+            continue;
+        }
+        uint32_t frames = (uint32_t)std::min<ma_uint64>(
+            block.frames - m_blockOffset,
+            frameCount - produced);
+        if (out != nullptr)
+        {
+            memcpy(out + produced * m_channels,
+                   blockSamples(readIndex) + (size_t)m_blockOffset * m_channels,
+                   (size_t)frames * m_channels * sizeof(float));
+        }
+        produced += frames;
+        m_blockOffset += frames;
+        m_cursor.store(m_cursor.load(std::memory_order_relaxed) + frames,
+                       std::memory_order_relaxed);
+        if (m_blockOffset == block.frames)
+        {
+            m_readDone = block.last;
+            m_blockOffset = 0;
+            m_readIndex.store(readIndex + 1, std::memory_order_release);
+        }
+    }
+
+    if (produced < frameCount && !m_readDone)
+    {
+        // The filler fell behind (or has not caught up with a seek yet).
+        // Play silence rather than ending the sound or stalling the mix.
+        if (out != nullptr)
+        {
+            memset(out + produced * m_channels,
+                   0,
+                   (size_t)(frameCount - produced) * m_channels *
+                       sizeof(float));
+        }
+        produced = frameCount;
+        m_underruns.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    *framesRead = produced;
+    return produced == 0 && m_readDone ? MA_AT_END : MA_SUCCESS;
+}
+
+void AudioStream::seek(uint64_t frame)
+{
+    m_readEpoch++;
+    m_seekFrame.store(frame, std::memory_order_relaxed);
+    m_seekEpoch.store(m_readEpoch, std::memory_order_release);
+    m_blockOffset = 0;
+    m_readDone = false;
+    m_cursor.store(frame, std::memory_order_relaxed);
+}
+
+ma_result AudioStream::Read(ma_data_source* dataSource,
+                            void* framesOut,
+                            ma_uint64 frameCount,
+                            ma_uint64* framesRead)
+{
+    return ((DataSource*)dataSource)
+        ->stream->read((float*)framesOut, frameCount, framesRead);
+}
+
+ma_result AudioStream::Seek(ma_data_source* dataSource, ma_uint64 frameIndex)
+{
+    ((DataSource*)dataSource)->stream->seek((uint64_t)frameIndex);
+    return MA_SUCCESS;
+}
+
+ma_result AudioStream::GetDataFormat(ma_data_source* dataSource,
+                                     ma_format* format,
+                                     ma_uint32* channels,
+                                     ma_uint32* sampleRate,
+                                     ma_channel* channelMap,
+                                     size_t channelMapCap)
+{
+    AudioStream* stream = ((DataSource*)dataSource)->stream;
+    if (format != nullptr)
+    {
+        *format = ma_format_f32;
+    }
+    if (channels != nullptr)
+    {
+        *channels = stream->m_channels;
+    }
+    if (sampleRate != nullptr)
+    {
+        *sampleRate = stream->m_sampleRate;
+    }
+    if (channelMap != nullptr)
+    {
+        ma_channel_map_init_standard(ma_standard_channel_map_default,
+                                     channelMap,
+                                     channelMapCap,
+                                     stream->m_channels);
+    }
+    return MA_SUCCESS;
+}
+
+ma_result AudioStream::GetCursor(ma_data_source* dataSource,
+                                 ma_uint64* cursor)
+{
+    AudioStream* stream = ((DataSource*)dataSource)->stream;
+    *cursor = stream->m_cursor.load(std::memory_order_relaxed);
+    return MA_SUCCESS;
+}
+
+ma_result AudioStream::GetLength(ma_data_source* dataSource,
+                                 ma_uint64* length)
+{
+    AudioStream* stream = ((DataSource*)dataSource)->stream;
+    if (stream->m_lengthInFrames == 0)
+    {
+        return MA_NOT_IMPLEMENTED;
+    }
+    *length = stream->m_lengthInFrames;
+    return MA_SUCCESS;
+}
+
+AudioStreamFiller::~AudioStreamFiller()
+{
+#ifdef RIVE_AUDIO_STREAM_THREAD
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_wake.notify_one();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+#endif
+}
+
+void AudioStreamFiller::add(rcp<AudioStream> stream)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_streams.push_back(std::move(stream));
+#ifdef RIVE_AUDIO_STREAM_THREAD
+    if (!m_thread.joinable())
+    {
+        m_thread = std::thread(&AudioStreamFiller::threadLoop, this);
+    }
+    lock.unlock();
+    m_wake.notify_one();
+#endif
+}
+
+void AudioStreamFiller::pump()
+{
+#ifndef RIVE_AUDIO_STREAM_THREAD
+    fillOpenStreams();
+#endif
+}
+
+size_t AudioStreamFiller::streamCount()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return std::count_if(m_streams.begin(),
+                         m_streams.end(),
+                         [](const rcp<AudioStream>& stream) {
+                             return !stream->closed();
+                         });
+}
+
+void AudioStreamFiller::fillOpenStreams()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_streams.erase(std::remove_if(m_streams.begin(),
+                                       m_streams.end(),
+                                       [](const rcp<AudioStream>& stream) {
+                                           return stream->closed();
+                                       }),
+                        m_streams.end());
+        m_filling.assign(m_streams.begin(), m_streams.end());
+    }
+    for (auto& stream : m_filling)
+    {
+        stream->fill();
+    }
+    m_filling.clear();
+}
+
+#ifdef RIVE_AUDIO_STREAM_THREAD
+void AudioStreamFiller::threadLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_shutdown)
+    {
+        lock.unlock();
+        fillOpenStreams();
+        lock.lock();
+        if (m_streams.empty())
+        {
+            m_wake.wait(lock,
+                        [this] { return m_shutdown || !m_streams.empty(); });
+        }
+        else
+        {
+            m_wake.wait_for(lock,
+                            std::chrono::milliseconds(kFillIntervalMs),
+                            [this] { return m_shutdown; });
+        }
+    }
+}
+#endif
+#endif
@@ -0,0 +1,62 @@
+#ifdef WITH_RIVE_AUDIO
+#include "rive/audio/decoded_audio_cache.hpp"
+
+using namespace rive;
+
+rcp<DecodedAudio> DecodedAudioCache::find(uint64_t sourceId)
+{
+    auto itr = m_lookup.find(sourceId);
+    if (itr == m_lookup.end())
+    {
+        m_misses++;
+        return nullptr;
+    }
+    m_hits++;
+    m_entries.splice(m_entries.begin(), m_entries, itr->second);
+    return itr->second->audio;
+}
+
+void DecodedAudioCache::insert(uint64_t sourceId, rcp<DecodedAudio> audio)
+{
+    auto existing = m_lookup.find(sourceId);
+    if (existing != m_lookup.end())
+    {
+        m_bytes -= existing->second->audio->sizeInBytes();
+        m_entries.erase(existing->second);
+        m_lookup.erase(existing);
+    }
+    size_t bytes = audio->sizeInBytes();
+    if (bytes > m_budget)
+    {
+        return;
+    }
+    evictToFit(bytes);
+    m_entries.push_front({sourceId, std::move(audio)});
+    m_lookup[sourceId] = m_entries.begin();
+    m_bytes += bytes;
+}
+
+void DecodedAudioCache::budget(size_t bytes)
+{
+    m_budget = bytes;
+    evictToFit(0);
+}
+
+void DecodedAudioCache::clear()
+{
+    m_entries.clear();
+    m_lookup.clear();
+    m_bytes = 0;
+}
+
+void DecodedAudioCache::evictToFit(size_t bytes)
+{
+    while (!m_entries.empty() && m_bytes + bytes > m_budget)
+    {
+        Entry& oldest = m_entries.back();
+        m_bytes -= oldest.audio->sizeInBytes();
+        m_lookup.erase(oldest.sourceId);
+        m_entries.pop_back();
+    }
+}
+#endif
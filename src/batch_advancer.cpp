@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "rive/batch_advancer.hpp"
+#include "rive/artboard.hpp"
+#include "rive/async/work_pool.hpp"
+#include "rive/scene.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+using namespace rive;
+
+static thread_local bool s_isAdvancingThread = false;
+
+namespace
+{
+// Marks a thread as advancing while it works on a chunk of a batch.
+class AdvancingThreadScope
+{
+public:
+    AdvancingThreadScope() : m_wasAdvancing(s_isAdvancingThread)
+    {
+        s_isAdvancingThread = true;
+    }
+    ~AdvancingThreadScope() { s_isAdvancingThread = m_wasAdvancing; }
+
+private:
+    const bool m_wasAdvancing;
+};
+} // namespace
+
+uint32_t BatchAdvancer::defaultThreadCount()
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    return 1;
+#else
+    return std::max(std::thread::hardware_concurrency(), 1u);
+#endif
+}
+
+bool BatchAdvancer::isAdvancingThread() { return s_isAdvancingThread; }
+
+BatchAdvancer::BatchAdvancer(uint32_t threadCount) :
+    m_threadCount(
+        std::min(threadCount != 0 ? threadCount : defaultThreadCount(),
+                 getGlobalWorkPool()->threadCount() + 1))
+{}
+
+bool BatchAdvancer::advance(Span<Scene* const> scenes,
+                            float elapsedSeconds,
+                            bool* keepGoing)
+{
+    return run(scenes.size(), [&](size_t i) {
+        bool result = scenes[i]->advanceAndApply(elapsedSeconds);
+        if (keepGoing != nullptr)
+        {
+            keepGoing[i] = result;
+        }
+        return result;
+    });
+}
+
+bool BatchAdvancer::advance(Span<ArtboardInstance* const> artboards,
+                            float elapsedSeconds,
+                            bool* didUpdate,
+                            AdvanceFlags flags)
+{
+    return run(artboards.size(), [&](size_t i) {
+        bool result = artboards[i]->advance(elapsedSeconds, flags);
+        if (didUpdate != nullptr)
+        {
+            didUpdate[i] = result;
+        }
+        return result;
+    });
+}
+
+bool BatchAdvancer::run(size_t count,
+                        const std::function<bool(size_t)>& advanceOne)
+{
+    // Deliver async completions before anything advances; the workers skip
+    // this poll (see Artboard::pollAsyncWork).
+    rive_pollAsyncWork();
+
+    // Hand out small chunks so a few expensive items don't leave the other
+    // threads idle at the end of the batch.
+    constexpr static size_t kChunksPerThread = 8;
+    size_t chunkCount =
+        m_threadCount > 1 ? std::min<size_t>(count,
+                                             m_threadCount * kChunksPerThread)
+                          : 1;
+    std::atomic<bool> anyAdvanced{false};
+    auto advanceChunk = [&](size_t chunk) {
+        AdvancingThreadScope scope;
+        bool chunkAdvanced = false;
+        size_t end = (chunk + 1) * count / chunkCount;
+        for (size_t i = chunk * count / chunkCount; i < end; ++i)
+        {
+            if (advanceOne(i))
+            {
+                chunkAdvanced = true;
+            }
+        }
+        if (chunkAdvanced)
+        {
+            anyAdvanced.store(true, std::memory_order_relaxed);
+        }
+    };
+    // parallelFor() returns only once every chunk has, which orders the
+    // helpers' writes before ours.
+    getGlobalWorkPool()->parallelFor(chunkCount,
+                                     advanceChunk,
+                                     m_threadCount - 1);
+    return anyAdvanced.load(std::memory_order_relaxed);
+}
@@ -2,9 +2,12 @@
 #include "rive/bones/bone.hpp"
 #include "rive/bones/skinnable.hpp"
 #include "rive/bones/tendon.hpp"
+#include "rive/bones/cubic_weight.hpp"
+#include "rive/shapes/cubic_vertex.hpp"
 #include "rive/shapes/vertex.hpp"
 #include "rive/shapes/path_vertex.hpp"
 #include "rive/constraints/constraint.hpp"
+#include "rive/math/simd.hpp"
 
 using namespace rive;
 
@@ -76,11 +79,128 @@ void Skin::buildDependencies()
     m_BoneTransforms[5] = 0;
 }
 
-void Skin::deform(Span<Vertex*> vertices)
+void Skin::addSkinnedPoint(unsigned int indices,
+                           unsigned int values,
+                           Vec2D* deformed)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        unsigned int weight = (values >> (i * 8)) & 0xFF;
+        unsigned int index = (indices >> (i * 8)) & 0xFF;
+        // Point unused influences at the identity in slot 0, their weight of
+        // 0 drops them from the blend.
+        if (weight == 0 || index > m_Tendons.size())
+        {
+            weight = 0;
+            index = 0;
+        }
+        m_pointWeights.push_back(weight / 255.0f);
+        m_pointBoneOffsets.push_back(index * 6);
+    }
+    m_deformedPoints.push_back(deformed);
+}
+
+void Skin::buildSkinnedPoints(Span<Vertex*> vertices)
 {
+    m_skinnedPointsDirty = false;
+    m_skinnedVertices.clear();
+    m_skinnedCubicVertices.clear();
+    m_pointWeights.clear();
+    m_pointBoneOffsets.clear();
+    m_deformedPoints.clear();
     for (auto vertex : vertices)
     {
-        vertex->deform(m_WorldTransform, m_BoneTransforms);
+        if (!vertex->hasWeight())
+        {
+            continue;
+        }
+        m_skinnedVertices.push_back(vertex);
+        auto weight = vertex->weight<Weight>();
+        addSkinnedPoint(weight->indices(),
+                        weight->values(),
+                        &weight->translation());
+    }
+    for (auto vertex : m_skinnedVertices)
+    {
+        if (!vertex->is<CubicVertex>())
+        {
+            continue;
+        }
+        m_skinnedCubicVertices.push_back(vertex->as<CubicVertex>());
+        auto weight = vertex->weight<CubicWeight>();
+        addSkinnedPoint(weight->inIndices(),
+                        weight->inValues(),
+                        &weight->inTranslation());
+        addSkinnedPoint(weight->outIndices(),
+                        weight->outValues(),
+                        &weight->outTranslation());
+    }
+    m_restPoints.resize(m_deformedPoints.size());
+}
+
+void Skin::deform(Span<Vertex*> vertices)
+{
+    if (m_skinnedPointsDirty)
+    {
+        buildSkinnedPoints(vertices);
+    }
+
+    // Vertices (and so their handles) can animate, gather their current
+    // positions.
+    Vec2D* rest = m_restPoints.data();
+    for (auto vertex : m_skinnedVertices)
+    {
+        *rest++ = Vec2D(vertex->x(), vertex->y());
+    }
+    for (auto vertex : m_skinnedCubicVertices)
+    {
+        *rest++ = vertex->inPoint();
+        *rest++ = vertex->outPoint();
+    }
+
+    deformPoints(m_WorldTransform,
+                 m_BoneTransforms,
+                 m_restPoints.data(),
+                 m_pointWeights.data(),
+                 m_pointBoneOffsets.data(),
+                 m_deformedPoints.data(),
+                 m_deformedPoints.size());
+}
+
+void Skin::deformPoints(const Mat2D& world,
+                        const float* boneTransforms,
+                        const Vec2D* rest,
+                        const float* weights,
+                        const uint32_t* boneOffsets,
+                        Vec2D* const* deformed,
+                        size_t count)
+{
+    float4 worldScaleSkew = simd::load4f(world.values());
+    float2 worldTranslation = simd::load2f(world.values() + 4);
+    for (size_t i = 0; i < count; i++, weights += 4, boneOffsets += 4)
+    {
+        // Blend the 4 bone matrices: xx, xy, yx, yy in one vector and tx, ty
+        // in the other. Same summation order as Weight::deform, and a 0
+        // weight adds exactly 0, so the results match it.
+        float4 w = simd::load4f(weights);
+        const float* bone0 = boneTransforms + boneOffsets[0];
+        const float* bone1 = boneTransforms + boneOffsets[1];
+        const float* bone2 = boneTransforms + boneOffsets[2];
+        const float* bone3 = boneTransforms + boneOffsets[3];
+        float4 scaleSkew = simd::load4f(bone0) * w.x;
+        float2 translation = simd::load2f(bone0 + 4) * w.x;
+        scaleSkew += simd::load4f(bone1) * w.y;
+        translation += simd::load2f(bone1 + 4) * w.y;
+        scaleSkew += simd::load4f(bone2) * w.z;
+        translation += simd::load2f(bone2 + 4) * w.z;
+        scaleSkew += simd::load4f(bone3) * w.w;
+        translation += simd::load2f(bone3 + 4) * w.w;
+
+        float2 point = simd::load2f(rest + i);
+        point = worldScaleSkew.xy * point.x + worldScaleSkew.zw * point.y +
+                worldTranslation;
+        point = scaleSkew.xy * point.x + scaleSkew.zw * point.y + translation;
+        simd::store(deformed[i], point);
     }
 }
 void Skin::addTendon(Tendon* tendon) { m_Tendons.push_back(tendon); }
@@ -1,4 +1,5 @@
 #include "rive/bones/skinnable.hpp"
+#include "rive/bones/skin.hpp"
 #include "rive/shapes/points_path.hpp"
 #include "rive/shapes/mesh.hpp"
 
@@ -16,4 +17,12 @@ Skinnable* Skinnable::from(Component* component)
     return nullptr;
 }
 
-void Skinnable::skin(Skin* skin) { m_Skin = skin; }
\ No newline at end of file
+void Skinnable::skin(Skin* skin) { m_Skin = skin; }
+
+void Skinnable::skinnedVerticesChanged()
+{
+    if (m_Skin != nullptr)
+    {
+        m_Skin->m_skinnedPointsDirty = true;
+    }
+}
@@ -4,37 +4,122 @@
 
 #include "rive/command_queue.hpp"
 
+#include <thread>
+
 namespace rive
 {
-namespace
-{
-// RAII utility to lock a mutex, and call notify_one() on a condition variable
-// immediately before unlocking.
-class AutoLockAndNotify
+// RAII utility to record a single command. With Transport::lockedStreams it
+// locks the command mutex, and calls notify_one() on the condition variable
+// immediately before unlocking. With Transport::spscRing the client owns the
+// streams outright, so it only publishes them once the command is complete.
+class CommandQueue::AutoLockAndNotify
 {
 public:
-    AutoLockAndNotify(std::mutex& mutex, std::condition_variable& cv) :
-        m_mutex(mutex), m_cv(cv)
+    AutoLockAndNotify(CommandQueue* queue) : m_queue(queue)
     {
-        m_mutex.lock();
+        if (m_queue->m_transport == Transport::lockedStreams)
+        {
+            m_queue->m_commandMutex.lock();
+        }
     }
 
     ~AutoLockAndNotify()
     {
-        m_cv.notify_one();
-        m_mutex.unlock();
+        if (m_queue->m_transport == Transport::lockedStreams)
+        {
+            m_queue->m_commandConditionVariable.notify_one();
+            m_queue->m_commandMutex.unlock();
+        }
+        else if (m_queue->m_batchDepth == 0)
+        {
+            m_queue->publishCommands();
+        }
     }
 
 private:
-    std::mutex& m_mutex;
-    std::condition_variable& m_cv;
+    CommandQueue* const m_queue;
 };
-}; // namespace
 
-CommandQueue::CommandQueue() {}
+void CommandQueue::CommandStreams::swap(CommandStreams& other)
+{
+    commandStream.swap(other.commandStream);
+    externalImages.swap(other.externalImages);
+    externalAudioSources.swap(other.externalAudioSources);
+    externalFonts.swap(other.externalFonts);
+    externalBlobs.swap(other.externalBlobs);
+    byteVectors.swap(other.byteVectors);
+#ifdef WITH_RIVE_SCRIPTING
+    scriptingContextFactories.swap(other.scriptingContextFactories);
+#endif
+    pointerEvents.swap(other.pointerEvents);
+    names.swap(other.names);
+    callbacks.swap(other.callbacks);
+    drawCallbacks.swap(other.drawCallbacks);
+}
+
+CommandQueue::CommandQueue(Transport transport) : m_transport(transport) {}
 
 CommandQueue::~CommandQueue() {}
 
+void CommandQueue::beginBatch()
+{
+    if (m_transport == Transport::spscRing)
+    {
+        ++m_batchDepth;
+    }
+}
+
+void CommandQueue::endBatch()
+{
+    if (m_transport == Transport::spscRing)
+    {
+        assert(m_batchDepth > 0);
+        if (--m_batchDepth == 0)
+        {
+            publishCommands();
+        }
+    }
+}
+
+bool CommandQueue::publishCommands()
+{
+    if (m_transport != Transport::spscRing || m_commandStreams.empty())
+    {
+        return true;
+    }
+
+    // Reuse a batch the server has finished with when we can, so the streams'
+    // capacity carries over from frame to frame.
+    std::unique_ptr<CommandStreams> batch = std::move(m_unpublishedBatch);
+    if (batch == nullptr && !m_recycledCommands.tryPopAndRelease(batch))
+    {
+        batch = std::make_unique<CommandStreams>();
+    }
+    assert(batch->empty());
+    batch->swap(m_commandStreams);
+
+    if (!m_publishedCommands.tryPushAndPublish(std::move(batch)))
+    {
+        // The server is a whole ring behind. Keep recording into the same
+        // streams and try again on the next publish. (tryPush() doesn't move
+        // from its argument when it fails.)
+        batch->swap(m_commandStreams);
+        m_unpublishedBatch = std::move(batch);
+        return false;
+    }
+
+    // Only take the mutex if the server is asleep. The fence pairs with the
+    // one in CommandServer::waitCommands() so that either we see the server
+    // waiting, or the server sees the batch we just published.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_serverWaitingForCommands.load(std::memory_order_relaxed))
+    {
+        std::unique_lock<std::mutex> lock(m_commandMutex);
+        m_commandConditionVariable.notify_one();
+    }
+    return true;
+}
+
 FileHandle CommandQueue::loadFile(
     std::vector<uint8_t> rivBytes,
     FileListener* listener,
@@ -55,13 +140,14 @@ FileHandle CommandQueue::loadFile(
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::loadFile;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_byteVectors << std::move(rivBytes);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::loadFile;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.byteVectors << std::move(rivBytes);
 #ifdef WITH_RIVE_SCRIPTING
-    m_scriptingContextFactories << std::move(scriptingContextFactory);
+    m_commandStreams.scriptingContextFactories
+        << std::move(scriptingContextFactory);
 #endif
 
     return handle;
@@ -69,67 +155,67 @@ FileHandle CommandQueue::loadFile(
 
 void CommandQueue::deleteFile(FileHandle fileHandle, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteFile;
-    m_commandStream << fileHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteFile;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::addGlobalImageAsset(std::string name,
                                        RenderImageHandle handle,
                                        uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::addImageFileAsset;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::addImageFileAsset;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 void CommandQueue::addGlobalFontAsset(std::string name,
                                       FontHandle handle,
                                       uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::addFontFileAsset;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::addFontFileAsset;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 void CommandQueue::addGlobalAudioAsset(std::string name,
                                        AudioSourceHandle handle,
                                        uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::addAudioFileAsset;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::addAudioFileAsset;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 void CommandQueue::removeGlobalImageAsset(std::string name, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::removeImageFileAsset;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::removeImageFileAsset;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 void CommandQueue::removeGlobalFontAsset(std::string name, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::removeFontFileAsset;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::removeFontFileAsset;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 void CommandQueue::removeGlobalAudioAsset(std::string name, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::removeAudioFileAsset;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::removeAudioFileAsset;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 ArtboardHandle CommandQueue::instantiateArtboardNamed(
@@ -149,12 +235,12 @@ ArtboardHandle CommandQueue::instantiateArtboardNamed(
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::instantiateArtboard;
-    m_commandStream << handle;
-    m_commandStream << fileHandle;
-    m_commandStream << requestId;
-    m_names << std::move(name);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::instantiateArtboard;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << std::move(name);
 
     return handle;
 }
@@ -165,50 +251,50 @@ void CommandQueue::setArtboardSize(ArtboardHandle artboardHandle,
                                    float scale,
                                    uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setArtboardSize;
-    m_commandStream << artboardHandle;
-    m_commandStream << width / scale;
-    m_commandStream << height / scale;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setArtboardSize;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << width / scale;
+    m_commandStreams.commandStream << height / scale;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::resetArtboardSize(ArtboardHandle artboardHandle,
                                      uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::resetArtboardSize;
-    m_commandStream << artboardHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::resetArtboardSize;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::setArtboardVolume(ArtboardHandle artboardHandle,
                                      float volume,
                                      uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setArtboardVolume;
-    m_commandStream << artboardHandle;
-    m_commandStream << volume;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setArtboardVolume;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << volume;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestArtboardVolume(ArtboardHandle artboardHandle,
                                          uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::getArtboardVolume;
-    m_commandStream << artboardHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::getArtboardVolume;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::deleteArtboard(ArtboardHandle artboardHandle,
                                   uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteArtboard;
-    m_commandStream << artboardHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteArtboard;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 ViewModelInstanceHandle CommandQueue::instantiateBlankViewModelInstance(
@@ -226,12 +312,13 @@ ViewModelInstanceHandle CommandQueue::instantiateBlankViewModelInstance(
         listener->m_owningQueue = ref_rcp(this);
         registerListener(viewHandle, listener);
     }
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::instantiateBlankViewModelForArtboard;
-    m_commandStream << fileHandle;
-    m_commandStream << artboardHandle;
-    m_commandStream << viewHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream
+        << Command::instantiateBlankViewModelForArtboard;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << viewHandle;
+    m_commandStreams.commandStream << requestId;
 
     return viewHandle;
 }
@@ -251,12 +338,12 @@ ViewModelInstanceHandle CommandQueue::instantiateBlankViewModelInstance(
         listener->m_owningQueue = ref_rcp(this);
         registerListener(viewHandle, listener);
     }
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::instantiateBlankViewModel;
-    m_commandStream << fileHandle;
-    m_commandStream << viewHandle;
-    m_commandStream << requestId;
-    m_names << viewModelName;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::instantiateBlankViewModel;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << viewHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << viewModelName;
 
     return viewHandle;
 }
@@ -277,13 +364,14 @@ ViewModelInstanceHandle CommandQueue::instantiateViewModelInstanceNamed(
         listener->m_owningQueue = ref_rcp(this);
         registerListener(viewHandle, listener);
     }
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::instantiateViewModelForArtboard;
-    m_commandStream << fileHandle;
-    m_commandStream << artboardHandle;
-    m_commandStream << viewHandle;
-    m_commandStream << requestId;
-    m_names << viewModelInstanceName;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream
+        << Command::instantiateViewModelForArtboard;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << viewHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << viewModelInstanceName;
 
     return viewHandle;
 }
@@ -304,13 +392,13 @@ ViewModelInstanceHandle CommandQueue::instantiateViewModelInstanceNamed(
         listener->m_owningQueue = ref_rcp(this);
         registerListener(viewHandle, listener);
     }
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::instantiateViewModel;
-    m_commandStream << fileHandle;
-    m_commandStream << viewHandle;
-    m_commandStream << requestId;
-    m_names << viewModelName;
-    m_names << viewModelInstanceName;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::instantiateViewModel;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << viewHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << viewModelName;
+    m_commandStreams.names << viewModelInstanceName;
 
     return viewHandle;
 }
@@ -330,12 +418,12 @@ ViewModelInstanceHandle CommandQueue::referenceNestedViewModelInstance(
         listener->m_owningQueue = ref_rcp(this);
         registerListener(viewHandle, listener);
     }
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::refNestedViewModel;
-    m_commandStream << handle;
-    m_commandStream << viewHandle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::refNestedViewModel;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << viewHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 
     return viewHandle;
 }
@@ -356,13 +444,13 @@ ViewModelInstanceHandle CommandQueue::referenceListViewModelInstance(
         listener->m_owningQueue = ref_rcp(this);
         registerListener(viewHandle, listener);
     }
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::refListViewModel;
-    m_commandStream << handle;
-    m_commandStream << index;
-    m_commandStream << viewHandle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::refListViewModel;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << index;
+    m_commandStreams.commandStream << viewHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 
     return viewHandle;
 }
@@ -371,12 +459,12 @@ void CommandQueue::fireViewModelTrigger(ViewModelInstanceHandle handle,
                                         std::string path,
                                         uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::trigger;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::trigger;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::setViewModelInstanceBool(ViewModelInstanceHandle handle,
@@ -384,13 +472,13 @@ void CommandQueue::setViewModelInstanceBool(ViewModelInstanceHandle handle,
                                             bool value,
                                             uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::boolean;
-    m_commandStream << requestId;
-    m_commandStream << value;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::boolean;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::setViewModelInstanceNumber(ViewModelInstanceHandle handle,
@@ -398,13 +486,13 @@ void CommandQueue::setViewModelInstanceNumber(ViewModelInstanceHandle handle,
                                               float value,
                                               uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::number;
-    m_commandStream << requestId;
-    m_commandStream << value;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::number;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::setViewModelInstanceColor(ViewModelInstanceHandle handle,
@@ -412,13 +500,13 @@ void CommandQueue::setViewModelInstanceColor(ViewModelInstanceHandle handle,
                                              ColorInt value,
                                              uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::color;
-    m_commandStream << requestId;
-    m_commandStream << value;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::color;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::setViewModelInstanceEnum(ViewModelInstanceHandle handle,
@@ -426,13 +514,13 @@ void CommandQueue::setViewModelInstanceEnum(ViewModelInstanceHandle handle,
                                             std::string value,
                                             uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::enumType;
-    m_commandStream << requestId;
-    m_names << path;
-    m_names << value;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::enumType;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
+    m_commandStreams.names << value;
 }
 
 void CommandQueue::setViewModelInstanceString(ViewModelInstanceHandle handle,
@@ -440,13 +528,13 @@ void CommandQueue::setViewModelInstanceString(ViewModelInstanceHandle handle,
                                               std::string value,
                                               uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::string;
-    m_commandStream << requestId;
-    m_names << path;
-    m_names << value;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::string;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
+    m_commandStreams.names << value;
 }
 
 void CommandQueue::setViewModelInstanceImage(ViewModelInstanceHandle handle,
@@ -454,13 +542,13 @@ void CommandQueue::setViewModelInstanceImage(ViewModelInstanceHandle handle,
                                              RenderImageHandle value,
                                              uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::assetImage;
-    m_commandStream << requestId;
-    m_commandStream << value;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::assetImage;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::setViewModelInstanceBlob(ViewModelInstanceHandle handle,
@@ -468,13 +556,13 @@ void CommandQueue::setViewModelInstanceBlob(ViewModelInstanceHandle handle,
                                             BlobAssetHandle value,
                                             uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::assetBlob;
-    m_commandStream << requestId;
-    m_commandStream << value;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::assetBlob;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::setViewModelInstanceArtboard(ViewModelInstanceHandle handle,
@@ -482,13 +570,13 @@ void CommandQueue::setViewModelInstanceArtboard(ViewModelInstanceHandle handle,
                                                 ArtboardHandle value,
                                                 uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::artboard;
-    m_commandStream << requestId;
-    m_commandStream << value;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::artboard;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::setViewModelInstanceNestedViewModel(
@@ -497,13 +585,13 @@ void CommandQueue::setViewModelInstanceNestedViewModel(
     ViewModelInstanceHandle value,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstanceValue;
-    m_commandStream << handle;
-    m_commandStream << DataType::viewModel;
-    m_commandStream << requestId;
-    m_commandStream << value;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstanceValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << DataType::viewModel;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::insertViewModelInstanceListViewModel(
@@ -513,13 +601,13 @@ void CommandQueue::insertViewModelInstanceListViewModel(
     int index,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::addViewModelListValue;
-    m_commandStream << handle;
-    m_commandStream << value;
-    m_commandStream << index;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::addViewModelListValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.commandStream << index;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::removeViewModelInstanceListViewModel(
@@ -529,13 +617,13 @@ void CommandQueue::removeViewModelInstanceListViewModel(
     ViewModelInstanceHandle value,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::removeViewModelListValue;
-    m_commandStream << handle;
-    m_commandStream << value;
-    m_commandStream << index;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::removeViewModelListValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << value;
+    m_commandStreams.commandStream << index;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::swapViewModelInstanceListValues(
@@ -545,13 +633,13 @@ void CommandQueue::swapViewModelInstanceListValues(
     int indexb,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::swapViewModelListValue;
-    m_commandStream << handle;
-    m_commandStream << indexa;
-    m_commandStream << indexb;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::swapViewModelListValue;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << indexa;
+    m_commandStreams.commandStream << indexb;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::subscribeToViewModelProperty(ViewModelInstanceHandle handle,
@@ -559,12 +647,12 @@ void CommandQueue::subscribeToViewModelProperty(ViewModelInstanceHandle handle,
                                                 DataType type,
                                                 uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::subscribeViewModelProperty;
-    m_commandStream << handle;
-    m_commandStream << type;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::subscribeViewModelProperty;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << type;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::unsubscribeToViewModelProperty(
@@ -573,21 +661,21 @@ void CommandQueue::unsubscribeToViewModelProperty(
     DataType type,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::unsubscribeViewModelProperty;
-    m_commandStream << handle;
-    m_commandStream << type;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::unsubscribeViewModelProperty;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << type;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::deleteViewModelInstance(ViewModelInstanceHandle handle,
                                            uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteViewModel;
-    m_commandStream << handle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteViewModel;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
 }
 
 StateMachineHandle CommandQueue::instantiateStateMachineNamed(
@@ -607,12 +695,12 @@ StateMachineHandle CommandQueue::instantiateStateMachineNamed(
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::instantiateStateMachine;
-    m_commandStream << handle;
-    m_commandStream << artboardHandle;
-    m_commandStream << requestId;
-    m_names << std::move(name);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::instantiateStateMachine;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << std::move(name);
 
     return handle;
 }
@@ -621,75 +709,75 @@ void CommandQueue::pointerMove(StateMachineHandle stateMachineHandle,
                                PointerEvent pointerEvent,
                                uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::pointerMove;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_pointerEvents << std::move(pointerEvent);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::pointerMove;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.pointerEvents << std::move(pointerEvent);
 }
 
 void CommandQueue::pointerDown(StateMachineHandle stateMachineHandle,
                                PointerEvent pointerEvent,
                                uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::pointerDown;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_pointerEvents << std::move(pointerEvent);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::pointerDown;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.pointerEvents << std::move(pointerEvent);
 }
 
 void CommandQueue::pointerUp(StateMachineHandle stateMachineHandle,
                              PointerEvent pointerEvent,
                              uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::pointerUp;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_pointerEvents << std::move(pointerEvent);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::pointerUp;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.pointerEvents << std::move(pointerEvent);
 }
 
 void CommandQueue::pointerExit(StateMachineHandle stateMachineHandle,
                                PointerEvent pointerEvent,
                                uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::pointerExit;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_pointerEvents << std::move(pointerEvent);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::pointerExit;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.pointerEvents << std::move(pointerEvent);
 }
 
 void CommandQueue::bindViewModelInstance(StateMachineHandle handle,
                                          ViewModelInstanceHandle viewModel,
                                          uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::bindViewModelInstance;
-    m_commandStream << handle;
-    m_commandStream << viewModel;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::bindViewModelInstance;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << viewModel;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::setViewModelInstance(StateMachineHandle handle,
                                         ViewModelInstanceHandle viewModel,
                                         uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setViewModelInstance;
-    m_commandStream << handle;
-    m_commandStream << viewModel;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setViewModelInstance;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << viewModel;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::clearViewModelInstance(StateMachineHandle handle,
                                           uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::clearViewModelInstance;
-    m_commandStream << handle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::clearViewModelInstance;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::setGlobalViewModelInstance(StateMachineHandle handle,
@@ -697,23 +785,23 @@ void CommandQueue::setGlobalViewModelInstance(StateMachineHandle handle,
                                               ViewModelInstanceHandle viewModel,
                                               uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::setGlobalViewModelInstance;
-    m_commandStream << handle;
-    m_commandStream << viewModel;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::setGlobalViewModelInstance;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << viewModel;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 void CommandQueue::clearGlobalViewModelInstance(StateMachineHandle handle,
                                                 std::string name,
                                                 uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::clearGlobalViewModelInstance;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::clearGlobalViewModelInstance;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 }
 
 ViewModelInstanceHandle CommandQueue::globalViewModelInstance(
@@ -731,51 +819,51 @@ ViewModelInstanceHandle CommandQueue::globalViewModelInstance(
         listener->m_owningQueue = ref_rcp(this);
         registerListener(viewHandle, listener);
     }
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::getGlobalViewModelInstance;
-    m_commandStream << handle;
-    m_commandStream << viewHandle;
-    m_commandStream << requestId;
-    m_names << name;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::getGlobalViewModelInstance;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << viewHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << name;
 
     return viewHandle;
 }
 
 void CommandQueue::bind(StateMachineHandle handle, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::bind;
-    m_commandStream << handle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::bind;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::advanceStateMachine(StateMachineHandle stateMachineHandle,
                                        float timeToAdvance,
                                        uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::advanceStateMachine;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_commandStream << timeToAdvance;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::advanceStateMachine;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << timeToAdvance;
 }
 
 void CommandQueue::deleteStateMachine(StateMachineHandle stateMachineHandle,
                                       uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteStateMachine;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteStateMachine;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::enableSemantics(StateMachineHandle stateMachineHandle,
                                    uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::enableSemantics;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::enableSemantics;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::drainSemanticsDiff(StateMachineHandle stateMachineHandle,
@@ -785,15 +873,15 @@ void CommandQueue::drainSemanticsDiff(StateMachineHandle stateMachineHandle,
                                       Vec2D viewBounds,
                                       uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::drainSemanticsDiff;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_commandStream << fit;
-    m_commandStream << alignment.x();
-    m_commandStream << alignment.y();
-    m_commandStream << scaleFactor;
-    m_commandStream << viewBounds;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::drainSemanticsDiff;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << fit;
+    m_commandStreams.commandStream << alignment.x();
+    m_commandStreams.commandStream << alignment.y();
+    m_commandStreams.commandStream << scaleFactor;
+    m_commandStreams.commandStream << viewBounds;
 }
 
 void CommandQueue::fireSemanticAction(StateMachineHandle stateMachineHandle,
@@ -801,32 +889,32 @@ void CommandQueue::fireSemanticAction(StateMachineHandle stateMachineHandle,
                                       SemanticActionType actionType,
                                       uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::fireSemanticAction;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_commandStream << semanticNodeId;
-    m_commandStream << actionType;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::fireSemanticAction;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << semanticNodeId;
+    m_commandStreams.commandStream << actionType;
 }
 
 void CommandQueue::requestSemanticFocus(StateMachineHandle stateMachineHandle,
                                         uint32_t semanticNodeId,
                                         uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::requestSemanticFocus;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
-    m_commandStream << semanticNodeId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::requestSemanticFocus;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.commandStream << semanticNodeId;
 }
 
 void CommandQueue::clearSemanticFocus(StateMachineHandle stateMachineHandle,
                                       uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::clearSemanticFocus;
-    m_commandStream << stateMachineHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::clearSemanticFocus;
+    m_commandStreams.commandStream << stateMachineHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 RenderImageHandle CommandQueue::decodeImage(
@@ -845,11 +933,11 @@ RenderImageHandle CommandQueue::decodeImage(
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::decodeImage;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_byteVectors << std::move(imageEncodedBytes);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::decodeImage;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.byteVectors << std::move(imageEncodedBytes);
     return handle;
 }
 
@@ -868,20 +956,20 @@ RenderImageHandle CommandQueue::addExternalImage(rcp<RenderImage> externalImage,
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::externalImage;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_externalImages << std::move(externalImage);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::externalImage;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.externalImages << std::move(externalImage);
     return handle;
 }
 
 void CommandQueue::deleteImage(RenderImageHandle handle, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteImage;
-    m_commandStream << handle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteImage;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
 }
 
 AudioSourceHandle CommandQueue::decodeAudio(
@@ -900,11 +988,11 @@ AudioSourceHandle CommandQueue::decodeAudio(
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::decodeAudio;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_byteVectors << std::move(imageEncodedBytes);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::decodeAudio;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.byteVectors << std::move(imageEncodedBytes);
     return handle;
 }
 
@@ -923,20 +1011,20 @@ AudioSourceHandle CommandQueue::addExternalAudio(rcp<AudioSource> externalAudio,
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::externalAudio;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_externalAudioSources << std::move(externalAudio);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::externalAudio;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.externalAudioSources << std::move(externalAudio);
     return handle;
 }
 
 void CommandQueue::deleteAudio(AudioSourceHandle handle, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteAudio;
-    m_commandStream << handle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteAudio;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
 }
 
 FontHandle CommandQueue::decodeFont(std::vector<uint8_t> imageEncodedBytes,
@@ -953,11 +1041,11 @@ FontHandle CommandQueue::decodeFont(std::vector<uint8_t> imageEncodedBytes,
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::decodeFont;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_byteVectors << std::move(imageEncodedBytes);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::decodeFont;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.byteVectors << std::move(imageEncodedBytes);
     return handle;
 }
 
@@ -975,20 +1063,20 @@ FontHandle CommandQueue::addExternalFont(rcp<Font> externalFont,
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::externalFont;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_externalFonts << std::move(externalFont);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::externalFont;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.externalFonts << std::move(externalFont);
     return handle;
 }
 
 void CommandQueue::deleteFont(FontHandle handle, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteFont;
-    m_commandStream << handle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteFont;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
 }
 
 BlobAssetHandle CommandQueue::decodeBlob(std::vector<uint8_t> blobBytes,
@@ -1006,11 +1094,11 @@ BlobAssetHandle CommandQueue::decodeBlob(std::vector<uint8_t> blobBytes,
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::decodeBlob;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_byteVectors << std::move(blobBytes);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::decodeBlob;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.byteVectors << std::move(blobBytes);
     return handle;
 }
 
@@ -1029,50 +1117,50 @@ BlobAssetHandle CommandQueue::addExternalBlob(rcp<BlobAsset> externalBlob,
         registerListener(handle, listener);
     }
 
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::externalBlob;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_externalBlobs << std::move(externalBlob);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::externalBlob;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.externalBlobs << std::move(externalBlob);
     return handle;
 }
 
 void CommandQueue::deleteBlob(BlobAssetHandle handle, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::deleteBlob;
-    m_commandStream << handle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::deleteBlob;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
 }
 
 DrawKey CommandQueue::createDrawKey()
 {
     // lock here so we can do this from several threads safely
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
+    AutoLockAndNotify lock(this);
     auto key = reinterpret_cast<DrawKey>(++m_currentDrawKeyIdx);
     return key;
 }
 
 void CommandQueue::draw(DrawKey drawKey, CommandServerDrawCallback callback)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::draw;
-    m_commandStream << drawKey;
-    m_drawCallbacks << std::move(callback);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::draw;
+    m_commandStreams.commandStream << drawKey;
+    m_commandStreams.drawCallbacks << std::move(callback);
 }
 
 void CommandQueue::cancelDraw(DrawKey drawKey)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::cancelDraw;
-    m_commandStream << drawKey;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::cancelDraw;
+    m_commandStreams.commandStream << drawKey;
 }
 
 #ifdef TESTING
 void CommandQueue::testing_commandLoopBreak()
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::commandLoopBreak;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::commandLoopBreak;
 }
 
 CommandQueue::FileListener* CommandQueue::testing_getFileListener(
@@ -1105,59 +1193,67 @@ CommandQueue::StateMachineListener* CommandQueue::
 #endif
 void CommandQueue::runOnce(CommandServerCallback callback)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::runOnce;
-    m_callbacks << std::move(callback);
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::runOnce;
+    m_commandStreams.callbacks << std::move(callback);
 }
 
 void CommandQueue::disconnect()
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::disconnect;
+    {
+        AutoLockAndNotify lock(this);
+        m_commandStreams.commandStream << Command::disconnect;
+    }
+    // The server has to see the disconnect, so wait out a full ring rather
+    // than leaving it unpublished.
+    while (!publishCommands())
+    {
+        std::this_thread::yield();
+    }
 }
 
 void CommandQueue::requestViewModelNames(FileHandle fileHandle,
                                          uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModels;
-    m_commandStream << fileHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModels;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestGlobalViewModelNames(FileHandle fileHandle,
                                                uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listGlobalViewModelNames;
-    m_commandStream << fileHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listGlobalViewModelNames;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestArtboardNames(FileHandle fileHandle,
                                         uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listArtboards;
-    m_commandStream << fileHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listArtboards;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestFileAssets(FileHandle fileHandle, uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listFileAssets;
-    m_commandStream << fileHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listFileAssets;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestViewModelEnums(FileHandle fileHandle,
                                          uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelEnums;
-    m_commandStream << fileHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelEnums;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestViewModelPropertyDefinitions(
@@ -1165,54 +1261,55 @@ void CommandQueue::requestViewModelPropertyDefinitions(
     std::string viewModelName,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelProperties;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << viewModelName;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelProperties;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << viewModelName;
 }
 
 void CommandQueue::requestViewModelInstanceNames(FileHandle handle,
                                                  std::string viewModelName,
                                                  uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelInstanceNames;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << viewModelName;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelInstanceNames;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << viewModelName;
 }
 
 void CommandQueue::requestViewModelInstanceViewModelName(
     ViewModelInstanceHandle viewModelInstanceHandle,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::getViewModelInstanceViewModelName;
-    m_commandStream << viewModelInstanceHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream
+        << Command::getViewModelInstanceViewModelName;
+    m_commandStreams.commandStream << viewModelInstanceHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestViewModelInstanceName(
     ViewModelInstanceHandle viewModelInstanceHandle,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::getViewModelInstanceName;
-    m_commandStream << viewModelInstanceHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::getViewModelInstanceName;
+    m_commandStreams.commandStream << viewModelInstanceHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestViewModelInstanceBool(ViewModelInstanceHandle handle,
                                                 std::string path,
                                                 uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelPropertyValue;
-    m_commandStream << DataType::boolean;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelPropertyValue;
+    m_commandStreams.commandStream << DataType::boolean;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::requestViewModelInstanceNumber(
@@ -1220,36 +1317,36 @@ void CommandQueue::requestViewModelInstanceNumber(
     std::string path,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelPropertyValue;
-    m_commandStream << DataType::number;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelPropertyValue;
+    m_commandStreams.commandStream << DataType::number;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::requestViewModelInstanceColor(ViewModelInstanceHandle handle,
                                                  std::string path,
                                                  uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelPropertyValue;
-    m_commandStream << DataType::color;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelPropertyValue;
+    m_commandStreams.commandStream << DataType::color;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::requestViewModelInstanceEnum(ViewModelInstanceHandle handle,
                                                 std::string path,
                                                 uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelPropertyValue;
-    m_commandStream << DataType::enumType;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelPropertyValue;
+    m_commandStreams.commandStream << DataType::enumType;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::requestViewModelInstanceString(
@@ -1257,12 +1354,12 @@ void CommandQueue::requestViewModelInstanceString(
     std::string path,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listViewModelPropertyValue;
-    m_commandStream << DataType::string;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listViewModelPropertyValue;
+    m_commandStreams.commandStream << DataType::string;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::requestViewModelInstanceListSize(
@@ -1270,11 +1367,11 @@ void CommandQueue::requestViewModelInstanceListSize(
     std::string path,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::getViewModelListSize;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::getViewModelListSize;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::requestViewModelInstanceListClear(
@@ -1282,44 +1379,47 @@ void CommandQueue::requestViewModelInstanceListClear(
     std::string path,
     uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::clearViewModelList;
-    m_commandStream << handle;
-    m_commandStream << requestId;
-    m_names << path;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::clearViewModelList;
+    m_commandStreams.commandStream << handle;
+    m_commandStreams.commandStream << requestId;
+    m_commandStreams.names << path;
 }
 
 void CommandQueue::requestArtboardSize(ArtboardHandle artboardHandle,
                                        uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::getArtboardSize;
-    m_commandStream << artboardHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::getArtboardSize;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestStateMachineNames(ArtboardHandle artboardHandle,
                                             uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::listStateMachines;
-    m_commandStream << artboardHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::listStateMachines;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::requestDefaultViewModelInfo(ArtboardHandle artboardHandle,
                                                FileHandle fileHandle,
                                                uint64_t requestId)
 {
-    AutoLockAndNotify lock(m_commandMutex, m_commandConditionVariable);
-    m_commandStream << Command::getDefaultViewModel;
-    m_commandStream << fileHandle;
-    m_commandStream << artboardHandle;
-    m_commandStream << requestId;
+    AutoLockAndNotify lock(this);
+    m_commandStreams.commandStream << Command::getDefaultViewModel;
+    m_commandStreams.commandStream << fileHandle;
+    m_commandStreams.commandStream << artboardHandle;
+    m_commandStreams.commandStream << requestId;
 }
 
 void CommandQueue::processMessages()
 {
+    // Retry anything that was left unpublished because the ring was full.
+    publishCommands();
+
     std::unique_lock<std::mutex> lock(m_messageMutex);
 
     if (m_messageStream.empty())
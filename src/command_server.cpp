@@ -642,15 +642,37 @@ void CommandServer::serveUntilDisconnect()
 
 bool CommandServer::waitCommands()
 {
-    PODStream& commandStream = m_commandQueue->m_commandStream;
+    if (m_commandQueue->m_transport == CommandQueue::Transport::spscRing)
+    {
+        auto& published = m_commandQueue->m_publishedCommands;
+        if (published.readable() == 0 && m_partialCommandBatch == nullptr)
+        {
+            std::unique_lock<std::mutex> lock(m_commandQueue->m_commandMutex);
+            m_commandQueue->m_serverWaitingForCommands.store(
+                true,
+                std::memory_order_relaxed);
+            // Pairs with the fence in CommandQueue::publishCommands().
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            while (published.readable() == 0)
+            {
+                m_commandQueue->m_commandConditionVariable.wait(lock);
+            }
+            m_commandQueue->m_serverWaitingForCommands.store(
+                false,
+                std::memory_order_relaxed);
+        }
+        return processCommands();
+    }
+
+    PODStream& commandStream = m_commandQueue->m_commandStreams.commandStream;
     if (commandStream.empty())
     {
         std::unique_lock<std::mutex> lock(m_commandQueue->m_commandMutex);
         while (commandStream.empty())
         {
-            assert(m_commandQueue->m_callbacks.empty());
-            assert(m_commandQueue->m_byteVectors.empty());
-            assert(m_commandQueue->m_names.empty());
+            assert(m_commandQueue->m_commandStreams.callbacks.empty());
+            assert(m_commandQueue->m_commandStreams.byteVectors.empty());
+            assert(m_commandQueue->m_commandStreams.names.empty());
             m_commandQueue->m_commandConditionVariable.wait(lock);
         }
     }
@@ -663,22 +685,106 @@ bool CommandServer::processCommands()
     assert(m_wasDisconnectReceived == false);
     assert(std::this_thread::get_id() == m_threadID);
 
-    PODStream& commandStream = m_commandQueue->m_commandStream;
-    PODStream& messageStream = m_commandQueue->m_messageStream;
     std::unique_lock<std::mutex> lock(m_commandQueue->m_commandMutex);
 
-    // Early out if we don't have anything to process.
-    if (commandStream.empty())
-        return !m_wasDisconnectReceived;
-
-    // Ensure we stop processing messages and get to the draw loop.
-    // This avoids a race condition where we never stop processing messages and
-    // therefore never draw anything.
-    commandStream << CommandQueue::Command::commandLoopBreak;
-
     // The map should be empty at this point.
     assert(m_uniqueDraws.empty());
 
+    if (m_commandQueue->m_transport == CommandQueue::Transport::spscRing)
+    {
+        // The client never takes m_commandMutex while we're awake, so holding
+        // it below is uncontended; it only keeps the lock/unlock choreography
+        // of processCommandStreams() the same for both transports.
+        auto& published = m_commandQueue->m_publishedCommands;
+        auto& recycled = m_commandQueue->m_recycledCommands;
+
+        // Only consume the batches that were published when we started, so a
+        // client that publishes faster than we process can't keep us from
+        // drawing.
+        uint32_t batchCount = published.readable();
+        if (batchCount == 0 && m_partialCommandBatch == nullptr)
+            return !m_wasDisconnectReceived;
+
+        // Resume a batch that was interrupted by an explicit commandLoopBreak
+        // before starting on any new ones.
+        std::unique_ptr<CommandQueue::CommandStreams> batch =
+            std::move(m_partialCommandBatch);
+        for (;;)
+        {
+            if (batch == nullptr)
+            {
+                if (batchCount == 0)
+                    break;
+                --batchCount;
+                published.tryPopAndRelease(batch);
+                assert(batch != nullptr);
+                // The batch belongs to us now, so we can mark its end
+                // directly.
+                batch->commandStream
+                    << CommandQueue::Command::commandLoopBreak;
+            }
+
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+            }
+            if (!processCommandStreams(*batch, lock))
+            {
+                return false;
+            }
+
+            if (!batch->empty())
+            {
+                // The client recorded its own commandLoopBreak. Stop here and
+                // pick the rest of the batch up on the next call.
+                m_partialCommandBatch = std::move(batch);
+                break;
+            }
+
+            // Hand the drained batch back so the client can record into it
+            // again. If that ring is full, just let the batch go.
+            recycled.tryPushAndPublish(std::move(batch));
+            batch.reset();
+        }
+    }
+    else
+    {
+        PODStream& commandStream =
+            m_commandQueue->m_commandStreams.commandStream;
+
+        // Early out if we don't have anything to process.
+        if (commandStream.empty())
+            return !m_wasDisconnectReceived;
+
+        // Ensure we stop processing messages and get to the draw loop.
+        // This avoids a race condition where we never stop processing messages
+        // and therefore never draw anything.
+        commandStream << CommandQueue::Command::commandLoopBreak;
+
+        if (!processCommandStreams(m_commandQueue->m_commandStreams, lock))
+        {
+            return false;
+        }
+    }
+
+    for (const auto& drawPair : m_uniqueDraws)
+    {
+        drawPair.second(drawPair.first, this);
+    }
+
+    m_uniqueDraws.clear();
+
+    checkPropertySubscriptions();
+
+    return !m_wasDisconnectReceived;
+}
+
+bool CommandServer::processCommandStreams(CommandQueue::CommandStreams& streams,
+                                          std::unique_lock<std::mutex>& lock)
+{
+    PODStream& commandStream = streams.commandStream;
+    PODStream& messageStream = m_commandQueue->m_messageStream;
+
     bool shouldProcessCommands = true;
     do
     {
@@ -694,11 +800,10 @@ bool CommandServer::processCommands()
                 std::vector<uint8_t> rivBytes;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_byteVectors >> rivBytes;
+                streams.byteVectors >> rivBytes;
 #ifdef WITH_RIVE_SCRIPTING
                 ScriptingContextFactory scriptingContextFactory;
-                m_commandQueue->m_scriptingContextFactories >>
-                    scriptingContextFactory;
+                streams.scriptingContextFactories >> scriptingContextFactory;
 #endif
                 lock.unlock();
 #if defined(WITH_RIVE_SCRIPTING) && defined(WITH_RIVE_SCRIPTING_LUAU)
@@ -789,7 +894,7 @@ bool CommandServer::processCommands()
                 std::vector<uint8_t> bytes;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_byteVectors >> bytes;
+                streams.byteVectors >> bytes;
                 lock.unlock();
 
                 auto image = factory()->decodeImage(bytes);
@@ -822,7 +927,7 @@ bool CommandServer::processCommands()
                 rcp<RenderImage> image;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_externalImages >> image;
+                streams.externalImages >> image;
                 lock.unlock();
 
                 if (image)
@@ -871,7 +976,7 @@ bool CommandServer::processCommands()
                 std::vector<uint8_t> bytes;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_byteVectors >> bytes;
+                streams.byteVectors >> bytes;
                 lock.unlock();
 
                 auto blob = make_rcp<BlobAsset>();
@@ -905,7 +1010,7 @@ bool CommandServer::processCommands()
                 rcp<BlobAsset> blob;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_externalBlobs >> blob;
+                streams.externalBlobs >> blob;
                 lock.unlock();
 
                 if (blob)
@@ -953,7 +1058,7 @@ bool CommandServer::processCommands()
                 std::vector<uint8_t> bytes;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_byteVectors >> bytes;
+                streams.byteVectors >> bytes;
                 lock.unlock();
 
                 auto audio = factory()->decodeAudio(bytes);
@@ -986,7 +1091,7 @@ bool CommandServer::processCommands()
                 rcp<AudioSource> audio;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_externalAudioSources >> audio;
+                streams.externalAudioSources >> audio;
                 lock.unlock();
 
                 if (audio)
@@ -1035,7 +1140,7 @@ bool CommandServer::processCommands()
                 std::vector<uint8_t> bytes;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_byteVectors >> bytes;
+                streams.byteVectors >> bytes;
                 lock.unlock();
 
                 auto font = factory()->decodeFont(bytes);
@@ -1067,7 +1172,7 @@ bool CommandServer::processCommands()
                 rcp<Font> font;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_externalFonts >> font;
+                streams.externalFonts >> font;
                 lock.unlock();
 
                 if (font)
@@ -1117,7 +1222,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> fileHandle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 if (rive::File* file = getFile(fileHandle))
                 {
@@ -1313,11 +1418,11 @@ bool CommandServer::processCommands()
                 commandStream >> requestId;
                 if (!usesArtboard)
                 {
-                    m_commandQueue->m_names >> viewModelName;
+                    streams.names >> viewModelName;
                 }
                 if (usesInstanceName)
                 {
-                    m_commandQueue->m_names >> viewModelInstanceName;
+                    streams.names >> viewModelInstanceName;
                 }
                 lock.unlock();
                 if (auto file = getFile(fileHandle))
@@ -1494,7 +1599,7 @@ bool CommandServer::processCommands()
                 commandStream >> viewHandle;
                 commandStream >> index;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> path;
+                streams.names >> path;
                 lock.unlock();
 
                 if (auto root = getViewModelInstance(rootHandle))
@@ -1555,7 +1660,7 @@ bool CommandServer::processCommands()
                 commandStream >> viewHandle;
                 commandStream >> index;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> path;
+                streams.names >> path;
                 lock.unlock();
 
                 if (auto root = getViewModelInstance(rootHandle))
@@ -1609,7 +1714,7 @@ bool CommandServer::processCommands()
                 commandStream >> indexa;
                 commandStream >> indexb;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> path;
+                streams.names >> path;
                 lock.unlock();
                 if (auto viewModel = getViewModelInstance(rootHandle))
                 {
@@ -1652,7 +1757,7 @@ bool CommandServer::processCommands()
                 commandStream >> rootHandle;
                 commandStream >> data.type;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> data.name;
+                streams.names >> data.name;
                 lock.unlock();
 
                 if (command ==
@@ -1735,7 +1840,7 @@ bool CommandServer::processCommands()
                 commandStream >> rootViewHandle;
                 commandStream >> nestedViewHandle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> path;
+                streams.names >> path;
                 lock.unlock();
 
                 if (auto rootViewInstance =
@@ -1793,7 +1898,7 @@ bool CommandServer::processCommands()
                 commandStream >> index;
                 commandStream >> listViewHandle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> path;
+                streams.names >> path;
                 lock.unlock();
 
                 if (auto rootViewInstance =
@@ -1876,7 +1981,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> artboardHandle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 if (rive::ArtboardInstance* artboard =
                         getArtboardInstance(artboardHandle))
@@ -2061,7 +2166,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> viewModel;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
 
                 if (auto stateMachineWrapper = getStateMachineWrapper(handle))
@@ -2118,7 +2223,7 @@ bool CommandServer::processCommands()
                 std::string name;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
 
                 if (auto stateMachineWrapper = getStateMachineWrapper(handle))
@@ -2160,7 +2265,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> viewHandle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
 
                 if (auto stateMachineWrapper = getStateMachineWrapper(handle))
@@ -2536,7 +2641,7 @@ bool CommandServer::processCommands()
             case CommandQueue::Command::runOnce:
             {
                 CommandServerCallback callback;
-                m_commandQueue->m_callbacks >> callback;
+                streams.callbacks >> callback;
                 lock.unlock();
                 callback(this);
                 break;
@@ -2547,7 +2652,7 @@ bool CommandServer::processCommands()
                 DrawKey drawKey;
                 CommandServerDrawCallback drawCallback;
                 commandStream >> drawKey;
-                m_commandQueue->m_drawCallbacks >> drawCallback;
+                streams.drawCallbacks >> drawCallback;
                 lock.unlock();
                 m_uniqueDraws[drawKey] = std::move(drawCallback);
                 break;
@@ -2993,7 +3098,7 @@ bool CommandServer::processCommands()
                 std::string viewModelName;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> viewModelName;
+                streams.names >> viewModelName;
                 lock.unlock();
                 auto file = getFile(handle);
                 if (file)
@@ -3048,7 +3153,7 @@ bool CommandServer::processCommands()
                 std::string viewModelName;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> viewModelName;
+                streams.names >> viewModelName;
                 lock.unlock();
                 auto file = getFile(handle);
                 if (file)
@@ -3138,7 +3243,7 @@ bool CommandServer::processCommands()
                 commandStream >> handle;
                 commandStream >> value.metaData.type;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> value.metaData.name;
+                streams.names >> value.metaData.name;
 
                 switch (value.metaData.type)
                 {
@@ -3156,7 +3261,7 @@ bool CommandServer::processCommands()
                         break;
                     case DataType::string:
                     case DataType::enumType:
-                        m_commandQueue->m_names >> value.stringValue;
+                        streams.names >> value.stringValue;
                         break;
                     case DataType::viewModel:
                         commandStream >> nestedHandle;
@@ -3527,7 +3632,7 @@ bool CommandServer::processCommands()
                 commandStream >> value.metaData.type;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> value.metaData.name;
+                streams.names >> value.metaData.name;
                 lock.unlock();
 
                 if (auto viewModelInstance = getViewModelInstance(handle))
@@ -3701,7 +3806,7 @@ bool CommandServer::processCommands()
                 std::string path;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> path;
+                streams.names >> path;
                 lock.unlock();
 
                 if (auto viewModel = getViewModelInstance(handle))
@@ -3750,7 +3855,7 @@ bool CommandServer::processCommands()
                 std::string path;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> path;
+                streams.names >> path;
                 lock.unlock();
 
                 if (auto viewModel = getViewModelInstance(handle))
@@ -3799,7 +3904,7 @@ bool CommandServer::processCommands()
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_pointerEvents >> pointerEvent;
+                streams.pointerEvents >> pointerEvent;
                 lock.unlock();
                 if (auto stateMachineWrapper = getStateMachineWrapper(handle))
                 {
@@ -3833,7 +3938,7 @@ bool CommandServer::processCommands()
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_pointerEvents >> pointerEvent;
+                streams.pointerEvents >> pointerEvent;
                 lock.unlock();
                 if (auto stateMachineWrapper = getStateMachineWrapper(handle))
                 {
@@ -3872,7 +3977,7 @@ bool CommandServer::processCommands()
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_pointerEvents >> pointerEvent;
+                streams.pointerEvents >> pointerEvent;
                 lock.unlock();
                 if (auto stateMachineWrapper = getStateMachineWrapper(handle))
                 {
@@ -3911,7 +4016,7 @@ bool CommandServer::processCommands()
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_pointerEvents >> pointerEvent;
+                streams.pointerEvents >> pointerEvent;
                 lock.unlock();
                 if (auto stateMachineWrapper = getStateMachineWrapper(handle))
                 {
@@ -3945,7 +4050,7 @@ bool CommandServer::processCommands()
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 if (handle && getImage(handle) != nullptr)
                 {
@@ -3960,7 +4065,7 @@ bool CommandServer::processCommands()
                 uint64_t requestId;
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 m_fileAssetLoader->removeRenderImage(std::move(name));
                 break;
@@ -3974,7 +4079,7 @@ bool CommandServer::processCommands()
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 if (handle && getAudioSource(handle) != nullptr)
                 {
@@ -3989,7 +4094,7 @@ bool CommandServer::processCommands()
                 uint64_t requestId;
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 m_fileAssetLoader->removeAudioSource(std::move(name));
                 break;
@@ -4003,7 +4108,7 @@ bool CommandServer::processCommands()
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> handle;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 if (handle && getFont(handle) != nullptr)
                 {
@@ -4018,7 +4123,7 @@ bool CommandServer::processCommands()
                 uint64_t requestId;
                 CommandQueue::PointerEvent pointerEvent;
                 commandStream >> requestId;
-                m_commandQueue->m_names >> name;
+                streams.names >> name;
                 lock.unlock();
                 m_fileAssetLoader->removeFont(std::move(name));
                 break;
@@ -4041,17 +4146,9 @@ bool CommandServer::processCommands()
     // unlock here.
     lock.unlock();
 
-    for (const auto& drawPair : m_uniqueDraws)
-    {
-        drawPair.second(drawPair.first, this);
-    }
-
-    m_uniqueDraws.clear();
-
-    checkPropertySubscriptions();
-
-    return !m_wasDisconnectReceived;
+    return true;
 }
+
 CommandServer::SynchronizedStateMachine::~SynchronizedStateMachine()
 {
     std::unique_lock<std::mutex> lock(m_mutex);
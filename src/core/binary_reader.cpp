@@ -1,7 +1,6 @@
 #include "rive/core/binary_reader.hpp"
 #include "rive/core/reader.h"
 #include "rive/span.hpp"
-#include <vector>
 
 using namespace rive;
 
@@ -51,16 +50,15 @@ uint64_t BinaryReader::readVarUint64()
 
 std::string BinaryReader::readString(size_t length)
 {
-    std::vector<char> rawValue((size_t)length + 1);
-    auto readBytes =
-        decode_string(length, m_Position, m_Bytes.end(), &rawValue[0]);
-    if (readBytes != length)
+    if (length > static_cast<size_t>(m_Bytes.end() - m_Position))
     {
         overflow();
         return std::string();
     }
-    m_Position += readBytes;
-    return std::string(rawValue.data(), (size_t)length);
+    // Copy straight out of the buffer; short strings don't allocate at all.
+    std::string value(reinterpret_cast<const char*>(m_Position), length);
+    m_Position += length;
+    return value;
 }
 
 std::string BinaryReader::readString()
@@ -73,6 +71,13 @@ std::string BinaryReader::readString()
     return readString(length);
 }
 
+std::string_view BinaryReader::readStringView()
+{
+    Span<const uint8_t> bytes = readBytes();
+    return std::string_view(reinterpret_cast<const char*>(bytes.data()),
+                            bytes.size());
+}
+
 Span<const uint8_t> BinaryReader::readBytes()
 {
     uint64_t length = readVarUint64();
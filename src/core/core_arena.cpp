@@ -0,0 +1,67 @@
+#include "rive/core/core_arena.hpp"
+
+#include <algorithm>
+#include <new>
+
+using namespace rive;
+
+namespace
+{
+constexpr size_t kAlignment = alignof(std::max_align_t);
+constexpr size_t kMinBlockSize = 4 * 1024;
+
+size_t alignUp(size_t size)
+{
+    return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+} // namespace
+
+CoreArena::CoreArena(size_t initialCapacity) :
+    m_nextBlockSize(std::max(alignUp(initialCapacity), kMinBlockSize))
+{}
+
+CoreArena::~CoreArena()
+{
+    for (const Block& block : m_blocks)
+    {
+        ::operator delete(block.data);
+    }
+}
+
+void CoreArena::addBlock(size_t minSize)
+{
+    size_t size = std::max(m_nextBlockSize, alignUp(minSize));
+    auto data = static_cast<uint8_t*>(::operator new(size));
+    m_blocks.push_back({data, size});
+    m_cursor = data;
+    m_end = data + size;
+    // Spill blocks only happen when the up front estimate was short, so grow
+    // geometrically to keep their number small.
+    m_nextBlockSize = size * 2;
+}
+
+void* CoreArena::allocate(size_t size)
+{
+    size = alignUp(std::max<size_t>(size, 1));
+    if (static_cast<size_t>(m_end - m_cursor) < size)
+    {
+        addBlock(size);
+    }
+    void* result = m_cursor;
+    m_cursor += size;
+    m_bytesUsed += size;
+    return result;
+}
+
+bool CoreArena::owns(const void* object) const
+{
+    auto address = static_cast<const uint8_t*>(object);
+    for (const Block& block : m_blocks)
+    {
+        if (address >= block.data && address < block.data + block.size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
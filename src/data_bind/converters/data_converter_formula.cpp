@@ -14,7 +14,9 @@
 #include "rive/function_type.hpp"
 #include "rive/math/math_types.hpp"
 #include "rive/math/random.hpp"
+#include <algorithm>
 #include <cmath>
+#include <unordered_set>
 
 using namespace rive;
 
@@ -79,9 +81,8 @@ int DataConverterFormula::getPrecedence(FormulaToken* token)
 void DataConverterFormula::calculateFormula()
 {
     // convert the formula to Reverse Polish Notation using a version of
-    // the Shunting yard algorithm
-    // Some optimizations could be done here by precomputing constant parts
-    // of the equation
+    // the Shunting yard algorithm. compileProgram() turns it into the
+    // bytecode that is evaluated.
     std::vector<FormulaToken*> operationsStack;
     int tokenIndex = 0;
     for (auto& token : m_tokens)
@@ -197,6 +198,129 @@ void DataConverterFormula::calculateFormula()
             m_outputQueue.push_back(operation);
         }
     }
+    m_programDirty = true;
+}
+
+void DataConverterFormula::compileProgram()
+{
+    // Token values that are data bound change at runtime, everything else in
+    // the output queue is fixed once it has been built.
+    std::unordered_set<const Core*> boundTokens;
+    for (auto dataBind : dataBinds())
+    {
+        boundTokens.insert(dataBind->target());
+    }
+
+    m_program.clear();
+    // Whether each value on the stack is a constant. A constant is always
+    // pushed by a single pushConstant, so n constants on top of the stack are
+    // the last n instructions of the program and can be folded away.
+    std::vector<bool> isConstant;
+    std::vector<float> arguments;
+    size_t maxDepth = 0;
+    auto pushConstant = [&](float value) {
+        Instruction instruction = {};
+        instruction.op = Instruction::Op::pushConstant;
+        instruction.value = value;
+        m_program.push_back(instruction);
+        isConstant.push_back(true);
+    };
+    for (auto& token : m_outputQueue)
+    {
+        Instruction instruction = {};
+        if (token->is<FormulaTokenOperation>())
+        {
+            // Operations without two operands were never applied.
+            size_t depth = isConstant.size();
+            if (depth < 2)
+            {
+                continue;
+            }
+            int operationType =
+                token->as<FormulaTokenOperation>()->operationType();
+            if (isConstant[depth - 1] && isConstant[depth - 2])
+            {
+                float right = m_program.back().value;
+                m_program.pop_back();
+                float left = m_program.back().value;
+                m_program.pop_back();
+                isConstant.resize(depth - 2);
+                pushConstant(applyOperation(left, right, operationType));
+                continue;
+            }
+            instruction.op = Instruction::Op::operation;
+            instruction.type = operationType;
+            m_program.push_back(instruction);
+            isConstant.resize(depth - 2);
+            isConstant.push_back(false);
+        }
+        else if (token->is<FormulaTokenFunction>())
+        {
+            auto argumentsCountSearch = m_argumentsCount.find(token);
+            size_t depth = isConstant.size();
+            // A function pops as many of its arguments as there are values.
+            size_t argumentsCount = std::min<size_t>(
+                argumentsCountSearch == m_argumentsCount.end()
+                    ? 0
+                    : std::max(argumentsCountSearch->second, 0),
+                std::min<size_t>(depth, UINT16_MAX));
+            int functionType =
+                token->as<FormulaTokenFunction>()->functionType();
+            bool canFold =
+                functionType != static_cast<int>(FunctionType::random);
+            for (size_t i = depth - argumentsCount; i < depth && canFold; i++)
+            {
+                canFold = isConstant[i];
+            }
+            if (canFold)
+            {
+                arguments.clear();
+                for (size_t i = m_program.size() - argumentsCount;
+                     i < m_program.size();
+                     i++)
+                {
+                    arguments.push_back(m_program[i].value);
+                }
+                m_program.resize(m_program.size() - argumentsCount);
+                isConstant.resize(depth - argumentsCount);
+                pushConstant(applyFunction(arguments.data(),
+                                           functionType,
+                                           (int)argumentsCount));
+                continue;
+            }
+            instruction.op = Instruction::Op::function;
+            instruction.argumentsCount = (uint16_t)argumentsCount;
+            instruction.type = functionType;
+            m_program.push_back(instruction);
+            isConstant.resize(depth - argumentsCount);
+            isConstant.push_back(false);
+        }
+        else if (token->is<FormulaTokenInput>())
+        {
+            instruction.op = Instruction::Op::pushInput;
+            m_program.push_back(instruction);
+            isConstant.push_back(false);
+        }
+        else if (token->is<FormulaTokenValue>())
+        {
+            auto valueToken = token->as<FormulaTokenValue>();
+            if (boundTokens.count(valueToken) == 0)
+            {
+                pushConstant(valueToken->operationValue());
+            }
+            else
+            {
+                instruction.op = Instruction::Op::pushToken;
+                instruction.token = valueToken;
+                m_program.push_back(instruction);
+                isConstant.push_back(false);
+            }
+        }
+        maxDepth = std::max(maxDepth, isConstant.size());
+    }
+    m_programIsWellFormed = isConstant.size() == 1;
+    m_stack.resize(maxDepth);
+    m_programDirty = false;
 }
 
 float DataConverterFormula::applyOperation(float left,
@@ -235,24 +359,21 @@ float DataConverterFormula::getRandom(int randomIndex)
     return m_randoms[randomIndex];
 }
 
-float DataConverterFormula::applyFunction(std::vector<float>& stack,
+float DataConverterFormula::applyFunction(const float* arguments,
                                           int functionTypeIndex,
                                           int totalArguments)
 {
-
-    std::vector<float> functionArguments;
-    int index = 0;
-    int currentRandom = 0;
-    while (index < totalArguments)
+    // The arguments in the order they come off the stack: the last argument
+    // first.
+    struct
     {
-        if (stack.size() > 0)
-        {
-            auto functionArgument = stack.back();
-            stack.pop_back();
-            functionArguments.push_back(functionArgument);
-        }
-        index++;
-    }
+        const float* arguments;
+        size_t count;
+        size_t size() const { return count; }
+        float operator[](size_t i) const { return arguments[count - 1 - i]; }
+        float back() const { return arguments[0]; }
+    } functionArguments = {arguments, (size_t)totalArguments};
+    int currentRandom = 0;
     auto functionType = (FunctionType)functionTypeIndex;
     switch (functionType)
     {
@@ -417,52 +538,46 @@ DataValue* DataConverterFormula::convert(DataValue* value, DataBind* dataBind)
                 : (float)(value->as<DataValueSymbolListIndex>()->value());
         float resultValue = inputValue;
 
-        std::vector<float> stack;
-        for (auto& token : m_outputQueue)
+        if (m_programDirty)
         {
-            if (token->is<FormulaTokenOperation>())
-            {
-                if (stack.size() > 1)
-                {
-                    auto right = stack.back();
-                    stack.pop_back();
-                    auto left = stack.back();
-                    stack.pop_back();
-                    float operationResult = applyOperation(
-                        left,
-                        right,
-                        token->as<FormulaTokenOperation>()->operationType());
-                    stack.push_back(operationResult);
-                }
-            }
-            else if (token->is<FormulaTokenFunction>())
-            {
-                auto argumentsCount = m_argumentsCount.find(token);
-                float operationResult = applyFunction(
-                    stack,
-                    token->as<FormulaTokenFunction>()->functionType(),
-                    argumentsCount == m_argumentsCount.end()
-                        ? 0
-                        : argumentsCount->second);
-                stack.push_back(operationResult);
-            }
-            else if (token->is<FormulaTokenInput>())
-            {
-                stack.push_back(inputValue);
-            }
-            else if (token->is<FormulaTokenValue>())
+            compileProgram();
+        }
+        float* stack = m_stack.data();
+        size_t depth = 0;
+        for (const Instruction& instruction : m_program)
+        {
+            switch (instruction.op)
             {
-                stack.push_back(
-                    token->as<FormulaTokenValue>()->operationValue());
+                case Instruction::Op::pushConstant:
+                    stack[depth++] = instruction.value;
+                    break;
+                case Instruction::Op::pushInput:
+                    stack[depth++] = inputValue;
+                    break;
+                case Instruction::Op::pushToken:
+                    stack[depth++] = instruction.token->operationValue();
+                    break;
+                case Instruction::Op::operation:
+                    depth--;
+                    stack[depth - 1] = applyOperation(stack[depth - 1],
+                                                      stack[depth],
+                                                      instruction.type);
+                    break;
+                case Instruction::Op::function:
+                    depth -= instruction.argumentsCount;
+                    stack[depth] = applyFunction(stack + depth,
+                                                 instruction.type,
+                                                 instruction.argumentsCount);
+                    depth++;
+                    break;
             }
         }
 
         // If the formula is well formed, the stack at the end has to be of size
         // 1
-        if (stack.size() == 1)
+        if (m_programIsWellFormed)
         {
-            resultValue = stack.back();
-            stack.pop_back();
+            resultValue = stack[0];
         }
 
         m_output.value(resultValue);
@@ -490,6 +605,7 @@ void DataConverterFormula::addOutputToken(FormulaToken* token,
 {
     m_outputQueue.push_back(token);
     m_argumentsCount[token] = argumentsCount;
+    m_programDirty = true;
 }
 
 // Warning! this clone override is not making a clean copy of the core object.
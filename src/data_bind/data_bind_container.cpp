@@ -2,9 +2,66 @@
 #include "rive/data_bind/data_bind_context.hpp"
 #include "rive/data_bind/data_bind.hpp"
 #include "rive/data_bind/data_context.hpp"
+#include <algorithm>
 
 using namespace rive;
 
+const std::vector<DataBind*> DataBindContainer::dataBinds() const
+{
+    if (m_removedDataBindCount == 0)
+    {
+        return m_dataBinds;
+    }
+    std::vector<DataBind*> dataBinds;
+    dataBinds.reserve(m_dataBinds.size() - m_removedDataBindCount);
+    for (auto dataBind : m_dataBinds)
+    {
+        if (dataBind != nullptr)
+        {
+            dataBinds.push_back(dataBind);
+        }
+    }
+    return dataBinds;
+}
+
+void DataBindContainer::compactDataBinds()
+{
+    if (m_removedDataBindCount == 0)
+    {
+        return;
+    }
+    uint32_t count = 0;
+    for (auto dataBind : m_dataBinds)
+    {
+        if (dataBind != nullptr)
+        {
+            dataBind->m_dataBindIndex = count;
+            m_dataBinds[count++] = dataBind;
+        }
+    }
+    m_dataBinds.resize(count);
+    m_removedDataBindCount = 0;
+}
+
+void DataBindContainer::compactPersistingDataBinds()
+{
+    if (m_removedPersistingDataBindCount == 0)
+    {
+        return;
+    }
+    uint32_t count = 0;
+    for (auto dataBind : m_persistingDataBinds)
+    {
+        if (dataBind != nullptr)
+        {
+            dataBind->m_persistingIndex = count;
+            m_persistingDataBinds[count++] = dataBind;
+        }
+    }
+    m_persistingDataBinds.resize(count);
+    m_removedPersistingDataBindCount = 0;
+}
+
 void DataBindContainer::deleteDataBinds()
 {
     for (auto& dataBind : m_dataBinds)
@@ -15,6 +72,7 @@ void DataBindContainer::deleteDataBinds()
 
 void DataBindContainer::unbindDataBinds()
 {
+    compactDataBinds();
     for (auto& dataBind : m_dataBinds)
     {
         dataBind->unbind();
@@ -24,6 +82,7 @@ void DataBindContainer::unbindDataBinds()
 
 void DataBindContainer::bindDataBindsFromContext(DataContext* dataContext)
 {
+    compactDataBinds();
     for (auto& dataBind : m_dataBinds)
     {
         if (dataBind->is<DataBindContext>())
@@ -36,6 +95,7 @@ void DataBindContainer::bindDataBindsFromContext(DataContext* dataContext)
 
 bool DataBindContainer::advanceDataBinds(float elapsedSeconds)
 {
+    compactDataBinds();
     if (m_dataBinds.size() == 0)
     {
         return false;
@@ -61,23 +121,50 @@ void DataBindContainer::removeDataBind(DataBind* dataBind)
         m_pendingRemovals.push_back(dataBind);
         return;
     }
-    auto eraseOne = [dataBind](std::vector<DataBind*>& v) {
-        v.erase(std::remove(v.begin(), v.end(), dataBind), v.end());
+    // Clears the bind's slot in v, found through its cached index. Should the
+    // index ever be stale, fall back to a scan rather than leave a pointer to
+    // a bind that is about to be deleted. Returns whether it was there.
+    auto clearSlot = [dataBind](std::vector<DataBind*>& v, uint32_t index) {
+        if (index < v.size() && v[index] == dataBind)
+        {
+            v[index] = nullptr;
+            return true;
+        }
+        auto itr = std::find(v.begin(), v.end(), dataBind);
+        if (itr == v.end())
+        {
+            return false;
+        }
+        *itr = nullptr;
+        return true;
     };
-    eraseOne(m_dataBinds);
+    if (clearSlot(m_dataBinds, dataBind->m_dataBindIndex))
+    {
+        m_removedDataBindCount++;
+    }
     if (dataBind->inPersistingList())
     {
-        eraseOne(m_persistingDataBinds);
+        if (clearSlot(m_persistingDataBinds, dataBind->m_persistingIndex))
+        {
+            m_removedPersistingDataBindCount++;
+        }
         dataBind->inPersistingList(false);
     }
     if (dataBind->inDirtyList())
     {
-        // Membership flag doesn't distinguish which dirty list contains the
-        // bind, so scan all four — toSource + toTarget × active + pending.
-        eraseOne(m_dirtyToSourceDataBinds);
-        eraseOne(m_pendingDirtyToSourceDataBinds);
-        eraseOne(m_dirtyDataBinds);
-        eraseOne(m_pendingDirtyDataBinds);
+        // Outside of updateDataBinds the pending lists are always empty (they
+        // get swapped in at the end of it), so the bind is normally in the
+        // active list for its direction. If not, look in all of them.
+        uint32_t index = dataBind->m_dirtyIndex;
+        bool toSource = dataBind->toSource();
+        if (!clearSlot(toSource ? m_dirtyToSourceDataBinds : m_dirtyDataBinds,
+                       index))
+        {
+            clearSlot(toSource ? m_dirtyDataBinds : m_dirtyToSourceDataBinds,
+                      index);
+            clearSlot(m_pendingDirtyToSourceDataBinds, index);
+            clearSlot(m_pendingDirtyDataBinds, index);
+        }
         dataBind->inDirtyList(false);
     }
     dataBind->container(nullptr);
@@ -94,6 +181,12 @@ void DataBindContainer::addDataBind(DataBind* dataBind)
         m_pendingAdditions.push_back(dataBind);
         return;
     }
+    // Don't let removed slots pile up in containers that never get advanced.
+    if (m_removedDataBindCount * 2 > m_dataBinds.size())
+    {
+        compactDataBinds();
+    }
+    dataBind->m_dataBindIndex = (uint32_t)m_dataBinds.size();
     m_dataBinds.push_back(dataBind);
     // toSource binds: prefer push notifications when the target supports it
     // (Alternative A — Core::notifyPropertyChanged). Fall back to per-frame
@@ -101,6 +194,12 @@ void DataBindContainer::addDataBind(DataBind* dataBind)
     // that don't go through a generated property setter.
     if (dataBind->toSource() && !dataBind->targetSupportsPush())
     {
+        if (m_removedPersistingDataBindCount * 2 >
+            m_persistingDataBinds.size())
+        {
+            compactPersistingDataBinds();
+        }
+        dataBind->m_persistingIndex = (uint32_t)m_persistingDataBinds.size();
         m_persistingDataBinds.push_back(dataBind);
         dataBind->inPersistingList(true);
     }
@@ -169,6 +268,7 @@ void DataBindContainer::updateDataBinds(bool applyTargetToSource)
     {
         return;
     }
+    compactPersistingDataBinds();
     m_isProcessing = true;
     for (auto& dataBind : m_persistingDataBinds)
     {
@@ -182,12 +282,21 @@ void DataBindContainer::updateDataBinds(bool applyTargetToSource)
     // the order that m_persistingDataBinds used to give us under polling.
     for (auto& dataBind : m_dirtyToSourceDataBinds)
     {
+        if (dataBind == nullptr)
+        {
+            // Removed after it was marked dirty.
+            continue;
+        }
         dataBind->inDirtyList(false);
         updateDataBind(dataBind, applyTargetToSource);
     }
     for (auto& dataBind : m_dirtyDataBinds)
     {
         // Pure toTarget binds — updateSourceBinding is a guarded no-op here.
+        if (dataBind == nullptr)
+        {
+            continue;
+        }
         dataBind->inDirtyList(false);
         updateDataBind(dataBind, applyTargetToSource);
     }
@@ -226,6 +335,7 @@ void DataBindContainer::updateDataBinds(bool applyTargetToSource)
 
 void DataBindContainer::sortDataBinds()
 {
+    compactDataBinds();
     size_t currentToSourceIndex = 0;
     for (size_t i = 0; i < m_dataBinds.size(); i++)
     {
@@ -240,6 +350,10 @@ void DataBindContainer::sortDataBinds()
             currentToSourceIndex += 1;
         }
     }
+    for (size_t i = 0; i < m_dataBinds.size(); i++)
+    {
+        m_dataBinds[i]->m_dataBindIndex = (uint32_t)i;
+    }
 }
 
 void DataBindContainer::addDirtyDataBind(DataBind* dataBind)
@@ -264,6 +378,7 @@ void DataBindContainer::addDirtyDataBind(DataBind* dataBind)
             ? (m_isProcessing ? m_pendingDirtyToSourceDataBinds
                               : m_dirtyToSourceDataBinds)
             : (m_isProcessing ? m_pendingDirtyDataBinds : m_dirtyDataBinds);
+    dataBind->m_dirtyIndex = (uint32_t)insertingList.size();
     insertingList.push_back(dataBind);
     dataBind->inDirtyList(true);
 }
\ No newline at end of file
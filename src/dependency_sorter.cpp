@@ -1,12 +1,37 @@
 #include "rive/dependency_sorter.hpp"
 #include "rive/component.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
 
 using namespace rive;
 
+// Stamps left behind by earlier sorters never match a later one's, so marks
+// don't need clearing. Starts past 0, the stamp of a component that was never
+// sorted.
+static std::atomic<uint32_t> s_nextGeneration{2};
+
+static uint32_t claimGeneration()
+{
+    uint32_t generation = s_nextGeneration.fetch_add(2);
+    if (generation == 0)
+    {
+        // Wrapped around, skip the unsorted stamp.
+        generation = s_nextGeneration.fetch_add(2);
+    }
+    return generation;
+}
+
+DependencySorter::DependencySorter() :
+    m_visiting(claimGeneration()),
+    m_sorted(m_visiting + 1)
+{}
+
 void DependencySorter::sort(Component* root, std::vector<Component*>& order)
 {
     order.clear();
     visit(root, order);
+    std::reverse(order.begin(), order.end());
 }
 
 void DependencySorter::sort(std::vector<Component*> roots,
@@ -17,33 +42,51 @@ void DependencySorter::sort(std::vector<Component*> roots,
     {
         visit(root, order);
     }
+    std::reverse(order.begin(), order.end());
 }
 
+// Walks with an explicit stack so deep hierarchies can't overflow the call
+// stack.
 bool DependencySorter::visit(Component* component,
                              std::vector<Component*>& order)
 {
-    if (m_Perm.find(component) != m_Perm.end())
+    if (component->m_sortMark == m_sorted)
     {
         return true;
     }
-    if (m_Temp.find(component) != m_Temp.end())
+    if (component->m_sortMark == m_visiting)
     {
         fprintf(stderr, "Dependency cycle!\n");
         return false;
     }
-
-    m_Temp.emplace(component);
-
-    auto dependents = component->dependents();
-    for (auto dependent : dependents)
+    component->m_sortMark = m_visiting;
+    m_stack.push_back({component, 0});
+    while (!m_stack.empty())
     {
-        if (!visit(dependent, order))
+        Frame& frame = m_stack.back();
+        const auto& dependents = frame.component->dependents();
+        if (frame.nextDependent == dependents.size())
+        {
+            frame.component->m_sortMark = m_sorted;
+            order.push_back(frame.component);
+            m_stack.pop_back();
+            continue;
+        }
+        Component* dependent = dependents[frame.nextDependent++];
+        if (dependent->m_sortMark == m_sorted)
         {
+            continue;
+        }
+        if (dependent->m_sortMark == m_visiting)
+        {
+            fprintf(stderr, "Dependency cycle!\n");
+            // Leave the cycle marked as visiting so later visits reaching it
+            // fail too.
+            m_stack.clear();
             return false;
         }
+        dependent->m_sortMark = m_visiting;
+        m_stack.push_back({dependent, 0});
     }
-    m_Perm.emplace(component);
-    order.insert(order.begin(), component);
-
     return true;
-}
\ No newline at end of file
+}
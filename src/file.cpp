@@ -3,6 +3,7 @@
 #include "rive/runtime_header.hpp"
 #include "rive/animation/animation.hpp"
 #include "rive/artboard_component_list.hpp"
+#include "rive/core/field_types/core_bool_type.hpp"
 #include "rive/core/field_types/core_color_type.hpp"
 #include "rive/core/field_types/core_double_type.hpp"
 #include "rive/core/field_types/core_string_type.hpp"
@@ -102,6 +103,12 @@
 #include "rive/viewmodel/viewmodel_property_symbol_list_index.hpp"
 #include "rive/viewmodel/runtime/viewmodel_runtime.hpp"
 #include "rive/view_model_type.hpp"
+#include "rive/artboard_referencer.hpp"
+#include "rive/data_bind/converters/data_converter_group_item.hpp"
+#include "rive/viewmodel/data_enum_value.hpp"
+#include "rive/viewmodel/viewmodel_property.hpp"
+#include <mutex>
+#include <unordered_set>
 
 // Default namespace for Rive Cpp code
 using namespace rive;
@@ -168,6 +175,55 @@ bool File::applyWasmRegistration(const std::string& moduleName, int ref)
 }
 #endif
 
+// Skips a property that the object being read doesn't understand, using
+// the property's field type. Returns false if the field type is unknown and
+// the rest of the object can't be read.
+static bool skipUnknownProperty(BinaryReader& reader,
+                                const RuntimeHeader& header,
+                                uint16_t propertyKey)
+{
+    // First see if core knows the property type.
+    int id = CoreRegistry::propertyFieldId(propertyKey);
+    if (id == -1)
+    {
+        // No, check if it's in toc.
+        id = header.propertyFieldId(propertyKey);
+    }
+
+    if (id == -1)
+    {
+        // Still couldn't find it, give up.
+        fprintf(stderr,
+                "Unknown property key %d, missing from property ToC.\n",
+                propertyKey);
+        return false;
+    }
+
+    switch (id)
+    {
+        case CoreUintType::id:
+            // Uint64 shares the uint type id; skip the full range so an
+            // unknown 64 bit value never aborts the read.
+            reader.readVarUint64();
+            break;
+        case CoreStringType::id:
+            reader.readStringView();
+            break;
+        case CoreDoubleType::id:
+            CoreDoubleType::deserialize(reader);
+            break;
+        case CoreColorType::id:
+            CoreColorType::deserialize(reader);
+            break;
+        case CoreBoolType::id:
+            // Core knows bools by their own type (the ToC stores them as
+            // uints), and they're a single byte rather than a varuint.
+            CoreBoolType::deserialize(reader);
+            break;
+    }
+    return true;
+}
+
 static Core* readRuntimeObject(BinaryReader& reader,
                                const RuntimeHeader& header)
 {
@@ -189,42 +245,12 @@ static Core* readRuntimeObject(BinaryReader& reader,
         }
         if (object == nullptr || !object->deserialize(propertyKey, reader))
         {
-            // We have an unknown object or property, first see if core knows
-            // the property type.
-            int id = CoreRegistry::propertyFieldId(propertyKey);
-            if (id == -1)
-            {
-                // No, check if it's in toc.
-                id = header.propertyFieldId(propertyKey);
-            }
-
-            if (id == -1)
+            // We have an unknown object or property.
+            if (!skipUnknownProperty(reader, header, propertyKey))
             {
-                // Still couldn't find it, give up.
-                fprintf(stderr,
-                        "Unknown property key %d, missing from property ToC.\n",
-                        propertyKey);
                 delete object;
                 return nullptr;
             }
-
-            switch (id)
-            {
-                case CoreUintType::id:
-                    // Uint64 shares the uint type id; skip the full range so
-                    // an unknown 64 bit value never aborts the read.
-                    reader.readVarUint64();
-                    break;
-                case CoreStringType::id:
-                    CoreStringType::deserialize(reader);
-                    break;
-                case CoreDoubleType::id:
-                    CoreDoubleType::deserialize(reader);
-                    break;
-                case CoreColorType::id:
-                    CoreColorType::deserialize(reader);
-                    break;
-            }
         }
     }
     if (object == nullptr)
@@ -238,6 +264,52 @@ static Core* readRuntimeObject(BinaryReader& reader,
     return object;
 }
 
+// Skips over an object without instancing it. Returns its core type key, or
+// 0 if it couldn't be skipped.
+static uint16_t skipRuntimeObject(BinaryReader& reader,
+                                  const RuntimeHeader& header)
+{
+    auto coreObjectKey = reader.readVarUintAs<uint16_t>();
+    while (true)
+    {
+        auto propertyKey = reader.readVarUintAs<uint16_t>();
+        if (propertyKey == 0)
+        {
+            break;
+        }
+        if (reader.hasError() ||
+            !skipUnknownProperty(reader, header, propertyKey))
+        {
+            return 0;
+        }
+    }
+    return reader.hasError() ? 0 : coreObjectKey;
+}
+
+// State kept by a lazily imported file until all of its artboards are read.
+struct File::LazyArtboards
+{
+    explicit LazyArtboards(const RuntimeHeader& runtimeHeader) :
+        header(runtimeHeader)
+    {}
+
+    // Whether objects of this type can be read after the rest of the file.
+    bool canDefer(uint16_t typeKey);
+
+    const RuntimeHeader header;
+    // Resolves deferred artboards' references into the rest of the file.
+    std::unique_ptr<BackboardImporter> backboard;
+    // The bytes of each artboard's objects that haven't been read yet. These
+    // point into the data the file was imported from.
+    std::unordered_map<Artboard*, Span<const uint8_t>> pending;
+    std::unordered_set<Artboard*> failed;
+    std::unordered_map<uint16_t, bool> deferrableTypes;
+    // Held while an artboard is loaded. Loading appends to lists the whole
+    // file shares, so this covers every artboard rather than just one, and
+    // it's recursive because loading an artboard loads the ones it nests.
+    std::recursive_mutex mutex;
+};
+
 bool File::deterministicMode = false;
 
 File::File(Factory* factory, rcp<FileAssetLoader> assetLoader) :
@@ -292,6 +364,35 @@ rcp<File> File::import(Span<const uint8_t> bytes,
                        ImportResult* result,
                        rcp<FileAssetLoader> assetLoader,
                        ScriptingVM* vm)
+{
+    return importBytes(bytes,
+                       factory,
+                       result,
+                       std::move(assetLoader),
+                       vm,
+                       /*lazy=*/false);
+}
+
+rcp<File> File::importLazy(Span<const uint8_t> bytes,
+                           Factory* factory,
+                           ImportResult* result,
+                           rcp<FileAssetLoader> assetLoader,
+                           ScriptingVM* vm)
+{
+    return importBytes(bytes,
+                       factory,
+                       result,
+                       std::move(assetLoader),
+                       vm,
+                       /*lazy=*/true);
+}
+
+rcp<File> File::importBytes(Span<const uint8_t> bytes,
+                            Factory* factory,
+                            ImportResult* result,
+                            rcp<FileAssetLoader> assetLoader,
+                            ScriptingVM* vm,
+                            bool lazy)
 {
     BinaryReader reader(bytes);
     RuntimeHeader header;
@@ -327,6 +428,10 @@ rcp<File> File::import(Span<const uint8_t> bytes,
 #else
     (void)vm;
 #endif
+    if (lazy)
+    {
+        file->m_lazyArtboards = std::make_unique<LazyArtboards>(header);
+    }
 
     auto readResult = file->read(reader, header);
     if (result)
@@ -344,13 +449,45 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
 {
     ImportStack importStack;
     importStack.version(header.majorVersion(), header.minorVersion());
+    ImportResult readResult =
+        readObjects(reader, header, importStack, /*lastBindableObject=*/nullptr);
+    if (readResult != ImportResult::success)
+    {
+        return readResult;
+    }
+
+    std::vector<ArtboardReferencer*> artboardReferencers;
+    auto backboardImporter =
+        importStack.latest<BackboardImporter>(Backboard::typeKey);
+    if (m_lazyArtboards != nullptr && backboardImporter != nullptr)
+    {
+        // Deferred artboards resolve against the same assets, artboards and
+        // converters the backboard did.
+        m_lazyArtboards->backboard = backboardImporter->makeDeferred();
+        artboardReferencers = backboardImporter->artboardReferencers();
+    }
+
+    auto resolved = importStack.resolve();
 #ifdef WITH_RIVE_SCRIPTING
-    std::vector<InBandContent> inBandContent;
+    registerScripts();
 #endif
+    if (reader.hasError() || resolved != StatusCode::Ok)
+    {
+        return ImportResult::malformed;
+    }
+    // Artboards that were read up front may nest deferred ones.
+    loadReferencedArtboards(artboardReferencers);
+    return ImportResult::success;
+}
+
+ImportResult File::readObjects(BinaryReader& reader,
+                               const RuntimeHeader& header,
+                               ImportStack& importStack,
+                               Core* lastBindableObject)
+{
     // TODO: @hernan consider moving this to a special importer. It's not that
     // simple because Core doesn't have a typeKey, so it should be treated as
     // a special case. In any case, it's not that bad having it here for now.
-    Core* lastBindableObject = nullptr;
     while (!reader.reachedEnd())
     {
         auto object = readRuntimeObject(reader, header);
@@ -444,8 +581,14 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
                 static_cast<BackboardImporter*>(stackObject.get())->file(this);
                 break;
             case Artboard::typeKey:
-                stackObject =
-                    std::make_unique<ArtboardImporter>(object->as<Artboard>());
+                // A lazily imported file skips over the artboard's objects and
+                // reads them the first time the artboard is used.
+                if (m_lazyArtboards == nullptr ||
+                    !deferArtboard(object->as<Artboard>(), reader))
+                {
+                    stackObject = std::make_unique<ArtboardImporter>(
+                        object->as<Artboard>());
+                }
                 break;
             case DataEnumCustom::typeKey:
                 stackObject = std::make_unique<EnumImporter>(
@@ -715,13 +858,137 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
         }
     }
 
-    auto resolved = importStack.resolve();
-#ifdef WITH_RIVE_SCRIPTING
-    registerScripts();
-#endif
-    return !reader.hasError() && resolved == StatusCode::Ok
-               ? ImportResult::success
-               : ImportResult::malformed;
+    return ImportResult::success;
+}
+
+bool File::LazyArtboards::canDefer(uint16_t typeKey)
+{
+    auto itr = deferrableTypes.find(typeKey);
+    if (itr != deferrableTypes.end())
+    {
+        return itr->second;
+    }
+    // Objects that append to the file's own lists, which other objects index
+    // into, have to be read in file order. So do scripted objects, which
+    // register with the VM as the file loads. An artboard that contains any of
+    // them is read up front.
+    Core* object = CoreRegistry::makeCoreInstance(typeKey);
+    bool deferrable =
+        object == nullptr ||
+        !(object->is<Backboard>() || object->is<FileAsset>() ||
+          object->is<FileAssetContents>() || object->is<ViewModel>() ||
+          object->is<ViewModelProperty>() || object->is<DataEnum>() ||
+          object->is<DataEnumValue>() || object->is<ViewModelInstance>() ||
+          object->is<ViewModelInstanceValue>() || object->is<DataConverter>() ||
+          object->is<DataConverterGroupItem>() ||
+          object->is<ScrollPhysics>() || ScriptedObject::from(object) != nullptr);
+    delete object;
+    deferrableTypes[typeKey] = deferrable;
+    return deferrable;
+}
+
+bool File::deferArtboard(Artboard* artboard, BinaryReader& reader)
+{
+    // Find where the artboard's objects end (the next artboard or the end of
+    // the file) without instancing any of them.
+    BinaryReader scanner = reader;
+    BinaryReader end = scanner;
+    while (!scanner.reachedEnd())
+    {
+        uint16_t typeKey = skipRuntimeObject(scanner, m_lazyArtboards->header);
+        if (typeKey == Artboard::typeKey)
+        {
+            break;
+        }
+        if (typeKey == 0 || !m_lazyArtboards->canDefer(typeKey))
+        {
+            return false;
+        }
+        end = scanner;
+    }
+    const uint8_t* begin = reader.position();
+    m_lazyArtboards->pending[artboard] =
+        Span<const uint8_t>(begin, end.position() - begin);
+    reader = end;
+    return true;
+}
+
+Artboard* File::loadArtboard(Artboard* artboard) const
+{
+    if (artboard == nullptr || m_lazyArtboards == nullptr)
+    {
+        return artboard;
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_lazyArtboards->mutex);
+    if (m_lazyArtboards->failed.count(artboard) != 0)
+    {
+        return nullptr;
+    }
+    auto itr = m_lazyArtboards->pending.find(artboard);
+    if (itr == m_lazyArtboards->pending.end())
+    {
+        return artboard;
+    }
+    Span<const uint8_t> bytes = itr->second;
+    // Erase before reading so artboards that nest each other don't recurse.
+    m_lazyArtboards->pending.erase(itr);
+    // Loading only finishes the import that was started, so it's logically
+    // const, but it appends to the file's lists just like the initial read.
+    if (!const_cast<File*>(this)->readDeferredArtboard(artboard, bytes))
+    {
+        fprintf(stderr,
+                "Failed to load artboard %s\n",
+                artboard->name().c_str());
+        m_lazyArtboards->failed.insert(artboard);
+        return nullptr;
+    }
+    return artboard;
+}
+
+bool File::readDeferredArtboard(Artboard* artboard, Span<const uint8_t> bytes)
+{
+    if (m_lazyArtboards->backboard == nullptr)
+    {
+        return false;
+    }
+    const RuntimeHeader& header = m_lazyArtboards->header;
+    ImportStack importStack;
+    importStack.version(header.majorVersion(), header.minorVersion());
+    importStack.makeLatest(Backboard::typeKey,
+                           m_lazyArtboards->backboard->makeDeferred());
+    auto backboardImporter =
+        importStack.latest<BackboardImporter>(Backboard::typeKey);
+    importStack.makeLatest(Artboard::typeKey,
+                           std::make_unique<ArtboardImporter>(artboard));
+
+    BinaryReader reader(bytes);
+    if (readObjects(reader, header, importStack, artboard) !=
+        ImportResult::success)
+    {
+        return false;
+    }
+    std::vector<ArtboardReferencer*> artboardReferencers =
+        backboardImporter->artboardReferencers();
+    if (importStack.resolve() != StatusCode::Ok || reader.hasError())
+    {
+        return false;
+    }
+    loadReferencedArtboards(artboardReferencers);
+    return true;
+}
+
+void File::loadReferencedArtboards(
+    const std::vector<ArtboardReferencer*>& artboardReferencers) const
+{
+    if (m_lazyArtboards == nullptr || m_lazyArtboards->backboard == nullptr)
+    {
+        return;
+    }
+    for (auto referencer : artboardReferencers)
+    {
+        loadArtboard(m_lazyArtboards->backboard->artboard(
+            referencer->referencedArtboardId()));
+    }
 }
 
 void File::addFileViewModelInstance(ViewModelInstance* viewModelInstance)
@@ -1014,7 +1281,7 @@ Artboard* File::artboard(std::string name) const
     {
         if (artboard->name() == name)
         {
-            return artboard;
+            return loadArtboard(artboard);
         }
     }
     return nullptr;
@@ -1026,7 +1293,7 @@ Artboard* File::artboard() const
     {
         return nullptr;
     }
-    return m_artboards[0];
+    return loadArtboard(m_artboards[0]);
 }
 
 Artboard* File::artboard(size_t index) const
@@ -1035,13 +1302,47 @@ Artboard* File::artboard(size_t index) const
     {
         return nullptr;
     }
-    return m_artboards[index];
+    return loadArtboard(m_artboards[index]);
+}
+
+std::vector<Artboard*> File::artboards()
+{
+    for (auto artboard : m_artboards)
+    {
+        loadArtboard(artboard);
+    }
+    return m_artboards;
 }
 
 std::string File::artboardNameAt(size_t index) const
 {
-    auto ab = this->artboard(index);
-    return ab ? ab->name() : "";
+    // Names are read up front, so this doesn't need to load the artboard.
+    return index < m_artboards.size() ? m_artboards[index]->name() : "";
+}
+
+bool File::artboardLoaded(size_t index) const
+{
+    if (index >= m_artboards.size() || m_lazyArtboards == nullptr)
+    {
+        return index < m_artboards.size();
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_lazyArtboards->mutex);
+    Artboard* artboard = m_artboards[index];
+    return m_lazyArtboards->pending.count(artboard) == 0 &&
+           m_lazyArtboards->failed.count(artboard) == 0;
+}
+
+int File::artboardIndexForViewModel(uint32_t viewModelId) const
+{
+    // View model ids are read up front too, so nothing gets loaded here.
+    for (size_t i = 0; i < m_artboards.size(); ++i)
+    {
+        if (m_artboards[i]->viewModelId() == viewModelId)
+        {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
 }
 
 std::unique_ptr<ArtboardInstance> File::instanceArtboard(Artboard* ab) const
@@ -1506,7 +1807,8 @@ ViewModelInstanceListItem* File::viewModelInstanceListItem(
     {
         if (artboard->viewModelId() == viewModelInstance->viewModelId())
         {
-            return viewModelInstanceListItem(viewModelInstance, artboard);
+            return viewModelInstanceListItem(viewModelInstance,
+                                             loadArtboard(artboard));
         }
     }
     return nullptr;
@@ -73,6 +73,25 @@ void BackboardImporter::addArtboard(Artboard* artboard)
 
 void BackboardImporter::addMissingArtboard() { m_NextArtboardId++; }
 
+Artboard* BackboardImporter::artboard(int artboardId) const
+{
+    auto itr = m_ArtboardLookup.find(artboardId);
+    return itr == m_ArtboardLookup.end() ? nullptr : itr->second;
+}
+
+std::unique_ptr<BackboardImporter> BackboardImporter::makeDeferred() const
+{
+    auto deferred = std::make_unique<BackboardImporter>(m_Backboard);
+    deferred->m_ArtboardLookup = m_ArtboardLookup;
+    deferred->m_FileAssets = m_FileAssets;
+    deferred->m_DataConverters = m_DataConverters;
+    deferred->m_interpolators = m_interpolators;
+    deferred->m_physics = m_physics;
+    deferred->m_NextArtboardId = m_NextArtboardId;
+    deferred->m_file = m_file;
+    return deferred;
+}
+
 StatusCode BackboardImporter::resolve()
 {
     for (auto nestedArtboard : m_ArtboardsReferencers)
@@ -23,19 +23,25 @@ ListenerGroup::~ListenerGroup()
 
 _PointerData* ListenerGroup::pointerData(int id)
 {
-    if (m_pointers.find(id) == m_pointers.end())
+    // Called for every group on every pointer event, so look the pointer up
+    // once.
+    auto itr = m_pointers.find(id);
+    if (itr != m_pointers.end())
     {
-        if (m_pointersPool.size() > 0)
-        {
-            m_pointers[id] = m_pointersPool.back();
-            m_pointersPool.pop_back();
-        }
-        else
-        {
-            m_pointers[id] = new _PointerData();
-        }
+        return itr->second;
+    }
+    _PointerData* pointer;
+    if (m_pointersPool.size() > 0)
+    {
+        pointer = m_pointersPool.back();
+        m_pointersPool.pop_back();
+    }
+    else
+    {
+        pointer = new _PointerData();
     }
-    return m_pointers[id];
+    m_pointers[id] = pointer;
+    return pointer;
 }
 
 void ListenerGroup::hover(int id)
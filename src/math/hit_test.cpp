@@ -5,8 +5,12 @@
 #include "rive/math/hit_test.hpp"
 
 #include "rive/math/mat2d.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/math/simd.hpp"
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <cfloat>
 #include <cmath>
 
 // Should we make this an option at runtime?
@@ -366,6 +370,255 @@ bool HitTester::test(FillRule rule)
 
 /////////////////////////
 
+// Floats per block of four edges.
+static constexpr size_t kBlockSize = 16;
+static constexpr size_t kMaxEdges =
+    HitTestPolylines::kMaxBytes / (kBlockSize / 4 * sizeof(float));
+
+static std::atomic<size_t> s_budgetBytesUsed{0};
+
+HitTestPolylines::~HitTestPolylines()
+{
+    s_budgetBytesUsed.fetch_sub(m_claimedBytes, std::memory_order_relaxed);
+}
+
+size_t HitTestPolylines::BudgetBytesUsed()
+{
+    return s_budgetBytesUsed.load(std::memory_order_relaxed);
+}
+
+void HitTestPolylines::release()
+{
+    s_budgetBytesUsed.fetch_sub(m_claimedBytes, std::memory_order_relaxed);
+    m_claimedBytes = 0;
+    m_blocks = std::vector<float>();
+    m_edgeCount = 0;
+}
+
+void HitTestPolylines::addEdge(Vec2D p0, Vec2D p1)
+{
+    // Horizontal edges never change the winding (see clip_line).
+    if (p0.y == p1.y)
+    {
+        return;
+    }
+    if (m_edgeCount == kMaxEdges)
+    {
+        m_overflowed = true;
+        return;
+    }
+    m_edges.push_back({p0, p1});
+    m_edgeCount++;
+}
+
+// Mirrors HitTester::recurse_cubic, minus the rejection against the hit area,
+// so the curve is split into the same segments.
+void HitTestPolylines::addCubic(Vec2D a, Vec2D b, Vec2D c, Vec2D d, int count)
+{
+    if (count > MAX_LOCAL_SEGMENTS)
+    {
+        CubicChop chop(a, b, c, d);
+        const int newCount = (count + 1) >> 1;
+        addCubic(chop[0], chop[1], chop[2], chop[3], newCount);
+        addCubic(chop[3], chop[4], chop[5], chop[6], newCount);
+        return;
+    }
+    const float dt = 1.0f / (float)count;
+    float t = dt;
+
+    CubicCoeff cube(a, b, c, d);
+    Point prev = a;
+    for (int i = 1; i < count - 1; ++i)
+    {
+        auto next = cube.eval(t);
+        addEdge(Vec2D(prev.x, prev.y), Vec2D(next.x, next.y));
+        prev = next;
+        t += dt;
+    }
+    addEdge(Vec2D(prev.x, prev.y), d);
+}
+
+void HitTestPolylines::addPath(const RawPath& path, const Mat2D& xform)
+{
+    assert(m_claimedBytes == 0);
+    Vec2D first, prev;
+    bool open = false;
+    for (auto iter : path)
+    {
+        PathVerb verb = std::get<0>(iter);
+        const Vec2D* pts = std::get<1>(iter);
+        switch (verb)
+        {
+            case PathVerb::move:
+                if (open)
+                {
+                    addEdge(prev, first);
+                }
+                first = prev = xform * pts[0];
+                open = true;
+                break;
+            case PathVerb::line:
+            {
+                Vec2D next = xform * pts[1];
+                addEdge(prev, next);
+                prev = next;
+                break;
+            }
+            case PathVerb::quad:
+            case PathVerb::cubic:
+            {
+                // Quads become cubics the same way RawPath::addTo passes them
+                // to HitTester.
+                Vec2D b, c, d;
+                if (verb == PathVerb::quad)
+                {
+                    b = xform * Vec2D::lerp(pts[0], pts[1], 2 / 3.f);
+                    c = xform * Vec2D::lerp(pts[2], pts[1], 2 / 3.f);
+                    d = xform * pts[2];
+                }
+                else
+                {
+                    b = xform * pts[1];
+                    c = xform * pts[2];
+                    d = xform * pts[3];
+                }
+                addCubic(prev, b, c, d, compute_cubic_segments(prev, b, c, d));
+                prev = d;
+                break;
+            }
+            case PathVerb::close:
+                if (open)
+                {
+                    addEdge(prev, first);
+                    prev = first;
+                    open = false;
+                }
+                break;
+        }
+    }
+    // HitTester closes open contours too.
+    if (open)
+    {
+        addEdge(prev, first);
+    }
+}
+
+bool HitTestPolylines::commit()
+{
+    assert(m_claimedBytes == 0);
+    if (m_overflowed)
+    {
+        m_edges = std::vector<Edge>();
+        release();
+        return false;
+    }
+    std::sort(m_edges.begin(),
+              m_edges.end(),
+              [](const Edge& a, const Edge& b) {
+                  return std::min(a.p0.y, a.p1.y) < std::min(b.p0.y, b.p1.y);
+              });
+    // Pad the last block with edges that every hit area rejects.
+    m_blocks.assign((m_edges.size() + 3) / 4 * kBlockSize, FLT_MAX);
+    for (size_t i = 0; i < m_edges.size(); ++i)
+    {
+        float* block = m_blocks.data() + i / 4 * kBlockSize;
+        size_t lane = i % 4;
+        block[lane] = m_edges[i].p0.x;
+        block[4 + lane] = m_edges[i].p0.y;
+        block[8 + lane] = m_edges[i].p1.x;
+        block[12 + lane] = m_edges[i].p1.y;
+    }
+    m_edges = std::vector<Edge>();
+    size_t bytes = byteSize();
+    size_t used = s_budgetBytesUsed.load(std::memory_order_relaxed);
+    do
+    {
+        if (used + bytes > kBudgetBytes)
+        {
+            release();
+            return false;
+        }
+    } while (!s_budgetBytesUsed.compare_exchange_weak(
+        used,
+        used + bytes,
+        std::memory_order_relaxed));
+    m_claimedBytes = bytes;
+    return true;
+}
+
+bool HitTestPolylines::test(const IAABB& area, FillRule rule) const
+{
+    const int iwidth = area.width();
+    const int iheight = area.height();
+    if (iwidth <= 0 || iheight <= 0)
+    {
+        return false;
+    }
+    const float height = (float)iheight;
+
+    // Hit radii are a couple of pixels, so the grid nearly always fits on the
+    // stack.
+    int stackDeltas[64];
+    std::vector<int> heapDeltas;
+    int* deltas = stackDeltas;
+    const size_t cellCount = (size_t)iwidth * iheight;
+    if (cellCount > sizeof(stackDeltas) / sizeof(*stackDeltas))
+    {
+        heapDeltas.resize(cellCount);
+        deltas = heapDeltas.data();
+    }
+    std::fill(deltas, deltas + cellCount, 0);
+
+    const float4 left = (float)area.left;
+    const float4 top = (float)area.top;
+    // append_line drops crossings at or right of the grid, leave a pixel of
+    // slack for the rounding in its interpolation.
+    const float4 right = (float)iwidth + 1.0f;
+    for (size_t i = 0; i < m_blocks.size(); i += kBlockSize)
+    {
+        const float* block = m_blocks.data() + i;
+        float4 x0 = simd::load4f(block) - left;
+        float4 y0 = simd::load4f(block + 4) - top;
+        float4 x1 = simd::load4f(block + 8) - left;
+        float4 y1 = simd::load4f(block + 12) - top;
+        // Blocks are sorted by their top edge, which the first lane holds.
+        if (std::min(y0[0], y1[0]) >= height)
+        {
+            break;
+        }
+        // The same rejection as clip_line, plus edges entirely to the right.
+        auto crosses = ((y0 > 0.0f) | (y1 > 0.0f)) &
+                       ((y0 < height) | (y1 < height)) &
+                       ((x0 < right) | (x1 < right));
+        if (!simd::any(crosses))
+        {
+            continue;
+        }
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            if (crosses[lane])
+            {
+                clip_line(height,
+                          Point(x0[lane], y0[lane]),
+                          Point(x1[lane], y1[lane]),
+                          deltas,
+                          iwidth);
+            }
+        }
+    }
+
+    const int mask = (rule == rive::FillRule::nonZero) ? -1 : 1;
+
+    int nonzero = 0;
+    for (size_t i = 0; i < cellCount; ++i)
+    {
+        nonzero |= (deltas[i] & mask);
+    }
+    return nonzero != 0;
+}
+
+/////////////////////////
+
 static bool cross_lt(Vec2D a, Vec2D b) { return a.x * b.y < a.y * b.x; }
 
 bool HitTester::testMesh(Vec2D pt, Span<Vec2D> verts, Span<uint16_t> indices)
@@ -1,6 +1,7 @@
 #include "rive/math/mat2d.hpp"
 #include "rive/renderer.hpp"
 #include "rive/text_engine.hpp"
+#include "rive/text/shaped_paragraph_cache.hpp"
 
 using namespace rive;
 
@@ -153,6 +154,13 @@ bool rive::isWhiteSpace(Unichar c)
     return c <= ' ' || c == 0x2028 || c == 0x200B;
 }
 
+Font::~Font()
+{
+#ifdef WITH_RIVE_TEXT
+    ShapedParagraphCache::purgeFont(this);
+#endif
+}
+
 SimpleArray<Paragraph> Font::shapeText(Span<const Unichar> text,
                                        Span<const TextRun> runs,
                                        int textDirectionFlag) const
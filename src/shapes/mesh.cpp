@@ -22,7 +22,11 @@ void Mesh::markDrawableDirty()
     addDirt(ComponentDirt::Vertices);
 }
 
-void Mesh::addVertex(MeshVertex* vertex) { m_Vertices.push_back(vertex); }
+void Mesh::addVertex(MeshVertex* vertex)
+{
+    m_Vertices.push_back(vertex);
+    skinnedVerticesChanged();
+}
 
 StatusCode Mesh::onAddedDirty(CoreContext* context)
 {
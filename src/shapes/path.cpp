@@ -1,4 +1,5 @@
 #include "rive/shapes/path.hpp"
+#include "rive/bones/skinnable.hpp"
 #include "rive/renderer.hpp"
 #include "rive/shapes/cubic_vertex.hpp"
 #include "rive/shapes/cubic_detached_vertex.hpp"
@@ -98,9 +99,25 @@ StatusCode Path::onAddedClean(CoreContext* context)
 
 void Path::buildDependencies() { Super::buildDependencies(); }
 
-void Path::addVertex(PathVertex* vertex) { m_Vertices.push_back(vertex); }
+static void verticesChanged(Path* path)
+{
+    if (auto skinnable = Skinnable::from(path))
+    {
+        skinnable->skinnedVerticesChanged();
+    }
+}
 
-void Path::popVertex() { m_Vertices.pop_back(); }
+void Path::addVertex(PathVertex* vertex)
+{
+    m_Vertices.push_back(vertex);
+    verticesChanged(this);
+}
+
+void Path::popVertex()
+{
+    m_Vertices.pop_back();
+    verticesChanged(this);
+}
 
 void Path::addFlags(PathFlags flags) { m_pathFlags |= flags; }
 bool Path::isFlagged(PathFlags flags) const
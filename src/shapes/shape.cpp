@@ -13,6 +13,7 @@
 #include "rive/artboard.hpp"
 #include "rive/clip_result.hpp"
 #include "rive/math/contour_measure.hpp"
+#include "rive/math/hit_test.hpp"
 #include "rive/math/raw_path.hpp"
 #include "rive/profiler/profiler_macros.h"
 #include <algorithm>
@@ -21,6 +22,8 @@ using namespace rive;
 
 Shape::Shape() : m_PathComposer(this) {}
 
+Shape::~Shape() {}
+
 void Shape::addPath(Path* path)
 {
     // Make sure the path is not already in the shape.
@@ -164,6 +167,28 @@ void Shape::draw(Renderer* renderer)
     }
 }
 
+void Shape::markBoundsDirty()
+{
+    drawableFlags(drawableFlags() & ~static_cast<unsigned short>(
+                                        DrawableFlag::WorldBoundsClean));
+    m_WorldLength = -1;
+    m_worldBoundsVersion++;
+    m_hitCacheState = HitCacheState::untested;
+    m_hitPolylines = nullptr;
+    if (auto ab = artboard())
+    {
+        ab->markWorldBoundsChanged();
+    }
+#ifdef WITH_RIVE_LAYOUT
+    // A participant's intrinsic bounds drive its layout slot, so
+    // re-measure/re-solve when they change.
+    if (auto* participant = layoutParticipant())
+    {
+        participant->markLayoutNodeDirty();
+    }
+#endif
+}
+
 bool Shape::hitTestAABB(const Vec2D& position)
 {
     return worldBounds().contains(position);
@@ -176,6 +201,10 @@ bool Shape::hitTestHiFi(const Vec2D& position, float hitRadius)
                         position.x + hitRadius,
                         position.y + hitRadius)
                        .round();
+    if (auto polylines = hitPolylines())
+    {
+        return polylines->test(hitArea);
+    }
     HitTestCommandPath tester(hitArea);
 
     for (auto path : m_Paths)
@@ -189,6 +218,46 @@ bool Shape::hitTestHiFi(const Vec2D& position, float hitRadius)
     return tester.wasHit();
 }
 
+const HitTestPolylines* Shape::hitPolylines()
+{
+    // A deferred path update leaves the paths changed without marking the
+    // bounds dirty, so nothing would drop a cache built on them.
+    if (m_PathComposer.hasDeferredPathDirt())
+    {
+        return nullptr;
+    }
+    switch (m_hitCacheState)
+    {
+        case HitCacheState::untested:
+            m_hitCacheState = HitCacheState::tested;
+            return nullptr;
+        case HitCacheState::tested:
+        {
+            auto polylines = std::make_unique<HitTestPolylines>();
+            for (auto path : m_Paths)
+            {
+                if (!path->isCollapsed())
+                {
+                    polylines->addPath(path->rawPath(), path->pathTransform());
+                }
+            }
+            if (!polylines->commit())
+            {
+                m_hitCacheState = HitCacheState::rejected;
+                return nullptr;
+            }
+            m_hitCacheState = HitCacheState::cached;
+            m_hitPolylines = std::move(polylines);
+            return m_hitPolylines.get();
+        }
+        case HitCacheState::cached:
+            return m_hitPolylines.get();
+        case HitCacheState::rejected:
+            return nullptr;
+    }
+    RIVE_UNREACHABLE();
+}
+
 Core* Shape::hitTest(HitInfo* hinfo, const Mat2D& xform)
 {
     if (renderOpacity() == 0.0f)
@@ -32,6 +32,11 @@ void SliceMesh::draw(Renderer* renderer,
     {
         return;
     }
+    if (m_buffersDirty && m_nslicer->image()->imageAsset() != nullptr)
+    {
+        updateBuffers();
+        m_buffersDirty = false;
+    }
     if (!m_VertexRenderBuffer || !m_UVRenderBuffer || !m_IndexRenderBuffer)
     {
         return;
@@ -396,5 +401,5 @@ void SliceMesh::update()
     }
 
     calc();
-    updateBuffers();
+    m_buffersDirty = true;
 }
@@ -2,8 +2,76 @@
 #include "rive/text/fully_shaped_text.hpp"
 #include "rive/text/text.hpp"
 
+#include <algorithm>
+#include <cassert>
+
 using namespace rive;
 
+// Whether shaping text with run a gives the same glyphs as with run b.
+static bool shapes_like(const TextRun& a, const TextRun& b)
+{
+    return a.font == b.font && a.size == b.size &&
+           a.lineHeight == b.lineHeight && a.letterSpacing == b.letterSpacing &&
+           a.script == b.script && a.styleId == b.styleId && a.level == b.level;
+}
+
+// Shapes one '\n' terminated chunk of text (or the unterminated end of it)
+// the way Font::shapeText() would have as part of the whole text.
+static SimpleArray<Paragraph> shape_chunk(Span<const Unichar> text,
+                                          uint32_t start,
+                                          uint32_t length,
+                                          const TextRun& run)
+{
+    TextRun chunkRun = run;
+    chunkRun.unicharCount = length;
+    SimpleArray<Paragraph> paragraphs =
+        run.font->shapeText(Span<const Unichar>(text.data() + start, length),
+                            Span<const TextRun>(&chunkRun, 1));
+    GlyphRun* lastRun = nullptr;
+    for (Paragraph& paragraph : paragraphs)
+    {
+        for (GlyphRun& glyphRun : paragraph.runs)
+        {
+            for (uint32_t& textIndex : glyphRun.textIndices)
+            {
+                textIndex += start;
+            }
+            for (uint32_t& joiner : glyphRun.joiners)
+            {
+                joiner += start;
+            }
+            lastRun = &glyphRun;
+        }
+    }
+    // Font::shapeText() closes off the last word of the text it's given. Only
+    // the real end of the text gets that, so drop it from chunks that end in a
+    // '\n' (whitespace, which leaves the word break state where a new text
+    // starts it).
+    if (lastRun != nullptr && start + length != text.size())
+    {
+        assert(text[start + length - 1] == '\n');
+        assert(lastRun->breaks.size() >= 2);
+        lastRun->breaks = SimpleArray<uint32_t>(lastRun->breaks.data(),
+                                                lastRun->breaks.size() - 2);
+    }
+    return paragraphs;
+}
+
+static void shift_text_indices(Paragraph& paragraph, int64_t delta)
+{
+    for (GlyphRun& glyphRun : paragraph.runs)
+    {
+        for (uint32_t& textIndex : glyphRun.textIndices)
+        {
+            textIndex = (uint32_t)(textIndex + delta);
+        }
+        for (uint32_t& joiner : glyphRun.joiners)
+        {
+            joiner = (uint32_t)(joiner + delta);
+        }
+    }
+}
+
 void FullyShapedText::shape(Span<Unichar> text,
                             Span<TextRun> runs,
                             TextSizing sizing,
@@ -23,6 +91,24 @@ void FullyShapedText::shape(Span<Unichar> text,
                          sizing == TextSizing::autoWidth ? -1.0f : maxWidth,
                          alignment,
                          wrap);
+    // reshape() can't reuse anything from this.
+    m_shapedChunks.clear();
+    m_shapedText.clear();
+    layoutLines(sizing,
+                maxWidth,
+                maxHeight,
+                origin,
+                overflow,
+                paragraphSpacing);
+}
+
+void FullyShapedText::layoutLines(TextSizing sizing,
+                                  float maxWidth,
+                                  float maxHeight,
+                                  TextOrigin origin,
+                                  TextOverflow overflow,
+                                  float paragraphSpacing)
+{
     m_orderedLines.clear();
     m_ellipsisRun = {};
 
@@ -142,6 +228,208 @@ void FullyShapedText::shape(Span<Unichar> text,
         }
         y += paragraphSpacing;
     }
-    return;
 }
-#endif
\ No newline at end of file
+
+void FullyShapedText::reshape(Span<const Unichar> text,
+                              const TextRun& run,
+                              TextSizing sizing,
+                              float maxWidth,
+                              float maxHeight,
+                              TextAlign alignment,
+                              TextWrap wrap,
+                              TextOrigin origin,
+                              TextOverflow overflow,
+                              float paragraphSpacing)
+{
+    const float width = sizing == TextSizing::autoWidth ? -1.0f : maxWidth;
+    const float breakWidth =
+        (width == -1.0f || wrap == TextWrap::noWrap) ? -1.0f : width;
+    const bool reuseShapes =
+        !m_shapedChunks.empty() && shapes_like(run, m_shapedRun) &&
+        m_shapedFallbackProc == Font::gFallbackProc &&
+        m_shapedFallbackProcEnabled == Font::gFallbackProcEnabled;
+    const bool reuseLines = reuseShapes && breakWidth == m_shapedBreakWidth;
+
+    // Find the range of text that changed.
+    const size_t oldSize = m_shapedText.size();
+    const size_t newSize = text.size();
+    const size_t commonSize = std::min(oldSize, newSize);
+    size_t prefix = 0;
+    size_t suffix = 0;
+    if (reuseShapes)
+    {
+        while (prefix < commonSize && m_shapedText[prefix] == text[prefix])
+        {
+            prefix++;
+        }
+        while (suffix < commonSize - prefix &&
+               m_shapedText[oldSize - 1 - suffix] == text[newSize - 1 - suffix])
+        {
+            suffix++;
+        }
+    }
+    const int64_t delta = (int64_t)newSize - (int64_t)oldSize;
+
+    // Leading chunks entirely before the change are still chunks of the new
+    // text, as long as they're still the last chunk if (and only if) they were
+    // before.
+    size_t headCount = 0;
+    uint32_t headParagraphCount = 0;
+    uint32_t headEnd = 0;
+    if (reuseShapes)
+    {
+        for (const ShapedChunk& chunk : m_shapedChunks)
+        {
+            uint32_t end = chunk.textStart + chunk.textLength;
+            if (end > prefix || (end == oldSize) != (end == newSize))
+            {
+                break;
+            }
+            headCount++;
+            headParagraphCount += chunk.paragraphCount;
+            headEnd = end;
+        }
+    }
+
+    // Trailing chunks entirely after the change are too, as long as a '\n'
+    // still precedes them.
+    size_t tailCount = 0;
+    uint32_t tailParagraphCount = 0;
+    size_t tailStart = newSize;
+    if (reuseShapes)
+    {
+        for (size_t i = m_shapedChunks.size(); i > headCount; --i)
+        {
+            const ShapedChunk& chunk = m_shapedChunks[i - 1];
+            int64_t start = chunk.textStart + delta;
+            if (chunk.textStart < oldSize - suffix || start < headEnd ||
+                (start > 0 && text[(size_t)start - 1] != '\n'))
+            {
+                break;
+            }
+            tailCount++;
+            tailParagraphCount += chunk.paragraphCount;
+            tailStart = (size_t)start;
+        }
+    }
+
+    // Shape what's in between, chunk by chunk.
+    std::vector<ShapedChunk> chunks;
+    chunks.reserve(m_shapedChunks.size() + 1);
+    chunks.insert(chunks.end(),
+                  m_shapedChunks.begin(),
+                  m_shapedChunks.begin() + headCount);
+    std::vector<SimpleArray<Paragraph>> shapedChunks;
+    uint32_t shapedParagraphCount = 0;
+    for (size_t start = headEnd; start < tailStart;)
+    {
+        size_t end = start;
+        while (end < tailStart && text[end] != '\n')
+        {
+            end++;
+        }
+        if (end < tailStart)
+        {
+            // Include the '\n'.
+            end++;
+        }
+        SimpleArray<Paragraph> paragraphs =
+            shape_chunk(text, (uint32_t)start, (uint32_t)(end - start), run);
+        chunks.push_back({(uint32_t)start,
+                          (uint32_t)(end - start),
+                          (uint32_t)paragraphs.size()});
+        shapedParagraphCount += (uint32_t)paragraphs.size();
+        shapedChunks.push_back(std::move(paragraphs));
+        start = end;
+    }
+    for (size_t i = m_shapedChunks.size() - tailCount;
+         i < m_shapedChunks.size();
+         ++i)
+    {
+        ShapedChunk chunk = m_shapedChunks[i];
+        chunk.textStart = (uint32_t)(chunk.textStart + delta);
+        chunks.push_back(chunk);
+    }
+
+    // Splice the new paragraphs in between the reused ones.
+    const size_t paragraphCount =
+        headParagraphCount + shapedParagraphCount + tailParagraphCount;
+    SimpleArray<Paragraph> paragraphs(paragraphCount);
+    SimpleArray<SimpleArray<GlyphLine>> lines(paragraphCount);
+    size_t index = 0;
+    for (uint32_t i = 0; i < headParagraphCount; ++i, ++index)
+    {
+        paragraphs[index] = std::move(m_paragraphs[i]);
+        if (reuseLines)
+        {
+            lines[index] = std::move(m_paragraphLines[i]);
+        }
+    }
+    for (SimpleArray<Paragraph>& shaped : shapedChunks)
+    {
+        for (Paragraph& paragraph : shaped)
+        {
+            paragraphs[index++] = std::move(paragraph);
+        }
+    }
+    const size_t oldTailIndex = m_paragraphs.size() - tailParagraphCount;
+    for (uint32_t i = 0; i < tailParagraphCount; ++i, ++index)
+    {
+        paragraphs[index] = std::move(m_paragraphs[oldTailIndex + i]);
+        if (delta != 0)
+        {
+            shift_text_indices(paragraphs[index], delta);
+        }
+        if (reuseLines)
+        {
+            lines[index] = std::move(m_paragraphLines[oldTailIndex + i]);
+        }
+    }
+    assert(index == paragraphCount);
+
+    // Break whatever doesn't have lines yet, then lay them all out the way
+    // Text::BreakLines() does.
+    float paragraphWidth = width;
+    for (size_t i = 0; i < paragraphCount; ++i)
+    {
+        bool reused = reuseLines && (i < headParagraphCount ||
+                                     i >= paragraphCount - tailParagraphCount);
+        if (!reused)
+        {
+            lines[i] = GlyphLine::BreakLines(paragraphs[i].runs, breakWidth);
+        }
+        if (width == -1.0f)
+        {
+            paragraphWidth = std::max(
+                paragraphWidth,
+                GlyphLine::ComputeMaxWidth(lines[i], paragraphs[i].runs));
+        }
+    }
+    for (size_t i = 0; i < paragraphCount; ++i)
+    {
+        GlyphLine::ComputeLineSpacing(i == 0,
+                                      lines[i],
+                                      paragraphs[i].runs,
+                                      paragraphWidth,
+                                      alignment);
+    }
+
+    m_paragraphs = std::move(paragraphs);
+    m_paragraphLines = std::move(lines);
+    m_glyphLookup.compute(text, m_paragraphs);
+    m_shapedChunks = std::move(chunks);
+    m_shapedText.assign(text.begin(), text.end());
+    m_shapedRun = run;
+    m_shapedFallbackProc = Font::gFallbackProc;
+    m_shapedFallbackProcEnabled = Font::gFallbackProcEnabled;
+    m_shapedBreakWidth = breakWidth;
+    m_reshapedParagraphCount = shapedParagraphCount;
+
+    layoutLines(sizing,
+                maxWidth,
+                maxHeight,
+                origin,
+                overflow,
+                paragraphSpacing);
+}
+#endif
@@ -323,8 +323,9 @@ void RawText::update()
                 }
                 else
                 {
-                    RawPath path = font->getPath(glyphId);
-                    style->path.addPathClockwise(path, &transform);
+                    font->visitGlyphPath(glyphId, [&](const RawPath& path) {
+                        style->path.addPathClockwise(path, &transform);
+                    });
 
                     if (style->isEmpty)
                     {
@@ -226,17 +226,18 @@ void RawTextInput::ensureShape()
 {
     if (unflag(Flags::shapeDirty))
     {
+        // Edits usually touch one paragraph, so only reshape what changed.
         m_textRun.unicharCount = (uint32_t)m_text.size();
-        m_shape.shape(m_text,
-                      Span<TextRun>(&m_textRun, 1),
-                      m_sizing,
-                      m_maxWidth,
-                      m_maxHeight,
-                      m_align,
-                      m_wrap,
-                      m_origin,
-                      m_overflow,
-                      m_paragraphSpacing);
+        m_shape.reshape(m_text,
+                        m_textRun,
+                        m_sizing,
+                        m_maxWidth,
+                        m_maxHeight,
+                        m_align,
+                        m_wrap,
+                        m_origin,
+                        m_overflow,
+                        m_paragraphSpacing);
     }
 }
 
@@ -366,14 +367,15 @@ void RawTextInput::buildTextPaths(Factory* factory)
                 GlyphID glyphId = run->glyphs[glyphIndex];
                 float advance = run->advances[glyphIndex];
 
-                RawPath rawPath = font->getPath(glyphId);
-
-                rawPath.transformInPlace(Mat2D(run->size,
-                                               0.0f,
-                                               0.0f,
-                                               run->size,
-                                               x + offset.x,
-                                               renderY + offset.y));
+                RawPath rawPath;
+                font->visitGlyphPath(glyphId, [&](const RawPath& path) {
+                    rawPath = path.transform(Mat2D(run->size,
+                                                   0.0f,
+                                                   0.0f,
+                                                   run->size,
+                                                   x + offset.x,
+                                                   renderY + offset.y));
+                });
 
                 x += advance;
 
@@ -0,0 +1,351 @@
+#ifdef WITH_RIVE_TEXT
+#include "rive/text/shaped_paragraph_cache.hpp"
+#include "rive/math/math_types.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace rive;
+
+namespace
+{
+// A TextRun that borrows its font. Fonts purge the entries that use them when
+// they're destroyed, so the pointer is valid for as long as the entry is.
+struct KeyRun
+{
+    explicit KeyRun(const TextRun& run) :
+        font(run.font.get()),
+        size(run.size),
+        lineHeight(run.lineHeight),
+        letterSpacing(run.letterSpacing),
+        unicharCount(run.unicharCount),
+        script(run.script),
+        styleId(run.styleId),
+        level(run.level)
+    {}
+
+    Font* font;
+    float size;
+    float lineHeight;
+    float letterSpacing;
+    uint32_t unicharCount;
+    uint32_t script;
+    uint16_t styleId;
+    uint8_t level;
+};
+
+struct CacheEntry
+{
+    size_t hash;
+    std::vector<Unichar> text;
+    std::vector<KeyRun> runs;
+    Font::FallbackProc fallbackProc;
+    bool fallbackProcEnabled;
+    // The shaped paragraphs with every GlyphRun's font ref released. The
+    // fonts are in glyphRunFonts, in the same order, and are all key fonts.
+    SimpleArray<Paragraph> paragraphs;
+    std::vector<Font*> glyphRunFonts;
+    size_t sizeInBytes;
+};
+
+struct CacheState
+{
+    std::mutex mutex;
+    size_t budgetInBytes = ShapedParagraphCache::kDefaultBudgetInBytes;
+    // Most recently used at the front.
+    std::list<CacheEntry> lru;
+    std::unordered_multimap<size_t, std::list<CacheEntry>::iterator> index;
+    ShapedParagraphCache::Stats stats;
+};
+
+CacheState& cache_state()
+{
+    // Leaked, so fonts destroyed during static destruction can still purge.
+    static CacheState* state = new CacheState();
+    return *state;
+}
+
+void hash_combine(size_t& h, uint64_t value)
+{
+    h ^= std::hash<uint64_t>()(value) + 0x9e3779b9 + (h << 6) + (h >> 2);
+}
+
+size_t hash_key(Span<const Unichar> text, Span<const TextRun> runs)
+{
+    size_t h = text.size();
+    for (Unichar c : text)
+    {
+        hash_combine(h, c);
+    }
+    for (const TextRun& run : runs)
+    {
+        hash_combine(h, reinterpret_cast<uintptr_t>(run.font.get()));
+        hash_combine(h, math::bit_cast<uint32_t>(run.size));
+        hash_combine(h, run.unicharCount);
+        hash_combine(h, run.styleId);
+    }
+    hash_combine(h, reinterpret_cast<uintptr_t>(Font::gFallbackProc));
+    hash_combine(h, Font::gFallbackProcEnabled);
+    return h;
+}
+
+bool runs_equal(const KeyRun& a, const TextRun& b)
+{
+    // Compare floats bitwise so NaN sizes etc. still match themselves.
+    return a.font == b.font.get() &&
+           math::bit_cast<uint32_t>(a.size) ==
+               math::bit_cast<uint32_t>(b.size) &&
+           math::bit_cast<uint32_t>(a.lineHeight) ==
+               math::bit_cast<uint32_t>(b.lineHeight) &&
+           math::bit_cast<uint32_t>(a.letterSpacing) ==
+               math::bit_cast<uint32_t>(b.letterSpacing) &&
+           a.unicharCount == b.unicharCount && a.script == b.script &&
+           a.styleId == b.styleId && a.level == b.level;
+}
+
+bool entry_matches(const CacheEntry& entry,
+                   Span<const Unichar> text,
+                   Span<const TextRun> runs)
+{
+    if (entry.text.size() != text.size() || entry.runs.size() != runs.size() ||
+        entry.fallbackProc != Font::gFallbackProc ||
+        entry.fallbackProcEnabled != Font::gFallbackProcEnabled)
+    {
+        return false;
+    }
+    if (!std::equal(entry.text.begin(), entry.text.end(), text.begin()))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        if (!runs_equal(entry.runs[i], runs[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t paragraphs_size_in_bytes(const SimpleArray<Paragraph>& paragraphs)
+{
+    size_t size = paragraphs.size() * sizeof(Paragraph);
+    for (const Paragraph& paragraph : paragraphs)
+    {
+        size += paragraph.runs.size() * sizeof(GlyphRun);
+        for (const GlyphRun& run : paragraph.runs)
+        {
+            size += run.glyphs.size_bytes() + run.textIndices.size_bytes() +
+                    run.advances.size_bytes() + run.xpos.size_bytes() +
+                    run.offsets.size_bytes() + run.breaks.size_bytes() +
+                    run.joiners.size_bytes();
+        }
+    }
+    return size;
+}
+
+// Moves the fonts out of paragraphs' GlyphRuns, so the cache holds no refs.
+// Returns false if a GlyphRun uses a font none of the runs do (a fallback
+// font), since nothing would keep that one alive.
+bool release_fonts(SimpleArray<Paragraph>& paragraphs,
+                   Span<const TextRun> runs,
+                   std::vector<Font*>* glyphRunFonts)
+{
+    for (Paragraph& paragraph : paragraphs)
+    {
+        for (GlyphRun& glyphRun : paragraph.runs)
+        {
+            Font* font = glyphRun.font.get();
+            if (std::none_of(runs.begin(),
+                             runs.end(),
+                             [font](const TextRun& run) {
+                                 return run.font.get() == font;
+                             }))
+            {
+                return false;
+            }
+            glyphRunFonts->push_back(font);
+            glyphRun.font = nullptr;
+        }
+    }
+    return true;
+}
+
+// Copies an entry's paragraphs out with refs on their fonts. Every one of
+// them is a key font, so the caller already holds a ref on it.
+SimpleArray<Paragraph> copy_paragraphs(const CacheEntry& entry)
+{
+    SimpleArray<Paragraph> paragraphs(entry.paragraphs);
+    auto font = entry.glyphRunFonts.begin();
+    for (Paragraph& paragraph : paragraphs)
+    {
+        for (GlyphRun& glyphRun : paragraph.runs)
+        {
+            glyphRun.font = ref_rcp(*font++);
+        }
+    }
+    assert(font == entry.glyphRunFonts.end());
+    return paragraphs;
+}
+
+// Called with the state's mutex held.
+void erase_entry(CacheState& state, std::list<CacheEntry>::iterator entry)
+{
+    auto range = state.index.equal_range(entry->hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (iter->second == entry)
+        {
+            state.index.erase(iter);
+            break;
+        }
+    }
+    state.stats.bytesUsed -= entry->sizeInBytes;
+    --state.stats.entryCount;
+    state.lru.erase(entry);
+}
+
+// Called with the state's mutex held.
+void evict_down_to(CacheState& state, size_t budgetInBytes)
+{
+    while (state.stats.bytesUsed > budgetInBytes)
+    {
+        assert(!state.lru.empty());
+        erase_entry(state, std::prev(state.lru.end()));
+        ++state.stats.evictions;
+    }
+}
+} // namespace
+
+SimpleArray<Paragraph> ShapedParagraphCache::shapeText(
+    Span<const Unichar> text,
+    Span<const TextRun> runs)
+{
+    assert(!runs.empty());
+    CacheState& state = cache_state();
+    const size_t hash = hash_key(text, runs);
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        auto range = state.index.equal_range(hash);
+        for (auto iter = range.first; iter != range.second; ++iter)
+        {
+            if (entry_matches(*iter->second, text, runs))
+            {
+                state.lru.splice(state.lru.begin(), state.lru, iter->second);
+                ++state.stats.hits;
+                return copy_paragraphs(*iter->second);
+            }
+        }
+        ++state.stats.misses;
+        if (state.budgetInBytes == 0)
+        {
+            lock.unlock();
+            return runs[0].font->shapeText(text, runs);
+        }
+    }
+
+    SimpleArray<Paragraph> paragraphs = runs[0].font->shapeText(text, runs);
+    SimpleArray<Paragraph> cachedParagraphs(paragraphs);
+    std::vector<Font*> glyphRunFonts;
+    if (!release_fonts(cachedParagraphs, runs, &glyphRunFonts))
+    {
+        return paragraphs;
+    }
+    size_t sizeInBytes = sizeof(CacheEntry) + text.size_bytes() +
+                         runs.size() * sizeof(KeyRun) +
+                         glyphRunFonts.size() * sizeof(Font*) +
+                         paragraphs_size_in_bytes(paragraphs);
+
+    std::unique_lock<std::mutex> lock(state.mutex);
+    if (sizeInBytes > state.budgetInBytes)
+    {
+        return paragraphs;
+    }
+    // Another thread may have shaped the same text while we weren't holding
+    // the lock.
+    auto range = state.index.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (entry_matches(*iter->second, text, runs))
+        {
+            return paragraphs;
+        }
+    }
+    evict_down_to(state, state.budgetInBytes - sizeInBytes);
+    state.lru.push_front({hash,
+                          std::vector<Unichar>(text.begin(), text.end()),
+                          std::vector<KeyRun>(runs.begin(), runs.end()),
+                          Font::gFallbackProc,
+                          Font::gFallbackProcEnabled,
+                          std::move(cachedParagraphs),
+                          std::move(glyphRunFonts),
+                          sizeInBytes});
+    state.index.emplace(hash, state.lru.begin());
+    state.stats.bytesUsed += sizeInBytes;
+    ++state.stats.entryCount;
+    return paragraphs;
+}
+
+void ShapedParagraphCache::setBudgetInBytes(size_t budgetInBytes)
+{
+    CacheState& state = cache_state();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.budgetInBytes = budgetInBytes;
+    evict_down_to(state, budgetInBytes);
+}
+
+size_t ShapedParagraphCache::budgetInBytes()
+{
+    CacheState& state = cache_state();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    return state.budgetInBytes;
+}
+
+ShapedParagraphCache::Stats ShapedParagraphCache::stats()
+{
+    CacheState& state = cache_state();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    return state.stats;
+}
+
+void ShapedParagraphCache::resetStats()
+{
+    CacheState& state = cache_state();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.stats.hits = 0;
+    state.stats.misses = 0;
+    state.stats.evictions = 0;
+}
+
+void ShapedParagraphCache::purgeFont(const Font* font)
+{
+    CacheState& state = cache_state();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    for (auto entry = state.lru.begin(); entry != state.lru.end();)
+    {
+        auto next = std::next(entry);
+        if (std::any_of(entry->runs.begin(),
+                        entry->runs.end(),
+                        [font](const KeyRun& run) { return run.font == font; }))
+        {
+            erase_entry(state, entry);
+        }
+        entry = next;
+    }
+}
+
+void ShapedParagraphCache::clear()
+{
+    CacheState& state = cache_state();
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.index.clear();
+    state.lru.clear();
+    state.stats.entryCount = 0;
+    state.stats.bytesUsed = 0;
+}
+#endif
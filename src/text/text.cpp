@@ -10,6 +10,7 @@ using namespace rive;
 #include "rive/text/text_style_paint.hpp"
 #include "rive/text/text_value_run.hpp"
 #include "rive/text/text_modifier_group.hpp"
+#include "rive/text/shaped_paragraph_cache.hpp"
 #include "rive/shapes/paint/shape_paint.hpp"
 #include "rive/shapes/paint/color.hpp"
 #include "rive/shapes/paint/blend_mode.hpp"
@@ -439,7 +440,8 @@ float Text::fitFontScale()
             return true;
         }
         auto runs = styledText.runs();
-        auto shape = runs[0].font->shapeText(styledText.unichars(), runs);
+        auto shape =
+            ShapedParagraphCache::shapeText(styledText.unichars(), runs);
         auto lines = BreakLines(shape, boxWidth, align(), wrap());
 
         float maxWidth = 0.0f;
@@ -761,8 +763,12 @@ void Text::buildRenderStyles()
                 }
                 else
                 {
-                    RawPath path = font->getPath(glyphId);
-                    path.transformInPlace(pathTransform);
+                    RawPath path;
+                    font->visitGlyphPath(glyphId,
+                                         [&](const RawPath& glyphPath) {
+                                             path = glyphPath.transform(
+                                                 pathTransform);
+                                         });
 
                     if (style->addPath(path, opacity))
                     {
@@ -1228,7 +1234,8 @@ void Text::update(ComponentDirt value)
         {
             auto runs = m_modifierStyledText.runs();
             m_modifierShape =
-                runs[0].font->shapeText(m_modifierStyledText.unichars(), runs);
+                ShapedParagraphCache::shapeText(m_modifierStyledText.unichars(),
+                                                runs);
             m_modifierLines =
                 BreakLines(m_modifierShape,
                            (effectiveSizing() == TextSizing::autoWidth &&
@@ -1253,7 +1260,8 @@ void Text::update(ComponentDirt value)
         if (makeStyled(m_styledText, true, fontScale))
         {
             auto runs = m_styledText.runs();
-            m_shape = runs[0].font->shapeText(m_styledText.unichars(), runs);
+            m_shape =
+                ShapedParagraphCache::shapeText(m_styledText.unichars(), runs);
 
             m_lines = BreakLines(m_shape,
                                  (effectiveSizing() == TextSizing::autoWidth &&
@@ -1326,7 +1334,8 @@ Vec2D Text::measure(Vec2D maxSize)
     {
         const float paragraphSpace = paragraphSpacing();
         auto runs = m_styledText.runs();
-        auto shape = runs[0].font->shapeText(m_styledText.unichars(), runs);
+        auto shape =
+            ShapedParagraphCache::shapeText(m_styledText.unichars(), runs);
         auto measuringWidth = 0.0f;
         switch (effectiveSizing())
         {
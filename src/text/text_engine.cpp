@@ -1,6 +1,7 @@
 #include "rive/text_engine.hpp"
 #include "rive/text/utf.hpp"
 #include "rive/text/glyph_lookup.hpp"
+#include <cassert>
 #ifdef WITH_RIVE_TEXT
 using namespace rive;
 
@@ -307,4 +308,63 @@ float OrderedLine::bottom() const
     return m_y - m_glyphLine->baseline + m_glyphLine->bottom;
 }
 
+static size_t glyph_path_size_in_bytes(const RawPath& path)
+{
+    return sizeof(GlyphID) + sizeof(RawPath) +
+           path.points().size_bytes() + path.verbs().size_bytes();
+}
+
+const RawPath& GlyphPathCache::get(const Font* font, GlyphID glyph)
+{
+    auto iter = m_entries.find(glyph);
+    if (iter != m_entries.end())
+    {
+        m_lru.splice(m_lru.begin(), m_lru, iter->second);
+        ++m_stats.hits;
+        return iter->second->path;
+    }
+    ++m_stats.misses;
+    RawPath path = font->getPath(glyph);
+    size_t sizeInBytes = glyph_path_size_in_bytes(path);
+    if (sizeInBytes > m_budgetInBytes)
+    {
+        m_uncachedPath = std::move(path);
+        return m_uncachedPath;
+    }
+    evictDownTo(m_budgetInBytes - sizeInBytes);
+    m_lru.push_front({glyph, std::move(path), sizeInBytes});
+    m_entries.emplace(glyph, m_lru.begin());
+    m_bytesUsed += sizeInBytes;
+    return m_lru.front().path;
+}
+
+void GlyphPathCache::setBudgetInBytes(size_t budgetInBytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_budgetInBytes = budgetInBytes;
+    evictDownTo(m_budgetInBytes);
+}
+
+void GlyphPathCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_lru.clear();
+    m_bytesUsed = 0;
+    m_uncachedPath = RawPath();
+}
+
+void GlyphPathCache::evictDownTo(size_t budgetInBytes)
+{
+    while (m_bytesUsed > budgetInBytes)
+    {
+        assert(!m_lru.empty());
+        const Entry& entry = m_lru.back();
+        m_bytesUsed -= entry.sizeInBytes;
+        m_entries.erase(entry.glyph);
+        m_lru.pop_back();
+        ++m_stats.evictions;
+    }
+}
+
 #endif
\ No newline at end of file
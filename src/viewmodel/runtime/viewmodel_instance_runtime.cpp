@@ -23,14 +23,25 @@
 #include "rive/viewmodel/viewmodel_property_trigger.hpp"
 #include "rive/viewmodel/viewmodel_property_viewmodel.hpp"
 #include "rive/viewmodel/runtime/viewmodel_runtime.hpp"
+#include <atomic>
 
 // Default namespace for Rive Cpp code
 using namespace rive;
 
+uint64_t ViewModelInstanceRuntime::NextHandleStamp()
+{
+    static std::atomic<uint64_t> s_nextStamp{1};
+    return s_nextStamp.fetch_add(1, std::memory_order_relaxed);
+}
+
 ViewModelInstanceRuntime::ViewModelInstanceRuntime(
     rcp<ViewModelInstance> instance) :
-    m_viewModelInstance(instance)
-{}
+    m_viewModelInstance(instance),
+    m_id(NextHandleStamp()),
+    m_replaceCount(make_rcp<ReplaceCount>())
+{
+    m_replaceCount->value = NextHandleStamp();
+}
 
 ViewModelInstanceRuntime::~ViewModelInstanceRuntime()
 {
@@ -322,6 +333,7 @@ rcp<ViewModelInstanceRuntime> ViewModelInstanceRuntime::instanceRuntime(
     {
         auto viewModelInstanceRef =
             make_rcp<ViewModelInstanceRuntime>(viewModelInstance);
+        viewModelInstanceRef->m_replaceCount = m_replaceCount;
         m_viewModelInstances[name] = viewModelInstanceRef;
         return viewModelInstanceRef;
     }
@@ -436,6 +448,8 @@ bool ViewModelInstanceRuntime::replaceViewModelByName(
         {
             m_viewModelInstances[name] = ref_rcp(value);
         }
+        // Paths through name may now lead to different properties.
+        m_replaceCount->value = NextHandleStamp();
         return true;
     }
     return false;
@@ -446,4 +460,187 @@ std::vector<PropertyData> ViewModelInstanceRuntime::properties() const
     std::vector<PropertyData> props;
     auto properties = m_viewModelInstance->viewModel()->properties();
     return ViewModelRuntime::buildPropertiesData(properties);
-}
\ No newline at end of file
+}
+
+ViewModelNumberHandle ViewModelInstanceRuntime::numberHandle(
+    const std::string& path) const
+{
+    return makeHandle(propertyNumber(path));
+}
+
+ViewModelStringHandle ViewModelInstanceRuntime::stringHandle(
+    const std::string& path) const
+{
+    return makeHandle(propertyString(path));
+}
+
+ViewModelBooleanHandle ViewModelInstanceRuntime::booleanHandle(
+    const std::string& path) const
+{
+    return makeHandle(propertyBoolean(path));
+}
+
+ViewModelColorHandle ViewModelInstanceRuntime::colorHandle(
+    const std::string& path) const
+{
+    return makeHandle(propertyColor(path));
+}
+
+ViewModelEnumHandle ViewModelInstanceRuntime::enumHandle(
+    const std::string& path) const
+{
+    return makeHandle(propertyEnum(path));
+}
+
+ViewModelTriggerHandle ViewModelInstanceRuntime::triggerHandle(
+    const std::string& path) const
+{
+    return makeHandle(propertyTrigger(path));
+}
+
+static void setPropertyValue(ViewModelInstanceNumberRuntime* property,
+                             float value)
+{
+    property->value(value);
+}
+
+static void setPropertyValue(ViewModelInstanceStringRuntime* property,
+                             const std::string& value)
+{
+    property->value(value);
+}
+
+static void setPropertyValue(ViewModelInstanceBooleanRuntime* property,
+                             bool value)
+{
+    property->value(value);
+}
+
+static void setPropertyValue(ViewModelInstanceColorRuntime* property,
+                             int value)
+{
+    property->value(value);
+}
+
+static void setPropertyValue(ViewModelInstanceEnumRuntime* property,
+                             uint32_t value)
+{
+    property->valueIndex(value);
+}
+
+bool ViewModelInstanceRuntime::setValue(const ViewModelNumberHandle& handle,
+                                        float value) const
+{
+    if (!isValid(handle))
+    {
+        return false;
+    }
+    setPropertyValue(handle.m_property, value);
+    return true;
+}
+
+bool ViewModelInstanceRuntime::setValue(const ViewModelStringHandle& handle,
+                                        const std::string& value) const
+{
+    if (!isValid(handle))
+    {
+        return false;
+    }
+    setPropertyValue(handle.m_property, value);
+    return true;
+}
+
+bool ViewModelInstanceRuntime::setValue(const ViewModelBooleanHandle& handle,
+                                        bool value) const
+{
+    if (!isValid(handle))
+    {
+        return false;
+    }
+    setPropertyValue(handle.m_property, value);
+    return true;
+}
+
+bool ViewModelInstanceRuntime::setValue(const ViewModelColorHandle& handle,
+                                        int value) const
+{
+    if (!isValid(handle))
+    {
+        return false;
+    }
+    setPropertyValue(handle.m_property, value);
+    return true;
+}
+
+bool ViewModelInstanceRuntime::setValue(const ViewModelEnumHandle& handle,
+                                        uint32_t value) const
+{
+    if (!isValid(handle))
+    {
+        return false;
+    }
+    setPropertyValue(handle.m_property, value);
+    return true;
+}
+
+bool ViewModelInstanceRuntime::fire(const ViewModelTriggerHandle& handle) const
+{
+    if (!isValid(handle))
+    {
+        return false;
+    }
+    handle.m_property->trigger();
+    return true;
+}
+
+template <typename T, typename V>
+size_t ViewModelInstanceRuntime::setValuesImpl(
+    Span<const ViewModelPropertyUpdate<T, V>> updates) const
+{
+    // Each handle's owner and generation are still compared, but the replace
+    // count they're compared against is only loaded once for the batch.
+    const uint64_t replaceCount = m_replaceCount->value;
+    size_t count = 0;
+    for (const auto& update : updates)
+    {
+        const ViewModelPropertyHandle<T>& handle = update.handle;
+        if (handle.m_property == nullptr || handle.m_ownerId != m_id ||
+            handle.m_generation != replaceCount)
+        {
+            continue;
+        }
+        setPropertyValue(handle.m_property, update.value);
+        count++;
+    }
+    return count;
+}
+
+size_t ViewModelInstanceRuntime::setValues(
+    Span<const ViewModelNumberUpdate> updates) const
+{
+    return setValuesImpl(updates);
+}
+
+size_t ViewModelInstanceRuntime::setValues(
+    Span<const ViewModelStringUpdate> updates) const
+{
+    return setValuesImpl(updates);
+}
+
+size_t ViewModelInstanceRuntime::setValues(
+    Span<const ViewModelBooleanUpdate> updates) const
+{
+    return setValuesImpl(updates);
+}
+
+size_t ViewModelInstanceRuntime::setValues(
+    Span<const ViewModelColorUpdate> updates) const
+{
+    return setValuesImpl(updates);
+}
+
+size_t ViewModelInstanceRuntime::setValues(
+    Span<const ViewModelEnumUpdate> updates) const
+{
+    return setValuesImpl(updates);
+}
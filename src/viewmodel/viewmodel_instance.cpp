@@ -1,6 +1,8 @@
 #include <sstream>
 #include <iomanip>
 #include <array>
+#include <algorithm>
+#include <cassert>
 
 #include "rive/viewmodel/viewmodel_instance.hpp"
 #include "rive/viewmodel/viewmodel.hpp"
@@ -21,6 +23,10 @@ using namespace rive;
 
 ViewModelInstance::~ViewModelInstance()
 {
+    for (auto value : m_deferredValues)
+    {
+        value->m_deferredDirt = ComponentDirt::None;
+    }
     for (auto& value : m_PropertyValues)
     {
         if (value->is<ViewModelInstanceViewModel>())
@@ -97,12 +103,55 @@ bool ViewModelInstance::removeValue(uint32_t propertyId)
                 ++sit;
             }
         }
+        if (value->m_deferredDirt != ComponentDirt::None)
+        {
+            m_deferredValues.erase(std::remove(m_deferredValues.begin(),
+                                               m_deferredValues.end(),
+                                               value.get()),
+                                   m_deferredValues.end());
+            value->m_deferredDirt = ComponentDirt::None;
+        }
         m_PropertyValues.erase(it); // rcp releases the value
         return true;
     }
     return false;
 }
 
+void ViewModelInstance::deferDirt(ViewModelInstanceValue* value,
+                                  ComponentDirt dirt)
+{
+    if (value->m_deferredDirt == ComponentDirt::None)
+    {
+        m_deferredValues.push_back(value);
+    }
+    value->m_deferredDirt |= dirt;
+}
+
+void ViewModelInstance::commitTransaction()
+{
+    assert(m_transactionDepth > 0);
+    if (m_transactionDepth == 0 || --m_transactionDepth != 0)
+    {
+        return;
+    }
+    // Swap the list out, as dependents can set values of their own while we
+    // flush (those go straight through now that the transaction is closed).
+    std::vector<ViewModelInstanceValue*> values;
+    values.swap(m_deferredValues);
+    for (auto value : values)
+    {
+        ComponentDirt dirt = value->m_deferredDirt;
+        value->m_deferredDirt = ComponentDirt::None;
+        value->m_DependencyHelper.addDirtToDependents(dirt);
+    }
+    if (m_deferredValues.empty())
+    {
+        // Keep the capacity for the next transaction.
+        values.clear();
+        m_deferredValues.swap(values);
+    }
+}
+
 ViewModelInstanceValue* ViewModelInstance::propertyValue(const uint32_t id)
 {
     for (auto value : m_PropertyValues)
@@ -102,6 +102,11 @@ void ViewModelInstanceValue::removeDependent(ViewModelValueDependent* value)
 
 void ViewModelInstanceValue::addDirt(ComponentDirt value)
 {
+    if (m_viewModelInstance != nullptr && m_viewModelInstance->inTransaction())
+    {
+        m_viewModelInstance->deferDirt(this, value);
+        return;
+    }
     m_DependencyHelper.addDirtToDependents(value);
 }
 
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#ifndef _RIVE_SW_FACTORY_HPP_
+#define _RIVE_SW_FACTORY_HPP_
+
+#include "rive/factory.hpp"
+
+namespace rive
+{
+// Factory for the CPU software renderer (see SWRasterizer). Every object it
+// makes lives in CPU memory, so it is safe to call from any thread.
+class SWFactory : public Factory
+{
+public:
+    rcp<RenderBuffer> makeRenderBuffer(RenderBufferType,
+                                       RenderBufferFlags,
+                                       size_t) override;
+
+    rcp<RenderShader> makeLinearGradient(float sx,
+                                         float sy,
+                                         float ex,
+                                         float ey,
+                                         const ColorInt colors[], // [count]
+                                         const float stops[],     // [count]
+                                         size_t count) override;
+
+    rcp<RenderShader> makeRadialGradient(float cx,
+                                         float cy,
+                                         float radius,
+                                         const ColorInt colors[], // [count]
+                                         const float stops[],     // [count]
+                                         size_t count) override;
+
+    rcp<RenderPath> makeRenderPath(RawPath&, FillRule) override;
+
+    rcp<RenderPath> makeEmptyRenderPath() override;
+
+    rcp<RenderPaint> makeRenderPaint() override;
+
+    rcp<RenderImage> decodeImage(Span<const uint8_t>) override;
+
+    // Makes an image from premultiplied RGBA8 pixels, rows top to bottom.
+    rcp<RenderImage> makeImage(uint32_t width,
+                               uint32_t height,
+                               std::unique_ptr<const uint8_t[]> pixels);
+};
+} // namespace rive
+#endif
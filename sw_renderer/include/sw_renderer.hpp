@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#ifndef _RIVE_SW_RENDERER_HPP_
+#define _RIVE_SW_RENDERER_HPP_
+
+#include "rive/renderer.hpp"
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+namespace sw
+{
+struct ClipNode;
+struct Frame;
+} // namespace sw
+
+// Multithreaded, tile-based CPU rasterizer for headless rendering.
+//
+// An SWRenderer records draws into the rasterizer's current frame, and flush()
+// rasterizes them all at once: first every path is flattened (and stroked)
+// into device-space edges, in parallel across draws, then the target is split
+// into 64x64 tiles that are rasterized in parallel, each tile applying every
+// draw that touches it in order. The parallel work runs on the global
+// WorkPool's workers (inline without WITH_RIVE_THREADING). Since no two
+// threads ever write the same pixel, the output doesn't depend on the thread
+// count.
+//
+// Coverage is computed analytically (exact pixel area, no multisampling) for
+// nonZero, evenOdd and clockwise fills. Strokes, linear and radial gradients,
+// images, image meshes, clipping, every BlendMode and feathering are
+// supported. Meshes are not antialiased, like on the GPU.
+class SWRasterizer
+{
+public:
+    // Thread count used when none is requested: the hardware concurrency.
+    static uint32_t defaultThreadCount();
+
+    // The most threads a flush() runs on. A threadCount of 0 uses
+    // defaultThreadCount(). The thread calling flush() counts as one of the
+    // threads, and the rest are borrowed from the global WorkPool when they
+    // are free. The pool is created here if it doesn't exist yet, so size it
+    // with setGlobalWorkPoolThreadCount() first to run on more than its
+    // default thread count.
+    explicit SWRasterizer(uint32_t threadCount = 0);
+    ~SWRasterizer();
+
+    SWRasterizer(const SWRasterizer&) = delete;
+    SWRasterizer& operator=(const SWRasterizer&) = delete;
+
+    // The threads a flush() can actually run on: the requested count, capped
+    // at the global WorkPool's workers plus the calling thread. Always 1
+    // without WITH_RIVE_THREADING.
+    uint32_t threadCount() const { return m_threadCount; }
+
+    // Packs a color the way the rasterizer stores pixels: premultiplied RGBA
+    // bytes.
+    static uint32_t PremultipliedRGBA(ColorInt);
+
+    // Starts a frame that draws into pixels, width * height premultiplied
+    // RGBA8 pixels with rows top to bottom. The pixels are drawn over as they
+    // are; clear them first if needed. They must stay valid until flush().
+    void beginFrame(uint32_t* pixels, uint32_t width, uint32_t height);
+
+    // Rasterizes every draw recorded since beginFrame() and ends the frame.
+    void flush();
+
+    uint32_t width() const { return m_width; }
+    uint32_t height() const { return m_height; }
+
+private:
+    friend class SWRenderer;
+
+    const uint32_t m_threadCount;
+    std::unique_ptr<sw::Frame> m_frame;
+    uint32_t* m_pixels = nullptr;
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+};
+
+// Records draws into an SWRasterizer's current frame. The recorded paths are
+// snapshotted, so they may be modified (or destroyed) before the frame is
+// flushed.
+class SWRenderer : public Renderer
+{
+public:
+    explicit SWRenderer(SWRasterizer*);
+    ~SWRenderer() override;
+
+    void save() override;
+    void restore() override;
+    void transform(const Mat2D& transform) override;
+    void modulateOpacity(float opacity) override;
+    void clipPath(RenderPath* path) override;
+    void drawPath(RenderPath* path, RenderPaint* paint) override;
+    void drawImage(const RenderImage*,
+                   ImageSampler,
+                   BlendMode,
+                   float opacity) override;
+    void drawImageMesh(const RenderImage*,
+                       ImageSampler,
+                       rcp<RenderBuffer> vertices_f32,
+                       rcp<RenderBuffer> uvCoords_f32,
+                       rcp<RenderBuffer> indices_u16,
+                       uint32_t vertexCount,
+                       uint32_t indexCount,
+                       BlendMode,
+                       float opacity) override;
+
+private:
+    struct State
+    {
+        Mat2D matrix;
+        const sw::ClipNode* clip = nullptr;
+        float opacity = 1.0f;
+        // Set once a clip leaves nothing to draw into.
+        bool clipIsEmpty = false;
+    };
+
+    SWRasterizer* const m_rasterizer;
+    std::vector<State> m_stack{State()};
+};
+} // namespace rive
+#endif
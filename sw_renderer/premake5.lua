@@ -0,0 +1,29 @@
+dofile('rive_build_config.lua')
+
+project('rive_sw_renderer')
+do
+    kind('StaticLib')
+    includedirs({ 'include', 'src', '../include', '../decoders/include' })
+
+    libdirs({ '../../build/%{cfg.system}/bin/' .. RIVE_BUILD_CONFIG })
+
+    files({ 'src/**.cpp' })
+
+    fatalwarnings { "All" }
+
+    filter('system:windows')
+    do
+        architecture('x64')
+        defines({ '_USE_MATH_DEFINES' })
+    end
+
+    filter({ 'system:not windows', 'options:not no_ffp_contract' })
+    do
+        buildoptions({
+            '-ffp-contract=on',
+            '-fassociative-math',
+            -- Don't warn about simd vectors larger than 128 bits when AVX is not enabled.
+            '-Wno-psabi',
+        })
+    end
+end
@@ -0,0 +1,751 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "sw_frame.hpp"
+
+#include "rive/math/math_types.hpp"
+#include "rive/math/raw_path_utils.hpp"
+#include "rive/math/wangs_formula.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace rive::sw
+{
+namespace
+{
+// Curves are flattened to within a quarter pixel.
+constexpr float kPrecision = 4;
+constexpr int kMaxCurveSegments = 1024;
+// Matches the GPU renderer.
+constexpr float kMiterLimit = 4;
+
+// Polylines of one contour in local space. isSmooth marks the points inside
+// a curve, which get simple joins since they barely turn.
+struct Contour
+{
+    std::vector<Vec2D> points;
+    std::vector<bool> isSmooth;
+    bool isClosed = false;
+
+    void add(Vec2D point, bool smooth)
+    {
+        if (!points.empty() && points.back() == point)
+        {
+            return;
+        }
+        points.push_back(point);
+        isSmooth.push_back(smooth);
+    }
+};
+
+std::vector<Contour> flatten(const RawPath& path, const Mat2D& matrix)
+{
+    std::vector<Contour> contours;
+    wangs_formula::VectorXform vectorXform(matrix);
+    Vec2D lastPoint = {0, 0};
+    for (auto [verb, pts] : path)
+    {
+        if (verb != PathVerb::move && contours.empty())
+        {
+            contours.emplace_back();
+            contours.back().add(lastPoint, false);
+        }
+        switch (verb)
+        {
+            case PathVerb::move:
+                contours.emplace_back();
+                contours.back().add(pts[0], false);
+                lastPoint = pts[0];
+                break;
+            case PathVerb::line:
+                contours.back().add(pts[1], false);
+                lastPoint = pts[1];
+                break;
+            case PathVerb::quad:
+            {
+                int n = static_cast<int>(ceilf(
+                    wangs_formula::quadratic(pts, kPrecision, vectorXform)));
+                n = std::clamp(n, 1, kMaxCurveSegments);
+                EvalQuad evalQuad(pts);
+                for (int i = 1; i < n; ++i)
+                {
+                    contours.back().add(evalQuad(i / static_cast<float>(n)),
+                                        true);
+                }
+                contours.back().add(pts[2], false);
+                lastPoint = pts[2];
+                break;
+            }
+            case PathVerb::cubic:
+            {
+                int n = static_cast<int>(ceilf(
+                    wangs_formula::cubic(pts, kPrecision, vectorXform)));
+                n = std::clamp(n, 1, kMaxCurveSegments);
+                EvalCubic evalCubic(pts);
+                for (int i = 1; i < n; ++i)
+                {
+                    contours.back().add(evalCubic(i / static_cast<float>(n)),
+                                        true);
+                }
+                contours.back().add(pts[3], false);
+                lastPoint = pts[3];
+                break;
+            }
+            case PathVerb::close:
+                if (!contours.empty())
+                {
+                    contours.back().isClosed = true;
+                    lastPoint = contours.back().points.front();
+                }
+                break;
+        }
+    }
+    return contours;
+}
+
+class EdgeBuilder
+{
+public:
+    EdgeBuilder(const Mat2D& matrix, std::vector<Edge>* edges) :
+        m_matrix(matrix), m_edges(edges)
+    {}
+
+    // Adds a closed polygon, given in local space, as it is.
+    void addContour(const std::vector<Vec2D>& points)
+    {
+        if (points.size() < 2)
+        {
+            return;
+        }
+        Vec2D last = m_matrix * points.back();
+        for (Vec2D point : points)
+        {
+            Vec2D devicePoint = m_matrix * point;
+            addEdge(last, devicePoint);
+            last = devicePoint;
+        }
+    }
+
+    // Adds a closed polygon, given in local space, wound clockwise in device
+    // space so it adds to (and never cancels) the other stroke polygons under
+    // nonZero.
+    void addStrokePolygon(std::initializer_list<Vec2D> points)
+    {
+        addStrokePolygon(points.begin(), points.size());
+    }
+    void addStrokePolygon(const Vec2D* points, size_t count)
+    {
+        Vec2D device[4];
+        std::vector<Vec2D> deviceVector;
+        Vec2D* out = device;
+        if (count > 4)
+        {
+            deviceVector.resize(count);
+            out = deviceVector.data();
+        }
+        float area = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            out[i] = m_matrix * points[i];
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vec2D a = out[i];
+            Vec2D b = out[(i + 1) % count];
+            area += a.x * b.y - b.x * a.y;
+        }
+        if (std::abs(area) < 1e-6f)
+        {
+            return;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vec2D a = out[i];
+            Vec2D b = out[(i + 1) % count];
+            if (area > 0)
+            {
+                addEdge(a, b);
+            }
+            else
+            {
+                addEdge(b, a);
+            }
+        }
+    }
+
+private:
+    void addEdge(Vec2D a, Vec2D b)
+    {
+        if (a.y != b.y)
+        {
+            m_edges->push_back({a.x, a.y, b.x, b.y});
+        }
+    }
+
+    const Mat2D m_matrix;
+    std::vector<Edge>* const m_edges;
+};
+
+class Stroker
+{
+public:
+    Stroker(const Draw& stroke, const Mat2D& matrix, EdgeBuilder* builder) :
+        m_radius(stroke.thickness * .5f),
+        m_join(stroke.join),
+        m_cap(stroke.cap),
+        m_builder(builder)
+    {
+        // Round joins and caps are drawn as polygons that stay within a
+        // quarter pixel of the circle.
+        float deviceRadius = m_radius * std::max(matrix.findMaxScale(), 1e-3f);
+        float step = deviceRadius > .25f
+                         ? 2 * acosf(1 - .25f / deviceRadius)
+                         : math::PI / 2;
+        int segments = static_cast<int>(ceilf(2 * math::PI / step));
+        segments = std::clamp(segments, 8, 512);
+        m_circle.resize(segments);
+        for (int i = 0; i < segments; ++i)
+        {
+            float theta = i * 2 * math::PI / segments;
+            m_circle[i] = Vec2D(cosf(theta), sinf(theta)) * m_radius;
+        }
+    }
+
+    void stroke(const Contour& contour)
+    {
+        const std::vector<Vec2D>& points = contour.points;
+        size_t count = points.size();
+        bool isClosed = contour.isClosed && count > 2;
+        if (count == 1 || (count == 2 && contour.isClosed &&
+                           points[0] == points[1]))
+        {
+            addDot(points[0]);
+            return;
+        }
+        size_t segmentCount = isClosed ? count : count - 1;
+        for (size_t i = 0; i < segmentCount; ++i)
+        {
+            Vec2D a = points[i];
+            Vec2D b = points[(i + 1) % count];
+            Vec2D normal = this->normal(a, b);
+            m_builder->addStrokePolygon(
+                {a + normal, b + normal, b - normal, a - normal});
+        }
+        size_t first = isClosed ? 0 : 1;
+        size_t last = isClosed ? count : count - 1;
+        for (size_t i = first; i < last; ++i)
+        {
+            addJoin(points[(i + count - 1) % count],
+                    points[i],
+                    points[(i + 1) % count],
+                    contour.isSmooth[i]);
+        }
+        if (!isClosed)
+        {
+            addCap(points[0], points[1]);
+            addCap(points[count - 1], points[count - 2]);
+        }
+    }
+
+private:
+    Vec2D normal(Vec2D a, Vec2D b) const
+    {
+        Vec2D direction = (b - a).normalized();
+        return Vec2D(-direction.y, direction.x) * m_radius;
+    }
+
+    void addCircle(Vec2D center)
+    {
+        m_scratch.resize(m_circle.size());
+        for (size_t i = 0; i < m_circle.size(); ++i)
+        {
+            m_scratch[i] = center + m_circle[i];
+        }
+        m_builder->addStrokePolygon(m_scratch.data(), m_scratch.size());
+    }
+
+    void addDot(Vec2D point)
+    {
+        switch (m_cap)
+        {
+            case StrokeCap::butt:
+                break;
+            case StrokeCap::round:
+                addCircle(point);
+                break;
+            case StrokeCap::square:
+            {
+                Vec2D x(m_radius, 0), y(0, m_radius);
+                m_builder->addStrokePolygon({point - x - y,
+                                             point + x - y,
+                                             point + x + y,
+                                             point - x + y});
+                break;
+            }
+        }
+    }
+
+    void addJoin(Vec2D previous, Vec2D point, Vec2D next, bool isSmooth)
+    {
+        Vec2D n0 = normal(previous, point);
+        Vec2D n1 = normal(point, next);
+        float cross = Vec2D::cross(point - previous, next - point);
+        if (cross == 0 && Vec2D::dot(n0, n1) > 0)
+        {
+            return;
+        }
+        // The outer side of the turn.
+        if (cross > 0)
+        {
+            n0 = -n0;
+            n1 = -n1;
+        }
+        StrokeJoin join = isSmooth ? StrokeJoin::bevel : m_join;
+        if (join == StrokeJoin::round)
+        {
+            addCircle(point);
+            return;
+        }
+        if (join == StrokeJoin::miter)
+        {
+            Vec2D bisector = n0 + n1;
+            float bisectorLength = bisector.length();
+            // 1 / cos(theta / 2), where theta is the angle between normals.
+            float miterRatio = bisectorLength > 0
+                                   ? 2 * m_radius / bisectorLength
+                                   : std::numeric_limits<float>::infinity();
+            if (miterRatio <= kMiterLimit)
+            {
+                Vec2D miter = bisector * (m_radius * miterRatio / bisectorLength);
+                m_builder->addStrokePolygon(
+                    {point, point + n0, point + miter, point + n1});
+                return;
+            }
+        }
+        m_builder->addStrokePolygon({point, point + n0, point + n1});
+    }
+
+    // Adds the cap at endpoint, whose segment comes from neighbor.
+    void addCap(Vec2D endpoint, Vec2D neighbor)
+    {
+        switch (m_cap)
+        {
+            case StrokeCap::butt:
+                break;
+            case StrokeCap::round:
+                addCircle(endpoint);
+                break;
+            case StrokeCap::square:
+            {
+                Vec2D normal = this->normal(neighbor, endpoint);
+                Vec2D extension = Vec2D(normal.y, -normal.x);
+                m_builder->addStrokePolygon({endpoint + normal,
+                                             endpoint + normal + extension,
+                                             endpoint - normal + extension,
+                                             endpoint - normal});
+                break;
+            }
+        }
+    }
+
+    const float m_radius;
+    const StrokeJoin m_join;
+    const StrokeCap m_cap;
+    EdgeBuilder* const m_builder;
+    std::vector<Vec2D> m_circle;
+    std::vector<Vec2D> m_scratch;
+};
+
+// Adds the area of the edge (x0, y0) -> (x1, y1), with y0 < y1 and x within
+// 0..width, to the accumulation rows: after a running sum along each row, every
+// pixel holds the winding number times the portion of it the edge's right
+// side covers. This is the exact signed area accumulation from font-rs.
+void accumulate_line(float* acc,
+                     int stride,
+                     int height,
+                     float x0,
+                     float y0,
+                     float x1,
+                     float y1,
+                     float direction)
+{
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    if (y0 < 0)
+    {
+        x -= y0 * dxdy;
+        y0 = 0;
+    }
+    y1 = std::min(y1, static_cast<float>(height));
+    int yEnd = static_cast<int>(ceilf(y1));
+    for (int y = static_cast<int>(y0); y < yEnd; ++y)
+    {
+        float* row = acc + y * stride;
+        float dy = std::min(y + 1.f, y1) - std::max(static_cast<float>(y), y0);
+        float xNext = x + dxdy * dy;
+        float d = dy * direction;
+        float xa = std::min(x, xNext);
+        float xb = std::max(x, xNext);
+        float xaFloor = floorf(xa);
+        int xai = static_cast<int>(xaFloor);
+        float xbCeil = ceilf(xb);
+        int xbi = static_cast<int>(xbCeil);
+        if (xbi <= xai + 1)
+        {
+            float xmf = .5f * (x + xNext) - xaFloor;
+            row[xai] += d - d * xmf;
+            row[xai + 1] += d * xmf;
+        }
+        else
+        {
+            float s = 1 / (xb - xa);
+            float xaf = xa - xaFloor;
+            float a0 = .5f * s * (1 - xaf) * (1 - xaf);
+            float xbf = xb - xbCeil + 1;
+            float am = .5f * s * xbf * xbf;
+            row[xai] += d * a0;
+            if (xbi == xai + 2)
+            {
+                row[xai + 1] += d * (1 - a0 - am);
+            }
+            else
+            {
+                float a1 = s * (1.5f - xaf);
+                row[xai + 1] += d * (a1 - a0);
+                for (int xi = xai + 2; xi < xbi - 1; ++xi)
+                {
+                    row[xi] += d * s;
+                }
+                float a2 = a1 + (xbi - xai - 3) * s;
+                row[xbi - 1] += d * (1 - a2 - am);
+            }
+            row[xbi] += d * am;
+        }
+        x = xNext;
+    }
+}
+
+// Accumulates an edge given relative to a width x height rect. The parts of
+// the edge left of the rect count as if they were on its left side; the parts
+// right of it don't count.
+void accumulate_edge(float* acc,
+                     int stride,
+                     int width,
+                     int height,
+                     float x0,
+                     float y0,
+                     float x1,
+                     float y1)
+{
+    // Edges going up wind +1 (see Edge).
+    float direction = -1;
+    if (y0 > y1)
+    {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        direction = 1;
+    }
+    if (y1 <= 0 || y0 >= height || (x0 >= width && x1 >= width))
+    {
+        return;
+    }
+    // Split the edge where it crosses x = 0 and x = width so each piece is
+    // entirely inside or outside.
+    float w = static_cast<float>(width);
+    float splits[4] = {y0, y1, y1, y1};
+    int splitCount = 1;
+    float dydx = x1 != x0 ? (y1 - y0) / (x1 - x0) : 0;
+    for (float bound : {0.f, w})
+    {
+        if ((x0 < bound) != (x1 < bound) && x0 != bound && x1 != bound)
+        {
+            splits[splitCount++] = y0 + (bound - x0) * dydx;
+        }
+    }
+    splits[splitCount++] = y1;
+    std::sort(splits + 1, splits + splitCount - 1);
+    float dxdy = (x1 - x0) / (y1 - y0);
+    for (int i = 0; i + 1 < splitCount; ++i)
+    {
+        float ya = splits[i];
+        float yb = splits[i + 1];
+        if (ya >= yb)
+        {
+            continue;
+        }
+        float xa = x0 + (ya - y0) * dxdy;
+        float xb = x0 + (yb - y0) * dxdy;
+        if (std::min(xa, xb) >= w - 1e-4f)
+        {
+            continue;
+        }
+        xa = std::clamp(xa, 0.f, w);
+        xb = std::clamp(xb, 0.f, w);
+        accumulate_line(acc, stride, height, xa, ya, xb, yb, direction);
+    }
+}
+
+float apply_fill_rule(float winding, FillRule fillRule)
+{
+    switch (fillRule)
+    {
+        case FillRule::nonZero:
+            return std::min(std::abs(winding), 1.f);
+        case FillRule::evenOdd:
+        {
+            float a = std::abs(winding);
+            a -= 2 * floorf(a * .5f);
+            return a > 1 ? 2 - a : a;
+        }
+        case FillRule::clockwise:
+            return std::clamp(winding, 0.f, 1.f);
+    }
+    RIVE_UNREACHABLE();
+}
+
+// Box blur of radius r along rows (or columns, with the strides swapped).
+void box_blur(const float* src,
+              float* dst,
+              int lineCount,
+              int lineLength,
+              int lineStride,
+              int pixelStride,
+              int r)
+{
+    float scale = 1.f / (2 * r + 1);
+    for (int line = 0; line < lineCount; ++line)
+    {
+        const float* in = src + line * lineStride;
+        float* out = dst + line * lineStride;
+        float sum = 0;
+        auto at = [&](int i) {
+            return i >= 0 && i < lineLength ? in[i * pixelStride] : 0.f;
+        };
+        for (int i = -r; i <= r; ++i)
+        {
+            sum += at(i);
+        }
+        for (int i = 0; i < lineLength; ++i)
+        {
+            out[i * pixelStride] = sum * scale;
+            sum += at(i + r + 1) - at(i - r);
+        }
+    }
+}
+
+// Approximates a gaussian blur with three box blurs in each direction.
+void gaussian_blur(std::vector<float>& mask, int width, int height, float sigma)
+{
+    // Box radius whose three passes have the gaussian's variance.
+    int r = std::max(
+        static_cast<int>(roundf((sqrtf(4 * sigma * sigma + 1) - 1) * .5f)),
+        1);
+    std::vector<float> scratch(mask.size());
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        box_blur(mask.data(), scratch.data(), height, width, width, 1, r);
+        box_blur(scratch.data(), mask.data(), width, height, 1, width, r);
+    }
+}
+} // namespace
+
+void Coverage::rasterize(const IAABB& rect, float* out) const
+{
+    int width = rect.width();
+    int height = rect.height();
+    assert(width <= kTileSize && height <= kTileSize);
+    if (isFeathered())
+    {
+        int maskWidth = bounds.width();
+        for (int y = 0; y < height; ++y)
+        {
+            const float* row = featherMask.data() +
+                               (rect.top + y - bounds.top) * maskWidth +
+                               (rect.left - bounds.left);
+            std::copy(row, row + width, out + y * kTileSize);
+        }
+        return;
+    }
+
+    constexpr int kStride = kTileSize + 2;
+    float acc[kTileSize * kStride];
+    for (int y = 0; y < height; ++y)
+    {
+        std::fill(acc + y * kStride, acc + y * kStride + width + 2, 0.f);
+    }
+    size_t tileRow = rect.top / kTileSize - bounds.top / kTileSize;
+    float dx = static_cast<float>(rect.left);
+    float dy = static_cast<float>(rect.top);
+    for (uint32_t i = tileRowOffsets[tileRow]; i < tileRowOffsets[tileRow + 1];
+         ++i)
+    {
+        const Edge& edge = edges[tileRowEdges[i]];
+        accumulate_edge(acc,
+                        kStride,
+                        width,
+                        height,
+                        edge.x0 - dx,
+                        edge.y0 - dy,
+                        edge.x1 - dx,
+                        edge.y1 - dy);
+    }
+    for (int y = 0; y < height; ++y)
+    {
+        const float* accRow = acc + y * kStride;
+        float* outRow = out + y * kTileSize;
+        float winding = 0;
+        for (int x = 0; x < width; ++x)
+        {
+            winding += accRow[x];
+            outRow[x] = apply_fill_rule(winding, fillRule);
+        }
+    }
+}
+
+void prepare_coverage(const RawPath& path,
+                      const Mat2D& matrix,
+                      FillRule fillRule,
+                      const Draw* stroke,
+                      float feather,
+                      int targetWidth,
+                      int targetHeight,
+                      Coverage* coverage)
+{
+    coverage->fillRule = stroke != nullptr ? FillRule::nonZero : fillRule;
+    coverage->edges.clear();
+    EdgeBuilder builder(matrix, &coverage->edges);
+    std::vector<Contour> contours = flatten(path, matrix);
+    if (stroke != nullptr)
+    {
+        Stroker stroker(*stroke, matrix, &builder);
+        for (const Contour& contour : contours)
+        {
+            stroker.stroke(contour);
+        }
+    }
+    else
+    {
+        for (const Contour& contour : contours)
+        {
+            builder.addContour(contour.points);
+        }
+    }
+
+    const std::vector<Edge>& edges = coverage->edges;
+    if (edges.empty())
+    {
+        coverage->bounds = {0, 0, 0, 0};
+        return;
+    }
+    AABB deviceBounds = AABB::forExpansion();
+    for (const Edge& edge : edges)
+    {
+        deviceBounds.expandTo(deviceBounds, Vec2D(edge.x0, edge.y0));
+        deviceBounds.expandTo(deviceBounds, Vec2D(edge.x1, edge.y1));
+    }
+    float sigma = 0;
+    if (feather > 0)
+    {
+        // Feathers are two standard deviations wide, like in the GPU
+        // renderer.
+        sigma = feather * .5f * sqrtf(std::abs(matrix.xx() * matrix.yy() -
+                                               matrix.xy() * matrix.yx()));
+        float outset = ceilf(sigma * 3);
+        deviceBounds = deviceBounds.inset(-outset, -outset);
+    }
+    IAABB bounds = round_out(deviceBounds, targetWidth, targetHeight);
+    if (bounds.empty())
+    {
+        coverage->bounds = {0, 0, 0, 0};
+        return;
+    }
+    coverage->bounds = bounds;
+
+    // Bin the edges by the rows of tiles they cross.
+    int firstTileRow = bounds.top / kTileSize;
+    int tileRowCount = (bounds.bottom - 1) / kTileSize - firstTileRow + 1;
+    // Edges aren't clipped, so clamp them to the rows of tiles in bounds
+    // before converting to int, and give non-finite ones no rows at all.
+    float rowsTop = static_cast<float>(firstTileRow * kTileSize);
+    float rowsBottom =
+        static_cast<float>((firstTileRow + tileRowCount) * kTileSize - 1);
+    auto tileRowRange = [&](const Edge& edge) {
+        if (!std::isfinite(edge.y0) || !std::isfinite(edge.y1))
+        {
+            return std::make_pair(0, -1);
+        }
+        float top = std::clamp(std::min(edge.y0, edge.y1), rowsTop, rowsBottom);
+        float bottom =
+            std::clamp(std::max(edge.y0, edge.y1), rowsTop, rowsBottom);
+        int first = static_cast<int>(floorf(top)) / kTileSize - firstTileRow;
+        int last = static_cast<int>(ceilf(bottom)) / kTileSize - firstTileRow;
+        return std::make_pair(first, last);
+    };
+    coverage->tileRowOffsets.assign(tileRowCount + 1, 0);
+    for (const Edge& edge : edges)
+    {
+        if (std::min(edge.x0, edge.x1) >= bounds.right)
+        {
+            continue;
+        }
+        auto [first, last] = tileRowRange(edge);
+        for (int row = first; row <= last; ++row)
+        {
+            ++coverage->tileRowOffsets[row + 1];
+        }
+    }
+    for (int row = 0; row < tileRowCount; ++row)
+    {
+        coverage->tileRowOffsets[row + 1] += coverage->tileRowOffsets[row];
+    }
+    coverage->tileRowEdges.resize(coverage->tileRowOffsets.back());
+    std::vector<uint32_t> cursors(coverage->tileRowOffsets.begin(),
+                                  coverage->tileRowOffsets.end() - 1);
+    for (uint32_t i = 0; i < edges.size(); ++i)
+    {
+        const Edge& edge = edges[i];
+        if (std::min(edge.x0, edge.x1) >= bounds.right)
+        {
+            continue;
+        }
+        auto [first, last] = tileRowRange(edge);
+        for (int row = first; row <= last; ++row)
+        {
+            coverage->tileRowEdges[cursors[row]++] = i;
+        }
+    }
+
+    if (sigma > 0)
+    {
+        int width = bounds.width();
+        int height = bounds.height();
+        std::vector<float> mask(static_cast<size_t>(width) * height);
+        float tile[kTileSize * kTileSize];
+        for (int y = bounds.top; y < bounds.bottom;
+             y = (y / kTileSize + 1) * kTileSize)
+        {
+            for (int x = bounds.left; x < bounds.right;
+                 x = (x / kTileSize + 1) * kTileSize)
+            {
+                IAABB rect = {x,
+                              y,
+                              std::min((x / kTileSize + 1) * kTileSize,
+                                       bounds.right),
+                              std::min((y / kTileSize + 1) * kTileSize,
+                                       bounds.bottom)};
+                coverage->rasterize(rect, tile);
+                for (int row = 0; row < rect.height(); ++row)
+                {
+                    std::copy(tile + row * kTileSize,
+                              tile + row * kTileSize + rect.width(),
+                              mask.data() + (y - bounds.top + row) * width +
+                                  (x - bounds.left));
+                }
+            }
+        }
+        gaussian_blur(mask, width, height, sigma);
+        coverage->featherMask = std::move(mask);
+    }
+}
+} // namespace rive::sw
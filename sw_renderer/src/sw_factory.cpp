@@ -0,0 +1,144 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "sw_factory.hpp"
+
+#include "sw_render_objects.hpp"
+#include "rive/decoders/bitmap_decoder.hpp"
+#include "rive/shapes/paint/color.hpp"
+#include "utils/factory_utils.hpp"
+#include <algorithm>
+
+using namespace rive;
+
+SWGradient::SWGradient(Type type,
+                       Vec2D p0,
+                       Vec2D p1,
+                       const ColorInt colors[],
+                       const float stops[],
+                       size_t count) :
+    m_type(type), m_p0(p0), m_p1(p1)
+{
+    auto unpremul = [](ColorInt color) {
+        return float4{static_cast<float>(colorRed(color)),
+                      static_cast<float>(colorGreen(color)),
+                      static_cast<float>(colorBlue(color)),
+                      static_cast<float>(colorAlpha(color))} *
+               (1 / 255.f);
+    };
+    size_t stop = 0;
+    for (int i = 0; i < kRampSize; ++i)
+    {
+        float t = i / static_cast<float>(kRampSize - 1);
+        float4 color;
+        if (count == 0)
+        {
+            color = float4(0);
+        }
+        else if (t <= stops[0])
+        {
+            color = unpremul(colors[0]);
+        }
+        else if (t >= stops[count - 1])
+        {
+            color = unpremul(colors[count - 1]);
+        }
+        else
+        {
+            while (stop + 1 < count && stops[stop + 1] < t)
+            {
+                ++stop;
+            }
+            float span = stops[stop + 1] - stops[stop];
+            float weight = span > 0 ? (t - stops[stop]) / span : 1;
+            color = simd::mix(unpremul(colors[stop]),
+                              unpremul(colors[stop + 1]),
+                              float4(weight));
+        }
+        float alpha = color[3];
+        color *= alpha;
+        color[3] = alpha;
+        m_ramp[i] = color;
+    }
+}
+
+rcp<RenderBuffer> SWFactory::makeRenderBuffer(RenderBufferType type,
+                                              RenderBufferFlags flags,
+                                              size_t sizeInBytes)
+{
+    return make_rcp<DataRenderBuffer>(type, flags, sizeInBytes);
+}
+
+rcp<RenderShader> SWFactory::makeLinearGradient(float sx,
+                                                float sy,
+                                                float ex,
+                                                float ey,
+                                                const ColorInt colors[],
+                                                const float stops[],
+                                                size_t count)
+{
+    return make_rcp<SWGradient>(SWGradient::Type::linear,
+                                Vec2D(sx, sy),
+                                Vec2D(ex, ey),
+                                colors,
+                                stops,
+                                count);
+}
+
+rcp<RenderShader> SWFactory::makeRadialGradient(float cx,
+                                                float cy,
+                                                float radius,
+                                                const ColorInt colors[],
+                                                const float stops[],
+                                                size_t count)
+{
+    return make_rcp<SWGradient>(SWGradient::Type::radial,
+                                Vec2D(cx, cy),
+                                Vec2D(radius, 0),
+                                colors,
+                                stops,
+                                count);
+}
+
+rcp<RenderPath> SWFactory::makeRenderPath(RawPath& rawPath, FillRule fillRule)
+{
+    return make_rcp<SWRenderPath>(rawPath, fillRule);
+}
+
+rcp<RenderPath> SWFactory::makeEmptyRenderPath()
+{
+    return make_rcp<SWRenderPath>();
+}
+
+rcp<RenderPaint> SWFactory::makeRenderPaint()
+{
+    return make_rcp<SWRenderPaint>();
+}
+
+rcp<RenderImage> SWFactory::decodeImage(Span<const uint8_t> encoded)
+{
+    auto bitmap = Bitmap::decode(encoded.data(), encoded.size());
+    if (bitmap == nullptr)
+    {
+        return nullptr;
+    }
+    if (bitmap->pixelFormat() != Bitmap::PixelFormat::RGBAPremul)
+    {
+        bitmap->pixelFormat(Bitmap::PixelFormat::RGBAPremul);
+    }
+    uint32_t width = bitmap->width();
+    uint32_t height = bitmap->height();
+    return makeImage(width, height, bitmap->detachBytes());
+}
+
+rcp<RenderImage> SWFactory::makeImage(uint32_t width,
+                                      uint32_t height,
+                                      std::unique_ptr<const uint8_t[]> pixels)
+{
+    if (width == 0 || height == 0 || pixels == nullptr)
+    {
+        return nullptr;
+    }
+    return make_rcp<SWRenderImage>(width, height, std::move(pixels));
+}
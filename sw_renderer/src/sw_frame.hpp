@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#ifndef _RIVE_SW_FRAME_HPP_
+#define _RIVE_SW_FRAME_HPP_
+
+#include "sw_render_objects.hpp"
+#include "rive/math/aabb.hpp"
+#include "rive/shapes/paint/image_sampler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace rive::sw
+{
+constexpr static int kTileSize = 64;
+
+// A device-space line segment. Edges that go up add +1 to the winding number
+// of everything to their right and edges that go down add -1, so clockwise
+// contours (in y-down device space) wind positively.
+struct Edge
+{
+    float x0, y0, x1, y1;
+};
+
+// The coverage of a filled path, stroke or image rect in device space.
+struct Coverage
+{
+    FillRule fillRule = FillRule::nonZero;
+    std::vector<Edge> edges;
+    // Pixels the edges can touch, intersected with the render target.
+    IAABB bounds = {0, 0, 0, 0};
+    // Indices of the edges that cross each row of tiles, starting at the row
+    // of bounds.top: tileRowEdges[tileRowOffsets[i]..tileRowOffsets[i + 1]].
+    std::vector<uint32_t> tileRowOffsets;
+    std::vector<uint32_t> tileRowEdges;
+    // Feathered coverage is rasterized and blurred over all of bounds before
+    // any tiles, since each pixel depends on its neighbors.
+    std::vector<float> featherMask;
+
+    bool isFeathered() const { return !featherMask.empty(); }
+
+    // Writes the coverage of rect, which must lie within one tile, to
+    // out[y * kTileSize + x], relative to rect's top left.
+    void rasterize(const IAABB& rect, float* out) const;
+};
+
+// What a draw paints with. Colors are premultiplied.
+struct Source
+{
+    enum class Type : uint8_t
+    {
+        color,
+        linearGradient,
+        radialGradient,
+        image,
+    };
+
+    Type type = Type::color;
+    float4 color = {0, 0, 0, 1};
+    // Multiplies gradients and images.
+    float opacity = 1;
+    // Maps device pixel centers to the gradient's or the image's local space
+    // (texels for images).
+    Mat2D deviceToLocal;
+    rcp<const SWGradient> gradient;
+    rcp<const SWRenderImage> image;
+    ImageSampler sampler;
+};
+
+// One clipPath() call: its coverage is intersected with its parent's.
+struct ClipNode
+{
+    std::shared_ptr<const RawPath> path;
+    Mat2D matrix;
+    const ClipNode* parent = nullptr;
+    Coverage coverage;
+    // coverage.bounds intersected with every ancestor's, set after preparing.
+    IAABB bounds;
+};
+
+struct Draw
+{
+    enum class Type : uint8_t
+    {
+        path,
+        mesh,
+    };
+
+    Type type = Type::path;
+    BlendMode blendMode = BlendMode::srcOver;
+    const ClipNode* clip = nullptr;
+    Source source;
+
+    // Path draws.
+    std::shared_ptr<const RawPath> path;
+    Mat2D matrix;
+    FillRule fillRule = FillRule::nonZero;
+    bool isStroke = false;
+    float thickness = 0;
+    StrokeJoin join = StrokeJoin::miter;
+    StrokeCap cap = StrokeCap::butt;
+    float feather = 0;
+    Coverage coverage;
+
+    // Mesh draws: device-space triangles with texel coordinates.
+    std::vector<Vec2D> meshPoints;
+    std::vector<Vec2D> meshTexels;
+    std::vector<uint16_t> meshIndices;
+
+    // Pixels the draw can touch, set after preparing.
+    IAABB bounds = {0, 0, 0, 0};
+};
+
+struct Frame
+{
+    // Deque so ClipNode pointers stay valid as clips are added.
+    std::deque<ClipNode> clips;
+    std::vector<Draw> draws;
+};
+
+// The pixels bounds touches, clamped to a width x height target (also keeping
+// huge or infinite coordinates away from the int conversion).
+inline IAABB round_out(const AABB& bounds, int width, int height)
+{
+    auto clampX = [=](float x) { return std::clamp(x, 0.f, (float)width); };
+    auto clampY = [=](float y) { return std::clamp(y, 0.f, (float)height); };
+    IAABB pixels = {static_cast<int>(floorf(clampX(bounds.left()))),
+                    static_cast<int>(floorf(clampY(bounds.top()))),
+                    static_cast<int>(ceilf(clampX(bounds.right()))),
+                    static_cast<int>(ceilf(clampY(bounds.bottom())))};
+    return pixels.empty() ? IAABB{0, 0, 0, 0} : pixels;
+}
+
+// Flattens (and for strokes, strokes) a path into device-space edges, bins
+// them by tile row, and rasterizes feathered coverage up front.
+void prepare_coverage(const RawPath& path,
+                      const Mat2D& matrix,
+                      FillRule fillRule,
+                      const Draw* stroke,
+                      float feather,
+                      int targetWidth,
+                      int targetHeight,
+                      Coverage* coverage);
+} // namespace rive::sw
+#endif
@@ -0,0 +1,590 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "sw_renderer.hpp"
+
+#include "rive/async/work_pool.hpp"
+#include "sw_frame.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace rive
+{
+namespace
+{
+using namespace sw;
+
+float4 unpack(uint32_t pixel)
+{
+    return float4{static_cast<float>(pixel & 0xff),
+                  static_cast<float>((pixel >> 8) & 0xff),
+                  static_cast<float>((pixel >> 16) & 0xff),
+                  static_cast<float>(pixel >> 24)} *
+           (1 / 255.f);
+}
+
+uint32_t pack(float4 color)
+{
+    color = simd::clamp(color, float4(0), float4(1)) * 255.f + .5f;
+    return static_cast<uint32_t>(color[0]) |
+           static_cast<uint32_t>(color[1]) << 8 |
+           static_cast<uint32_t>(color[2]) << 16 |
+           static_cast<uint32_t>(color[3]) << 24;
+}
+
+////// Shading //////
+
+int wrap(int i, int size, ImageWrap wrap)
+{
+    switch (wrap)
+    {
+        case ImageWrap::clamp:
+            return std::clamp(i, 0, size - 1);
+        case ImageWrap::repeat:
+            i %= size;
+            return i < 0 ? i + size : i;
+        case ImageWrap::mirror:
+        {
+            int period = size * 2;
+            i %= period;
+            i = i < 0 ? i + period : i;
+            return i < size ? i : period - 1 - i;
+        }
+    }
+    RIVE_UNREACHABLE();
+}
+
+float4 texel(const SWRenderImage* image, int x, int y)
+{
+    const uint8_t* p = image->pixels() + (y * image->width() + x) * 4;
+    return float4{static_cast<float>(p[0]),
+                  static_cast<float>(p[1]),
+                  static_cast<float>(p[2]),
+                  static_cast<float>(p[3])} *
+           (1 / 255.f);
+}
+
+// Samples image at uv, in texels.
+float4 sample(const SWRenderImage* image, ImageSampler sampler, Vec2D uv)
+{
+    int w = image->width();
+    int h = image->height();
+    if (sampler.filter == ImageFilter::nearest)
+    {
+        return texel(image,
+                     wrap(static_cast<int>(floorf(uv.x)), w, sampler.wrapX),
+                     wrap(static_cast<int>(floorf(uv.y)), h, sampler.wrapY));
+    }
+    float x = uv.x - .5f;
+    float y = uv.y - .5f;
+    float x0f = floorf(x);
+    float y0f = floorf(y);
+    float fx = x - x0f;
+    float fy = y - y0f;
+    int x0 = static_cast<int>(x0f);
+    int y0 = static_cast<int>(y0f);
+    int xa = wrap(x0, w, sampler.wrapX);
+    int xb = wrap(x0 + 1, w, sampler.wrapX);
+    int ya = wrap(y0, h, sampler.wrapY);
+    int yb = wrap(y0 + 1, h, sampler.wrapY);
+    float4 top = simd::mix(texel(image, xa, ya), texel(image, xb, ya), float4(fx));
+    float4 bottom =
+        simd::mix(texel(image, xa, yb), texel(image, xb, yb), float4(fx));
+    return simd::mix(top, bottom, float4(fy));
+}
+
+float4 shade(const Source& source, int x, int y)
+{
+    if (source.type == Source::Type::color)
+    {
+        return source.color;
+    }
+    Vec2D local = source.deviceToLocal * Vec2D(x + .5f, y + .5f);
+    switch (source.type)
+    {
+        case Source::Type::color:
+            break;
+        case Source::Type::linearGradient:
+        {
+            const SWGradient* gradient = source.gradient.get();
+            Vec2D direction = gradient->p1() - gradient->p0();
+            float lengthSquared = Vec2D::dot(direction, direction);
+            float t = lengthSquared > 0
+                          ? Vec2D::dot(local - gradient->p0(), direction) /
+                                lengthSquared
+                          : 0;
+            return gradient->colorAt(std::clamp(t, 0.f, 1.f)) * source.opacity;
+        }
+        case Source::Type::radialGradient:
+        {
+            const SWGradient* gradient = source.gradient.get();
+            float radius = gradient->p1().x;
+            float t = radius > 0 ? (local - gradient->p0()).length() / radius
+                                 : 1;
+            return gradient->colorAt(std::clamp(t, 0.f, 1.f)) * source.opacity;
+        }
+        case Source::Type::image:
+            return sample(source.image.get(), source.sampler, local) *
+                   source.opacity;
+    }
+    RIVE_UNREACHABLE();
+}
+
+////// Blending //////
+
+// The W3C compositing spec's separable blend functions, on unpremultiplied
+// channels.
+float blend_channel(BlendMode mode, float cs, float cd)
+{
+    switch (mode)
+    {
+        case BlendMode::screen:
+            return cs + cd - cs * cd;
+        case BlendMode::overlay:
+            return blend_channel(BlendMode::hardLight, cd, cs);
+        case BlendMode::darken:
+            return std::min(cs, cd);
+        case BlendMode::lighten:
+            return std::max(cs, cd);
+        case BlendMode::colorDodge:
+            if (cd <= 0)
+            {
+                return 0;
+            }
+            return cs >= 1 ? 1 : std::min(1.f, cd / (1 - cs));
+        case BlendMode::colorBurn:
+            if (cd >= 1)
+            {
+                return 1;
+            }
+            return cs <= 0 ? 0 : 1 - std::min(1.f, (1 - cd) / cs);
+        case BlendMode::hardLight:
+            return cs <= .5f ? cd * 2 * cs
+                             : blend_channel(BlendMode::screen, 2 * cs - 1, cd);
+        case BlendMode::softLight:
+        {
+            if (cs <= .5f)
+            {
+                return cd - (1 - 2 * cs) * cd * (1 - cd);
+            }
+            float d = cd <= .25f ? ((16 * cd - 12) * cd + 4) * cd : sqrtf(cd);
+            return cd + (2 * cs - 1) * (d - cd);
+        }
+        case BlendMode::difference:
+            return std::abs(cs - cd);
+        case BlendMode::exclusion:
+            return cs + cd - 2 * cs * cd;
+        case BlendMode::multiply:
+            return cs * cd;
+        default:
+            RIVE_UNREACHABLE();
+    }
+}
+
+float lum(float4 c) { return .3f * c[0] + .59f * c[1] + .11f * c[2]; }
+
+float sat(float4 c)
+{
+    return std::max({c[0], c[1], c[2]}) - std::min({c[0], c[1], c[2]});
+}
+
+float4 clip_color(float4 c)
+{
+    float l = lum(c);
+    float n = std::min({c[0], c[1], c[2]});
+    float x = std::max({c[0], c[1], c[2]});
+    if (n < 0)
+    {
+        c = l + (c - l) * (l / (l - n));
+    }
+    if (x > 1)
+    {
+        c = l + (c - l) * ((1 - l) / (x - l));
+    }
+    return c;
+}
+
+float4 set_lum(float4 c, float l) { return clip_color(c + (l - lum(c))); }
+
+float4 set_sat(float4 c, float s)
+{
+    float n = std::min({c[0], c[1], c[2]});
+    float x = std::max({c[0], c[1], c[2]});
+    if (x <= n)
+    {
+        return float4(0);
+    }
+    return (c - n) * (s / (x - n));
+}
+
+// Blends premultiplied src over premultiplied dst.
+float4 blend(BlendMode mode, float4 src, float4 dst)
+{
+    float sa = src[3];
+    float da = dst[3];
+    if (mode == BlendMode::srcOver)
+    {
+        return src + dst * (1 - sa);
+    }
+    float4 cs = sa > 0 ? src / sa : float4(0);
+    float4 cd = da > 0 ? dst / da : float4(0);
+    float4 b;
+    switch (mode)
+    {
+        case BlendMode::hue:
+            b = set_lum(set_sat(cs, sat(cd)), lum(cd));
+            break;
+        case BlendMode::saturation:
+            b = set_lum(set_sat(cd, sat(cs)), lum(cd));
+            break;
+        case BlendMode::color:
+            b = set_lum(cs, lum(cd));
+            break;
+        case BlendMode::luminosity:
+            b = set_lum(cd, lum(cs));
+            break;
+        default:
+            for (int i = 0; i < 3; ++i)
+            {
+                b[i] = blend_channel(mode, cs[i], cd[i]);
+            }
+            break;
+    }
+    float4 result = dst * (1 - sa) + src * (1 - da) + b * (sa * da);
+    result[3] = sa + da - sa * da;
+    return result;
+}
+
+////// Tiles //////
+
+// Everything one thread needs to rasterize a tile.
+class TileRasterizer
+{
+public:
+    void rasterize(const Frame& frame,
+                   uint32_t* pixels,
+                   uint32_t width,
+                   const IAABB& rect)
+    {
+        m_pixels = pixels;
+        m_width = width;
+        m_rect = rect;
+        m_clipCache.clear();
+        for (int y = rect.top; y < rect.bottom; ++y)
+        {
+            const uint32_t* row = m_pixels + y * m_width;
+            for (int x = rect.left; x < rect.right; ++x)
+            {
+                m_dst[(y - rect.top) * kTileSize + x - rect.left] =
+                    unpack(row[x]);
+            }
+        }
+        for (const Draw& draw : frame.draws)
+        {
+            IAABB drawRect = draw.bounds.intersect(rect);
+            if (drawRect.empty())
+            {
+                continue;
+            }
+            if (draw.type == Draw::Type::mesh)
+            {
+                drawMesh(draw, drawRect);
+            }
+            else
+            {
+                drawPath(draw, drawRect);
+            }
+        }
+        for (int y = rect.top; y < rect.bottom; ++y)
+        {
+            uint32_t* row = m_pixels + y * m_width;
+            for (int x = rect.left; x < rect.right; ++x)
+            {
+                row[x] = pack(m_dst[(y - rect.top) * kTileSize + x - rect.left]);
+            }
+        }
+    }
+
+private:
+    // Coverage of the clip (and all its ancestors) over the whole tile,
+    // computed once per tile.
+    const float* clipCoverage(const ClipNode* clip)
+    {
+        for (auto& [cachedClip, coverage] : m_clipCache)
+        {
+            if (cachedClip == clip)
+            {
+                return coverage.data();
+            }
+        }
+        const float* parentCoverage =
+            clip->parent != nullptr ? clipCoverage(clip->parent) : nullptr;
+        m_clipCache.emplace_back(clip,
+                                 std::vector<float>(kTileSize * kTileSize, 0));
+        float* coverage = m_clipCache.back().second.data();
+        IAABB clipRect = clip->bounds.intersect(m_rect);
+        if (!clipRect.empty())
+        {
+            size_t offset = (clipRect.top - m_rect.top) * kTileSize +
+                            (clipRect.left - m_rect.left);
+            clip->coverage.rasterize(clipRect, coverage + offset);
+            if (parentCoverage != nullptr)
+            {
+                for (int y = 0; y < clipRect.height(); ++y)
+                {
+                    for (int x = 0; x < clipRect.width(); ++x)
+                    {
+                        size_t i = offset + y * kTileSize + x;
+                        coverage[i] *= parentCoverage[i];
+                    }
+                }
+            }
+        }
+        return coverage;
+    }
+
+    void blendPixel(const Draw& draw, int x, int y, float4 src, float coverage)
+    {
+        float4& dst = m_dst[(y - m_rect.top) * kTileSize + x - m_rect.left];
+        if (draw.blendMode == BlendMode::srcOver)
+        {
+            src *= coverage;
+            dst = src + dst * (1 - src[3]);
+        }
+        else
+        {
+            dst += (blend(draw.blendMode, src, dst) - dst) * coverage;
+        }
+    }
+
+    void drawPath(const Draw& draw, const IAABB& rect)
+    {
+        draw.coverage.rasterize(rect, m_coverage);
+        const float* clip =
+            draw.clip != nullptr ? clipCoverage(draw.clip) : nullptr;
+        for (int y = rect.top; y < rect.bottom; ++y)
+        {
+            const float* coverageRow = m_coverage + (y - rect.top) * kTileSize;
+            for (int x = rect.left; x < rect.right; ++x)
+            {
+                float coverage = coverageRow[x - rect.left];
+                if (clip != nullptr)
+                {
+                    coverage *= clip[(y - m_rect.top) * kTileSize + x -
+                                     m_rect.left];
+                }
+                if (coverage <= 0)
+                {
+                    continue;
+                }
+                blendPixel(draw, x, y, shade(draw.source, x, y), coverage);
+            }
+        }
+    }
+
+    // Draws each triangle's pixel centers, without antialiasing.
+    void drawMesh(const Draw& draw, const IAABB& rect)
+    {
+        const float* clip =
+            draw.clip != nullptr ? clipCoverage(draw.clip) : nullptr;
+        const Source& source = draw.source;
+        const std::vector<Vec2D>& points = draw.meshPoints;
+        const std::vector<Vec2D>& texels = draw.meshTexels;
+        for (size_t i = 0; i + 2 < draw.meshIndices.size(); i += 3)
+        {
+            uint16_t i0 = draw.meshIndices[i];
+            uint16_t i1 = draw.meshIndices[i + 1];
+            uint16_t i2 = draw.meshIndices[i + 2];
+            if (std::max({i0, i1, i2}) >= points.size())
+            {
+                continue;
+            }
+            Vec2D p0 = points[i0], p1 = points[i1], p2 = points[i2];
+            float area = Vec2D::cross(p1 - p0, p2 - p0);
+            if (area == 0)
+            {
+                continue;
+            }
+            AABB bounds = AABB::forExpansion();
+            bounds.expandTo(bounds, p0);
+            bounds.expandTo(bounds, p1);
+            bounds.expandTo(bounds, p2);
+            IAABB triangleRect =
+                round_out(bounds, rect.right, rect.bottom).intersect(rect);
+            float invArea = 1 / area;
+            for (int y = triangleRect.top; y < triangleRect.bottom; ++y)
+            {
+                for (int x = triangleRect.left; x < triangleRect.right; ++x)
+                {
+                    Vec2D p(x + .5f, y + .5f);
+                    float w0 = Vec2D::cross(p2 - p1, p - p1) * invArea;
+                    float w1 = Vec2D::cross(p0 - p2, p - p2) * invArea;
+                    float w2 = 1 - w0 - w1;
+                    // Half-open on one side so shared edges draw once.
+                    if (w0 < 0 || w1 < 0 || w2 <= 0)
+                    {
+                        continue;
+                    }
+                    float coverage = 1;
+                    if (clip != nullptr)
+                    {
+                        coverage = clip[(y - m_rect.top) * kTileSize + x -
+                                        m_rect.left];
+                        if (coverage <= 0)
+                        {
+                            continue;
+                        }
+                    }
+                    Vec2D uv = texels[i0] * w0 + texels[i1] * w1 +
+                               texels[i2] * w2;
+                    float4 src = sample(source.image.get(), source.sampler, uv) *
+                                 source.opacity;
+                    blendPixel(draw, x, y, src, coverage);
+                }
+            }
+        }
+    }
+
+    uint32_t* m_pixels = nullptr;
+    uint32_t m_width = 0;
+    IAABB m_rect;
+    float4 m_dst[kTileSize * kTileSize];
+    float m_coverage[kTileSize * kTileSize];
+    std::vector<std::pair<const ClipNode*, std::vector<float>>> m_clipCache;
+};
+} // namespace
+
+uint32_t SWRasterizer::defaultThreadCount()
+{
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    return 1;
+#else
+    return std::max(std::thread::hardware_concurrency(), 1u);
+#endif
+}
+
+SWRasterizer::SWRasterizer(uint32_t threadCount) :
+    m_threadCount(
+        std::min(threadCount != 0 ? threadCount : defaultThreadCount(),
+                 getGlobalWorkPool()->threadCount() + 1)),
+    m_frame(std::make_unique<Frame>())
+{}
+
+SWRasterizer::~SWRasterizer() {}
+
+uint32_t SWRasterizer::PremultipliedRGBA(ColorInt color)
+{
+    float a = colorAlpha(color) / 255.f;
+    return pack(float4{colorRed(color) / 255.f * a,
+                       colorGreen(color) / 255.f * a,
+                       colorBlue(color) / 255.f * a,
+                       a});
+}
+
+void SWRasterizer::beginFrame(uint32_t* pixels, uint32_t width, uint32_t height)
+{
+    m_pixels = pixels;
+    m_width = width;
+    m_height = height;
+    m_frame->clips.clear();
+    m_frame->draws.clear();
+}
+
+void SWRasterizer::flush()
+{
+    Frame& frame = *m_frame;
+    int width = static_cast<int>(m_width);
+    int height = static_cast<int>(m_height);
+
+    rcp<WorkPool>& workPool = getGlobalWorkPool();
+    uint32_t maxHelpers = m_threadCount - 1;
+
+    // Flatten every clip and path draw.
+    size_t clipCount = frame.clips.size();
+    auto prepareDraw = [&](size_t i) {
+        if (i < clipCount)
+        {
+            ClipNode& clip = frame.clips[i];
+            prepare_coverage(*clip.path,
+                             clip.matrix,
+                             clip.coverage.fillRule,
+                             nullptr,
+                             0,
+                             width,
+                             height,
+                             &clip.coverage);
+            return;
+        }
+        Draw& draw = frame.draws[i - clipCount];
+        if (draw.type == Draw::Type::path)
+        {
+            prepare_coverage(*draw.path,
+                             draw.matrix,
+                             draw.fillRule,
+                             draw.isStroke ? &draw : nullptr,
+                             draw.feather,
+                             width,
+                             height,
+                             &draw.coverage);
+        }
+    };
+    workPool->parallelFor(clipCount + frame.draws.size(),
+                          prepareDraw,
+                          maxHelpers);
+
+    // Parents are always recorded before their children.
+    for (ClipNode& clip : frame.clips)
+    {
+        clip.bounds = clip.coverage.bounds;
+        if (clip.parent != nullptr)
+        {
+            clip.bounds = clip.bounds.intersect(clip.parent->bounds);
+        }
+    }
+    for (Draw& draw : frame.draws)
+    {
+        if (draw.type == Draw::Type::path)
+        {
+            draw.bounds = draw.coverage.bounds;
+        }
+        else
+        {
+            AABB bounds = AABB::forExpansion();
+            for (Vec2D point : draw.meshPoints)
+            {
+                bounds.expandTo(bounds, point);
+            }
+            draw.bounds = round_out(bounds, width, height);
+        }
+        if (draw.clip != nullptr)
+        {
+            draw.bounds = draw.bounds.intersect(draw.clip->bounds);
+        }
+    }
+
+    int tilesX = (width + kTileSize - 1) / kTileSize;
+    int tilesY = (height + kTileSize - 1) / kTileSize;
+    auto rasterizeTile = [&](size_t i) {
+        // Big enough to keep off the workers' stacks, and reused across
+        // frames.
+        thread_local std::unique_ptr<TileRasterizer> tileRasterizer =
+            std::make_unique<TileRasterizer>();
+        int x = static_cast<int>(i % tilesX) * kTileSize;
+        int y = static_cast<int>(i / tilesX) * kTileSize;
+        tileRasterizer->rasterize(frame,
+                                  m_pixels,
+                                  m_width,
+                                  IAABB{x,
+                                        y,
+                                        std::min(x + kTileSize, width),
+                                        std::min(y + kTileSize, height)});
+    };
+    workPool->parallelFor(tilesX * tilesY, rasterizeTile, maxHelpers);
+
+    frame.clips.clear();
+    frame.draws.clear();
+    m_pixels = nullptr;
+}
+} // namespace rive
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#ifndef _RIVE_SW_RENDER_OBJECTS_HPP_
+#define _RIVE_SW_RENDER_OBJECTS_HPP_
+
+#include "rive/renderer.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/math/simd.hpp"
+#include <memory>
+
+namespace rive
+{
+class SWRenderPath : public LITE_RTTI_OVERRIDE(RenderPath, SWRenderPath)
+{
+public:
+    SWRenderPath() = default;
+    SWRenderPath(RawPath& rawPath, FillRule fillRule) :
+        m_rawPath(std::make_shared<RawPath>()), m_fillRule(fillRule)
+    {
+        m_rawPath->swap(rawPath);
+    }
+
+    void rewind() override { mutableRawPath().rewind(); }
+    void fillRule(FillRule value) override { m_fillRule = value; }
+    void moveTo(float x, float y) override { mutableRawPath().moveTo(x, y); }
+    void lineTo(float x, float y) override { mutableRawPath().lineTo(x, y); }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y)
+        override
+    {
+        mutableRawPath().cubicTo(ox, oy, ix, iy, x, y);
+    }
+    void close() override { mutableRawPath().close(); }
+    void addRenderPath(const RenderPath* path, const Mat2D& matrix) override
+    {
+        LITE_RTTI_CAST_OR_RETURN(swPath, const SWRenderPath*, path);
+        mutableRawPath().addPath(*swPath->m_rawPath, &matrix);
+    }
+    void addRawPath(const RawPath& path) override
+    {
+        mutableRawPath().addPath(path);
+    }
+
+    FillRule getFillRule() const { return m_fillRule; }
+
+    // The path as it is now. Draws hold on to this instead of copying the
+    // path; changing the path afterwards copies it first (see
+    // mutableRawPath()), so snapshots never change.
+    std::shared_ptr<const RawPath> snapshot() const { return m_rawPath; }
+
+private:
+    RawPath& mutableRawPath()
+    {
+        if (m_rawPath.use_count() > 1)
+        {
+            m_rawPath = std::make_shared<RawPath>(*m_rawPath);
+        }
+        return *m_rawPath;
+    }
+
+    std::shared_ptr<RawPath> m_rawPath = std::make_shared<RawPath>();
+    FillRule m_fillRule = FillRule::nonZero;
+};
+
+class SWGradient : public LITE_RTTI_OVERRIDE(RenderShader, SWGradient)
+{
+public:
+    constexpr static int kRampSize = 256;
+
+    enum class Type : uint8_t
+    {
+        linear,
+        radial,
+    };
+
+    // For linear gradients p0 and p1 are the start and end points. For radial
+    // gradients p0 is the center and p1.x the radius.
+    SWGradient(Type type,
+               Vec2D p0,
+               Vec2D p1,
+               const ColorInt colors[],
+               const float stops[],
+               size_t count);
+
+    Type type() const { return m_type; }
+    Vec2D p0() const { return m_p0; }
+    Vec2D p1() const { return m_p1; }
+
+    // Premultiplied color at t, which must be in 0..1.
+    float4 colorAt(float t) const
+    {
+        return m_ramp[static_cast<int>(t * (kRampSize - 1) + .5f)];
+    }
+
+private:
+    const Type m_type;
+    const Vec2D m_p0;
+    const Vec2D m_p1;
+    // Colors are interpolated unpremultiplied, then premultiplied, like the
+    // GPU renderer's color ramps.
+    float4 m_ramp[kRampSize];
+};
+
+class SWRenderPaint : public LITE_RTTI_OVERRIDE(RenderPaint, SWRenderPaint)
+{
+public:
+    void style(RenderPaintStyle value) override
+    {
+        m_isStroke = value == RenderPaintStyle::stroke;
+    }
+    void color(ColorInt value) override
+    {
+        m_color = value;
+        m_gradient = nullptr;
+    }
+    void thickness(float value) override { m_thickness = value; }
+    void join(StrokeJoin value) override { m_join = value; }
+    void cap(StrokeCap value) override { m_cap = value; }
+    void feather(float value) override { m_feather = value; }
+    void blendMode(BlendMode value) override { m_blendMode = value; }
+    void shader(rcp<RenderShader> shader) override
+    {
+        m_gradient = lite_rtti_rcp_cast<SWGradient>(std::move(shader));
+    }
+    void invalidateStroke() override {}
+
+    bool isStroke() const { return m_isStroke; }
+    ColorInt getColor() const { return m_color; }
+    float getThickness() const { return m_thickness; }
+    StrokeJoin getJoin() const { return m_join; }
+    StrokeCap getCap() const { return m_cap; }
+    float getFeather() const { return m_feather; }
+    BlendMode getBlendMode() const { return m_blendMode; }
+    // When set, the gradient is drawn instead of the color.
+    const rcp<SWGradient>& getGradient() const { return m_gradient; }
+
+private:
+    ColorInt m_color = 0xff000000;
+    rcp<SWGradient> m_gradient;
+    float m_thickness = 1;
+    float m_feather = 0;
+    StrokeJoin m_join = StrokeJoin::miter;
+    StrokeCap m_cap = StrokeCap::butt;
+    BlendMode m_blendMode = BlendMode::srcOver;
+    bool m_isStroke = false;
+};
+
+class SWRenderImage : public LITE_RTTI_OVERRIDE(RenderImage, SWRenderImage)
+{
+public:
+    // pixels are premultiplied RGBA8, rows top to bottom.
+    SWRenderImage(uint32_t width,
+                  uint32_t height,
+                  std::unique_ptr<const uint8_t[]> pixels) :
+        m_pixels(std::move(pixels))
+    {
+        m_Width = width;
+        m_Height = height;
+    }
+
+    const uint8_t* pixels() const { return m_pixels.get(); }
+
+private:
+    std::unique_ptr<const uint8_t[]> m_pixels;
+};
+} // namespace rive
+#endif
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "sw_renderer.hpp"
+
+#include "sw_frame.hpp"
+#include "utils/factory_utils.hpp"
+#include "rive/shapes/paint/color.hpp"
+#include <algorithm>
+
+using namespace rive;
+
+namespace
+{
+float4 premultiplied(ColorInt color, float opacity)
+{
+    float a = colorAlpha(color) / 255.f * opacity;
+    return float4{colorRed(color) / 255.f * a,
+                  colorGreen(color) / 255.f * a,
+                  colorBlue(color) / 255.f * a,
+                  a};
+}
+} // namespace
+
+SWRenderer::SWRenderer(SWRasterizer* rasterizer) : m_rasterizer(rasterizer) {}
+
+SWRenderer::~SWRenderer() {}
+
+void SWRenderer::save() { m_stack.push_back(m_stack.back()); }
+
+void SWRenderer::restore()
+{
+    assert(m_stack.size() > 1);
+    m_stack.pop_back();
+}
+
+void SWRenderer::transform(const Mat2D& transform)
+{
+    m_stack.back().matrix = m_stack.back().matrix * transform;
+}
+
+void SWRenderer::modulateOpacity(float opacity)
+{
+    m_stack.back().opacity = std::max(0.0f, m_stack.back().opacity * opacity);
+}
+
+void SWRenderer::clipPath(RenderPath* renderPath)
+{
+    LITE_RTTI_CAST_OR_RETURN(path, SWRenderPath*, renderPath);
+    State& state = m_stack.back();
+    std::shared_ptr<const RawPath> rawPath = path->snapshot();
+    if (rawPath->empty())
+    {
+        state.clipIsEmpty = true;
+        return;
+    }
+    sw::ClipNode& clip = m_rasterizer->m_frame->clips.emplace_back();
+    clip.path = std::move(rawPath);
+    clip.matrix = state.matrix;
+    clip.parent = state.clip;
+    clip.coverage.fillRule = path->getFillRule();
+    state.clip = &clip;
+}
+
+void SWRenderer::drawPath(RenderPath* renderPath, RenderPaint* renderPaint)
+{
+    LITE_RTTI_CAST_OR_RETURN(path, SWRenderPath*, renderPath);
+    LITE_RTTI_CAST_OR_RETURN(paint, SWRenderPaint*, renderPaint);
+    const State& state = m_stack.back();
+    if (state.clipIsEmpty || state.opacity <= 0 ||
+        (paint->isStroke() && paint->getThickness() <= 0))
+    {
+        return;
+    }
+    sw::Draw& draw = m_rasterizer->m_frame->draws.emplace_back();
+    draw.blendMode = paint->getBlendMode();
+    draw.clip = state.clip;
+    draw.path = path->snapshot();
+    draw.matrix = state.matrix;
+    draw.fillRule = path->getFillRule();
+    draw.isStroke = paint->isStroke();
+    draw.thickness = paint->getThickness();
+    draw.join = paint->getJoin();
+    draw.cap = paint->getCap();
+    draw.feather = paint->getFeather();
+    if (const SWGradient* gradient = paint->getGradient().get())
+    {
+        draw.source.type = gradient->type() == SWGradient::Type::linear
+                               ? sw::Source::Type::linearGradient
+                               : sw::Source::Type::radialGradient;
+        draw.source.gradient = ref_rcp(gradient);
+        draw.source.opacity = state.opacity;
+        draw.source.deviceToLocal = state.matrix.invertOrIdentity();
+    }
+    else
+    {
+        draw.source.color = premultiplied(paint->getColor(), state.opacity);
+    }
+}
+
+void SWRenderer::drawImage(const RenderImage* renderImage,
+                           ImageSampler sampler,
+                           BlendMode blendMode,
+                           float opacity)
+{
+    LITE_RTTI_CAST_OR_RETURN(image, const SWRenderImage*, renderImage);
+    const State& state = m_stack.back();
+    opacity = std::max(0.0f, opacity * state.opacity);
+    if (state.clipIsEmpty || opacity <= 0)
+    {
+        return;
+    }
+    // Drawn as the rect [0, 0, width, height], whose local coordinates are
+    // the image's texel coordinates.
+    auto rect = std::make_shared<RawPath>();
+    rect->addRect(AABB(0,
+                       0,
+                       static_cast<float>(image->width()),
+                       static_cast<float>(image->height())));
+    sw::Draw& draw = m_rasterizer->m_frame->draws.emplace_back();
+    draw.blendMode = blendMode;
+    draw.clip = state.clip;
+    draw.path = std::move(rect);
+    draw.matrix = state.matrix;
+    draw.source.type = sw::Source::Type::image;
+    draw.source.image = ref_rcp(image);
+    draw.source.sampler = sampler;
+    draw.source.opacity = opacity;
+    draw.source.deviceToLocal = state.matrix.invertOrIdentity();
+}
+
+void SWRenderer::drawImageMesh(const RenderImage* renderImage,
+                               ImageSampler sampler,
+                               rcp<RenderBuffer> vertices_f32,
+                               rcp<RenderBuffer> uvCoords_f32,
+                               rcp<RenderBuffer> indices_u16,
+                               uint32_t vertexCount,
+                               uint32_t indexCount,
+                               BlendMode blendMode,
+                               float opacity)
+{
+    LITE_RTTI_CAST_OR_RETURN(image, const SWRenderImage*, renderImage);
+    LITE_RTTI_CAST_OR_RETURN(vertices,
+                             const DataRenderBuffer*,
+                             vertices_f32.get());
+    LITE_RTTI_CAST_OR_RETURN(uvCoords,
+                             const DataRenderBuffer*,
+                             uvCoords_f32.get());
+    LITE_RTTI_CAST_OR_RETURN(indices,
+                             const DataRenderBuffer*,
+                             indices_u16.get());
+    const State& state = m_stack.back();
+    opacity = std::max(0.0f, opacity * state.opacity);
+    if (state.clipIsEmpty || opacity <= 0 || indexCount < 3)
+    {
+        return;
+    }
+    sw::Draw& draw = m_rasterizer->m_frame->draws.emplace_back();
+    draw.type = sw::Draw::Type::mesh;
+    draw.blendMode = blendMode;
+    draw.clip = state.clip;
+    draw.source.type = sw::Source::Type::image;
+    draw.source.image = ref_rcp(image);
+    draw.source.sampler = sampler;
+    draw.source.opacity = opacity;
+    // Recorded in device space and texels, since the buffers may change
+    // before the frame is flushed.
+    float width = static_cast<float>(image->width());
+    float height = static_cast<float>(image->height());
+    draw.meshPoints.resize(vertexCount);
+    draw.meshTexels.resize(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+        draw.meshPoints[i] = state.matrix * vertices->vecs()[i];
+        Vec2D uv = uvCoords->vecs()[i];
+        draw.meshTexels[i] = Vec2D(uv.x * width, uv.y * height);
+    }
+    draw.meshIndices.assign(indices->u16s(), indices->u16s() + indexCount);
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "assets/paper.riv.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/file.hpp"
+#include <cstdio>
+
+using namespace rive;
+
+// Measure instancing paper.riv's first artboard 100 times (and destroying
+// the instances), cloning the objects on the heap vs into one arena per
+// instance.
+class ArtboardInstanceBench : public Bench
+{
+public:
+    constexpr static int kInstanceCount = 100;
+
+    ArtboardInstanceBench(InstanceAllocation allocation) :
+        m_allocation(allocation)
+    {}
+
+    ~ArtboardInstanceBench()
+    {
+        if (m_source == nullptr)
+        {
+            return;
+        }
+        // Each object (and data bind) cloned on the heap is its own
+        // allocation; an arena instance makes one per arena block instead,
+        // plus one per data bind and object it leaves on the heap.
+        // Allocations made inside the objects (child lists, paths...) are the
+        // same either way.
+        auto artboard = m_source->instance(nullptr, m_allocation);
+        auto arena = artboard->instanceArena();
+        size_t objectCount = artboard->dataBinds().size();
+        size_t allocationCount = objectCount;
+        if (arena != nullptr)
+        {
+            allocationCount += arena->blockCount();
+        }
+        for (auto object : artboard->objects())
+        {
+            if (object == nullptr || object == artboard.get())
+            {
+                continue;
+            }
+            objectCount++;
+            allocationCount += arena == nullptr || !arena->owns(object);
+        }
+        printf("%s: %zu allocations to clone %zu objects per instance\n",
+               arena != nullptr ? "arena" : "heap",
+               allocationCount,
+               objectCount);
+    }
+
+    void setup() override
+    {
+        m_nullContext = RenderContextNULL::MakeContext();
+        m_file = File::import(assets::paper_riv(), m_nullContext.get());
+        m_source = m_file->artboard();
+        // Let the arena variant size its arenas from a first instance.
+        m_source->instance(nullptr, m_allocation);
+    }
+
+    int run() const override
+    {
+        int objectCount = 0;
+        for (int i = 0; i < kInstanceCount; ++i)
+        {
+            auto artboard = m_source->instance(nullptr, m_allocation);
+            objectCount += static_cast<int>(artboard->objects().size());
+        }
+        return objectCount;
+    }
+
+private:
+    const InstanceAllocation m_allocation;
+    std::unique_ptr<gpu::RenderContext> m_nullContext;
+    rcp<File> m_file;
+    Artboard* m_source = nullptr;
+};
+
+class ArtboardInstance_heap : public ArtboardInstanceBench
+{
+public:
+    ArtboardInstance_heap() : ArtboardInstanceBench(InstanceAllocation::Heap)
+    {}
+};
+REGISTER_BENCH(ArtboardInstance_heap);
+
+class ArtboardInstance_arena : public ArtboardInstanceBench
+{
+public:
+    ArtboardInstance_arena() : ArtboardInstanceBench(InstanceAllocation::Arena)
+    {}
+};
+REGISTER_BENCH(ArtboardInstance_arena);
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "common/render_context_null.hpp"
+#include "rive/artboard.hpp"
+#include "rive/node.hpp"
+#include "rive/shapes/rectangle.hpp"
+#include "rive/shapes/shape.hpp"
+
+using namespace rive;
+
+// Measure instancing an artboard of ~10k components, where sorting the
+// dependency graph is a large share of the work. Half of the components are
+// rectangles in groups of 50 hanging off the artboard, the rest are chains
+// of 500 nested nodes, so the graph is both wide and deep.
+class ArtboardInstance_10k : public Bench
+{
+public:
+    constexpr static int kInstanceCount = 10;
+    constexpr static int kGroupCount = 50;
+    constexpr static int kShapesPerGroup = 50;
+    constexpr static int kChainCount = 10;
+    constexpr static int kChainLength = 500;
+
+    void setup() override
+    {
+        m_nullContext = RenderContextNULL::MakeContext();
+        m_source = std::make_unique<Artboard>(m_nullContext.get());
+        m_source->width(1000);
+        m_source->height(1000);
+        m_source->addObject(m_source.get());
+        for (int i = 0; i < kGroupCount; ++i)
+        {
+            auto groupId = static_cast<uint32_t>(m_source->objects().size());
+            m_source->addObject(new Node());
+            for (int j = 0; j < kShapesPerGroup; ++j)
+            {
+                auto shape = new Shape();
+                shape->x(static_cast<float>(j) * 16);
+                shape->y(static_cast<float>(i) * 16);
+                shape->parentId(groupId);
+                auto rectangle = new Rectangle();
+                rectangle->width(12);
+                rectangle->height(12);
+                auto shapeId =
+                    static_cast<uint32_t>(m_source->objects().size());
+                m_source->addObject(shape);
+                m_source->addObject(rectangle);
+                rectangle->parentId(shapeId);
+            }
+        }
+        for (int i = 0; i < kChainCount; ++i)
+        {
+            uint32_t parentId = 0;
+            for (int j = 0; j < kChainLength; ++j)
+            {
+                auto node = new Node();
+                node->x(1);
+                node->parentId(parentId);
+                parentId = static_cast<uint32_t>(m_source->objects().size());
+                m_source->addObject(node);
+            }
+        }
+        m_source->initialize();
+    }
+
+    int run() const override
+    {
+        int componentCount = 0;
+        for (int i = 0; i < kInstanceCount; ++i)
+        {
+            auto artboard = m_source->instance();
+            componentCount += static_cast<int>(artboard->objects().size());
+        }
+        return componentCount;
+    }
+
+private:
+    std::unique_ptr<gpu::RenderContext> m_nullContext;
+    std::unique_ptr<Artboard> m_source;
+};
+REGISTER_BENCH(ArtboardInstance_10k);
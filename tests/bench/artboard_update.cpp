@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "common/render_context_null.hpp"
+#include "rive/artboard.hpp"
+#include "rive/shapes/rectangle.hpp"
+#include "rive/shapes/shape.hpp"
+
+using namespace rive;
+
+// Measure advancing a large artboard where only one node changes per frame.
+// The artboard holds 4k rectangles (~12k components once each shape's path
+// composer is counted in) and one of them moves every frame, so the update
+// cost should track the handful of components that moved rather than the
+// size of the artboard.
+class ArtboardUpdateOneDirty : public Bench
+{
+public:
+    constexpr static int kShapeCount = 4000;
+    constexpr static int kFrameCount = 1000;
+
+    void setup() override
+    {
+        m_nullContext = RenderContextNULL::MakeContext();
+        m_artboard = std::make_unique<Artboard>(m_nullContext.get());
+        m_artboard->width(1000);
+        m_artboard->height(1000);
+        m_artboard->addObject(m_artboard.get());
+        for (int i = 0; i < kShapeCount; ++i)
+        {
+            auto shape = new Shape();
+            shape->x(static_cast<float>(i % 64) * 16);
+            shape->y(static_cast<float>(i / 64) * 16);
+            auto rectangle = new Rectangle();
+            rectangle->width(12);
+            rectangle->height(12);
+            auto shapeId = static_cast<uint32_t>(m_artboard->objects().size());
+            m_artboard->addObject(shape);
+            m_artboard->addObject(rectangle);
+            rectangle->parentId(shapeId);
+            if (m_animatedShape == nullptr)
+            {
+                m_animatedShape = shape;
+            }
+        }
+        m_artboard->initialize();
+        m_artboard->advance(0);
+    }
+
+    int run() const override
+    {
+        int updates = 0;
+        for (int i = 0; i < kFrameCount; ++i)
+        {
+            m_animatedShape->x(static_cast<float>(i % 100));
+            updates += m_artboard->advance(1 / 60.0f);
+        }
+        return updates;
+    }
+
+private:
+    std::unique_ptr<gpu::RenderContext> m_nullContext;
+    std::unique_ptr<Artboard> m_artboard;
+    Shape* m_animatedShape = nullptr;
+};
+REGISTER_BENCH(ArtboardUpdateOneDirty);
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "assets/paper.riv.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/async/work_pool.hpp"
+#include "rive/batch_advancer.hpp"
+#include "rive/file.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace rive;
+
+// Measure one frame's advance of 1k independent instances of paper.riv's
+// default artboard and state machine, on a BatchAdvancer with the given number
+// of threads. The 1 thread variant advances on the calling thread only, the
+// same as advancing the instances serially, so the others report scaling
+// against it.
+//
+// The advancer borrows the global WorkPool's workers, which is sized to match,
+// so the runtime has to be built --with_rive_threading for anything but the 1
+// thread variant; the others exit with an error rather than quietly
+// measuring one thread.
+class BatchAdvance : public Bench
+{
+public:
+    constexpr static int kInstanceCount = 1000;
+    constexpr static int kFrameCount = 4;
+
+    BatchAdvance(uint32_t threadCount) : m_threadCount(threadCount) {}
+
+    void setup() override
+    {
+        // Each bench runs in its own process, so this comes before anything
+        // creates the global WorkPool. The calling thread makes up the
+        // difference (and 0 would mean the pool's default).
+        setGlobalWorkPoolThreadCount(std::max(m_threadCount - 1, 1u));
+
+        m_nullContext = RenderContextNULL::MakeContext();
+        m_file = File::import(assets::paper_riv(), m_nullContext.get());
+        for (int i = 0; i < kInstanceCount; ++i)
+        {
+            m_artboards.push_back(m_file->artboardDefault());
+            m_stateMachines.push_back(
+                m_artboards.back()->defaultStateMachine());
+            if (m_stateMachines.back() == nullptr)
+            {
+                m_stateMachines.back() = m_artboards.back()->stateMachineAt(0);
+            }
+            m_scenes.push_back(m_stateMachines.back().get());
+            // Stagger the instances so they aren't all doing the same work.
+            m_scenes.back()->advanceAndApply((i % 60) / 60.0f);
+        }
+        // This also starts the pool's threads, so we don't measure their
+        // startup.
+        m_advancer = std::make_unique<BatchAdvancer>(m_threadCount);
+        if (m_advancer->threadCount() != m_threadCount)
+        {
+            fprintf(stderr,
+                    "error: asked for %u threads but can only advance on %u; "
+                    "build --with_rive_threading\n",
+                    m_threadCount,
+                    m_advancer->threadCount());
+            exit(1);
+        }
+    }
+
+    int run() const override
+    {
+        int keepGoing = 0;
+        for (int frame = 0; frame < kFrameCount; ++frame)
+        {
+            keepGoing += m_advancer->advance(m_scenes, 1 / 60.0f);
+        }
+        return keepGoing;
+    }
+
+private:
+    const uint32_t m_threadCount;
+    std::unique_ptr<gpu::RenderContext> m_nullContext;
+    rcp<File> m_file;
+    std::vector<std::unique_ptr<ArtboardInstance>> m_artboards;
+    std::vector<std::unique_ptr<StateMachineInstance>> m_stateMachines;
+    std::vector<Scene*> m_scenes;
+    std::unique_ptr<BatchAdvancer> m_advancer;
+};
+
+#define REGISTER_BATCH_ADVANCE_BENCH(THREAD_COUNT)                             \
+    class BatchAdvance_##THREAD_COUNT##threads : public BatchAdvance           \
+    {                                                                          \
+    public:                                                                    \
+        BatchAdvance_##THREAD_COUNT##threads() : BatchAdvance(THREAD_COUNT) {} \
+    };                                                                         \
+    REGISTER_BENCH(BatchAdvance_##THREAD_COUNT##threads);
+
+REGISTER_BATCH_ADVANCE_BENCH(1)
+REGISTER_BATCH_ADVANCE_BENCH(2)
+REGISTER_BATCH_ADVANCE_BENCH(4)
+REGISTER_BATCH_ADVANCE_BENCH(8)
+REGISTER_BATCH_ADVANCE_BENCH(16)
@@ -0,0 +1,135 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "bench.hpp"
+
+#include "assets/paper.riv.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/command_queue.hpp"
+#include "rive/command_server.hpp"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace rive;
+
+// Measure how many commands per second make it from a CommandQueue to its
+// CommandServer, for each transport. Each run records the same per-frame
+// traffic the command_queue unit tests exercise -- artboard resizes, pointer
+// moves and view model sets across many artboards -- and then waits for the
+// server to drain it.
+class CommandQueueThroughput : public Bench
+{
+public:
+    constexpr static int kArtboardCount = 32;
+    constexpr static int kFrameCount = 100;
+
+    CommandQueueThroughput(CommandQueue::Transport transport) :
+        m_commandQueue(make_rcp<CommandQueue>(transport))
+    {}
+
+    ~CommandQueueThroughput() override
+    {
+        m_commandQueue->disconnect();
+        if (m_serverThread.joinable())
+        {
+            m_serverThread.join();
+        }
+    }
+
+    void setup() override
+    {
+        m_serverThread = std::thread([commandQueue = m_commandQueue]() {
+            std::unique_ptr<gpu::RenderContext> nullContext =
+                RenderContextNULL::MakeContext();
+            CommandServer server(commandQueue, nullContext.get());
+            server.serveUntilDisconnect();
+        });
+
+        auto riv = assets::paper_riv();
+        FileHandle file = m_commandQueue->loadFile(
+            std::vector<uint8_t>(riv.data(), riv.data() + riv.size()));
+        for (int i = 0; i < kArtboardCount; ++i)
+        {
+            ArtboardHandle artboard =
+                m_commandQueue->instantiateDefaultArtboard(file);
+            m_artboards.push_back(artboard);
+            m_stateMachines.push_back(
+                m_commandQueue->instantiateDefaultStateMachine(artboard));
+            m_viewModels.push_back(
+                m_commandQueue->instantiateBlankViewModelInstance(file,
+                                                                  artboard));
+        }
+        waitForServer();
+    }
+
+    int run() const override
+    {
+        CommandQueue::PointerEvent event;
+        event.fit = Fit::contain;
+        event.screenBounds = {1920, 1080};
+        for (int frame = 0; frame < kFrameCount; ++frame)
+        {
+            m_commandQueue->beginBatch();
+            for (int i = 0; i < kArtboardCount; ++i)
+            {
+                float f = static_cast<float>(frame + i);
+                m_commandQueue->setArtboardSize(m_artboards[i], 400 + f, 300);
+                event.position = {f, f};
+                m_commandQueue->pointerMove(m_stateMachines[i], event);
+                m_commandQueue->setViewModelInstanceNumber(m_viewModels[i],
+                                                           "value",
+                                                           f);
+            }
+            m_commandQueue->endBatch();
+        }
+        waitForServer();
+        // Drain any errors the server sent back so they don't pile up.
+        m_commandQueue->processMessages();
+        return kArtboardCount * kFrameCount * 3;
+    }
+
+private:
+    void waitForServer() const
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool complete = false;
+        std::unique_lock<std::mutex> lock(mutex);
+        m_commandQueue->runOnce([&](CommandServer*) {
+            std::unique_lock<std::mutex> serverLock(mutex);
+            complete = true;
+            cv.notify_one();
+        });
+        while (!complete)
+        {
+            cv.wait(lock);
+        }
+    }
+
+    const rcp<CommandQueue> m_commandQueue;
+    std::thread m_serverThread;
+    std::vector<ArtboardHandle> m_artboards;
+    std::vector<StateMachineHandle> m_stateMachines;
+    std::vector<ViewModelInstanceHandle> m_viewModels;
+};
+
+class CommandQueueThroughput_lockedStreams : public CommandQueueThroughput
+{
+public:
+    CommandQueueThroughput_lockedStreams() :
+        CommandQueueThroughput(CommandQueue::Transport::lockedStreams)
+    {}
+};
+REGISTER_BENCH(CommandQueueThroughput_lockedStreams);
+
+class CommandQueueThroughput_spscRing : public CommandQueueThroughput
+{
+public:
+    CommandQueueThroughput_spscRing() :
+        CommandQueueThroughput(CommandQueue::Transport::spscRing)
+    {}
+};
+REGISTER_BENCH(CommandQueueThroughput_spscRing);
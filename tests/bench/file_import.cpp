@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "assets/joel_signed.riv.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/file.hpp"
+#include <cstdio>
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+#include <sys/resource.h>
+#endif
+
+using namespace rive;
+
+// Measure startup: importing joel_signed.riv, a file with 28 artboards, and
+// instancing its default one, which nests none of the others. The eager
+// variant reads every artboard up front; the lazy one only reads the artboard
+// that gets instanced (and any artboards it references), leaving the rest
+// unread.
+class FileImport : public Bench
+{
+public:
+    FileImport(bool lazy) : m_lazy(lazy) {}
+
+    ~FileImport()
+    {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+        // Peak RSS is process-wide, so run one variant at a time to compare.
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            printf("%s import, %zu of %zu artboards read, peak RSS: %li KB\n",
+                   m_lazy ? "lazy" : "eager",
+                   m_artboardsRead,
+                   m_artboardCount,
+                   static_cast<long>(usage.ru_maxrss));
+        }
+#endif
+    }
+
+    void setup() override
+    {
+        m_nullContext = RenderContextNULL::MakeContext();
+    }
+
+    int run() const override
+    {
+        Span<const uint8_t> data = assets::joel_signed_riv();
+        rcp<File> file = m_lazy ? File::importLazy(data, m_nullContext.get())
+                                : File::import(data, m_nullContext.get());
+        if (file == nullptr)
+        {
+            return 0;
+        }
+        std::unique_ptr<ArtboardInstance> artboard = file->artboardDefault();
+        if (artboard == nullptr)
+        {
+            return 0;
+        }
+        m_artboardCount = file->artboardCount();
+        m_artboardsRead = 0;
+        for (size_t i = 0; i < m_artboardCount; ++i)
+        {
+            m_artboardsRead += file->artboardLoaded(i);
+        }
+        return static_cast<int>(m_artboardsRead);
+    }
+
+private:
+    const bool m_lazy;
+    std::unique_ptr<gpu::RenderContext> m_nullContext;
+    mutable size_t m_artboardCount = 0;
+    mutable size_t m_artboardsRead = 0;
+};
+
+class FileImport_eager : public FileImport
+{
+public:
+    FileImport_eager() : FileImport(false) {}
+};
+REGISTER_BENCH(FileImport_eager);
+
+class FileImport_lazy : public FileImport
+{
+public:
+    FileImport_lazy() : FileImport(true) {}
+};
+REGISTER_BENCH(FileImport_lazy);
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "common/rand.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/renderer/rive_renderer.hpp"
+#include "rive/renderer/render_context.hpp"
+#include "rive_render_paint.hpp"
+#include "rive_render_path.hpp"
+
+using namespace rive;
+using namespace rive::gpu;
+
+// Measure recording and flushing a static scene of stroked and filled paths
+// that only pans from frame to frame, with and without the TessellationCache.
+// On a hit, each draw skips chopping and counting its path's tessellation.
+class FlushCachedPaths : public Bench
+{
+public:
+    constexpr static uint32_t kTargetSize = 2048;
+    constexpr static int kPathCount = 4000;
+    constexpr static int kCurvesPerPath = 8;
+
+    FlushCachedPaths(size_t cacheBudgetInBytes) :
+        m_cacheBudgetInBytes(cacheBudgetInBytes)
+    {}
+
+    void setup() override
+    {
+        m_nullContext->tessellationCache().setBudgetInBytes(
+            m_cacheBudgetInBytes);
+        Rand rand;
+        rand.seed(0);
+        for (int i = 0; i < kPathCount; ++i)
+        {
+            auto path = static_rcp_cast<RiveRenderPath>(
+                m_nullContext->makeEmptyRenderPath());
+            Vec2D p(rand.f32(0, kTargetSize), rand.f32(0, kTargetSize));
+            path->moveTo(p.x, p.y);
+            for (int j = 0; j < kCurvesPerPath; ++j)
+            {
+                path->cubicTo(p.x + rand.f32(-60, 60),
+                              p.y + rand.f32(-60, 60),
+                              p.x + rand.f32(-60, 60),
+                              p.y + rand.f32(-60, 60),
+                              p.x + rand.f32(-60, 60),
+                              p.y + rand.f32(-60, 60));
+            }
+            m_paths.push_back(std::move(path));
+
+            auto paint = static_rcp_cast<RiveRenderPaint>(
+                m_nullContext->makeRenderPaint());
+            paint->color(0xff000000 | rand.u32());
+            if (i % 4 != 0)
+            {
+                paint->style(RenderPaintStyle::stroke);
+                paint->thickness(rand.f32(2, 12));
+                paint->join(static_cast<StrokeJoin>(i % 3));
+                paint->cap(static_cast<StrokeCap>(i % 3));
+            }
+            m_paints.push_back(std::move(paint));
+        }
+    }
+
+    int run() const override
+    {
+        m_nullContext->beginFrame({
+            .renderTargetWidth = kTargetSize,
+            .renderTargetHeight = kTargetSize,
+            .disableRasterOrdering = true,
+        });
+        m_renderer.save();
+        m_renderer.translate(static_cast<float>(m_frameCount++ % 16), 0);
+        for (int i = 0; i < kPathCount; ++i)
+        {
+            m_renderer.drawPath(m_paths[i].get(), m_paints[i].get());
+        }
+        m_renderer.restore();
+        m_nullContext->flush({.renderTarget = m_renderTarget.get()});
+        return 0;
+    }
+
+private:
+    const size_t m_cacheBudgetInBytes;
+    std::unique_ptr<RenderContext> m_nullContext =
+        RenderContextNULL::MakeContext();
+    mutable RiveRenderer m_renderer{m_nullContext.get()};
+    rcp<RenderTarget> m_renderTarget =
+        m_nullContext->static_impl_cast<RenderContextNULL>()->makeRenderTarget(
+            kTargetSize,
+            kTargetSize);
+    std::vector<rcp<RiveRenderPath>> m_paths;
+    std::vector<rcp<RiveRenderPaint>> m_paints;
+    mutable uint32_t m_frameCount = 0;
+};
+
+class FlushCachedPaths_NoCache : public FlushCachedPaths
+{
+public:
+    FlushCachedPaths_NoCache() : FlushCachedPaths(0) {}
+};
+REGISTER_BENCH(FlushCachedPaths_NoCache);
+
+class FlushCachedPaths_Cache : public FlushCachedPaths
+{
+public:
+    FlushCachedPaths_Cache() :
+        FlushCachedPaths(TessellationCache::kDefaultBudgetInBytes)
+    {}
+};
+REGISTER_BENCH(FlushCachedPaths_Cache);
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "common/rand.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/renderer/rive_renderer.hpp"
+#include "rive/renderer/render_context.hpp"
+#include "rive_render_paint.hpp"
+#include "rive_render_path.hpp"
+
+using namespace rive;
+using namespace rive::gpu;
+
+// Measure flushing a frame of many small, mostly disjoint draws with a null
+// render context in atomic mode, where the draws get reordered by sort key.
+// The draws mix fills and strokes, a few blend modes and gradients, so the
+// keys differ in more than just their draw group.
+class FlushSortedDraws : public Bench
+{
+public:
+    constexpr static uint32_t kTargetSize = 2048;
+    constexpr static int kPathCount = 64;
+
+    FlushSortedDraws(int drawCount) : m_drawCount(drawCount) {}
+
+    void setup() override
+    {
+        Rand rand;
+        rand.seed(0);
+        for (int i = 0; i < kPathCount; ++i)
+        {
+            auto path = static_rcp_cast<RiveRenderPath>(
+                m_nullContext->makeEmptyRenderPath());
+            float size = rand.f32(4, 12);
+            path->moveTo(0, 0);
+            path->cubicTo(size, -size / 2, size * 1.5f, size / 2, size, size);
+            path->lineTo(0, size);
+            path->close();
+            m_paths.push_back(std::move(path));
+
+            auto paint = static_rcp_cast<RiveRenderPaint>(
+                m_nullContext->makeRenderPaint());
+            paint->color(0xff000000 | rand.u32());
+            switch (i % 4)
+            {
+                case 1:
+                    paint->style(RenderPaintStyle::stroke);
+                    paint->thickness(rand.f32(1, 3));
+                    break;
+                case 2:
+                    paint->blendMode(i % 8 == 2 ? BlendMode::multiply
+                                                : BlendMode::screen);
+                    break;
+                case 3:
+                {
+                    const ColorInt colors[] = {0xffff0000, 0xff0000ff};
+                    const float stops[] = {0, 1};
+                    paint->shader(m_nullContext->makeLinearGradient(0,
+                                                                    0,
+                                                                    size,
+                                                                    size,
+                                                                    colors,
+                                                                    stops,
+                                                                    2));
+                    break;
+                }
+            }
+            m_paints.push_back(std::move(paint));
+        }
+        for (int i = 0; i < m_drawCount; ++i)
+        {
+            m_draws.push_back({rand.u32(0, kPathCount - 1),
+                               Vec2D(rand.f32(0, kTargetSize - 16),
+                                     rand.f32(0, kTargetSize - 16))});
+        }
+    }
+
+    int run() const override
+    {
+        m_nullContext->beginFrame({
+            .renderTargetWidth = kTargetSize,
+            .renderTargetHeight = kTargetSize,
+            .disableRasterOrdering = true,
+        });
+        for (const auto& [pathIdx, translate] : m_draws)
+        {
+            m_renderer.save();
+            m_renderer.translate(translate.x, translate.y);
+            m_renderer.drawPath(m_paths[pathIdx].get(),
+                                m_paints[pathIdx].get());
+            m_renderer.restore();
+        }
+        m_nullContext->flush({.renderTarget = m_renderTarget.get()});
+        return 0;
+    }
+
+private:
+    const int m_drawCount;
+    std::unique_ptr<RenderContext> m_nullContext =
+        RenderContextNULL::MakeContext();
+    mutable RiveRenderer m_renderer{m_nullContext.get()};
+    rcp<RenderTarget> m_renderTarget =
+        m_nullContext->static_impl_cast<RenderContextNULL>()->makeRenderTarget(
+            kTargetSize,
+            kTargetSize);
+    std::vector<rcp<RiveRenderPath>> m_paths;
+    std::vector<rcp<RiveRenderPaint>> m_paints;
+    std::vector<std::pair<uint32_t, Vec2D>> m_draws;
+};
+
+class FlushSortedDraws_10k : public FlushSortedDraws
+{
+public:
+    FlushSortedDraws_10k() : FlushSortedDraws(10000) {}
+};
+REGISTER_BENCH(FlushSortedDraws_10k);
+
+class FlushSortedDraws_50k : public FlushSortedDraws
+{
+public:
+    FlushSortedDraws_50k() : FlushSortedDraws(50000) {}
+};
+REGISTER_BENCH(FlushSortedDraws_50k);
+
+class FlushSortedDraws_100k : public FlushSortedDraws
+{
+public:
+    FlushSortedDraws_100k() : FlushSortedDraws(100000) {}
+};
+REGISTER_BENCH(FlushSortedDraws_100k);
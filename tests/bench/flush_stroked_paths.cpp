@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "common/rand.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/async/work_pool.hpp"
+#include "rive/renderer/rive_renderer.hpp"
+#include "rive/renderer/render_context.hpp"
+#include "rive_render_paint.hpp"
+#include "rive_render_path.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace rive;
+using namespace rive::gpu;
+
+// Measure flushing a frame of thousands of stroked paths with a null render
+// context, where writing out tessellation data dominates. Compares writing it
+// inline on the flushing thread against splitting it across threads.
+class FlushStrokedPaths : public Bench
+{
+public:
+    constexpr static uint32_t kTargetSize = 2048;
+    constexpr static int kPathCount = 4000;
+    constexpr static int kCurvesPerPath = 8;
+
+    FlushStrokedPaths(uint32_t threadCount) : m_threadCount(threadCount) {}
+
+    void setup() override
+    {
+        setGlobalWorkPoolThreadCount(std::max(m_threadCount - 1, 1u));
+        m_nullContext->setTessellationThreadCount(m_threadCount);
+        if (m_nullContext->tessellationThreadCount() != m_threadCount)
+        {
+            fprintf(stderr,
+                    "error: asked for %u threads but can only tessellate on "
+                    "%u; build --with_rive_threading\n",
+                    m_threadCount,
+                    m_nullContext->tessellationThreadCount());
+            exit(1);
+        }
+        Rand rand;
+        rand.seed(0);
+        for (int i = 0; i < kPathCount; ++i)
+        {
+            auto path = static_rcp_cast<RiveRenderPath>(
+                m_nullContext->makeEmptyRenderPath());
+            Vec2D p(rand.f32(0, kTargetSize), rand.f32(0, kTargetSize));
+            path->moveTo(p.x, p.y);
+            for (int j = 0; j < kCurvesPerPath; ++j)
+            {
+                path->cubicTo(p.x + rand.f32(-60, 60),
+                              p.y + rand.f32(-60, 60),
+                              p.x + rand.f32(-60, 60),
+                              p.y + rand.f32(-60, 60),
+                              p.x + rand.f32(-60, 60),
+                              p.y + rand.f32(-60, 60));
+            }
+            m_paths.push_back(std::move(path));
+
+            auto paint = static_rcp_cast<RiveRenderPaint>(
+                m_nullContext->makeRenderPaint());
+            paint->style(RenderPaintStyle::stroke);
+            paint->color(0xff000000 | rand.u32());
+            paint->thickness(rand.f32(2, 12));
+            paint->join(static_cast<StrokeJoin>(i % 3));
+            paint->cap(static_cast<StrokeCap>(i % 3));
+            m_paints.push_back(std::move(paint));
+        }
+    }
+
+    int run() const override
+    {
+        m_nullContext->beginFrame({
+            .renderTargetWidth = kTargetSize,
+            .renderTargetHeight = kTargetSize,
+            .disableRasterOrdering = true,
+        });
+        for (int i = 0; i < kPathCount; ++i)
+        {
+            m_renderer.drawPath(m_paths[i].get(), m_paints[i].get());
+        }
+        m_nullContext->flush({.renderTarget = m_renderTarget.get()});
+        return 0;
+    }
+
+private:
+    const uint32_t m_threadCount;
+    std::unique_ptr<RenderContext> m_nullContext =
+        RenderContextNULL::MakeContext();
+    mutable RiveRenderer m_renderer{m_nullContext.get()};
+    rcp<RenderTarget> m_renderTarget =
+        m_nullContext->static_impl_cast<RenderContextNULL>()->makeRenderTarget(
+            kTargetSize,
+            kTargetSize);
+    std::vector<rcp<RiveRenderPath>> m_paths;
+    std::vector<rcp<RiveRenderPaint>> m_paints;
+};
+
+class FlushStrokedPaths_1Thread : public FlushStrokedPaths
+{
+public:
+    FlushStrokedPaths_1Thread() : FlushStrokedPaths(1) {}
+};
+REGISTER_BENCH(FlushStrokedPaths_1Thread);
+
+class FlushStrokedPaths_4Threads : public FlushStrokedPaths
+{
+public:
+    FlushStrokedPaths_4Threads() : FlushStrokedPaths(4) {}
+};
+REGISTER_BENCH(FlushStrokedPaths_4Threads);
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "rive/animation/arithmetic_operation.hpp"
+#include "rive/data_bind/converters/data_converter_formula.hpp"
+#include "rive/data_bind/converters/formula/formula_token_argument_separator.hpp"
+#include "rive/data_bind/converters/formula/formula_token_function.hpp"
+#include "rive/data_bind/converters/formula/formula_token_input.hpp"
+#include "rive/data_bind/converters/formula/formula_token_operation.hpp"
+#include "rive/data_bind/converters/formula/formula_token_parenthesis_close.hpp"
+#include "rive/data_bind/converters/formula/formula_token_parenthesis_open.hpp"
+#include "rive/data_bind/converters/formula/formula_token_value.hpp"
+#include "rive/function_type.hpp"
+#include <cstdio>
+
+using namespace rive;
+
+// Measure DataConverterFormula conversions on formulas like the ones data
+// bound dashboards use: arithmetic on the input with constant parts, and
+// functions of the input.
+class FormulaConvert : public Bench
+{
+public:
+    constexpr static int kConversionCount = 100000;
+
+    ~FormulaConvert() override
+    {
+        printf("%i conversions per run\n", kConversionCount);
+    }
+
+protected:
+    void value(float v)
+    {
+        auto token = new FormulaTokenValue();
+        token->operationValue(v);
+        m_formula->addToken(token);
+    }
+    void input() { m_formula->addToken(new FormulaTokenInput()); }
+    void op(ArithmeticOperation operation)
+    {
+        auto token = new FormulaTokenOperation();
+        token->operationType((uint32_t)operation);
+        m_formula->addToken(token);
+    }
+    void function(FunctionType function)
+    {
+        auto token = new FormulaTokenFunction();
+        token->functionType((uint32_t)function);
+        m_formula->addToken(token);
+    }
+    void open() { m_formula->addToken(new FormulaTokenParenthesisOpen()); }
+    void close() { m_formula->addToken(new FormulaTokenParenthesisClose()); }
+    void separator()
+    {
+        m_formula->addToken(new FormulaTokenArgumentSeparator());
+    }
+
+    int run() const override
+    {
+        DataConverter* converter = m_formula.get();
+        DataValueNumber value;
+        float sum = 0;
+        for (int i = 0; i < kConversionCount; ++i)
+        {
+            value.value(static_cast<float>(i % 1000));
+            sum += converter->convert(&value, nullptr)
+                       ->as<DataValueNumber>()
+                       ->value();
+        }
+        return static_cast<int>(sum);
+    }
+
+    std::unique_ptr<DataConverterFormula> m_formula =
+        std::make_unique<DataConverterFormula>();
+};
+
+// (input - 32) * 5 / 9
+class FormulaConvert_arithmetic : public FormulaConvert
+{
+    void setup() override
+    {
+        open();
+        input();
+        op(ArithmeticOperation::subtract);
+        value(32);
+        close();
+        op(ArithmeticOperation::multiply);
+        value(5);
+        op(ArithmeticOperation::divide);
+        value(9);
+        m_formula->calculateFormula();
+    }
+};
+REGISTER_BENCH(FormulaConvert_arithmetic);
+
+// input * (100 / 60) + (2 * 3 - 1)
+class FormulaConvert_constants : public FormulaConvert
+{
+    void setup() override
+    {
+        input();
+        op(ArithmeticOperation::multiply);
+        open();
+        value(100);
+        op(ArithmeticOperation::divide);
+        value(60);
+        close();
+        op(ArithmeticOperation::add);
+        open();
+        value(2);
+        op(ArithmeticOperation::multiply);
+        value(3);
+        op(ArithmeticOperation::subtract);
+        value(1);
+        close();
+        m_formula->calculateFormula();
+    }
+};
+REGISTER_BENCH(FormulaConvert_constants);
+
+// max(min(input, 500), 10) + round(sin(input) * 100)
+class FormulaConvert_functions : public FormulaConvert
+{
+    void setup() override
+    {
+        function(FunctionType::max);
+        function(FunctionType::min);
+        input();
+        separator();
+        value(500);
+        close();
+        separator();
+        value(10);
+        close();
+        op(ArithmeticOperation::add);
+        function(FunctionType::round);
+        function(FunctionType::sine);
+        input();
+        close();
+        op(ArithmeticOperation::multiply);
+        value(100);
+        close();
+        m_formula->calculateFormula();
+    }
+};
+REGISTER_BENCH(FormulaConvert_functions);
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "common/render_context_null.hpp"
+#include "rive/artboard.hpp"
+#include "rive/shapes/ellipse.hpp"
+#include "rive/shapes/shape.hpp"
+#include "rive/shapes/star.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+using namespace rive;
+
+// Measure Shape::hitTestHiFi on a shape made of large curved paths, queried
+// along a deterministic sweep over its bounds. The static variant leaves the
+// shape alone, so every query after the first couple hits the cached
+// polylines. The animated variant moves the shape every 16 queries, as if it
+// played an animation under the pointer, so the paths are flattened again
+// after each frame.
+class HitTestHiFi : public Bench
+{
+public:
+    constexpr static int kQueryCount = 4000;
+    constexpr static int kQueriesPerFrame = 16;
+    constexpr static float kSize = 1000;
+
+    HitTestHiFi(bool animated) : m_animated(animated) {}
+
+    ~HitTestHiFi() override
+    {
+        if (m_bestRunTime.count() > 0)
+        {
+            printf("%s: %.0f queries/s\n",
+                   m_animated ? "animated" : "static",
+                   kQueryCount / m_bestRunTime.count());
+        }
+    }
+
+    void setup() override
+    {
+        m_nullContext = RenderContextNULL::MakeContext();
+        m_artboard = std::make_unique<Artboard>(m_nullContext.get());
+        m_artboard->width(kSize);
+        m_artboard->height(kSize);
+        m_artboard->addObject(m_artboard.get());
+
+        m_shape = new Shape();
+        m_shape->x(kSize / 2);
+        m_shape->y(kSize / 2);
+        m_artboard->addObject(m_shape);
+        // Concentric rings of ellipses and stars, so every query sits near a
+        // few hundred curve segments.
+        for (int i = 0; i < 6; ++i)
+        {
+            float size = kSize * (1.0f - i * 0.15f);
+            Path* path;
+            if (i % 2 == 0)
+            {
+                auto ellipse = new Ellipse();
+                ellipse->width(size);
+                ellipse->height(size * 0.8f);
+                path = ellipse;
+            }
+            else
+            {
+                auto star = new Star();
+                star->width(size);
+                star->height(size);
+                star->points(24);
+                star->innerRadius(0.8f);
+                star->cornerRadius(size * 0.02f);
+                path = star;
+            }
+            path->parentId(1);
+            m_artboard->addObject(path);
+        }
+        m_artboard->initialize();
+        m_artboard->advance(0);
+
+        for (int i = 0; i < kQueryCount; ++i)
+        {
+            float t = i / static_cast<float>(kQueryCount);
+            m_queries.push_back(
+                Vec2D((0.5f + 0.45f * std::sin(t * 6.2831853f * 3)) * kSize,
+                      (0.5f + 0.45f * std::sin(t * 6.2831853f * 2 + 1)) *
+                          kSize));
+        }
+    }
+
+    int run() const override
+    {
+        auto start = std::chrono::steady_clock::now();
+        int hits = 0;
+        for (int i = 0; i < kQueryCount; ++i)
+        {
+            if (m_animated && i % kQueriesPerFrame == 0)
+            {
+                m_shape->x(kSize / 2 + (i / kQueriesPerFrame % 2));
+                m_artboard->advance(1 / 60.0f);
+            }
+            hits += m_shape->hitTestHiFi(m_queries[i], 2);
+        }
+        std::chrono::duration<double> runTime =
+            std::chrono::steady_clock::now() - start;
+        if (m_bestRunTime.count() == 0 || runTime < m_bestRunTime)
+        {
+            m_bestRunTime = runTime;
+        }
+        return hits;
+    }
+
+private:
+    const bool m_animated;
+    std::unique_ptr<gpu::RenderContext> m_nullContext;
+    std::unique_ptr<Artboard> m_artboard;
+    Shape* m_shape = nullptr;
+    std::vector<Vec2D> m_queries;
+    mutable std::chrono::duration<double> m_bestRunTime{0};
+};
+
+class HitTestHiFi_static : public HitTestHiFi
+{
+public:
+    HitTestHiFi_static() : HitTestHiFi(false) {}
+};
+REGISTER_BENCH(HitTestHiFi_static);
+
+class HitTestHiFi_animated : public HitTestHiFi
+{
+public:
+    HitTestHiFi_animated() : HitTestHiFi(true) {}
+};
+REGISTER_BENCH(HitTestHiFi_animated);
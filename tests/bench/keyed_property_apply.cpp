@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "rive/animation/keyed_property.hpp"
+#include "rive/animation/keyframe_double.hpp"
+#include "rive/node.hpp"
+#include <cstdio>
+
+using namespace rive;
+
+// Measure playing back a 10 second animation at 60fps that keys 1024
+// properties with a keyframe every 4 frames. KeyedPropertyApply_search finds
+// each property's keyframes with a binary search every frame, the way
+// KeyedProperty::apply did for direct callers; KeyedPropertyApply_cursor
+// keeps a keyframe cursor per property, the way LinearAnimationInstance does.
+class KeyedPropertyApply : public Bench
+{
+public:
+    constexpr static int kPropertyCount = 1024;
+    constexpr static int kFps = 60;
+    constexpr static int kDurationFrames = 600;
+    constexpr static int kFramesPerKeyFrame = 4;
+
+    KeyedPropertyApply()
+    {
+        for (int i = 0; i < kPropertyCount; ++i)
+        {
+            auto property = std::make_unique<KeyedProperty>();
+            property->propertyKey(i % 2 == 0 ? NodeBase::xPropertyKey
+                                             : NodeBase::yPropertyKey);
+            for (int frame = 0; frame <= kDurationFrames;
+                 frame += kFramesPerKeyFrame)
+            {
+                auto keyframe = std::make_unique<KeyFrameDouble>();
+                keyframe->frame(frame);
+                keyframe->value(static_cast<float>((frame * 7 + i) % 100));
+                keyframe->interpolationType(1);
+                keyframe->computeSeconds(kFps);
+                property->addKeyFrame(std::move(keyframe));
+            }
+            m_properties.push_back(std::move(property));
+        }
+        m_nodes.resize(kPropertyCount / 2);
+        m_cursors.resize(kPropertyCount);
+    }
+
+    ~KeyedPropertyApply() override
+    {
+        printf("%i property applies per run\n",
+               kPropertyCount * kDurationFrames);
+    }
+
+protected:
+    int play(bool useCursors) const
+    {
+        for (int frame = 0; frame < kDurationFrames; ++frame)
+        {
+            float seconds = frame / static_cast<float>(kFps);
+            for (int i = 0; i < kPropertyCount; ++i)
+            {
+                m_properties[i]->apply(&m_nodes[i / 2],
+                                       seconds,
+                                       1.0f,
+                                       nullptr,
+                                       useCursors ? &m_cursors[i] : nullptr);
+            }
+        }
+        return static_cast<int>(m_nodes.back().x() + m_nodes.back().y());
+    }
+
+    std::vector<std::unique_ptr<KeyedProperty>> m_properties;
+    mutable std::vector<Node> m_nodes;
+    mutable std::vector<int> m_cursors;
+};
+
+class KeyedPropertyApply_search : public KeyedPropertyApply
+{
+    int run() const override { return play(false); }
+};
+REGISTER_BENCH(KeyedPropertyApply_search);
+
+class KeyedPropertyApply_cursor : public KeyedPropertyApply
+{
+    int run() const override { return play(true); }
+};
+REGISTER_BENCH(KeyedPropertyApply_cursor);
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "common/render_context_null.hpp"
+#include "rive/animation/listener_types/listener_input_type.hpp"
+#include "rive/animation/state_machine.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/animation/state_machine_listener.hpp"
+#include "rive/artboard.hpp"
+#include "rive/importers/import_stack.hpp"
+#include "rive/importers/state_machine_importer.hpp"
+#include "rive/importers/state_machine_listener_importer.hpp"
+#include "rive/shapes/rectangle.hpp"
+#include "rive/shapes/shape.hpp"
+#include <cmath>
+
+using namespace rive;
+
+// Measure replaying a pointer-move trace against a state machine listening to
+// pointer enter on each of a 40x25 grid of 1k rectangles. The trace is a
+// deterministic sweep back and forth over the artboard, standing in for a
+// recorded drag. The animated variant also moves one rectangle and advances
+// the artboard every 16 events, so the hit test bounds need refitting as they
+// would when a scene plays while the pointer moves.
+class PointerHitTest : public Bench
+{
+public:
+    constexpr static int kColumns = 40;
+    constexpr static int kRows = 25;
+    constexpr static float kCellSize = 48;
+    constexpr static int kTraceLength = 1000;
+    constexpr static int kEventsPerFrame = 16;
+
+    PointerHitTest(bool animated) : m_animated(animated) {}
+
+    void setup() override
+    {
+        m_nullContext = RenderContextNULL::MakeContext();
+        m_artboard = std::make_unique<Artboard>(m_nullContext.get());
+        m_artboard->width(kColumns * kCellSize);
+        m_artboard->height(kRows * kCellSize);
+        m_artboard->addObject(m_artboard.get());
+
+        auto machine = new StateMachine();
+        ImportStack importStack;
+        importStack.makeLatest(
+            StateMachineBase::typeKey,
+            std::make_unique<StateMachineImporter>(machine));
+        for (int i = 0; i < kColumns * kRows; ++i)
+        {
+            auto shape = new Shape();
+            shape->x((i % kColumns + 0.5f) * kCellSize);
+            shape->y((i / kColumns + 0.5f) * kCellSize);
+            auto rectangle = new Rectangle();
+            rectangle->width(kCellSize * 0.75f);
+            rectangle->height(kCellSize * 0.75f);
+            auto shapeId =
+                static_cast<uint32_t>(m_artboard->objects().size());
+            m_artboard->addObject(shape);
+            m_artboard->addObject(rectangle);
+            rectangle->parentId(shapeId);
+
+            // Pointer enter listeners can't early out of hit testing, so every
+            // move tests each of them.
+            auto listener = new StateMachineListener();
+            listener->targetId(shapeId);
+            listener->import(importStack);
+            importStack.makeLatest(
+                StateMachineListenerBase::typeKey,
+                std::make_unique<StateMachineListenerImporter>(listener));
+            auto inputType = new ListenerInputType();
+            inputType->listenerTypeValue(
+                static_cast<uint32_t>(ListenerType::enter));
+            inputType->import(importStack);
+        }
+        m_artboard->addStateMachine(machine);
+        m_artboard->initialize();
+
+        m_instance = m_artboard->instance();
+        m_stateMachine = m_instance->stateMachineAt(0);
+        m_stateMachine->advanceAndApply(0);
+        for (auto shape : m_instance->objects<Shape>())
+        {
+            m_animatedShape = shape;
+            break;
+        }
+
+        for (int i = 0; i < kTraceLength; ++i)
+        {
+            float t = i / static_cast<float>(kTraceLength);
+            m_trace.push_back(
+                Vec2D((0.5f + 0.45f * std::sin(t * 6.2831853f * 3)) *
+                          m_artboard->width(),
+                      (0.5f + 0.45f * std::sin(t * 6.2831853f * 2 + 1)) *
+                          m_artboard->height()));
+        }
+    }
+
+    int run() const override
+    {
+        int hits = 0;
+        for (int i = 0; i < kTraceLength; ++i)
+        {
+            if (m_animated && i % kEventsPerFrame == 0)
+            {
+                m_animatedShape->x(m_trace[i].x);
+                m_animatedShape->y(m_trace[i].y);
+                m_stateMachine->advanceAndApply(1 / 60.0f);
+            }
+            hits += m_stateMachine->pointerMove(m_trace[i]) != HitResult::none;
+        }
+        return hits;
+    }
+
+private:
+    const bool m_animated;
+    std::unique_ptr<gpu::RenderContext> m_nullContext;
+    std::unique_ptr<Artboard> m_artboard;
+    std::unique_ptr<ArtboardInstance> m_instance;
+    std::unique_ptr<StateMachineInstance> m_stateMachine;
+    Shape* m_animatedShape = nullptr;
+    std::vector<Vec2D> m_trace;
+};
+
+class PointerHitTest_static : public PointerHitTest
+{
+public:
+    PointerHitTest_static() : PointerHitTest(false) {}
+};
+REGISTER_BENCH(PointerHitTest_static);
+
+class PointerHitTest_animated : public PointerHitTest
+{
+public:
+    PointerHitTest_animated() : PointerHitTest(true) {}
+};
+REGISTER_BENCH(PointerHitTest_animated);
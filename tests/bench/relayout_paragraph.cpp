@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#ifdef WITH_RIVE_TEXT
+
+#include "assets/roboto_flex.ttf.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/text/font_hb.hpp"
+#include "rive/text/raw_text.hpp"
+#include "utils/no_op_renderer.hpp"
+#include <string>
+
+using namespace rive;
+using namespace rive::gpu;
+
+// Measure laying out a long paragraph 1000 times at alternating widths, the
+// way a resizing layout would, with and without the font's GlyphPathCache.
+// Every layout rebuilds the paragraph's paths from its glyph outlines.
+class RelayoutParagraph : public Bench
+{
+public:
+    constexpr static int kRelayoutCount = 1000;
+
+    RelayoutParagraph(size_t glyphCacheBudgetInBytes) :
+        m_glyphCacheBudgetInBytes(glyphCacheBudgetInBytes)
+    {}
+
+    void setup() override
+    {
+        m_font = HBFont::Decode(assets::roboto_flex_ttf());
+        m_font->glyphPathCache().setBudgetInBytes(m_glyphCacheBudgetInBytes);
+        std::string paragraph;
+        for (int i = 0; i < 20; ++i)
+        {
+            paragraph += "The quick brown fox jumps over the lazy dog while "
+                         "five boxing wizards jump quickly. ";
+        }
+        m_text.sizing(TextSizing::autoHeight);
+        m_text.append(paragraph, m_nullContext->makeRenderPaint(), m_font);
+    }
+
+    int run() const override
+    {
+        for (int i = 0; i < kRelayoutCount; ++i)
+        {
+            m_text.maxWidth(i & 1 ? 300.0f : 320.0f);
+            m_text.render(&m_renderer);
+        }
+        return static_cast<int>(m_font->glyphPathCache().stats().hits);
+    }
+
+private:
+    const size_t m_glyphCacheBudgetInBytes;
+    std::unique_ptr<RenderContext> m_nullContext =
+        RenderContextNULL::MakeContext();
+    rcp<Font> m_font;
+    mutable RawText m_text{m_nullContext.get()};
+    mutable NoOpRenderer m_renderer;
+};
+
+class RelayoutParagraph_NoCache : public RelayoutParagraph
+{
+public:
+    RelayoutParagraph_NoCache() : RelayoutParagraph(0) {}
+};
+REGISTER_BENCH(RelayoutParagraph_NoCache);
+
+class RelayoutParagraph_Cache : public RelayoutParagraph
+{
+public:
+    RelayoutParagraph_Cache() :
+        RelayoutParagraph(GlyphPathCache::kDefaultBudgetInBytes)
+    {}
+};
+REGISTER_BENCH(RelayoutParagraph_Cache);
+
+#endif
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#ifdef WITH_RIVE_TEXT
+
+#include "assets/roboto_flex.ttf.hpp"
+#include "rive/text/font_hb.hpp"
+#include "rive/text/shaped_paragraph_cache.hpp"
+#include <string>
+#include <vector>
+
+using namespace rive;
+
+// Measure shaping a list of 1k labels the way Text::update() does, where the
+// labels repeat (the items of a data bound list, say), with and without the
+// process-wide ShapedParagraphCache. Each label is shaped twice per run, like
+// the measure and update passes of a Text in a layout.
+class ShapeLabels : public Bench
+{
+public:
+    constexpr static int kLabelCount = 1000;
+    constexpr static int kDistinctLabelCount = 24;
+
+    ShapeLabels(bool cached) : m_cached(cached) {}
+
+    ~ShapeLabels() override { ShapedParagraphCache::clear(); }
+
+    void setup() override
+    {
+        ShapedParagraphCache::clear();
+        m_font = HBFont::Decode(assets::roboto_flex_ttf());
+        const char* words[] = {"Inbox", "Archive", "Settings", "Profile",
+                               "Friends", "Messages", "Photos", "Music"};
+        for (int i = 0; i < kDistinctLabelCount; ++i)
+        {
+            std::string label = std::string(words[i % 8]) + " " +
+                                words[(i * 3 + 1) % 8] + " " +
+                                std::to_string(i);
+            m_labels.emplace_back(label.begin(), label.end());
+        }
+    }
+
+    int run() const override
+    {
+        int glyphCount = 0;
+        for (int i = 0; i < kLabelCount; ++i)
+        {
+            const std::vector<Unichar>& label =
+                m_labels[i % kDistinctLabelCount];
+            TextRun run = {m_font,
+                           16.0f,
+                           -1.0f,
+                           0.0f,
+                           static_cast<uint32_t>(label.size()),
+                           0,
+                           0,
+                           0};
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                SimpleArray<Paragraph> paragraphs =
+                    m_cached ? ShapedParagraphCache::shapeText(label, {&run, 1})
+                             : m_font->shapeText(label, {&run, 1});
+                glyphCount += paragraphs[0].runs[0].glyphs.size();
+            }
+        }
+        return glyphCount;
+    }
+
+private:
+    const bool m_cached;
+    rcp<Font> m_font;
+    std::vector<std::vector<Unichar>> m_labels;
+};
+
+class ShapeLabels_NoCache : public ShapeLabels
+{
+public:
+    ShapeLabels_NoCache() : ShapeLabels(false) {}
+};
+REGISTER_BENCH(ShapeLabels_NoCache);
+
+class ShapeLabels_Cache : public ShapeLabels
+{
+public:
+    ShapeLabels_Cache() : ShapeLabels(true) {}
+};
+REGISTER_BENCH(ShapeLabels_Cache);
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "rive/bones/skin.hpp"
+#include "rive/bones/weight.hpp"
+#include <cstdio>
+
+using namespace rive;
+
+// Measure skinning 16k points with 4 bone influences each against 64 bones.
+// SkinDeformPerVertex is what Vertex::deform did for every vertex (decode the
+// packed weights and blend them, one point at a time); SkinDeformBatched is
+// Skin::deformPoints over the pre-decoded arrays Skin now builds.
+class SkinDeform : public Bench
+{
+public:
+    constexpr static int kPointCount = 16 * 1024;
+    constexpr static int kBoneCount = 64;
+    constexpr static int kIterations = 16;
+
+    SkinDeform()
+    {
+        srand(0);
+        auto random = [] { return rand() / (float)RAND_MAX * 2 - 1; };
+        m_world = Mat2D(1.1f, 0.2f, -0.1f, 0.9f, 12, -7);
+        // Slot 0 is the identity, like Skin's bone buffer.
+        m_boneTransforms = {1, 0, 0, 1, 0, 0};
+        for (int i = 0; i < kBoneCount * 6; ++i)
+        {
+            m_boneTransforms.push_back(random() * 10);
+        }
+        for (int i = 0; i < kPointCount; ++i)
+        {
+            m_rest.push_back(Vec2D(random() * 100, random() * 100));
+            // 4 distinct bones with weights that sum to 255.
+            unsigned int first = rand() % (kBoneCount - 3) + 1;
+            unsigned int w0 = 100 + rand() % 50, w1 = 50, w2 = 30;
+            unsigned int w3 = 255 - w0 - w1 - w2;
+            unsigned int indices =
+                first | (first + 1) << 8 | (first + 2) << 16 | (first + 3) << 24;
+            unsigned int values = w0 | w1 << 8 | w2 << 16 | w3 << 24;
+            m_indices.push_back(indices);
+            m_values.push_back(values);
+            for (int j = 0; j < 4; ++j)
+            {
+                m_weights.push_back(((values >> (j * 8)) & 0xFF) / 255.0f);
+                m_boneOffsets.push_back(((indices >> (j * 8)) & 0xFF) * 6);
+            }
+        }
+        m_deformed.resize(kPointCount);
+        for (Vec2D& point : m_deformed)
+        {
+            m_deformedPointers.push_back(&point);
+        }
+    }
+
+    ~SkinDeform() override
+    {
+        printf("%i points per run\n", kPointCount * kIterations);
+    }
+
+protected:
+    Mat2D m_world;
+    std::vector<float> m_boneTransforms;
+    std::vector<Vec2D> m_rest;
+    std::vector<unsigned int> m_indices;
+    std::vector<unsigned int> m_values;
+    std::vector<float> m_weights;
+    std::vector<uint32_t> m_boneOffsets;
+    mutable std::vector<Vec2D> m_deformed;
+    std::vector<Vec2D*> m_deformedPointers;
+};
+
+class SkinDeformPerVertex : public SkinDeform
+{
+    int run() const override
+    {
+        for (int iteration = 0; iteration < kIterations; ++iteration)
+        {
+            for (size_t i = 0; i < m_rest.size(); ++i)
+            {
+                m_deformed[i] = Weight::deform(m_rest[i],
+                                               m_indices[i],
+                                               m_values[i],
+                                               m_world,
+                                               m_boneTransforms.data());
+            }
+        }
+        return static_cast<int>(m_deformed.back().x);
+    }
+};
+REGISTER_BENCH(SkinDeformPerVertex);
+
+class SkinDeformBatched : public SkinDeform
+{
+    int run() const override
+    {
+        for (int iteration = 0; iteration < kIterations; ++iteration)
+        {
+            Skin::deformPoints(m_world,
+                               m_boneTransforms.data(),
+                               m_rest.data(),
+                               m_weights.data(),
+                               m_boneOffsets.data(),
+                               m_deformedPointers.data(),
+                               m_rest.size());
+        }
+        return static_cast<int>(m_deformed.back().x);
+    }
+};
+REGISTER_BENCH(SkinDeformBatched);
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "assets/paper.riv.hpp"
+#include "sw_factory.hpp"
+#include "sw_renderer.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/async/work_pool.hpp"
+#include "rive/file.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace rive;
+
+// Measure rendering a frame of paper.riv's default artboard at 1080p on the
+// CPU tile rasterizer with the given number of threads (0 is one per core).
+// Rasterizing is deterministic, so every variant draws the same pixels and
+// the fps they report compare directly.
+//
+// The global WorkPool is sized to match, so the runtime has to be built
+// --with_rive_threading for anything but the 1 thread variant; the others
+// exit with an error rather than quietly measuring one thread.
+class SWRender : public Bench
+{
+public:
+    constexpr static uint32_t kWidth = 1920;
+    constexpr static uint32_t kHeight = 1080;
+
+    SWRender(uint32_t threadCount) : m_threadCount(threadCount) {}
+
+    ~SWRender() override
+    {
+        if (m_rasterizer != nullptr && m_bestFrameTime.count() > 0)
+        {
+            printf("%ux%u on %u threads: %.1f fps\n",
+                   kWidth,
+                   kHeight,
+                   m_rasterizer->threadCount(),
+                   1 / m_bestFrameTime.count());
+        }
+    }
+
+    void setup() override
+    {
+        // Each bench runs in its own process, so this comes before anything
+        // creates the global WorkPool. The calling thread makes up the
+        // difference (and 0 would mean the pool's default).
+        uint32_t threadCount = m_threadCount != 0
+                                   ? m_threadCount
+                                   : SWRasterizer::defaultThreadCount();
+        setGlobalWorkPoolThreadCount(std::max(threadCount - 1, 1u));
+
+        m_file = File::import(assets::paper_riv(), &m_factory);
+        m_artboard = m_file->artboardDefault();
+        m_stateMachine = m_artboard->defaultStateMachine();
+        if (m_stateMachine == nullptr)
+        {
+            m_stateMachine = m_artboard->stateMachineAt(0);
+        }
+        m_stateMachine->advanceAndApply(0.5f);
+        m_pixels.resize(kWidth * kHeight);
+        // This also starts the pool's threads, so we don't measure their
+        // startup.
+        m_rasterizer = std::make_unique<SWRasterizer>(threadCount);
+        if (m_rasterizer->threadCount() != threadCount)
+        {
+            fprintf(stderr,
+                    "error: asked for %u threads but can only rasterize on "
+                    "%u; build --with_rive_threading\n",
+                    threadCount,
+                    m_rasterizer->threadCount());
+            exit(1);
+        }
+    }
+
+    int run() const override
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::fill(m_pixels.begin(),
+                  m_pixels.end(),
+                  SWRasterizer::PremultipliedRGBA(0xff303030));
+        m_rasterizer->beginFrame(m_pixels.data(), kWidth, kHeight);
+        {
+            SWRenderer renderer(m_rasterizer.get());
+            renderer.align(Fit::contain,
+                           Alignment::center,
+                           AABB(0, 0, kWidth, kHeight),
+                           m_artboard->bounds());
+            m_stateMachine->draw(&renderer);
+        }
+        m_rasterizer->flush();
+        std::chrono::duration<double> frameTime =
+            std::chrono::steady_clock::now() - start;
+        if (m_bestFrameTime.count() == 0 || frameTime < m_bestFrameTime)
+        {
+            m_bestFrameTime = frameTime;
+        }
+        return static_cast<int>(m_pixels[kWidth * kHeight / 2]);
+    }
+
+private:
+    const uint32_t m_threadCount;
+    SWFactory m_factory;
+    rcp<File> m_file;
+    std::unique_ptr<ArtboardInstance> m_artboard;
+    std::unique_ptr<StateMachineInstance> m_stateMachine;
+    std::unique_ptr<SWRasterizer> m_rasterizer;
+    mutable std::vector<uint32_t> m_pixels;
+    mutable std::chrono::duration<double> m_bestFrameTime{0};
+};
+
+#define REGISTER_SW_RENDER_BENCH(NAME, THREAD_COUNT)                           \
+    class SWRender_##NAME : public SWRender                                    \
+    {                                                                          \
+    public:                                                                    \
+        SWRender_##NAME() : SWRender(THREAD_COUNT) {}                          \
+    };                                                                         \
+    REGISTER_BENCH(SWRender_##NAME);
+
+REGISTER_SW_RENDER_BENCH(1thread, 1)
+REGISTER_SW_RENDER_BENCH(2threads, 2)
+REGISTER_SW_RENDER_BENCH(4threads, 4)
+REGISTER_SW_RENDER_BENCH(8threads, 8)
+REGISTER_SW_RENDER_BENCH(allCores, 0)
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#ifdef WITH_RIVE_TEXT
+
+#include "assets/roboto_flex.ttf.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/text/font_hb.hpp"
+#include "rive/text/raw_text_input.hpp"
+#include <string>
+
+using namespace rive;
+using namespace rive::gpu;
+
+// Measure typing 1000 characters, updating after each one, into the middle of
+// a 50 paragraph RawTextInput. Only the paragraph being typed into should get
+// shaped and line broken again on each keystroke.
+class TypeIntoParagraphs : public Bench
+{
+public:
+    constexpr static int kParagraphCount = 50;
+    constexpr static int kCharacterCount = 1000;
+
+    void setup() override
+    {
+        m_input.font(HBFont::Decode(assets::roboto_flex_ttf()));
+        m_input.sizing(TextSizing::autoHeight);
+        m_input.maxWidth(400.0f);
+        std::string text;
+        for (int i = 0; i < kParagraphCount; ++i)
+        {
+            if (i != 0)
+            {
+                text += "\n";
+            }
+            text += "Paragraph " + std::to_string(i) +
+                    " has a handful of words that wrap across a few lines "
+                    "of the input once it is laid out at this width.";
+        }
+        m_paragraphLength = (uint32_t)(text.size() / kParagraphCount);
+        m_input.text(text);
+        m_input.update(m_nullContext.get());
+    }
+
+    int run() const override
+    {
+        // Type into a different paragraph each run.
+        uint32_t paragraph = m_runCount++ % kParagraphCount;
+        uint32_t start = paragraph * m_paragraphLength + 10;
+        m_input.cursor(Cursor::collapsed(CursorPosition(start)));
+        for (int i = 0; i < kCharacterCount; ++i)
+        {
+            m_input.insert((Unichar)(i % 7 == 6 ? ' ' : 'a' + i % 26));
+            m_input.update(m_nullContext.get());
+        }
+
+        // Then delete what we typed, in one go.
+        m_input.cursor(Cursor(CursorPosition(start),
+                              CursorPosition(start + kCharacterCount)));
+        m_input.erase();
+        m_input.update(m_nullContext.get());
+        return (int)m_input.shape().lineCount();
+    }
+
+private:
+    std::unique_ptr<RenderContext> m_nullContext =
+        RenderContextNULL::MakeContext();
+    mutable RawTextInput m_input;
+    uint32_t m_paragraphLength = 0;
+    mutable uint32_t m_runCount = 0;
+};
+REGISTER_BENCH(TypeIntoParagraphs);
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "rive/data_bind/data_bind.hpp"
+#include "rive/data_bind/data_bind_container.hpp"
+#include "rive/data_bind_flags.hpp"
+#include "rive/viewmodel/viewmodel_instance.hpp"
+#include "rive/viewmodel/viewmodel_instance_number.hpp"
+#include <vector>
+
+using namespace rive;
+
+// 5k number properties, each with a data bind, updated by app code every
+// frame. Each property gets set 3 times per frame (as app code computing a
+// value in steps tends to), then the binds update.
+class ViewModelTransaction5k : public Bench
+{
+public:
+    constexpr static int kPropertyCount = 5000;
+    constexpr static int kFrameCount = 10;
+
+    ViewModelTransaction5k(bool transaction) : m_transaction(transaction) {}
+
+    ~ViewModelTransaction5k()
+    {
+        for (size_t i = 0; i < m_values.size(); i++)
+        {
+            m_values[i]->removeDependent(m_binds[i]);
+        }
+        m_container.deleteBinds();
+    }
+
+    void setup() override
+    {
+        m_instance = make_rcp<ViewModelInstance>();
+        for (int i = 0; i < kPropertyCount; i++)
+        {
+            auto* value = new ViewModelInstanceNumber();
+            m_instance->addValue(value);
+            auto* bind = new CountingDataBind();
+            bind->flags(static_cast<uint32_t>(DataBindFlags::ToTarget));
+            m_container.addDataBind(bind);
+            value->addDependent(bind);
+            m_values.push_back(value);
+            m_binds.push_back(bind);
+        }
+    }
+
+    int run() const override
+    {
+        for (int frame = 0; frame < kFrameCount; frame++)
+        {
+            if (m_transaction)
+            {
+                m_instance->beginTransaction();
+            }
+            for (int step = 0; step < 3; step++)
+            {
+                for (int i = 0; i < kPropertyCount; i++)
+                {
+                    m_values[i]->propertyValue((float)(frame * 3 + step + i));
+                }
+            }
+            if (m_transaction)
+            {
+                m_instance->commitTransaction();
+            }
+            m_container.updateDataBinds();
+        }
+        return CountingDataBind::s_updateCount;
+    }
+
+protected:
+    class CountingDataBind : public DataBind
+    {
+    public:
+        static int s_updateCount;
+        void update(ComponentDirt) override { s_updateCount++; }
+        void updateSourceBinding(bool) override {}
+    };
+
+    class Container : public DataBindContainer
+    {
+    public:
+        void deleteBinds() { deleteDataBinds(); }
+    };
+
+    const bool m_transaction;
+    rcp<ViewModelInstance> m_instance;
+    std::vector<ViewModelInstanceNumber*> m_values;
+    std::vector<CountingDataBind*> m_binds;
+    mutable Container m_container;
+};
+
+int ViewModelTransaction5k::CountingDataBind::s_updateCount = 0;
+
+class ViewModelTransaction5k_Off : public ViewModelTransaction5k
+{
+public:
+    ViewModelTransaction5k_Off() : ViewModelTransaction5k(false) {}
+};
+REGISTER_BENCH(ViewModelTransaction5k_Off);
+
+class ViewModelTransaction5k_On : public ViewModelTransaction5k
+{
+public:
+    ViewModelTransaction5k_On() : ViewModelTransaction5k(true) {}
+};
+REGISTER_BENCH(ViewModelTransaction5k_On);
+
+// Unbind and rebind all 5k binds in the order they were added, like a list
+// of bound items being torn down and rebuilt.
+class DataBindRemoval5k : public ViewModelTransaction5k
+{
+public:
+    DataBindRemoval5k() : ViewModelTransaction5k(false) {}
+
+    int run() const override
+    {
+        for (auto* bind : m_binds)
+        {
+            m_container.removeDataBind(bind);
+        }
+        for (auto* bind : m_binds)
+        {
+            m_container.addDataBind(bind);
+        }
+        return (int)m_container.dataBinds().size();
+    }
+};
+REGISTER_BENCH(DataBindRemoval5k);
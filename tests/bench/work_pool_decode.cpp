@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "bench.hpp"
+
+#include "assets/batdude.png.hpp"
+#include "assets/nomoon.png.hpp"
+#include "assets/paper.riv.hpp"
+#include "common/render_context_null.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "rive/async/work_pool.hpp"
+#include "rive/decoders/bitmap_decoder.hpp"
+#include "rive/file.hpp"
+#include "rive/file_asset_loader.hpp"
+#include <atomic>
+
+using namespace rive;
+
+// Collects the encoded bytes of every in-band image in a .riv.
+class EncodedImageCollector : public FileAssetLoader
+{
+public:
+    bool loadContents(FileAsset& asset,
+                      Span<const uint8_t> inBandBytes,
+                      Factory*) override
+    {
+        if (asset.is<ImageAsset>() && !inBandBytes.empty())
+        {
+            m_images.emplace_back(inBandBytes.begin(), inBandBytes.end());
+        }
+        return false;
+    }
+
+    std::vector<std::vector<uint8_t>> m_images;
+};
+
+class DecodeTask : public WorkTask
+{
+public:
+    DecodeTask(const std::vector<uint8_t>* encoded, std::atomic<int>* pixels) :
+        m_encoded(encoded), m_pixels(pixels)
+    {}
+
+    bool execute() override
+    {
+        auto bitmap = Bitmap::decode(m_encoded->data(), m_encoded->size());
+        if (bitmap == nullptr)
+        {
+            m_errorMessage = "decode failed";
+            return false;
+        }
+        m_pixels->fetch_add(bitmap->width() * bitmap->height(),
+                            std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    const std::vector<uint8_t>* m_encoded;
+    std::atomic<int>* m_pixels;
+};
+
+// Measure the wall-clock time to decode a fixed set of images on a WorkPool
+// with the given number of threads, up to the point every completion has been
+// delivered on the main thread. The images are harvested from paper.riv, plus
+// a couple of standalone PNGs so there is always something to decode.
+//
+// The runtime has to be built --with_rive_threading for the pool to actually
+// spin up threads; otherwise every variant decodes serially from
+// pollCompletedWork().
+class WorkPoolDecode : public Bench
+{
+public:
+    constexpr static int kDecodeCount = 64;
+
+    WorkPoolDecode(uint32_t threadCount) : m_threadCount(threadCount) {}
+
+    void setup() override
+    {
+        auto nullContext = RenderContextNULL::MakeContext();
+        auto collector = make_rcp<EncodedImageCollector>();
+        File::import(assets::paper_riv(),
+                     nullContext.get(),
+                     nullptr,
+                     collector);
+        m_images = std::move(collector->m_images);
+        for (auto png : {assets::batdude_png(), assets::nomoon_png()})
+        {
+            m_images.emplace_back(png.begin(), png.end());
+        }
+        // Construct the pool up front so we don't measure thread startup.
+        m_pool = make_rcp<WorkPool>(m_threadCount);
+    }
+
+    int run() const override
+    {
+        std::atomic<int> pixels{0};
+        for (int i = 0; i < kDecodeCount; ++i)
+        {
+            m_pool->submit(make_rcp<DecodeTask>(&m_images[i % m_images.size()],
+                                                &pixels));
+        }
+        while (m_pool->hasPendingWork())
+        {
+            m_pool->pollCompletedWork(WorkPool::kPollAll);
+        }
+        return pixels;
+    }
+
+private:
+    const uint32_t m_threadCount;
+    std::vector<std::vector<uint8_t>> m_images;
+    rcp<WorkPool> m_pool;
+};
+
+#define REGISTER_WORK_POOL_DECODE_BENCH(THREAD_COUNT)                          \
+    class WorkPoolDecode_##THREAD_COUNT##threads : public WorkPoolDecode       \
+    {                                                                          \
+    public:                                                                    \
+        WorkPoolDecode_##THREAD_COUNT##threads() :                             \
+            WorkPoolDecode(THREAD_COUNT)                                       \
+        {}                                                                     \
+    };                                                                         \
+    REGISTER_BENCH(WorkPoolDecode_##THREAD_COUNT##threads);
+
+REGISTER_WORK_POOL_DECODE_BENCH(1)
+REGISTER_WORK_POOL_DECODE_BENCH(2)
+REGISTER_WORK_POOL_DECODE_BENCH(4)
+REGISTER_WORK_POOL_DECODE_BENCH(8)
+REGISTER_WORK_POOL_DECODE_BENCH(16)
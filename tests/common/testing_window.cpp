@@ -73,6 +73,8 @@ const char* TestingWindow::BackendName(Backend backend)
             return "external";
         case TestingWindow::Backend::coregraphics:
             return "coregraphics";
+        case TestingWindow::Backend::sw:
+            return "sw";
         case TestingWindow::Backend::skia:
             return "skia";
         case TestingWindow::Backend::null:
@@ -282,6 +284,10 @@ TestingWindow::Backend TestingWindow::TryParseBackend(const char* name,
     {
         return Backend::coregraphics;
     }
+    if (nameStr == "sw")
+    {
+        return Backend::sw;
+    }
     if (nameStr == "skia")
     {
         return Backend::skia;
@@ -466,6 +472,9 @@ TestingWindow* TestingWindow::Init(Backend backend,
         case Backend::coregraphics:
             s_TestingWindow = MakeCoreGraphics();
             break;
+        case Backend::sw:
+            s_TestingWindow = MakeSW();
+            break;
         case Backend::skia:
             s_TestingWindow = MakeSkia();
             break;
@@ -80,6 +80,8 @@ public:
         wgpu,
         external,
         coregraphics,
+        // CPU tile rasterizer (sw_renderer).
+        sw,
         skia,
         null,
         invalid,
@@ -311,6 +313,7 @@ public:
     static TestingWindow* MakeMetalTexture(const BackendParams&);
 #endif
     static TestingWindow* MakeCoreGraphics();
+    static TestingWindow* MakeSW();
     static TestingWindow* MakeFiddleContext(Backend,
                                             const BackendParams&,
                                             Visibility,
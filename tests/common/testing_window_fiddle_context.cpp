@@ -296,6 +296,7 @@ public:
         {
             case Backend::wgpu:
             case Backend::coregraphics:
+            case Backend::sw:
             case Backend::skia:
             case Backend::external:
             case Backend::null:
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "testing_window.hpp"
+
+#include "sw_factory.hpp"
+#include "sw_renderer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+class TestingWindowSW : public TestingWindow
+{
+public:
+    rive::Factory* factory() override { return &m_factory; }
+
+    void resize(int w, int h) override
+    {
+        m_pixels.resize(w * h);
+        m_width = w;
+        m_height = h;
+    }
+
+    std::unique_ptr<rive::Renderer> beginFrame(
+        const FrameOptions& options) override
+    {
+        if (options.doClear)
+        {
+            std::fill(m_pixels.begin(),
+                      m_pixels.end(),
+                      rive::SWRasterizer::PremultipliedRGBA(options.clearColor));
+        }
+        m_rasterizer.beginFrame(m_pixels.data(), m_width, m_height);
+        return std::make_unique<rive::SWRenderer>(&m_rasterizer);
+    }
+
+    void endFrame(std::vector<uint8_t>* pixelData) override
+    {
+        m_rasterizer.flush();
+        if (pixelData)
+        {
+            pixelData->resize(m_pixels.size() * sizeof(uint32_t));
+            // copy scanlines backwards to match GL's convention
+            const uint32_t* src = m_pixels.data() + m_pixels.size();
+            uint8_t* dst = pixelData->data();
+            for (uint32_t y = 0; y < m_height; ++y)
+            {
+                src -= m_width;
+                memcpy(dst, src, m_width * sizeof(uint32_t));
+                dst += m_width * sizeof(uint32_t);
+            }
+            assert(src == m_pixels.data());
+            assert(dst == pixelData->data() + pixelData->size());
+        }
+    }
+
+private:
+    rive::SWFactory m_factory;
+    rive::SWRasterizer m_rasterizer;
+    std::vector<uint32_t> m_pixels;
+};
+
+TestingWindow* TestingWindow::MakeSW() { return new TestingWindowSW; }
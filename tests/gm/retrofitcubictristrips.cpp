@@ -149,27 +149,13 @@ public:
                 mirroredTessVertexCount = mirroredTessLocation = 0;
             }
 
-            RenderContext::TessellationWriter tessWriter(
-                flush,
-                m_pathID,
-                m_contourDirections,
-                forwardTessVertexCount,
-                forwardTessLocation,
-                mirroredTessVertexCount,
-                mirroredTessLocation);
-
-            uint32_t contourID = tessWriter.pushContour(
-                {0, 0},
-                /*isStroke=*/false,
-                /*closed=*/true,
-                0 /* gpu::OuterCubicPatchSegmentSpan - 1 */);
-            for (const auto& strips : TriangleStrips)
-            {
-                tessWriter.pushRetrofitCubicTriStrip(strips.data(),
-                                                     strips.size(),
-                                                     m_contourDirections,
-                                                     contourID);
-            }
+            flush->pushTessellationData(this,
+                                        m_pathID,
+                                        m_contourDirections,
+                                        forwardTessVertexCount,
+                                        forwardTessLocation,
+                                        mirroredTessVertexCount,
+                                        mirroredTessLocation);
 
             if (flush->frameDescriptor().clockwiseFillOverride)
             {
@@ -187,6 +173,23 @@ public:
         }
         return nullptr;
     }
+
+    void writeTessellationData(
+        RenderContext::TessellationWriter* tessWriter) override
+    {
+        uint32_t contourID = tessWriter->pushContour(
+            {0, 0},
+            /*isStroke=*/false,
+            /*closed=*/true,
+            0 /* gpu::OuterCubicPatchSegmentSpan - 1 */);
+        for (const auto& strips : TriangleStrips)
+        {
+            tessWriter->pushRetrofitCubicTriStrip(strips.data(),
+                                                  strips.size(),
+                                                  m_contourDirections,
+                                                  contourID);
+        }
+    }
 };
 
 // Checks that RenderContext properly draws triangle strips when using the
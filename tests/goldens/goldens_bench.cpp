@@ -185,6 +185,13 @@ static void analyze_frame_redundancy(const rive::cmd::RenderCommandBuffer& cmd)
                "(1.0 = each built once; >1 = redundant rebuilds)\n",
                double(totalRewind) / rewinds.size(),
                addRaw.empty() ? 0.0 : double(totalAdd) / addRaw.size());
+    const ElisionStats& elided = cmd.elisionStats();
+    printf("  elided at record: %u path rebuilds, %u fill rule sets, "
+           "%u paint sets, %.1f KB\n",
+           elided.pathRebuilds,
+           elided.pathSets,
+           elided.paintSets,
+           elided.bytes / 1024.0);
 }
 
 // Counts drawPath commands that resolve against the resident table versus ones
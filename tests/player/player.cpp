@@ -68,6 +68,7 @@ void Player::shutdown()
         m_file = nullptr;
         m_session = nullptr;
         m_replayer = nullptr;
+        m_framePool = nullptr;
     }
 #endif
 }
@@ -294,6 +295,8 @@ void Player::init(std::string rivName, std::vector<uint8_t> rivBytes)
                 // the device find it, like a real host.
                 m_session->bindRenderContext(rc);
                 m_replayer = std::make_unique<rive::cmd::DeferredReplayer>();
+                m_framePool =
+                    std::make_unique<rive::cmd::DeferredFramePool>();
                 m_factory = m_session.get();
             }
         }
@@ -484,11 +487,12 @@ bool Player::doFrame()
 #ifdef RIVE_CANVAS
     if (m_session != nullptr)
     {
-        // Snapshot replay is the same path a threaded consumer takes.
-        rive::cmd::DeferredFrame frame = rive::cmd::snapshotFrame(*m_session);
-        m_session->resetFrame();
+        // Pooled handoff is the same path a threaded consumer takes. Replay
+        // is synchronous here, so a frame is always free.
+        rive::cmd::DeferredFrame* frame = m_framePool->takeFrame(*m_session);
         TestingWindowFrameSink sink(frameOptions);
-        m_replayer->replayFrame(frame, sink);
+        m_replayer->replayFrame(*frame, sink);
+        m_framePool->recycle(frame);
         uint32_t dropped = m_replayer->droppedDraws();
         if (dropped != 0 && dropped != m_lastDroppedDraws)
         {
@@ -22,6 +22,7 @@ class Scene;
 
 namespace rive::cmd
 {
+class DeferredFramePool;
 class DeferredReplayer;
 class DeferredSession;
 } // namespace rive::cmd
@@ -87,6 +88,7 @@ private:
     // destruction into the session, so it must outlive them.
     std::unique_ptr<rive::cmd::DeferredSession> m_session;
     std::unique_ptr<rive::cmd::DeferredReplayer> m_replayer;
+    std::unique_ptr<rive::cmd::DeferredFramePool> m_framePool;
     uint32_t m_lastDroppedDraws = 0;
 #endif
 
@@ -24,6 +24,8 @@ if not _OPTIONS['for_unreal'] then
     )
     do
         files({ 'bench/*.cpp' })
+        -- work_pool_decode.cpp decodes images on a WorkPool.
+        includedirs({ '../decoders/include' })
     end
 end
 
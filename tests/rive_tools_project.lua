@@ -6,6 +6,7 @@ RIVE_PLS_DIR = path.getabsolute('../renderer')
 
 dofile(RIVE_RUNTIME_DIR .. '/premake5_v2.lua')
 dofile(RIVE_RUNTIME_DIR .. '/cg_renderer/premake5.lua')
+dofile(RIVE_RUNTIME_DIR .. '/sw_renderer/premake5.lua')
 dofile(RIVE_RUNTIME_DIR .. '/dependencies/premake5_libpng_v2.lua')
 dofile(RIVE_RUNTIME_DIR .. '/dependencies/premake5_glfw_v2.lua')
 dofile(RIVE_RUNTIME_DIR .. '/decoders/premake5_v2.lua')
@@ -33,6 +34,7 @@ function rive_tools_project(name, project_kind)
             'tools_common',
             'rive_pls_renderer',
             'rive_cg_renderer',
+            'rive_sw_renderer',
             'rive_decoders',
             'rive',
             'libpng',
@@ -80,6 +82,7 @@ function rive_tools_project(name, project_kind)
         RIVE_PLS_DIR .. '/src',
         RIVE_RUNTIME_DIR .. '/include',
         RIVE_RUNTIME_DIR .. '/cg_renderer/include',
+        RIVE_RUNTIME_DIR .. '/sw_renderer/include',
         'unit_tests',
         '%{cfg.targetdir}/include/libpng',
     })
@@ -234,6 +237,7 @@ function rive_tools_project(name, project_kind)
             'tools_common',
             'rive_pls_renderer',
             'rive_cg_renderer',
+            'rive_sw_renderer',
             'rive_decoders',
             'rive',
             'libpng',
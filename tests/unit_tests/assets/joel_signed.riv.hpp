@@ -0,0 +1,11 @@
+#include "rive/span.hpp"
+
+namespace assets
+{
+constexpr static unsigned int joel_signed_riv_data_len = 520622;
+extern unsigned char joel_signed_riv_data[joel_signed_riv_data_len];
+inline static rive::Span<uint8_t> joel_signed_riv()
+{
+    return {joel_signed_riv_data, joel_signed_riv_data_len};
+}
+}; // namespace assets
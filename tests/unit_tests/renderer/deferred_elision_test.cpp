@@ -0,0 +1,300 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+// Record time elision: a path rebuilt to the geometry replay already holds and
+// a paint set to its current value record nothing, and replay still draws
+// what the producer drew. No GPU.
+
+#include "rive/renderer/cmd/deferred_render_factory.hpp"
+#include "rive/renderer/cmd/deferred_replayer.hpp"
+#include "rive/renderer/cmd/deferred_session.hpp"
+#include "rive/math/raw_path.hpp"
+#include "utils/no_op_factory.hpp"
+#include "utils/no_op_renderer.hpp"
+
+#include <catch.hpp>
+#include <vector>
+
+using namespace rive;
+
+namespace
+{
+// Replay side resources that keep what they were told, so the sink can see
+// the geometry and color each draw resolved to.
+class GeometryPath : public RenderPath
+{
+public:
+    RawPath raw;
+
+    void rewind() override { raw.rewind(); }
+    void fillRule(FillRule) override {}
+    void addRenderPath(const RenderPath* path, const Mat2D& m) override
+    {
+        raw.addPath(static_cast<const GeometryPath*>(path)->raw, &m);
+    }
+    void addRawPath(const RawPath& path) override { raw.addPath(path); }
+    void moveTo(float x, float y) override { raw.moveTo(x, y); }
+    void lineTo(float x, float y) override { raw.lineTo(x, y); }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y)
+        override
+    {
+        raw.cubicTo(ox, oy, ix, iy, x, y);
+    }
+    void close() override { raw.close(); }
+};
+
+class ColorPaint : public RenderPaint
+{
+public:
+    ColorInt value = 0xFF000000;
+
+    void color(ColorInt v) override { value = v; }
+    void style(RenderPaintStyle) override {}
+    void thickness(float) override {}
+    void join(StrokeJoin) override {}
+    void cap(StrokeCap) override {}
+    void blendMode(BlendMode) override {}
+    void shader(rcp<RenderShader>) override {}
+    void invalidateStroke() override {}
+    void feather(float) override {}
+};
+
+class GeometryFactory : public NoOpFactory
+{
+public:
+    rcp<RenderPath> makeRenderPath(RawPath& path, FillRule) override
+    {
+        auto result = make_rcp<GeometryPath>();
+        result->raw = path;
+        return result;
+    }
+    rcp<RenderPath> makeEmptyRenderPath() override
+    {
+        return make_rcp<GeometryPath>();
+    }
+    rcp<RenderPaint> makeRenderPaint() override
+    {
+        return make_rcp<ColorPaint>();
+    }
+};
+
+struct Drawn
+{
+    std::vector<Vec2D> points;
+    ColorInt color;
+};
+
+class GeometrySink : public cmd::DeferredFrameSink
+{
+public:
+    std::vector<Drawn> drawn;
+
+    Factory* factory() override { return &m_factory; }
+    ore::Context* oreContext() override { return nullptr; }
+    Renderer* beginScreenFrame(uint64_t) override { return &m_renderer; }
+
+private:
+    class Recorder : public NoOpRenderer
+    {
+    public:
+        explicit Recorder(GeometrySink* sink) : m_sink(sink) {}
+        void drawPath(RenderPath* path, RenderPaint* paint) override
+        {
+            auto points = static_cast<GeometryPath*>(path)->raw.points();
+            m_sink->drawn.push_back(
+                {std::vector<Vec2D>(points.begin(), points.end()),
+                 static_cast<ColorPaint*>(paint)->value});
+        }
+
+    private:
+        GeometrySink* m_sink;
+    };
+
+    GeometryFactory m_factory;
+    Recorder m_renderer{this};
+};
+
+RawPath square(float size)
+{
+    RawPath raw;
+    raw.addRect({0, 0, size, size});
+    return raw;
+}
+
+uint32_t countOps(const cmd::RenderCommandBuffer& buffer, cmd::RenderCmd op)
+{
+    cmd::RenderCommandReader reader(buffer.commandBytes(), buffer.blobBytes());
+    uint32_t count = 0;
+    uint8_t type;
+    while (reader.next(type))
+    {
+        auto c = static_cast<cmd::RenderCmd>(type);
+        count += c == op ? 1 : 0;
+        reader.skip(cmd::payloadSizeOf(c));
+    }
+    return count;
+}
+} // namespace
+
+TEST_CASE("a path rebuilt to the same geometry records nothing",
+          "[cmd][deferred][elision]")
+{
+    cmd::DeferredSession session(rive::ore::ReplayCaps{});
+    auto paint = session.makeRenderPaint();
+    auto path = session.makeEmptyRenderPath();
+    const cmd::RenderCommandBuffer& buffer = session.commandBuffer();
+
+    auto drawFrame = [&](float size) {
+        path->rewind();
+        path->addRawPath(square(size));
+        session.screenRenderer()->drawPath(path.get(), paint.get());
+    };
+
+    drawFrame(10);
+    CHECK(countOps(buffer, cmd::RenderCmd::pathRewind) == 1);
+    CHECK(countOps(buffer, cmd::RenderCmd::pathAddRawPath) == 1);
+    CHECK(buffer.elisionStats().pathRebuilds == 0);
+    session.resetFrame();
+
+    drawFrame(10);
+    CHECK(countOps(buffer, cmd::RenderCmd::pathRewind) == 0);
+    CHECK(countOps(buffer, cmd::RenderCmd::pathAddRawPath) == 0);
+    CHECK(buffer.elisionStats().pathRebuilds == 1);
+    CHECK(buffer.elisionStats().bytes != 0);
+    // Rebuilding again within the frame, after a draw, still matches.
+    drawFrame(10);
+    CHECK(countOps(buffer, cmd::RenderCmd::pathRewind) == 0);
+    CHECK(countOps(buffer, cmd::RenderCmd::resourceNewVersion) == 0);
+    CHECK(buffer.elisionStats().pathRebuilds == 2);
+    session.resetFrame();
+    CHECK(buffer.elisionStats().pathRebuilds == 0);
+
+    drawFrame(20);
+    CHECK(countOps(buffer, cmd::RenderCmd::pathRewind) == 1);
+    CHECK(countOps(buffer, cmd::RenderCmd::pathAddRawPath) == 1);
+    CHECK(buffer.elisionStats().pathRebuilds == 0);
+}
+
+TEST_CASE("a path created with geometry elides a rebuild to it",
+          "[cmd][deferred][elision]")
+{
+    cmd::DeferredSession session(rive::ore::ReplayCaps{});
+    auto paint = session.makeRenderPaint();
+    RawPath created = square(5);
+    auto path = session.makeRenderPath(created, FillRule::nonZero);
+    session.resetFrame();
+
+    path->rewind();
+    square(5).addTo(path.get()); // per verb, through the scratch path
+    session.screenRenderer()->drawPath(path.get(), paint.get());
+    const cmd::RenderCommandBuffer& buffer = session.commandBuffer();
+    CHECK(countOps(buffer, cmd::RenderCmd::pathRewind) == 0);
+    CHECK(buffer.elisionStats().pathRebuilds == 1);
+}
+
+TEST_CASE("a path rebuilt to its mirror image is recorded",
+          "[cmd][deferred][elision]")
+{
+    cmd::DeferredSession session(rive::ore::ReplayCaps{});
+    cmd::DeferredReplayer replayer;
+    GeometrySink sink;
+    auto paint = session.makeRenderPaint();
+    auto path = session.makeEmptyRenderPath();
+
+    // Flipping the sign of y only flips the top bit of each point's word,
+    // which cancels out of an FNV style hash over an even number of points.
+    const float ys[] = {5, -5, 5};
+    for (float y : ys)
+    {
+        RawPath raw;
+        raw.moveTo(0, y);
+        raw.lineTo(10, y);
+        path->rewind();
+        path->addRawPath(raw);
+        session.screenRenderer()->drawPath(path.get(), paint.get());
+        const cmd::RenderCommandBuffer& buffer = session.commandBuffer();
+        CHECK(countOps(buffer, cmd::RenderCmd::pathRewind) == 1);
+        CHECK(buffer.elisionStats().pathRebuilds == 0);
+        replayer.replayFrame(cmd::takeFrame(session), sink);
+    }
+
+    REQUIRE(sink.drawn.size() == 3);
+    for (size_t i = 0; i < 3; i++)
+    {
+        CHECK(sink.drawn[i].points ==
+              std::vector<Vec2D>{{0, ys[i]}, {10, ys[i]}});
+    }
+}
+
+TEST_CASE("paint sets to the current value record nothing",
+          "[cmd][deferred][elision]")
+{
+    cmd::DeferredSession session(rive::ore::ReplayCaps{});
+    auto paint = session.makeRenderPaint();
+    const cmd::RenderCommandBuffer& buffer = session.commandBuffer();
+
+    paint->color(0xFF00FF00);
+    paint->color(0xFF00FF00);
+    paint->thickness(1); // the default
+    paint->blendMode(BlendMode::srcOver);
+    CHECK(countOps(buffer, cmd::RenderCmd::paintColor) == 1);
+    CHECK(countOps(buffer, cmd::RenderCmd::paintThickness) == 0);
+    CHECK(buffer.elisionStats().paintSets == 3);
+    CHECK(buffer.elisionStats().bytes ==
+          3 + sizeof(cmd::PaintColorPOD) + sizeof(cmd::PaintFloatPOD) +
+              sizeof(cmd::PaintU8POD));
+}
+
+TEST_CASE("replay draws the producer's geometry across elided frames",
+          "[cmd][deferred][elision]")
+{
+    cmd::DeferredSession session(rive::ore::ReplayCaps{});
+    cmd::DeferredReplayer replayer;
+    GeometrySink sink;
+    auto paint = session.makeRenderPaint();
+    auto path = session.makeEmptyRenderPath();
+
+    // Same, same, changed, back to the first, then appended onto.
+    const float sizes[] = {10, 10, 20, 10, 10};
+    uint32_t elided = 0;
+    for (int frame = 0; frame < 5; frame++)
+    {
+        RawPath raw = square(sizes[frame]);
+        path->rewind();
+        path->addRawPath(raw);
+        paint->color(frame < 3 ? 0xFFFF0000 : 0xFF0000FF);
+        session.screenRenderer()->drawPath(path.get(), paint.get());
+        if (frame == 4)
+        {
+            // Appending onto the drawn path and drawing it again.
+            RawPath extra = square(3);
+            path->addRawPath(extra);
+            session.screenRenderer()->drawPath(path.get(), paint.get());
+        }
+        elided += session.commandBuffer().elisionStats().pathRebuilds;
+        replayer.replayFrame(cmd::takeFrame(session), sink);
+    }
+    CHECK(elided == 2);
+    CHECK(replayer.droppedDraws() == 0);
+
+    REQUIRE(sink.drawn.size() == 6);
+    auto squarePoints = [](float size) {
+        RawPath raw = square(size);
+        return std::vector<Vec2D>(raw.points().begin(), raw.points().end());
+    };
+    CHECK(sink.drawn[0].points == squarePoints(10));
+    CHECK(sink.drawn[1].points == squarePoints(10));
+    CHECK(sink.drawn[2].points == squarePoints(20));
+    CHECK(sink.drawn[3].points == squarePoints(10));
+    CHECK(sink.drawn[4].points == squarePoints(10));
+    std::vector<Vec2D> appended = squarePoints(10);
+    for (Vec2D p : squarePoints(3))
+    {
+        appended.push_back(p);
+    }
+    CHECK(sink.drawn[5].points == appended);
+    CHECK(sink.drawn[0].color == 0xFFFF0000);
+    CHECK(sink.drawn[2].color == 0xFFFF0000);
+    CHECK(sink.drawn[3].color == 0xFF0000FF);
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+// A pooled frame handoff swaps the session's streams into the frame instead of
+// copying them, and recycled frames hand their buffers back to the session.
+// Replay must not be able to tell the two handoffs apart.
+
+#include "rive/renderer/cmd/deferred_replayer.hpp"
+#include "rive/renderer/cmd/deferred_session.hpp"
+#include "rive/math/raw_path.hpp"
+#include "deferred_test_sink.hpp"
+
+#include <catch.hpp>
+#include <chrono>
+#include <cstdio>
+#include <set>
+#include <vector>
+
+using namespace rive;
+using deferred_test::TestSink;
+
+namespace
+{
+// Resources minted once and redrawn with fresh state every frame, like an
+// artboard advancing.
+class PathScene
+{
+public:
+    PathScene(cmd::DeferredSession& session, int pathCount)
+    {
+        for (int i = 0; i < pathCount; i++)
+        {
+            RawPath raw;
+            raw.moveTo(i, 0);
+            raw.lineTo(i + 10, 0);
+            raw.lineTo(i + 10, 10);
+            raw.close();
+            m_paths.push_back(session.makeRenderPath(raw, FillRule::nonZero));
+        }
+        m_paint = session.makeRenderPaint();
+    }
+
+    void draw(cmd::DeferredSession& session, int frame)
+    {
+        Renderer* renderer = session.screenRenderer();
+        renderer->save();
+        renderer->translate(static_cast<float>(frame), 0);
+        for (size_t i = 0; i < m_paths.size(); i++)
+        {
+            m_paint->color(0xFF000000 | static_cast<uint32_t>(frame * 31 + i));
+            renderer->drawPath(m_paths[i].get(), m_paint.get());
+        }
+        renderer->restore();
+    }
+
+private:
+    std::vector<rcp<RenderPath>> m_paths;
+    rcp<RenderPaint> m_paint;
+};
+
+std::vector<uint8_t> toVector(Span<const uint8_t> bytes)
+{
+    return std::vector<uint8_t>(bytes.data(), bytes.data() + bytes.size());
+}
+} // namespace
+
+TEST_CASE("pooled frames replay like copied snapshots",
+          "[deferred][frame_pool]")
+{
+    cmd::DeferredSession copied(rive::ore::ReplayCaps{});
+    cmd::DeferredSession pooled(rive::ore::ReplayCaps{});
+    PathScene copiedScene(copied, 8);
+    PathScene pooledScene(pooled, 8);
+    TestSink copiedSink, pooledSink;
+    cmd::DeferredReplayer copiedReplayer, pooledReplayer;
+    cmd::DeferredFramePool pool;
+
+    for (int frame = 0; frame < 4; frame++)
+    {
+        copiedScene.draw(copied, frame);
+        copiedReplayer.replayFrame(cmd::takeFrame(copied), copiedSink);
+
+        pooledScene.draw(pooled, frame);
+        cmd::DeferredFrame* taken = pool.takeFrame(pooled);
+        REQUIRE(taken != nullptr);
+        CHECK(!taken->commands.empty());
+        CHECK(pooled.streamBytes() == 0);
+        pooledReplayer.replayFrame(*taken, pooledSink);
+        pool.recycle(taken);
+        CHECK(pooledReplayer.droppedDraws() == 0);
+    }
+
+    auto expected = toVector(copiedSink.serializingFactory.bytes());
+    CHECK(!expected.empty());
+    CHECK(toVector(pooledSink.serializingFactory.bytes()) == expected);
+}
+
+TEST_CASE("pooled handoff keeps stream buffers across frames",
+          "[deferred][frame_pool]")
+{
+    cmd::DeferredSession session(rive::ore::ReplayCaps{});
+    PathScene scene(session, 32);
+    TestSink sink;
+    cmd::DeferredReplayer replayer;
+    cmd::DeferredFramePool pool(2);
+
+    // Once every buffer in the rotation has grown to a frame's size, frames
+    // only ever land in storage the rotation already owns.
+    std::set<const uint8_t*> warm;
+    for (int frame = 0; frame < 12; frame++)
+    {
+        scene.draw(session, frame);
+        cmd::DeferredFrame* taken = pool.takeFrame(session);
+        REQUIRE(taken != nullptr);
+        if (frame < 4)
+        {
+            warm.insert(taken->commands.data());
+            warm.insert(taken->blobs.data());
+        }
+        else
+        {
+            CHECK(warm.count(taken->commands.data()) == 1);
+        }
+        replayer.replayFrame(*taken, sink);
+        pool.recycle(taken);
+    }
+    CHECK(replayer.droppedDraws() == 0);
+}
+
+TEST_CASE("an exhausted pool takes nothing until a frame comes back",
+          "[deferred][frame_pool]")
+{
+    cmd::DeferredSession session(rive::ore::ReplayCaps{});
+    PathScene scene(session, 2);
+    cmd::DeferredFramePool pool(2);
+
+    scene.draw(session, 0);
+    cmd::DeferredFrame* first = pool.takeFrame(session);
+    scene.draw(session, 1);
+    cmd::DeferredFrame* second = pool.takeFrame(session);
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+    CHECK(first != second);
+    CHECK(pool.framesInFlight() == 2);
+
+    // The refused frame stays recorded in the session.
+    scene.draw(session, 2);
+    uint64_t recorded = session.streamBytes();
+    CHECK(recorded != 0);
+    CHECK(pool.takeFrame(session) == nullptr);
+    CHECK(session.streamBytes() == recorded);
+
+    pool.recycle(first);
+    CHECK(pool.framesInFlight() == 1);
+    cmd::DeferredFrame* third = pool.takeFrame(session);
+    CHECK(third == first);
+    CHECK(third->commands.size() + third->blobs.size() == recorded);
+    CHECK(session.streamBytes() == 0);
+    pool.recycle(second);
+    pool.recycle(third);
+    CHECK(pool.framesInFlight() == 0);
+}
+
+// Handoff cost per frame, copied snapshot against pooled swap. Emits rows in
+// the deferred measure format; nothing asserts on a threshold.
+//
+// Hidden tag; run explicitly with test.sh -m "[deferred_measure]".
+TEST_CASE("deferred frame handoff measure", "[.][deferred_measure]")
+{
+    constexpr int kFrames = 500;
+    constexpr int kPaths = 500;
+    auto us = [](auto a, auto b) {
+        return std::chrono::duration<double, std::micro>(b - a).count();
+    };
+    auto row = [](const char* phase, const char* metric, double value) {
+        printf("MEASURE,handoff,%s,%s,%.6f\n", phase, metric, value);
+    };
+
+    for (bool usePool : {false, true})
+    {
+        cmd::DeferredSession session(rive::ore::ReplayCaps{});
+        PathScene scene(session, kPaths);
+        TestSink sink;
+        cmd::DeferredReplayer replayer;
+        cmd::DeferredFramePool pool;
+        double takeUs = 0, replayUs = 0, copiedBytes = 0;
+        for (int frame = 0; frame < kFrames; frame++)
+        {
+            scene.draw(session, frame);
+            auto t0 = std::chrono::steady_clock::now();
+            if (usePool)
+            {
+                cmd::DeferredFrame* taken = pool.takeFrame(session);
+                auto t1 = std::chrono::steady_clock::now();
+                replayer.replayFrame(*taken, sink);
+                auto t2 = std::chrono::steady_clock::now();
+                pool.recycle(taken);
+                takeUs += us(t0, t1);
+                replayUs += us(t1, t2);
+            }
+            else
+            {
+                copiedBytes += static_cast<double>(session.streamBytes());
+                cmd::DeferredFrame taken = cmd::takeFrame(session);
+                auto t1 = std::chrono::steady_clock::now();
+                replayer.replayFrame(taken, sink);
+                auto t2 = std::chrono::steady_clock::now();
+                takeUs += us(t0, t1);
+                replayUs += us(t1, t2);
+            }
+        }
+        const char* phase = usePool ? "pooled" : "copied";
+        row(phase, "take_us", takeUs / kFrames);
+        row(phase, "replay_us", replayUs / kFrames);
+        row(phase, "copied_bytes", copiedBytes / kFrames);
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include <catch.hpp>
+#include "common/rand.hpp"
+#include "draw_sort.hpp"
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace rive;
+using namespace rive::gpu;
+
+namespace
+{
+struct Entry
+{
+    int64_t sortKey;
+    int16_t drawIndex;
+};
+
+// Sorts entries with RadixSortBySortKey and checks the result matches a
+// stable sort by key.
+void check_sorted(std::vector<Entry> entries)
+{
+    std::vector<Entry> expected = entries;
+    std::stable_sort(
+        expected.begin(),
+        expected.end(),
+        [](const Entry& a, const Entry& b) { return a.sortKey < b.sortKey; });
+
+    std::vector<Entry> scratch(entries.size());
+    RadixSortBySortKey(entries.data(), scratch.data(), entries.size());
+    REQUIRE(entries.size() == expected.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        CHECK(entries[i].sortKey == expected[i].sortKey);
+        CHECK(entries[i].drawIndex == expected[i].drawIndex);
+    }
+}
+
+std::vector<Entry> make_entries(Rand& rand, size_t count, uint64_t keyMask)
+{
+    std::vector<Entry> entries;
+    for (size_t i = 0; i < count; ++i)
+    {
+        int64_t key = static_cast<int64_t>(rand.u64() & keyMask);
+        // Prepasses negate their keys.
+        entries.push_back({rand.u32(0, 3) == 0 ? -key : key, int16_t(i)});
+    }
+    return entries;
+}
+} // namespace
+
+TEST_CASE("radix sort matches a stable sort", "[draw_sort]")
+{
+    Rand rand;
+    rand.seed(0);
+    for (size_t count : {0, 1, 2, 17, 64, 65, 1000, 20000})
+    {
+        // Full keys, keys where most digits are constant, and keys with many
+        // duplicates.
+        check_sorted(make_entries(rand, count, (1ull << 63) - 1));
+        check_sorted(make_entries(rand, count, 0x7fff000000000007ull));
+        check_sorted(make_entries(rand, count, 0x0000000300000100ull));
+    }
+}
+
+TEST_CASE("radix sort handles extreme keys", "[draw_sort]")
+{
+    std::vector<Entry> entries;
+    for (int i = 0; i < 200; ++i)
+    {
+        int64_t key = i % 4 == 0   ? std::numeric_limits<int64_t>::max()
+                      : i % 4 == 1 ? -std::numeric_limits<int64_t>::max()
+                      : i % 4 == 2 ? 0
+                                   : -1;
+        entries.push_back({key, int16_t(i)});
+    }
+    check_sorted(entries);
+}
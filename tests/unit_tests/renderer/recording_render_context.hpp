@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#pragma once
+
+#include "common/render_context_null.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace rive::gpu
+{
+// Keeps a copy of every resource buffer the render context writes, in the
+// order they get unmapped. Mapped memory is filled with a known byte first, so
+// padding that never gets written compares equal too.
+class RenderContextRecordingImpl : public RenderContextNULL
+{
+    using Super = RenderContextNULL;
+
+public:
+    std::vector<std::vector<uint8_t>> unmappedBuffers;
+
+#define RECORD_MAP_UNMAP(index, Name)                                          \
+    void* map##Name(size_t mapSizeInBytes) override                            \
+    {                                                                          \
+        void* ptr = Super::map##Name(mapSizeInBytes);                          \
+        memset(ptr, 0xcd, mapSizeInBytes);                                     \
+        m_mappedBuffers[index] = static_cast<uint8_t*>(ptr);                   \
+        return ptr;                                                            \
+    }                                                                          \
+                                                                               \
+    void unmap##Name(size_t mapSizeInBytes) override                           \
+    {                                                                          \
+        const uint8_t* ptr = m_mappedBuffers[index];                           \
+        unmappedBuffers.emplace_back(ptr, ptr + mapSizeInBytes);               \
+        Super::unmap##Name(mapSizeInBytes);                                    \
+    }
+
+    RECORD_MAP_UNMAP(0, FlushUniformBuffer)
+    RECORD_MAP_UNMAP(1, PathBuffer)
+    RECORD_MAP_UNMAP(2, PaintBuffer)
+    RECORD_MAP_UNMAP(3, PaintAuxBuffer)
+    RECORD_MAP_UNMAP(4, ContourBuffer)
+    RECORD_MAP_UNMAP(5, GradSpanBuffer)
+    RECORD_MAP_UNMAP(6, TessVertexSpanBuffer)
+    RECORD_MAP_UNMAP(7, TriangleVertexBuffer)
+    RECORD_MAP_UNMAP(8, ImageDrawInstanceBuffer)
+
+#undef RECORD_MAP_UNMAP
+
+private:
+    uint8_t* m_mappedBuffers[9] = {};
+};
+} // namespace rive::gpu
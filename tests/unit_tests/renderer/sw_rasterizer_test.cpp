@@ -0,0 +1,251 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "sw_factory.hpp"
+#include "sw_renderer.hpp"
+#include <catch.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace rive;
+
+namespace
+{
+constexpr uint32_t kSize = 32;
+constexpr ColorInt kRed = 0xffff0000;
+constexpr ColorInt kBlue = 0xff0000ff;
+
+uint8_t alpha(uint32_t pixel) { return pixel >> 24; }
+
+// Adds a rectangle wound clockwise, or counterclockwise if reversed.
+void add_rect(RenderPath* path,
+              float l,
+              float t,
+              float r,
+              float b,
+              bool reversed = false)
+{
+    path->moveTo(l, t);
+    if (reversed)
+    {
+        path->lineTo(l, b);
+        path->lineTo(r, b);
+        path->lineTo(r, t);
+    }
+    else
+    {
+        path->lineTo(r, t);
+        path->lineTo(r, b);
+        path->lineTo(l, b);
+    }
+    path->close();
+}
+
+class SWCanvas
+{
+public:
+    explicit SWCanvas(uint32_t threadCount = 1,
+                      uint32_t width = kSize,
+                      uint32_t height = kSize) :
+        m_rasterizer(threadCount),
+        m_width(width),
+        m_height(height),
+        m_pixels(width * height, 0)
+    {}
+
+    SWRasterizer& rasterizer() { return m_rasterizer; }
+
+    SWFactory* factory() { return &m_factory; }
+
+    SWRenderer* begin()
+    {
+        m_rasterizer.beginFrame(m_pixels.data(), m_width, m_height);
+        m_renderer = std::make_unique<SWRenderer>(&m_rasterizer);
+        return m_renderer.get();
+    }
+
+    const std::vector<uint32_t>& flush()
+    {
+        m_rasterizer.flush();
+        m_renderer.reset();
+        return m_pixels;
+    }
+
+    void fill(RenderPath* path, ColorInt color)
+    {
+        auto paint = m_factory.makeRenderPaint();
+        paint->color(color);
+        m_renderer->drawPath(path, paint.get());
+    }
+
+    uint32_t pixel(uint32_t x, uint32_t y) const
+    {
+        return m_pixels[y * m_width + x];
+    }
+
+private:
+    SWFactory m_factory;
+    SWRasterizer m_rasterizer;
+    const uint32_t m_width;
+    const uint32_t m_height;
+    std::unique_ptr<SWRenderer> m_renderer;
+    std::vector<uint32_t> m_pixels;
+};
+} // namespace
+
+TEST_CASE("pixel-aligned rects cover whole pixels", "[sw_renderer]")
+{
+    SWCanvas canvas;
+    canvas.begin();
+    auto path = canvas.factory()->makeEmptyRenderPath();
+    add_rect(path.get(), 4, 4, 12, 12);
+    canvas.fill(path.get(), kRed);
+    canvas.flush();
+
+    uint32_t red = SWRasterizer::PremultipliedRGBA(kRed);
+    for (uint32_t y = 0; y < kSize; ++y)
+    {
+        for (uint32_t x = 0; x < kSize; ++x)
+        {
+            bool inside = x >= 4 && x < 12 && y >= 4 && y < 12;
+            CHECK(canvas.pixel(x, y) == (inside ? red : 0u));
+        }
+    }
+}
+
+TEST_CASE("coverage is the exact pixel area", "[sw_renderer]")
+{
+    SWCanvas canvas;
+    canvas.begin();
+    auto path = canvas.factory()->makeEmptyRenderPath();
+    // Half of column 4 and a quarter of column 11.
+    add_rect(path.get(), 4.5f, 2, 11.25f, 6);
+    canvas.fill(path.get(), kRed);
+    canvas.flush();
+
+    CHECK(alpha(canvas.pixel(3, 3)) == 0);
+    CHECK(alpha(canvas.pixel(4, 3)) == Approx(128).margin(1));
+    CHECK(alpha(canvas.pixel(8, 3)) == 255);
+    CHECK(alpha(canvas.pixel(11, 3)) == Approx(64).margin(1));
+    CHECK(alpha(canvas.pixel(12, 3)) == 0);
+}
+
+TEST_CASE("fill rules decide nested contours", "[sw_renderer]")
+{
+    uint32_t red = SWRasterizer::PremultipliedRGBA(kRed);
+    auto render = [&](FillRule fillRule, bool innerReversed) {
+        SWCanvas canvas;
+        canvas.begin();
+        auto path = canvas.factory()->makeEmptyRenderPath();
+        path->fillRule(fillRule);
+        add_rect(path.get(), 2, 2, 30, 30);
+        add_rect(path.get(), 10, 10, 22, 22, innerReversed);
+        canvas.fill(path.get(), kRed);
+        canvas.flush();
+        CHECK(canvas.pixel(5, 5) == red);
+        return canvas.pixel(16, 16);
+    };
+
+    CHECK(render(FillRule::nonZero, false) == red);
+    CHECK(render(FillRule::nonZero, true) == 0);
+    CHECK(render(FillRule::evenOdd, false) == 0);
+    CHECK(render(FillRule::evenOdd, true) == 0);
+    // Clockwise fills cover any positive winding, so only the reversed inner
+    // rect cuts a hole.
+    CHECK(render(FillRule::clockwise, false) == red);
+    CHECK(render(FillRule::clockwise, true) == 0);
+}
+
+TEST_CASE("nested clips intersect and restore", "[sw_renderer]")
+{
+    SWCanvas canvas;
+    SWRenderer* renderer = canvas.begin();
+    auto everything = canvas.factory()->makeEmptyRenderPath();
+    add_rect(everything.get(), 0, 0, kSize, kSize);
+    auto left = canvas.factory()->makeEmptyRenderPath();
+    add_rect(left.get(), 0, 0, 16, kSize);
+    auto top = canvas.factory()->makeEmptyRenderPath();
+    add_rect(top.get(), 0, 0, kSize, 16);
+
+    renderer->save();
+    renderer->clipPath(left.get());
+    canvas.fill(everything.get(), kBlue);
+    renderer->save();
+    renderer->clipPath(top.get());
+    canvas.fill(everything.get(), kRed);
+    renderer->restore();
+    renderer->restore();
+    canvas.flush();
+
+    uint32_t red = SWRasterizer::PremultipliedRGBA(kRed);
+    uint32_t blue = SWRasterizer::PremultipliedRGBA(kBlue);
+    CHECK(canvas.pixel(4, 4) == red);
+    CHECK(canvas.pixel(4, 20) == blue);
+    CHECK(canvas.pixel(20, 4) == 0);
+    CHECK(canvas.pixel(20, 20) == 0);
+}
+
+TEST_CASE("edges far outside the target still rasterize", "[sw_renderer]")
+{
+    SWCanvas canvas;
+    canvas.begin();
+    // Far enough past the bottom that its row doesn't fit in an int.
+    auto path = canvas.factory()->makeEmptyRenderPath();
+    path->moveTo(4, 4);
+    path->lineTo(12, 4);
+    path->lineTo(12, 1e12f);
+    path->lineTo(4, 1e12f);
+    path->close();
+    canvas.fill(path.get(), kRed);
+    // Non-finite edges draw nothing.
+    auto nan = canvas.factory()->makeEmptyRenderPath();
+    add_rect(nan.get(), 20, 4, 28, std::numeric_limits<float>::quiet_NaN());
+    canvas.fill(nan.get(), kBlue);
+    canvas.flush();
+
+    uint32_t red = SWRasterizer::PremultipliedRGBA(kRed);
+    CHECK(canvas.pixel(8, 3) == 0);
+    CHECK(canvas.pixel(8, 4) == red);
+    CHECK(canvas.pixel(8, kSize - 1) == red);
+    CHECK(canvas.pixel(24, 16) == 0);
+}
+
+TEST_CASE("thread count doesn't change the pixels", "[sw_renderer]")
+{
+    // Several 64px tiles in each direction, with partial ones on the right
+    // and bottom, so tiles are split between threads.
+    constexpr uint32_t kWidth = 300;
+    constexpr uint32_t kHeight = 200;
+    auto render = [](uint32_t threadCount) {
+        SWCanvas canvas(threadCount, kWidth, kHeight);
+#ifdef WITH_RIVE_THREADING
+        // Make sure the helpers actually run.
+        CHECK((threadCount == 1 || canvas.rasterizer().threadCount() > 1));
+#endif
+        SWRenderer* renderer = canvas.begin();
+        auto clip = canvas.factory()->makeEmptyRenderPath();
+        add_rect(clip.get(), 3, 3, kWidth - 3, kHeight - 3);
+        renderer->clipPath(clip.get());
+        for (int i = 0; i < 20; ++i)
+        {
+            auto path = canvas.factory()->makeEmptyRenderPath();
+            float o = i * 13.7f;
+            path->moveTo(o, 0);
+            path->cubicTo(kWidth, o, 0, kHeight - o, kWidth - o, kHeight);
+            path->close();
+            canvas.fill(path.get(), 0x80000000 | (i * 0x0b1d2f));
+        }
+        return canvas.flush();
+    };
+
+    std::vector<uint32_t> expected = render(1);
+    for (uint32_t threadCount : {2, 3, 8})
+    {
+        // Compare outside of CHECK() so Catch doesn't print every pixel on
+        // failure.
+        bool identical = render(threadCount) == expected;
+        CHECK(identical);
+    }
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+// Tests the TessellationCache that lets midpoint-fan PathDraws skip recounting
+// paths they drew the same way in a previous frame: its admission, LRU
+// eviction and stats, and that cached draws write the exact same resource
+// buffers as draws that recount.
+
+#include "rive/renderer/rive_renderer.hpp"
+#include "rive/renderer/tessellation_cache.hpp"
+#include "common/rand.hpp"
+#include "recording_render_context.hpp"
+#include <catch.hpp>
+#include <cstring>
+#include <vector>
+
+using namespace rive;
+using namespace rive::gpu;
+
+namespace
+{
+TessellationCache::Key make_key(uint64_t rawPathMutationID)
+{
+    return {rawPathMutationID, {1, 0, 0, 1}, 2, 0, 0, 0};
+}
+
+// Inserts sizeInBytes of data for the key, after drawing it in two consecutive
+// frames like PathDraw would have to.
+void insert_entry(TessellationCache* cache,
+                  const TessellationCache::Key& key,
+                  size_t sizeInBytes,
+                  uint8_t fill)
+{
+    REQUIRE(cache->find(key).empty());
+    REQUIRE(!cache->shouldInsert(key));
+    cache->endFrame();
+    REQUIRE(cache->find(key).empty());
+    REQUIRE(cache->shouldInsert(key));
+    uint8_t* data = cache->insert(key, sizeInBytes, .5);
+    REQUIRE(data != nullptr);
+    memset(data, fill, sizeInBytes);
+}
+} // namespace
+
+TEST_CASE("tessellation cache admits geometry on its second frame",
+          "[tessellation]")
+{
+    TessellationCache cache;
+    auto key = make_key(1);
+
+    // Drawn once, then not again for a frame: never admitted.
+    CHECK(cache.find(key).empty());
+    CHECK(!cache.shouldInsert(key));
+    cache.endFrame();
+    cache.endFrame();
+    CHECK(cache.find(key).empty());
+    CHECK(!cache.shouldInsert(key));
+
+    // Drawn again the next frame: admitted.
+    cache.endFrame();
+    CHECK(cache.find(key).empty());
+    CHECK(cache.shouldInsert(key));
+    uint8_t* data = cache.insert(key, 3, .25);
+    REQUIRE(data != nullptr);
+    data[0] = 7;
+    data[1] = 8;
+    data[2] = 9;
+
+    Span<const uint8_t> found = cache.find(key);
+    REQUIRE(found.size() == 3);
+    CHECK(found[0] == 7);
+    CHECK(found[1] == 8);
+    CHECK(found[2] == 9);
+
+    // Any change to the key misses.
+    auto otherKey = key;
+    otherKey.matrix2x2[1] = -0.f;
+    CHECK(cache.find(otherKey).empty());
+    otherKey = key;
+    otherKey.strokeCap = 1;
+    CHECK(cache.find(otherKey).empty());
+    CHECK(cache.find(make_key(2)).empty());
+
+    const TessellationCache::Stats& stats = cache.stats();
+    CHECK(stats.hits == 1);
+    CHECK(stats.misses == 6);
+    CHECK(stats.insertions == 1);
+    CHECK(stats.evictions == 0);
+    CHECK(stats.secondsSaved == .25);
+    CHECK(stats.hitRate() == 1.f / 7);
+    CHECK(cache.entryCount() == 1);
+    CHECK(cache.bytesUsed() == 3);
+
+    cache.resetStats();
+    CHECK(cache.stats().hits == 0);
+    CHECK(cache.stats().hitRate() == 0);
+    cache.clear();
+    CHECK(cache.entryCount() == 0);
+    CHECK(cache.bytesUsed() == 0);
+    CHECK(cache.find(key).empty());
+}
+
+TEST_CASE("tessellation cache evicts least recently used entries",
+          "[tessellation]")
+{
+    TessellationCache cache;
+    cache.setBudgetInBytes(300);
+    insert_entry(&cache, make_key(1), 100, 1);
+    insert_entry(&cache, make_key(2), 100, 2);
+    insert_entry(&cache, make_key(3), 100, 3);
+    CHECK(cache.bytesUsed() == 300);
+
+    // Touch key 1 so key 2 is the least recently used.
+    CHECK(!cache.find(make_key(1)).empty());
+    insert_entry(&cache, make_key(4), 100, 4);
+    CHECK(cache.entryCount() == 3);
+    CHECK(cache.bytesUsed() == 300);
+    CHECK(cache.stats().evictions == 1);
+    CHECK(cache.find(make_key(2)).empty());
+    for (uint8_t i : {1, 3, 4})
+    {
+        Span<const uint8_t> found = cache.find(make_key(i));
+        REQUIRE(found.size() == 100);
+        CHECK(found[99] == i);
+    }
+
+    // Data bigger than the whole budget doesn't get cached, and doesn't evict
+    // anything either.
+    cache.endFrame();
+    CHECK(cache.find(make_key(5)).empty());
+    CHECK(!cache.shouldInsert(make_key(5)));
+    cache.endFrame();
+    CHECK(cache.find(make_key(5)).empty());
+    CHECK(cache.shouldInsert(make_key(5)));
+    CHECK(cache.insert(make_key(5), 301, 0) == nullptr);
+    CHECK(cache.entryCount() == 3);
+
+    // Shrinking the budget evicts down to it.
+    cache.setBudgetInBytes(150);
+    CHECK(cache.entryCount() == 1);
+    CHECK(cache.bytesUsed() == 100);
+    CHECK(!cache.find(make_key(4)).empty());
+
+    // A zero budget disables the cache.
+    cache.setBudgetInBytes(0);
+    CHECK(cache.entryCount() == 0);
+    cache.endFrame();
+    CHECK(!cache.shouldInsert(make_key(6)));
+    cache.endFrame();
+    CHECK(!cache.shouldInsert(make_key(6)));
+}
+
+namespace
+{
+// Paths that persist across frames: strokes with every join and cap, fills,
+// and feathers.
+struct Scene
+{
+    std::vector<rcp<RenderPath>> paths;
+    std::vector<rcp<RenderPaint>> paints;
+};
+
+Scene make_scene(RenderContext* context)
+{
+    Scene scene;
+    Rand rand;
+    rand.seed(0);
+    for (int i = 0; i < 150; ++i)
+    {
+        auto path = context->makeEmptyRenderPath();
+        Vec2D origin(rand.f32(0, 1000), rand.f32(0, 1000));
+        path->moveTo(origin.x, origin.y);
+        int curveCount = rand.u32(1, 12);
+        for (int j = 0; j < curveCount; ++j)
+        {
+            Vec2D p = origin + Vec2D(rand.f32(-80, 80), rand.f32(-80, 80));
+            if (j % 3 == 0)
+            {
+                path->lineTo(p.x, p.y);
+            }
+            else
+            {
+                path->cubicTo(origin.x + rand.f32(-80, 80),
+                              origin.y + rand.f32(-80, 80),
+                              origin.x + rand.f32(-80, 80),
+                              origin.y + rand.f32(-80, 80),
+                              p.x,
+                              p.y);
+            }
+            if (j % 5 == 4)
+            {
+                path->close();
+                path->moveTo(p.x, p.y);
+            }
+        }
+        scene.paths.push_back(std::move(path));
+
+        auto paint = context->makeRenderPaint();
+        paint->color(0x80000000 | rand.u32());
+        if (i % 3 != 0)
+        {
+            paint->style(RenderPaintStyle::stroke);
+            paint->thickness(rand.f32(1, 20));
+            paint->join(static_cast<StrokeJoin>(i % 3));
+            paint->cap(static_cast<StrokeCap>(i % 3));
+        }
+        if (i % 7 == 0)
+        {
+            paint->feather(rand.f32(2, 30));
+        }
+        scene.paints.push_back(std::move(paint));
+    }
+    return scene;
+}
+
+// Renders the scene over several frames. Translating between frames keeps the
+// cached counts valid, scaling doesn't, and one path mutates partway through.
+std::vector<std::vector<uint8_t>> render_frames(size_t cacheBudgetInBytes,
+                                                TessellationCache::Stats* stats)
+{
+    auto impl = std::make_unique<RenderContextRecordingImpl>();
+    RenderContextRecordingImpl* recordingImpl = impl.get();
+    RenderContext context(std::move(impl));
+    context.tessellationCache().setBudgetInBytes(cacheBudgetInBytes);
+    auto renderTarget = recordingImpl->makeRenderTarget(1024, 1024);
+    Scene scene = make_scene(&context);
+    for (int frame = 0; frame < 6; ++frame)
+    {
+        context.beginFrame({
+            .renderTargetWidth = 1024,
+            .renderTargetHeight = 1024,
+        });
+        RiveRenderer renderer(&context);
+        renderer.translate(frame * 3.5f, frame * -2.f);
+        if (frame == 4)
+        {
+            renderer.scale(1.5f, 1.5f);
+        }
+        if (frame == 3)
+        {
+            scene.paths[1]->lineTo(500, 500);
+        }
+        for (size_t i = 0; i < scene.paths.size(); ++i)
+        {
+            renderer.drawPath(scene.paths[i].get(), scene.paints[i].get());
+        }
+        context.flush({.renderTarget = renderTarget.get()});
+    }
+    *stats = context.tessellationCache().stats();
+    return std::move(recordingImpl->unmappedBuffers);
+}
+} // namespace
+
+TEST_CASE("cached tessellations write identical buffers", "[tessellation]")
+{
+    TessellationCache::Stats uncachedStats;
+    std::vector<std::vector<uint8_t>> expected =
+        render_frames(0, &uncachedStats);
+    REQUIRE(!expected.empty());
+    CHECK(uncachedStats.hits == 0);
+    CHECK(uncachedStats.insertions == 0);
+
+    TessellationCache::Stats stats;
+    std::vector<std::vector<uint8_t>> buffers =
+        render_frames(TessellationCache::kDefaultBudgetInBytes, &stats);
+    REQUIRE(buffers.size() == expected.size());
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        // Compare outside of CHECK() so Catch doesn't print every byte on
+        // failure.
+        bool identical = buffers[i] == expected[i];
+        CHECK(identical);
+    }
+
+    // Frame 0 sees everything, frame 1 caches it, frames 2 and 3 hit, frame 4
+    // (scaled) misses, and frame 5 hits again on what frame 3 kept alive.
+    CHECK(stats.insertions > 0);
+    CHECK(stats.hits >= stats.insertions * 3 - 3);
+    CHECK(stats.hitRate() > .4f);
+    CHECK(stats.secondsSaved > 0);
+    CHECK(stats.evictions == 0);
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026 Rive
+ */
+
+#include "rive/async/work_pool.hpp"
+#include "rive/renderer/rive_renderer.hpp"
+#include "common/rand.hpp"
+#include "recording_render_context.hpp"
+#include "rive_render_paint.hpp"
+#include "rive_render_path.hpp"
+#include <catch.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace rive;
+using namespace rive::gpu;
+
+namespace
+{
+// Draws a mix of strokes (every join and cap), fills, feathers, and paths
+// large enough to get an interior triangulation or to wrap rows of the
+// tessellation texture.
+void draw_scene(RenderContext* context, Renderer* renderer)
+{
+    Rand rand;
+    rand.seed(0);
+    for (int i = 0; i < 300; ++i)
+    {
+        auto path = context->makeEmptyRenderPath();
+        int curveCount = i % 50 == 0 ? 400 : rand.u32(1, 12);
+        float size = i % 50 == 0 ? 900 : rand.f32(8, 80);
+        Vec2D origin(rand.f32(0, 1000), rand.f32(0, 1000));
+        path->moveTo(origin.x, origin.y);
+        for (int j = 0; j < curveCount; ++j)
+        {
+            Vec2D p =
+                origin + Vec2D(rand.f32(-size, size), rand.f32(-size, size));
+            if (j % 3 == 0)
+            {
+                path->lineTo(p.x, p.y);
+            }
+            else
+            {
+                path->cubicTo(origin.x + rand.f32(-size, size),
+                              origin.y + rand.f32(-size, size),
+                              origin.x + rand.f32(-size, size),
+                              origin.y + rand.f32(-size, size),
+                              p.x,
+                              p.y);
+            }
+            if (j % 5 == 4 && rand.boolean())
+            {
+                path->close();
+                path->moveTo(p.x, p.y);
+            }
+        }
+        if (i % 2 == 0)
+        {
+            path->close();
+        }
+
+        auto paint = context->makeRenderPaint();
+        paint->color(0x80000000 | rand.u32());
+        if (i % 3 != 0)
+        {
+            paint->style(RenderPaintStyle::stroke);
+            paint->thickness(rand.f32(1, 20));
+            paint->join(static_cast<StrokeJoin>(i % 3));
+            paint->cap(static_cast<StrokeCap>(i % 3));
+        }
+        if (i % 7 == 0)
+        {
+            paint->feather(rand.f32(2, 30));
+        }
+        renderer->drawPath(path.get(), paint.get());
+    }
+}
+
+std::vector<std::vector<uint8_t>> render_frames(
+    uint32_t threadCount,
+    const RenderContext::FrameDescriptor& frameDescriptor)
+{
+    auto impl = std::make_unique<RenderContextRecordingImpl>();
+    RenderContextRecordingImpl* recordingImpl = impl.get();
+    RenderContext context(std::move(impl));
+    context.setTessellationThreadCount(threadCount);
+    // Capped at the pool's workers plus this thread; 1 without threading.
+    CHECK(context.tessellationThreadCount() ==
+          std::min(threadCount, getGlobalWorkPool()->threadCount() + 1));
+    auto renderTarget = recordingImpl->makeRenderTarget(1024, 1024);
+    // Run a few frames so the writers get reused.
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        context.beginFrame(frameDescriptor);
+        RiveRenderer renderer(&context);
+        draw_scene(&context, &renderer);
+        context.flush({.renderTarget = renderTarget.get()});
+    }
+    return std::move(recordingImpl->unmappedBuffers);
+}
+} // namespace
+
+TEST_CASE("multithreaded tessellation writes identical buffers",
+          "[tessellation]")
+{
+    RenderContext::FrameDescriptor frameDescriptors[4];
+    for (auto& frameDescriptor : frameDescriptors)
+    {
+        frameDescriptor.renderTargetWidth = 1024;
+        frameDescriptor.renderTargetHeight = 1024;
+    }
+    frameDescriptors[1].disableRasterOrdering = true;
+    frameDescriptors[2].msaaSampleCount = 4;
+    frameDescriptors[3].disableRasterOrdering = true;
+    frameDescriptors[3].clockwiseFillOverride = true;
+
+    for (const auto& frameDescriptor : frameDescriptors)
+    {
+        std::vector<std::vector<uint8_t>> expected =
+            render_frames(1, frameDescriptor);
+        REQUIRE(!expected.empty());
+        for (uint32_t threadCount : {2, 4, 7})
+        {
+            std::vector<std::vector<uint8_t>> buffers =
+                render_frames(threadCount, frameDescriptor);
+            REQUIRE(buffers.size() == expected.size());
+            for (size_t i = 0; i < buffers.size(); ++i)
+            {
+                // Compare outside of CHECK() so Catch doesn't print every
+                // byte on failure.
+                bool identical = buffers[i] == expected[i];
+                CHECK(identical);
+            }
+        }
+    }
+}
+
+// The span bound only applies to tessellations staged for the worker threads.
+#ifdef WITH_RIVE_THREADING
+namespace
+{
+struct BoundedFlush
+{
+    std::vector<std::vector<uint8_t>> buffers;
+    size_t tessSpanCount;
+    size_t droppedTessSpanCount;
+};
+
+// Flushes a single stroke on 2 threads, with every pending tessellation's span
+// bound replaced by maxTessSpanCount (or left alone if it's 0).
+BoundedFlush flush_one_stroke(size_t maxTessSpanCount)
+{
+    auto impl = std::make_unique<RenderContextRecordingImpl>();
+    RenderContextRecordingImpl* recordingImpl = impl.get();
+    RenderContext context(std::move(impl));
+    context.setTessellationThreadCount(2);
+    context.testing_overrideMaxTessSpanCount(maxTessSpanCount);
+    auto renderTarget = recordingImpl->makeRenderTarget(1024, 1024);
+
+    RenderContext::FrameDescriptor frameDescriptor;
+    frameDescriptor.renderTargetWidth = 1024;
+    frameDescriptor.renderTargetHeight = 1024;
+    context.beginFrame(frameDescriptor);
+    RiveRenderer renderer(&context);
+    Rand rand;
+    rand.seed(0);
+    auto path = context.makeEmptyRenderPath();
+    path->moveTo(512, 512);
+    for (int i = 0; i < 200; ++i)
+    {
+        path->cubicTo(rand.f32(0, 1024),
+                      rand.f32(0, 1024),
+                      rand.f32(0, 1024),
+                      rand.f32(0, 1024),
+                      rand.f32(0, 1024),
+                      rand.f32(0, 1024));
+    }
+    auto paint = context.makeRenderPaint();
+    paint->style(RenderPaintStyle::stroke);
+    paint->thickness(10);
+    paint->join(StrokeJoin::round);
+    renderer.drawPath(path.get(), paint.get());
+    context.flush({.renderTarget = renderTarget.get()});
+    return {std::move(recordingImpl->unmappedBuffers),
+            context.testing_pendingTessSpanCount(),
+            context.droppedTessSpanCount()};
+}
+} // namespace
+
+TEST_CASE("multithreaded tessellation stops at its span bound",
+          "[tessellation]")
+{
+    BoundedFlush unbounded = flush_one_stroke(0);
+    REQUIRE(unbounded.tessSpanCount > 1);
+    CHECK(unbounded.droppedTessSpanCount == 0);
+
+    // A bound of exactly the spans written loses nothing.
+    BoundedFlush exact = flush_one_stroke(unbounded.tessSpanCount);
+    CHECK(exact.tessSpanCount == unbounded.tessSpanCount);
+    CHECK(exact.droppedTessSpanCount == 0);
+    bool identical = exact.buffers == unbounded.buffers;
+    CHECK(identical);
+
+    // One under drops the last span instead of writing past the buffer.
+    BoundedFlush under = flush_one_stroke(unbounded.tessSpanCount - 1);
+    CHECK(under.tessSpanCount == unbounded.tessSpanCount - 1);
+    CHECK(under.droppedTessSpanCount == 1);
+}
+#endif
@@ -1,7 +1,9 @@
 #include "rive/audio/audio_engine.hpp"
 #include "rive/audio/audio_source.hpp"
+#include "rive/audio/audio_stream.hpp"
 #include "rive/audio/audio_sound.hpp"
 #include "rive/audio/audio_reader.hpp"
+#include "rive/audio/decoded_audio_cache.hpp"
 #include "rive/audio_event.hpp"
 #include "rive/assets/audio_asset.hpp"
 #include "rive_file_reader.hpp"
@@ -11,7 +13,17 @@
 #ifdef WITH_RIVE_SCRIPTING_LUAU
 #include "rive/lua/rive_lua_libs.hpp"
 #endif
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <limits>
 #include <string>
+#include <thread>
+#include <utility>
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
 
 using namespace rive;
 
@@ -322,4 +334,296 @@ TEST_CASE("audio source duration mp3", "[audio]")
 }
 #endif
 
+TEST_CASE("decoded audio cache evicts least recently used clips", "[audio]")
+{
+    auto clip = [](size_t frames) {
+        return make_rcp<DecodedAudio>(std::vector<float>(frames * 2), 2);
+    };
+    // Room for two 1024 frame stereo clips.
+    DecodedAudioCache cache(2 * 1024 * 2 * sizeof(float));
+    cache.insert(1, clip(1024));
+    cache.insert(2, clip(1024));
+    REQUIRE(cache.count() == 2);
+    auto held = cache.find(2);
+    REQUIRE(cache.find(1) != nullptr); // 2 is now least recently used.
+
+    cache.insert(3, clip(1024));
+    REQUIRE(cache.count() == 2);
+    REQUIRE(cache.find(2) == nullptr);
+    REQUIRE(cache.find(1) != nullptr);
+    REQUIRE(cache.find(3) != nullptr);
+    // An evicted clip stays valid for whoever still holds it.
+    REQUIRE(held->lengthInFrames() == 1024);
+
+    // A clip bigger than the whole budget is not cached.
+    cache.insert(4, clip(4096));
+    REQUIRE(cache.find(4) == nullptr);
+    REQUIRE(cache.count() == 2);
+
+    cache.budget(1024 * 2 * sizeof(float));
+    REQUIRE(cache.count() == 1);
+    REQUIRE(cache.sizeInBytes() == 1024 * 2 * sizeof(float));
+    REQUIRE(cache.hits() == 4);
+    REQUIRE(cache.misses() == 2);
+}
+
+TEST_CASE("short clips decode once per engine", "[audio]")
+{
+    rcp<AudioEngine> engine = AudioEngine::Make(2, 44100);
+    auto file = loadFile("assets/audio/what.wav");
+    rcp<AudioSource> audioSource =
+        AudioSource::MakeAudioSource(Span<uint8_t>(file));
+    REQUIRE(audioSource != nullptr);
+    REQUIRE(audioSource->lengthInFrames() == 9688);
+
+    auto first = engine->play(audioSource, 0, 0, 0);
+    auto second = engine->play(audioSource, 0, 0, 0);
+    REQUIRE(first != nullptr);
+    REQUIRE(second != nullptr);
+    REQUIRE(engine->decodedCache().misses() == 1);
+    REQUIRE(engine->decodedCache().hits() == 1);
+    REQUIRE(engine->decodedCache().sizeInBytes() == 9688 * 2 * sizeof(float));
+    REQUIRE(engine->streamingSoundCount() == 0);
+}
+
+// Renders a sound of what.wav through an engine that either decodes it up
+// front or streams it, optionally clipped to endTime frames.
+static std::vector<float> renderWhat(size_t clipLimit,
+                                     uint64_t endTime,
+                                     bool* completed)
+{
+    rcp<AudioEngine> engine = AudioEngine::Make(2, 44100);
+    engine->decodedClipLimit(clipLimit);
+    auto file = loadFile("assets/audio/what.wav");
+    rcp<AudioSource> audioSource =
+        AudioSource::MakeAudioSource(Span<uint8_t>(file));
+    auto sound = engine->play(audioSource, 0, endTime, 0);
+    REQUIRE(sound != nullptr);
+    REQUIRE(engine->streamingSoundCount() == (clipLimit == 0 ? 1 : 0));
+
+    std::vector<float> frames(12000 * 2);
+    for (size_t offset = 0; offset < frames.size(); offset += 1000 * 2)
+    {
+        engine->readAudioFrames(frames.data() + offset, 1000);
+    }
+    *completed = sound->completed();
+    return frames;
+}
+
+TEST_CASE("streamed clips play like decoded clips", "[audio]")
+{
+    bool decodedCompleted = false;
+    bool streamedCompleted = false;
+    auto decoded = renderWhat(AudioEngine::defaultDecodedClipLimit,
+                              0,
+                              &decodedCompleted);
+    auto streamed = renderWhat(0, 0, &streamedCompleted);
+    REQUIRE(decodedCompleted);
+    REQUIRE(streamedCompleted);
+    REQUIRE(streamed == decoded);
+    REQUIRE(std::any_of(decoded.begin(), decoded.end(), [](float sample) {
+        return sample != 0.0f;
+    }));
+}
+
+TEST_CASE("clips end at their end time", "[audio]")
+{
+    for (size_t clipLimit : {AudioEngine::defaultDecodedClipLimit, size_t(0)})
+    {
+        bool completed = false;
+        auto frames = renderWhat(clipLimit, 2000, &completed);
+        REQUIRE(completed);
+        REQUIRE(std::all_of(frames.begin() + 2000 * 2,
+                            frames.end(),
+                            [](float sample) { return sample == 0.0f; }));
+    }
+}
+
+// A 16 bit PCM wav of a sine tone, long enough to stand in for a music track.
+static std::vector<uint8_t> makeToneWav(uint32_t sampleRate, float seconds)
+{
+    const uint32_t channels = 2;
+    const uint32_t frames = (uint32_t)(sampleRate * seconds);
+    const uint32_t dataBytes = frames * channels * 2;
+    std::vector<uint8_t> wav;
+    auto put = [&wav](uint32_t value, int bytes) {
+        for (int i = 0; i < bytes; i++)
+        {
+            wav.push_back((uint8_t)(value >> (i * 8)));
+        }
+    };
+    wav.insert(wav.end(), {'R', 'I', 'F', 'F'});
+    put(36 + dataBytes, 4);
+    wav.insert(wav.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    put(16, 4);
+    put(1, 2); // PCM
+    put(channels, 2);
+    put(sampleRate, 4);
+    put(sampleRate * channels * 2, 4);
+    put(channels * 2, 2);
+    put(16, 2);
+    wav.insert(wav.end(), {'d', 'a', 't', 'a'});
+    put(dataBytes, 4);
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        auto sample = (int16_t)(8000.0f * sinf(i * 0.05f));
+        put((uint16_t)sample, 2);
+        put((uint16_t)sample, 2);
+    }
+    return wav;
+}
+
+TEST_CASE("streamed clips longer than the ring play and seek like decoded "
+          "clips",
+          "[audio]")
+{
+    // A second at the engine's rate, so nothing resamples, is several times
+    // what a stream's ring holds; the filler thread has to keep refilling it.
+    const uint32_t sampleRate = 44100;
+    const uint64_t ringFrames =
+        (uint64_t)AudioStream::kBlockCount * AudioStream::kBlockFrames;
+    auto tone = makeToneWav(sampleRate, 1.0f);
+    const uint64_t seekFrame = 30000;
+    const size_t chunkFrames = 512;
+
+    // Plays the first 20000 frames, seeks, then plays 8000 more.
+    auto render = [&](size_t clipLimit) {
+        rcp<AudioEngine> engine = AudioEngine::Make(2, sampleRate);
+        engine->decodedClipLimit(clipLimit);
+        rcp<AudioSource> source =
+            AudioSource::MakeAudioSource(Span<uint8_t>(tone));
+        REQUIRE(source->lengthInFrames() > ringFrames * 2);
+        auto sound = engine->play(source, 0, 0, 0);
+        REQUIRE(sound != nullptr);
+        AudioStream* stream = sound->stream();
+        REQUIRE((stream != nullptr) == (clipLimit == 0));
+        // Give the filler a moment to get a read's worth of blocks ahead.
+        auto waitForFiller = [stream]() {
+            for (int i = 0; stream != nullptr && i < 50; i++)
+            {
+                if (stream->bufferedBlocks() >= 2)
+                {
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        };
+        std::vector<float> before(20000 * 2);
+        for (size_t offset = 0; offset < before.size();
+             offset += chunkFrames * 2)
+        {
+            waitForFiller();
+            size_t frames =
+                std::min(chunkFrames, (before.size() - offset) / 2);
+            engine->readAudioFrames(before.data() + offset, frames);
+        }
+        sound->seek(seekFrame);
+        std::vector<float> after(8000 * 2);
+        for (size_t offset = 0; offset < after.size();
+             offset += chunkFrames * 2)
+        {
+            waitForFiller();
+            size_t frames = std::min(chunkFrames, (after.size() - offset) / 2);
+            engine->readAudioFrames(after.data() + offset, frames);
+        }
+        if (stream != nullptr)
+        {
+            // Only the reads right after the seek may find the ring empty.
+            CHECK(stream->underruns() <= 2);
+        }
+        return std::make_pair(before, after);
+    };
+
+    auto decoded = render(AudioEngine::defaultDecodedClipLimit);
+    auto streamed = render(0);
+    REQUIRE(streamed.first == decoded.first);
+
+    // A seek throws away what the ring held and the stream plays silence
+    // until the filler decodes from the new position, which delays rather
+    // than drops audio.
+    auto& after = streamed.second;
+    auto audible = std::find_if(after.begin(), after.end(), [](float sample) {
+        return sample != 0.0f;
+    });
+    size_t silentSamples = audible - after.begin();
+    CHECK(silentSamples % 2 == 0);
+    CHECK(silentSamples <= chunkFrames * 2 * 2);
+    REQUIRE(std::equal(audible, after.end(), decoded.second.begin()));
+    REQUIRE(decoded.second[0] != 0.0f);
+}
+
+static double cpuSeconds() { return (double)clock() / CLOCKS_PER_SEC; }
+
+static double peakRssMB()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+    return usage.ru_maxrss / 1024.0;
+#endif
+#else
+    return 0;
+#endif
+}
+
+// CPU for 100 overlapping triggers of a short effect, and peak RSS for a five
+// minute track, each with the clip decoded up front and streamed. The engine
+// runs without a device, reading frames the way a null device would. Emits
+// rows in the measure format; nothing asserts on a threshold.
+//
+// Hidden tag; run explicitly with test.sh -m "[audio_measure]".
+TEST_CASE("audio decode measure", "[.][audio_measure]")
+{
+    auto row = [](const char* phase, const char* metric, double value) {
+        printf("MEASURE,audio,%s,%s,%.6f\n", phase, metric, value);
+    };
+    const uint32_t sampleRate = 48000;
+    std::vector<float> frames(512 * 2);
+
+    auto effect = makeToneWav(sampleRate, 0.25f);
+    for (size_t clipLimit : {AudioEngine::defaultDecodedClipLimit, size_t(0)})
+    {
+        const char* phase = clipLimit == 0 ? "sfx_streamed" : "sfx_decoded";
+        rcp<AudioEngine> engine = AudioEngine::Make(2, sampleRate);
+        engine->decodedClipLimit(clipLimit);
+        rcp<AudioSource> source =
+            AudioSource::MakeAudioSource(Span<uint8_t>(effect));
+        double start = cpuSeconds();
+        for (int i = 0; i < 100; i++)
+        {
+            engine->play(source, 0, 0, 0);
+            engine->readAudioFrames(frames.data(), 512);
+        }
+        // Play the tails out.
+        for (int i = 0; i < 30; i++)
+        {
+            engine->readAudioFrames(frames.data(), 512);
+        }
+        row(phase, "cpu_ms", (cpuSeconds() - start) * 1000.0);
+    }
+
+    // Streamed first: peak RSS only ever grows, so the decoded run has to
+    // come second to show up.
+    auto track = makeToneWav(sampleRate, 300.0f);
+    for (size_t clipLimit : {size_t(0), std::numeric_limits<size_t>::max()})
+    {
+        const char* phase = clipLimit == 0 ? "track_streamed" : "track_decoded";
+        double before = peakRssMB();
+        rcp<AudioEngine> engine = AudioEngine::Make(2, sampleRate);
+        engine->decodedClipLimit(clipLimit);
+        engine->decodedCacheBudget(clipLimit);
+        rcp<AudioSource> source =
+            AudioSource::MakeAudioSource(Span<uint8_t>(track));
+        auto sound = engine->play(source, 0, 0, 0);
+        for (int i = 0; i < 500; i++)
+        {
+            engine->readAudioFrames(frames.data(), 512);
+        }
+        row(phase, "peak_rss_growth_mb", peakRssMB() - before);
+    }
+}
+
 // TODO check if sound->stop calls completed callback!!!
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/async/work_pool.hpp>
+#include <rive/batch_advancer.hpp>
+#include <rive/file.hpp>
+#include <rive/transform_component.hpp>
+#include "rive_file_reader.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace rive;
+
+static void requireSameWorldState(ArtboardInstance* a, ArtboardInstance* b)
+{
+    REQUIRE(a->objects().size() == b->objects().size());
+    for (size_t i = 0; i < a->objects().size(); ++i)
+    {
+        Core* objA = a->objects()[i];
+        Core* objB = b->objects()[i];
+        if (objA == nullptr || !objA->is<TransformComponent>())
+        {
+            continue;
+        }
+        auto transformA = objA->as<TransformComponent>();
+        auto transformB = objB->as<TransformComponent>();
+        for (int j = 0; j < 6; ++j)
+        {
+            CHECK(transformA->worldTransform()[j] ==
+                  transformB->worldTransform()[j]);
+        }
+        CHECK(transformA->renderOpacity() == transformB->renderOpacity());
+    }
+}
+
+TEST_CASE("batch advanced scenes match serially advanced ones",
+          "[batch_advancer]")
+{
+    auto file = ReadRiveFile("assets/bullet_man.riv");
+    constexpr static size_t kInstanceCount = 64;
+
+    std::vector<std::unique_ptr<ArtboardInstance>> serialArtboards;
+    std::vector<std::unique_ptr<StateMachineInstance>> serialMachines;
+    std::vector<std::unique_ptr<ArtboardInstance>> batchArtboards;
+    std::vector<std::unique_ptr<StateMachineInstance>> batchMachines;
+    std::vector<Scene*> batchScenes;
+    for (size_t i = 0; i < kInstanceCount; ++i)
+    {
+        serialArtboards.push_back(file->artboard("Bullet Man")->instance());
+        serialMachines.push_back(serialArtboards.back()->stateMachineAt(0));
+        batchArtboards.push_back(file->artboard("Bullet Man")->instance());
+        batchMachines.push_back(batchArtboards.back()->stateMachineAt(0));
+        batchScenes.push_back(batchMachines.back().get());
+    }
+
+    // Stagger the instances so each one is at a different point in its
+    // animation, and a batch that mixed them up would show it.
+    for (size_t i = 0; i < kInstanceCount; ++i)
+    {
+        serialMachines[i]->advanceAndApply(i / 60.0f);
+        batchMachines[i]->advanceAndApply(i / 60.0f);
+    }
+
+    BatchAdvancer advancer(4);
+    // Capped at the global WorkPool's workers, plus the calling thread.
+    CHECK(advancer.threadCount() ==
+          std::min(4u, getGlobalWorkPool()->threadCount() + 1));
+    std::vector<char> serialKeepGoing(kInstanceCount);
+    bool batchKeepGoing[kInstanceCount];
+    for (int frame = 0; frame < 30; ++frame)
+    {
+        for (size_t i = 0; i < kInstanceCount; ++i)
+        {
+            serialKeepGoing[i] = serialMachines[i]->advanceAndApply(1 / 60.0f);
+        }
+        advancer.advance(batchScenes, 1 / 60.0f, batchKeepGoing);
+        for (size_t i = 0; i < kInstanceCount; ++i)
+        {
+            CHECK(static_cast<bool>(serialKeepGoing[i]) == batchKeepGoing[i]);
+            requireSameWorldState(serialArtboards[i].get(),
+                                  batchArtboards[i].get());
+        }
+    }
+}
+
+TEST_CASE("batch advanced artboards match serially advanced ones",
+          "[batch_advancer]")
+{
+    auto file = ReadRiveFile("assets/bullet_man.riv");
+    constexpr static size_t kInstanceCount = 32;
+
+    std::vector<std::unique_ptr<ArtboardInstance>> serialArtboards;
+    std::vector<std::unique_ptr<ArtboardInstance>> batchArtboards;
+    std::vector<ArtboardInstance*> batch;
+    for (size_t i = 0; i < kInstanceCount; ++i)
+    {
+        serialArtboards.push_back(file->artboard("Bullet Man")->instance());
+        batchArtboards.push_back(file->artboard("Bullet Man")->instance());
+        batch.push_back(batchArtboards.back().get());
+    }
+
+    BatchAdvancer advancer(3);
+    bool anySerialUpdate = false;
+    for (auto& artboard : serialArtboards)
+    {
+        anySerialUpdate |= artboard->advance(0.0f);
+    }
+    CHECK(advancer.advance(batch, 0.0f) == anySerialUpdate);
+    for (size_t i = 0; i < kInstanceCount; ++i)
+    {
+        requireSameWorldState(serialArtboards[i].get(),
+                              batchArtboards[i].get());
+    }
+}
+
+TEST_CASE("batch advancer only marks threads while advancing",
+          "[batch_advancer]")
+{
+    CHECK(!BatchAdvancer::isAdvancingThread());
+    BatchAdvancer single(1);
+    CHECK(single.threadCount() == 1);
+    CHECK(!single.advance(Span<Scene* const>(), 0.0f));
+    CHECK(!BatchAdvancer::isAdvancingThread());
+}
@@ -1,12 +1,16 @@
+#include <rive/bones/bone.hpp>
+#include <rive/bones/cubic_weight.hpp>
 #include <rive/bones/skin.hpp>
 #include <rive/bones/tendon.hpp>
 #include <rive/file.hpp>
 #include <rive/node.hpp>
 #include <rive/shapes/clipping_shape.hpp>
+#include <rive/shapes/cubic_vertex.hpp>
 #include <rive/shapes/path_vertex.hpp>
 #include <rive/shapes/points_path.hpp>
 #include <rive/shapes/rectangle.hpp>
 #include <rive/shapes/shape.hpp>
+#include <rive/shapes/straight_vertex.hpp>
 #include "utils/no_op_factory.hpp"
 #include "rive_file_reader.hpp"
 #include <catch.hpp>
@@ -35,3 +39,104 @@ TEST_CASE("bound bones load correctly", "[bones]")
 
     // Ok seems like bones are set up ok.
 }
+
+TEST_CASE("skinned vertices match per vertex weight deform", "[bones]")
+{
+    auto file = ReadRiveFile("assets/off_road_car.riv");
+    auto artboard = file->artboardDefault();
+    auto node = artboard->find("transmission_front_testing");
+    REQUIRE(node != nullptr);
+    auto path = node->as<rive::Shape>()->paths()[0];
+    auto skin = path->as<rive::PointsPath>()->skin();
+    REQUIRE(skin != nullptr);
+
+    // Move the bones off their bind pose so the deform does something.
+    for (auto tendon : skin->tendons())
+    {
+        auto bone = tendon->bone();
+        bone->rotation(bone->rotation() + 0.5f);
+        bone->scaleX(bone->scaleX() * 1.5f);
+    }
+    artboard->advance(0.0f);
+
+    rive::Mat2D world(skin->xx(),
+                      skin->xy(),
+                      skin->yx(),
+                      skin->yy(),
+                      skin->tx(),
+                      skin->ty());
+    std::vector<float> boneTransforms = {1, 0, 0, 1, 0, 0};
+    for (auto tendon : skin->tendons())
+    {
+        auto bone = tendon->bone()->worldTransform() * tendon->inverseBind();
+        boneTransforms.insert(boneTransforms.end(),
+                              bone.values(),
+                              bone.values() + 6);
+    }
+
+    auto requireNear = [](rive::Vec2D a, rive::Vec2D b) {
+        CHECK(a.x == Approx(b.x).margin(1e-3));
+        CHECK(a.y == Approx(b.y).margin(1e-3));
+    };
+    for (auto vertex : path->vertices())
+    {
+        auto weight = vertex->weight();
+        requireNear(weight->translation(),
+                    rive::Weight::deform(rive::Vec2D(vertex->x(), vertex->y()),
+                                         weight->indices(),
+                                         weight->values(),
+                                         world,
+                                         boneTransforms.data()));
+        if (vertex->is<rive::CubicVertex>())
+        {
+            auto cubic = vertex->as<rive::CubicVertex>();
+            auto cubicWeight = weight->as<rive::CubicWeight>();
+            requireNear(cubicWeight->inTranslation(),
+                        rive::Weight::deform(cubic->inPoint(),
+                                             cubicWeight->inIndices(),
+                                             cubicWeight->inValues(),
+                                             world,
+                                             boneTransforms.data()));
+            requireNear(cubicWeight->outTranslation(),
+                        rive::Weight::deform(cubic->outPoint(),
+                                             cubicWeight->outIndices(),
+                                             cubicWeight->outValues(),
+                                             world,
+                                             boneTransforms.data()));
+        }
+    }
+}
+
+TEST_CASE("skin gathers its vertices again when they change", "[bones]")
+{
+    // Outlives the artboard, whose path points at it.
+    rive::StraightVertex replacement;
+
+    auto file = ReadRiveFile("assets/off_road_car.riv");
+    auto artboard = file->artboardDefault();
+    auto node = artboard->find("transmission_front_testing");
+    REQUIRE(node != nullptr);
+    auto path = node->as<rive::Shape>()->paths()[0];
+    auto skin = path->as<rive::PointsPath>()->skin();
+    REQUIRE(skin != nullptr);
+    artboard->advance(0.0f);
+
+    // Swap the last vertex for another one. The vertex list keeps its buffer
+    // and size, but the removed vertex must no longer be skinned.
+    auto removed = path->vertices().back();
+    REQUIRE(removed->hasWeight());
+    rive::Vec2D removedTranslation = removed->weight()->translation();
+    path->popVertex();
+    path->addVertex(&replacement);
+
+    for (auto tendon : skin->tendons())
+    {
+        auto bone = tendon->bone();
+        bone->rotation(bone->rotation() + 0.5f);
+    }
+    artboard->advance(0.0f);
+    CHECK(removed->weight()->translation() == removedTranslation);
+
+    path->popVertex();
+    path->addVertex(removed);
+}
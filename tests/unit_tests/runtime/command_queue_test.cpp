@@ -211,6 +211,83 @@ TEST_CASE("artboard management", "[CommandQueue]")
     serverThread.join();
 }
 
+TEST_CASE("artboard management -- spsc ring transport", "[CommandQueue]")
+{
+    auto commandQueue =
+        make_rcp<CommandQueue>(CommandQueue::Transport::spscRing);
+    CHECK(commandQueue->transport() == CommandQueue::Transport::spscRing);
+    std::thread serverThread(server_thread, commandQueue);
+
+    std::ifstream stream("assets/two_artboards.riv", std::ios::binary);
+    FileHandle fileHandle = commandQueue->loadFile(
+        std::vector<uint8_t>(std::istreambuf_iterator<char>(stream), {}));
+
+    // Commands recorded in a batch are published together.
+    commandQueue->beginBatch();
+    ArtboardHandle artboardHandle1 =
+        commandQueue->instantiateArtboardNamed(fileHandle, "One");
+    ArtboardHandle artboardHandle2 =
+        commandQueue->instantiateArtboardNamed(fileHandle, "Two");
+    commandQueue->beginBatch();
+    commandQueue->setArtboardSize(artboardHandle1, 100, 200);
+    commandQueue->endBatch();
+    commandQueue->deleteArtboard(artboardHandle2);
+    commandQueue->endBatch();
+
+    commandQueue->runOnce([artboardHandle1,
+                           artboardHandle2](CommandServer* server) {
+        auto artboard = server->getArtboardInstance(artboardHandle1);
+        REQUIRE(artboard != nullptr);
+        CHECK(artboard->width() == 100);
+        CHECK(artboard->height() == 200);
+        CHECK(server->getArtboardInstance(artboardHandle2) == nullptr);
+    });
+
+    commandQueue->deleteFile(fileHandle);
+    commandQueue->runOnce([fileHandle, artboardHandle1](CommandServer* server) {
+        CHECK(server->getFile(fileHandle) == nullptr);
+        CHECK(server->getArtboardInstance(artboardHandle1) == nullptr);
+    });
+
+    wait_for_server(commandQueue.get());
+    commandQueue->disconnect();
+    serverThread.join();
+}
+
+TEST_CASE("spsc ring transport -- full ring", "[CommandQueue]")
+{
+    auto commandQueue =
+        make_rcp<CommandQueue>(CommandQueue::Transport::spscRing);
+
+    // Nobody is draining the ring yet, so it fills up and the rest of the
+    // commands have to wait client-side.
+    std::vector<int> order;
+    constexpr static int N = 1000;
+    for (int i = 0; i < N; ++i)
+    {
+        commandQueue->runOnce([i, &order](CommandServer*) {
+            order.push_back(i);
+        });
+    }
+    CHECK(!commandQueue->publishCommands());
+
+    std::thread serverThread(server_thread, commandQueue);
+    while (!commandQueue->publishCommands())
+    {
+        std::this_thread::yield();
+    }
+    wait_for_server(commandQueue.get());
+
+    REQUIRE(order.size() == N);
+    for (int i = 0; i < N; ++i)
+    {
+        CHECK(order[i] == i);
+    }
+
+    commandQueue->disconnect();
+    serverThread.join();
+}
+
 TEST_CASE("state machine management", "[CommandQueue]")
 {
     auto commandQueue = make_rcp<CommandQueue>();
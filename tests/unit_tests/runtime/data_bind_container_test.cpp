@@ -1,9 +1,13 @@
 #include <catch.hpp>
 #include <functional>
+#include <type_traits>
+#include <vector>
 #include "rive/component_dirt.hpp"
 #include "rive/data_bind/data_bind.hpp"
 #include "rive/data_bind/data_bind_container.hpp"
 #include "rive/data_bind_flags.hpp"
+#include "rive/viewmodel/viewmodel_instance.hpp"
+#include "rive/viewmodel/viewmodel_instance_number.hpp"
 
 using namespace rive;
 
@@ -13,7 +17,9 @@ namespace
 class TestContainer : public DataBindContainer
 {
 public:
+    using DataBindContainer::advanceDataBinds;
     using DataBindContainer::deleteDataBinds;
+    using DataBindContainer::sortDataBinds;
 };
 
 class TestDataBind : public DataBind
@@ -374,3 +380,120 @@ TEST_CASE("addDirt latches a single change origin", "[data_bind_container]")
     CHECK(favorSource->targetOrigin() == false);
     delete favorSource;
 }
+
+TEST_CASE("removeDataBind keeps the order of the remaining binds",
+          "[data_bind_container]")
+{
+    TestContainer c;
+    std::vector<TestDataBind*> binds;
+    for (int i = 0; i < 8; i++)
+    {
+        binds.push_back(makeBind(i % 2 ? DataBindFlags::ToSource
+                                       : DataBindFlags::ToTarget));
+        c.addDataBind(binds.back());
+    }
+    for (int i : {0, 3, 4, 7})
+    {
+        binds[i]->dirt(ComponentDirt::Bindings);
+        c.addDirtyDataBind(binds[i]);
+    }
+
+    c.removeDataBind(binds[2]);
+    c.removeDataBind(binds[3]);
+    c.removeDataBind(binds[7]);
+    // Removing twice is harmless.
+    c.removeDataBind(binds[7]);
+    CHECK(binds[3]->inDirtyList() == false);
+    CHECK(binds[3]->inPersistingList() == false);
+    std::vector<DataBind*> expected = {binds[0],
+                                       binds[1],
+                                       binds[4],
+                                       binds[5],
+                                       binds[6]};
+    CHECK(c.dataBinds() == expected);
+
+    // Removed binds are skipped by the next update, the rest still run.
+    c.updateDataBinds();
+    CHECK(binds[0]->updateCalls == 1);
+    CHECK(binds[4]->updateCalls == 1);
+    CHECK(binds[3]->updateCalls == 0);
+    CHECK(binds[7]->updateCalls == 0);
+    CHECK(binds[2]->updateCalls == 0);
+
+    // Adding after removing lands at the end, and binds removed after the
+    // list was compacted are found at their new slots.
+    c.advanceDataBinds(0.0f);
+    c.addDataBind(binds[2]);
+    c.removeDataBind(binds[5]);
+    c.removeDataBind(binds[0]);
+    expected = {binds[1], binds[4], binds[6], binds[2]};
+    CHECK(c.dataBinds() == expected);
+
+    // Sorting puts toSource binds first, and they can still be removed.
+    c.sortDataBinds();
+    c.removeDataBind(binds[1]);
+    expected = {binds[4], binds[6], binds[2]};
+    CHECK(c.dataBinds() == expected);
+
+    c.deleteDataBinds();
+    for (int i : {0, 1, 3, 5, 7})
+    {
+        delete binds[i];
+    }
+}
+
+// A copied transaction would commit twice, and an implicit one would open on
+// any ViewModelInstance* passed where a transaction is expected.
+static_assert(!std::is_copy_constructible<ViewModelTransaction>::value, "");
+static_assert(!std::is_copy_assignable<ViewModelTransaction>::value, "");
+static_assert(!std::is_convertible<ViewModelInstance*,
+                                   ViewModelTransaction>::value,
+              "");
+
+TEST_CASE("view model transactions mark each bind once on commit",
+          "[data_bind_container]")
+{
+    TestContainer c;
+    auto instance = make_rcp<ViewModelInstance>();
+    auto* a = new ViewModelInstanceNumber();
+    auto* b = new ViewModelInstanceNumber();
+    instance->addValue(a);
+    instance->addValue(b);
+    auto* bindA = makeBind();
+    auto* bindB = makeBind();
+    c.addDataBind(bindA);
+    c.addDataBind(bindB);
+    a->addDependent(bindA);
+    b->addDependent(bindB);
+
+    instance->beginTransaction();
+    for (int i = 1; i <= 10; i++)
+    {
+        a->propertyValue((float)i);
+    }
+    {
+        // Nested transactions don't flush.
+        ViewModelTransaction nested(instance.get());
+        b->propertyValue(3.0f);
+    }
+    // Values change right away, but binds don't hear about it yet.
+    CHECK(a->propertyValue() == 10.0f);
+    CHECK(bindA->inDirtyList() == false);
+    CHECK(bindB->inDirtyList() == false);
+
+    instance->commitTransaction();
+    CHECK(instance->inTransaction() == false);
+    CHECK(bindA->inDirtyList() == true);
+    CHECK(bindB->inDirtyList() == true);
+    c.updateDataBinds();
+    CHECK(bindA->updateCalls == 1);
+    CHECK(bindB->updateCalls == 1);
+
+    // Outside of a transaction dirt goes through immediately.
+    a->propertyValue(11.0f);
+    CHECK(bindA->inDirtyList() == true);
+
+    a->removeDependent(bindA);
+    b->removeDependent(bindB);
+    c.deleteDataBinds();
+}
@@ -2,6 +2,16 @@
 #include "rive/animation/linear_animation.hpp"
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/animation/state_machine_instance.hpp"
+#include "rive/animation/arithmetic_operation.hpp"
+#include "rive/data_bind/converters/data_converter_formula.hpp"
+#include "rive/data_bind/converters/formula/formula_token_argument_separator.hpp"
+#include "rive/data_bind/converters/formula/formula_token_function.hpp"
+#include "rive/data_bind/converters/formula/formula_token_input.hpp"
+#include "rive/data_bind/converters/formula/formula_token_operation.hpp"
+#include "rive/data_bind/converters/formula/formula_token_parenthesis_close.hpp"
+#include "rive/data_bind/converters/formula/formula_token_parenthesis_open.hpp"
+#include "rive/data_bind/converters/formula/formula_token_value.hpp"
+#include "rive/function_type.hpp"
 #include "rive/viewmodel/viewmodel.hpp"
 #include "rive/viewmodel/viewmodel_instance_color.hpp"
 #include "rive/viewmodel/viewmodel_instance_number.hpp"
@@ -197,4 +207,137 @@ TEST_CASE("Interpolations that change duration to zero work correctly",
     }
 
     CHECK(silver.matches("interpolation_zero_duration"));
-}
\ No newline at end of file
+}
+
+namespace
+{
+// Builds formula tokens the way the importer hands them to the converter.
+struct FormulaBuilder
+{
+    std::unique_ptr<DataConverterFormula> formula =
+        std::make_unique<DataConverterFormula>();
+
+    FormulaBuilder& value(float v)
+    {
+        auto token = new FormulaTokenValue();
+        token->operationValue(v);
+        formula->addToken(token);
+        return *this;
+    }
+    FormulaBuilder& input()
+    {
+        formula->addToken(new FormulaTokenInput());
+        return *this;
+    }
+    FormulaBuilder& op(ArithmeticOperation operation)
+    {
+        auto token = new FormulaTokenOperation();
+        token->operationType((uint32_t)operation);
+        formula->addToken(token);
+        return *this;
+    }
+    FormulaBuilder& function(FunctionType function)
+    {
+        auto token = new FormulaTokenFunction();
+        token->functionType((uint32_t)function);
+        formula->addToken(token);
+        return *this;
+    }
+    FormulaBuilder& open()
+    {
+        formula->addToken(new FormulaTokenParenthesisOpen());
+        return *this;
+    }
+    FormulaBuilder& close()
+    {
+        formula->addToken(new FormulaTokenParenthesisClose());
+        return *this;
+    }
+    FormulaBuilder& separator()
+    {
+        formula->addToken(new FormulaTokenArgumentSeparator());
+        return *this;
+    }
+
+    float convert(float input)
+    {
+        DataConverter* converter = formula.get();
+        DataValueNumber value(input);
+        return converter->convert(&value, nullptr)
+            ->as<DataValueNumber>()
+            ->value();
+    }
+};
+} // namespace
+
+TEST_CASE("formula converter evaluates compiled formulas", "[data binding]")
+{
+    // input * (2 + 3) - max(input, 4, 1)
+    FormulaBuilder formula;
+    formula.input()
+        .op(ArithmeticOperation::multiply)
+        .open()
+        .value(2)
+        .op(ArithmeticOperation::add)
+        .value(3)
+        .close()
+        .op(ArithmeticOperation::subtract)
+        .function(FunctionType::max)
+        .input()
+        .separator()
+        .value(4)
+        .separator()
+        .value(1)
+        .close();
+    formula.formula->calculateFormula();
+    CHECK(formula.convert(2) == 6);
+    CHECK(formula.convert(10) == 40);
+    CHECK(formula.convert(-1) == -9);
+
+    // pow(2, 3) + sqrt(16) folds entirely to a constant.
+    FormulaBuilder constant;
+    constant.function(FunctionType::pow)
+        .value(2)
+        .separator()
+        .value(3)
+        .close()
+        .op(ArithmeticOperation::add)
+        .function(FunctionType::sqrt)
+        .value(16)
+        .close();
+    constant.formula->calculateFormula();
+    CHECK(constant.convert(0) == 12);
+    CHECK(constant.convert(5) == 12);
+
+    // Malformed formulas leave the input unchanged.
+    FormulaBuilder malformed;
+    malformed.value(1).value(2);
+    malformed.formula->calculateFormula();
+    CHECK(malformed.convert(7) == 7);
+
+    // A dangling operation is skipped.
+    FormulaBuilder dangling;
+    dangling.op(ArithmeticOperation::add).input();
+    dangling.formula->calculateFormula();
+    CHECK(dangling.convert(3) == 3);
+}
+
+TEST_CASE("formula functions take more arguments than fit in a byte",
+          "[data binding]")
+{
+    // max(input, 0, 0, ..., 0) with 256 and 300 arguments; the input stays
+    // first so nothing folds and the function runs on the stack.
+    for (int argumentCount : {256, 300})
+    {
+        FormulaBuilder formula;
+        formula.function(FunctionType::max).input();
+        for (int i = 1; i < argumentCount; i++)
+        {
+            formula.separator().value(0);
+        }
+        formula.close().op(ArithmeticOperation::add).value(1);
+        formula.formula->calculateFormula();
+        CHECK(formula.convert(5) == 6);
+        CHECK(formula.convert(-3) == 1);
+    }
+}
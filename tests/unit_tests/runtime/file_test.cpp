@@ -13,6 +13,7 @@
 #include <catch.hpp>
 #include <cstdio>
 #include <cstring>
+#include <thread>
 
 TEST_CASE("transform order is as expected", "[transform]")
 {
@@ -320,3 +321,153 @@ TEST_CASE(
     CHECK(silver.matches("deterministic_mode"));
     rive::File::deterministicMode = false;
 }
+
+TEST_CASE("lazily imported file matches an eagerly imported one", "[file]")
+{
+    std::vector<uint8_t> bytes = ReadFile("assets/echo_show_demo.riv");
+    rive::ImportResult result;
+    auto eager =
+        rive::File::import(bytes, &gNoOpFactory, &result, /*loader=*/nullptr);
+    REQUIRE(result == rive::ImportResult::success);
+    auto lazy = rive::File::importLazy(bytes, &gNoOpFactory, &result);
+    REQUIRE(result == rive::ImportResult::success);
+    REQUIRE(lazy->artboardCount() == eager->artboardCount());
+
+    // Names are available without loading the artboards.
+    for (size_t i = 0; i < eager->artboardCount(); i++)
+    {
+        CHECK(lazy->artboardNameAt(i) == eager->artboardNameAt(i));
+        CHECK(!lazy->artboardLoaded(i));
+    }
+
+    for (size_t i = 0; i < eager->artboardCount(); i++)
+    {
+        auto eagerArtboard = eager->artboard(i);
+        auto lazyArtboard = lazy->artboard(i);
+        REQUIRE(lazyArtboard != nullptr);
+        CHECK(lazyArtboard->objects().size() ==
+              eagerArtboard->objects().size());
+        CHECK(lazyArtboard->animationCount() ==
+              eagerArtboard->animationCount());
+        CHECK(lazyArtboard->stateMachineCount() ==
+              eagerArtboard->stateMachineCount());
+        CHECK(lazyArtboard->nestedArtboards().size() ==
+              eagerArtboard->nestedArtboards().size());
+    }
+
+    auto eagerArtboard = eager->artboardDefault();
+    auto lazyArtboard = lazy->artboardDefault();
+    auto eagerMachine = eagerArtboard->defaultStateMachine();
+    auto lazyMachine = lazyArtboard->defaultStateMachine();
+    REQUIRE(eagerMachine != nullptr);
+    REQUIRE(lazyMachine != nullptr);
+    for (int frame = 0; frame < 10; frame++)
+    {
+        eagerMachine->advanceAndApply(0.016f);
+        lazyMachine->advanceAndApply(0.016f);
+    }
+    REQUIRE(lazyArtboard->objects().size() == eagerArtboard->objects().size());
+    for (size_t i = 0; i < eagerArtboard->objects().size(); i++)
+    {
+        auto eagerObject = eagerArtboard->objects()[i];
+        auto lazyObject = lazyArtboard->objects()[i];
+        if (eagerObject == nullptr || !eagerObject->is<rive::Node>())
+        {
+            continue;
+        }
+        REQUIRE(lazyObject->is<rive::Node>());
+        CHECK(lazyObject->as<rive::Node>()->worldTransform() ==
+              eagerObject->as<rive::Node>()->worldTransform());
+    }
+}
+
+TEST_CASE("lazily imported file loads an artboard on first use", "[file]")
+{
+    std::vector<uint8_t> bytes = ReadFile("assets/two_artboards.riv");
+    auto file = rive::File::importLazy(bytes, &gNoOpFactory);
+    REQUIRE(file != nullptr);
+    REQUIRE(file->artboardCount() == 2);
+
+    auto artboard = file->artboard("One");
+    REQUIRE(artboard != nullptr);
+    CHECK(artboard->objects().size() > 1);
+    // Later lookups return the same, already loaded, artboard.
+    CHECK(file->artboard("One") == artboard);
+    CHECK(file->artboard()->name() == "Two");
+}
+
+TEST_CASE("lazily imported artboards stay unloaded until requested", "[file]")
+{
+    std::vector<uint8_t> bytes = ReadFile("assets/two_artboards.riv");
+    auto file = rive::File::importLazy(bytes, &gNoOpFactory);
+    REQUIRE(file != nullptr);
+    REQUIRE(file->artboardCount() == 2);
+    size_t one = file->artboardNameAt(0) == "One" ? 0 : 1;
+    size_t two = 1 - one;
+    CHECK(!file->artboardLoaded(one));
+    CHECK(!file->artboardLoaded(two));
+
+    // Looking artboards up by name or view model doesn't load them.
+    CHECK(file->artboardNameAt(one) == "One");
+    file->artboardIndexForViewModel(0);
+    CHECK(!file->artboardLoaded(one));
+    CHECK(!file->artboardLoaded(two));
+
+    REQUIRE(file->artboard("One") != nullptr);
+    CHECK(file->artboardLoaded(one));
+    CHECK(!file->artboardLoaded(two));
+
+    // Eagerly imported files have every artboard loaded.
+    auto eager = rive::File::import(bytes, &gNoOpFactory);
+    REQUIRE(eager != nullptr);
+    CHECK(eager->artboardLoaded(one));
+    CHECK(eager->artboardLoaded(two));
+    CHECK(!eager->artboardLoaded(2));
+}
+
+TEST_CASE("lazily imported artboards load once across threads", "[file]")
+{
+    std::vector<uint8_t> bytes = ReadFile("assets/echo_show_demo.riv");
+    auto eager = rive::File::import(bytes, &gNoOpFactory);
+    auto lazy = rive::File::importLazy(bytes, &gNoOpFactory);
+    REQUIRE(eager != nullptr);
+    REQUIRE(lazy != nullptr);
+    size_t artboardCount = lazy->artboardCount();
+    // Every one of them is deferred, so the threads race to load them.
+    for (size_t i = 0; i < artboardCount; ++i)
+    {
+        REQUIRE(!lazy->artboardLoaded(i));
+    }
+
+    constexpr int kThreadCount = 4;
+    std::vector<std::vector<rive::Artboard*>> loaded(kThreadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            // Each thread starts at a different artboard, so they collide
+            // on artboards and on the ones those nest.
+            loaded[t].resize(artboardCount);
+            for (size_t i = 0; i < artboardCount; ++i)
+            {
+                size_t index = (i + t) % artboardCount;
+                loaded[t][index] = lazy->artboard(index);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < artboardCount; ++i)
+    {
+        REQUIRE(loaded[0][i] != nullptr);
+        for (int t = 1; t < kThreadCount; ++t)
+        {
+            CHECK(loaded[t][i] == loaded[0][i]);
+        }
+        CHECK(loaded[0][i]->objects().size() ==
+              eager->artboard(i)->objects().size());
+    }
+}
@@ -0,0 +1,289 @@
+#include "rive/text/fully_shaped_text.hpp"
+#include <catch.hpp>
+#include <cstring>
+#include <vector>
+
+using namespace rive;
+
+namespace
+{
+// Shapes each unichar to one glyph of the same id, starting a new paragraph
+// after each '\n' like the bidi algorithm does, and counts the paragraphs it
+// shaped.
+class ParagraphCountingFont : public Font
+{
+public:
+    ParagraphCountingFont() : Font({-0.8f, 0.2f}) {}
+
+    mutable int paragraphCount = 0;
+
+    uint16_t getAxisCount() const override { return 0; }
+    Axis getAxis(uint16_t) const override { return {}; }
+    float getAxisValue(uint32_t) const override { return 0; }
+    uint16_t getWeight() const override { return 400; }
+    bool isItalic() const override { return false; }
+    SimpleArray<uint32_t> features() const override { return {}; }
+    bool hasGlyph(const Unichar) const override { return true; }
+    uint32_t getFeatureValue(uint32_t) const override { return (uint32_t)-1; }
+    rcp<Font> withOptions(Span<const Coord>,
+                          Span<const Feature>) const override
+    {
+        return make_rcp<ParagraphCountingFont>();
+    }
+    RawPath getPath(GlyphID) const override { return RawPath(); }
+
+protected:
+    SimpleArray<Paragraph> onShapeText(Span<const Unichar> text,
+                                       Span<const TextRun> runs,
+                                       int) const override
+    {
+        const TextRun& run = runs[0];
+        std::vector<Paragraph> paragraphs;
+        uint32_t start = 0;
+        while (start < text.size())
+        {
+            uint32_t end = start;
+            while (end < text.size() && text[end++] != '\n')
+            {
+            }
+            GlyphRun glyphRun(end - start);
+            glyphRun.font = run.font;
+            glyphRun.size = run.size;
+            glyphRun.lineHeight = run.lineHeight;
+            glyphRun.letterSpacing = run.letterSpacing;
+            glyphRun.styleId = run.styleId;
+            glyphRun.level = 0;
+            float x = 0;
+            for (uint32_t i = start; i < end; ++i)
+            {
+                glyphRun.glyphs[i - start] = static_cast<GlyphID>(text[i]);
+                glyphRun.textIndices[i - start] = i;
+                glyphRun.advances[i - start] = run.size;
+                glyphRun.xpos[i - start] = x;
+                x += run.size;
+            }
+            glyphRun.xpos[end - start] = x;
+            SimpleArray<GlyphRun> glyphRuns(1);
+            glyphRuns[0] = std::move(glyphRun);
+            paragraphs.push_back({std::move(glyphRuns), 0});
+            ++paragraphCount;
+            start = end;
+        }
+        SimpleArray<Paragraph> result(paragraphs.size());
+        for (size_t i = 0; i < paragraphs.size(); ++i)
+        {
+            result[i] = std::move(paragraphs[i]);
+        }
+        return result;
+    }
+};
+
+std::vector<Unichar> unichars(const char* str)
+{
+    return std::vector<Unichar>(str, str + strlen(str));
+}
+
+struct Layout
+{
+    TextSizing sizing = TextSizing::fixed;
+    float maxWidth = 60.0f;
+    TextAlign align = TextAlign::center;
+};
+
+void reshape(FullyShapedText* shape,
+             std::vector<Unichar>& text,
+             const TextRun& run,
+             const Layout& layout = {})
+{
+    TextRun fullRun = run;
+    fullRun.unicharCount = (uint32_t)text.size();
+    shape->reshape(text,
+                   fullRun,
+                   layout.sizing,
+                   layout.maxWidth,
+                   1000.0f,
+                   layout.align,
+                   TextWrap::wrap,
+                   TextOrigin::top,
+                   TextOverflow::visible,
+                   2.0f);
+}
+
+// Checks that shape matches shaping all of text from scratch.
+void check_matches_full_shape(const FullyShapedText& shape,
+                              std::vector<Unichar>& text,
+                              const TextRun& run,
+                              const Layout& layout = {})
+{
+    TextRun fullRun = run;
+    fullRun.unicharCount = (uint32_t)text.size();
+    FullyShapedText expected;
+    expected.shape(text,
+                   Span<TextRun>(&fullRun, 1),
+                   layout.sizing,
+                   layout.maxWidth,
+                   1000.0f,
+                   layout.align,
+                   TextWrap::wrap,
+                   TextOrigin::top,
+                   TextOverflow::visible,
+                   2.0f);
+
+    REQUIRE(shape.paragraphs().size() == expected.paragraphs().size());
+    for (size_t i = 0; i < expected.paragraphs().size(); ++i)
+    {
+        const Paragraph& a = shape.paragraphs()[i];
+        const Paragraph& b = expected.paragraphs()[i];
+        REQUIRE(a.runs.size() == b.runs.size());
+        for (size_t j = 0; j < b.runs.size(); ++j)
+        {
+            const GlyphRun& ra = a.runs[j];
+            const GlyphRun& rb = b.runs[j];
+            CHECK(std::vector<GlyphID>(ra.glyphs.begin(), ra.glyphs.end()) ==
+                  std::vector<GlyphID>(rb.glyphs.begin(), rb.glyphs.end()));
+            CHECK(std::vector<uint32_t>(ra.textIndices.begin(),
+                                        ra.textIndices.end()) ==
+                  std::vector<uint32_t>(rb.textIndices.begin(),
+                                        rb.textIndices.end()));
+            CHECK(std::vector<uint32_t>(ra.breaks.begin(), ra.breaks.end()) ==
+                  std::vector<uint32_t>(rb.breaks.begin(), rb.breaks.end()));
+        }
+
+        const SimpleArray<GlyphLine>& la = shape.paragraphLines()[i];
+        const SimpleArray<GlyphLine>& lb = expected.paragraphLines()[i];
+        REQUIRE(la.size() == lb.size());
+        for (size_t j = 0; j < lb.size(); ++j)
+        {
+            CHECK(la[j] == lb[j]);
+            CHECK(la[j].startX == lb[j].startX);
+            CHECK(la[j].top == lb[j].top);
+            CHECK(la[j].baseline == lb[j].baseline);
+            CHECK(la[j].bottom == lb[j].bottom);
+        }
+    }
+    CHECK(shape.lineCount() == expected.lineCount());
+    CHECK(shape.bounds() == expected.bounds());
+    for (uint32_t i = 0; i <= text.size(); ++i)
+    {
+        CHECK(shape.glyphLookup()[i] == expected.glyphLookup()[i]);
+    }
+}
+} // namespace
+
+TEST_CASE("reshape only shapes edited paragraphs", "[text]")
+{
+    auto font = make_rcp<ParagraphCountingFont>();
+    TextRun run = {font, 10.0f, -1.0f, 0.0f, 0, 0, 0, 0};
+    auto text = unichars("one two three\nfour five\nsix seven eight nine\n"
+                         "ten\neleven twelve");
+    FullyShapedText shape;
+
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 5);
+    CHECK(font->paragraphCount == 5);
+    check_matches_full_shape(shape, text, run);
+
+    // Type into the third paragraph.
+    text.insert(text.begin() + 30, 'x');
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 1);
+    check_matches_full_shape(shape, text, run);
+
+    // Nothing changed.
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 0);
+    check_matches_full_shape(shape, text, run);
+
+    // Split the first paragraph in two, then join them back up.
+    text.insert(text.begin() + 4, '\n');
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 2);
+    check_matches_full_shape(shape, text, run);
+    text.erase(text.begin() + 4);
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 1);
+    check_matches_full_shape(shape, text, run);
+
+    // Edit the last paragraph, which has no '\n'.
+    text.push_back('!');
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 1);
+    check_matches_full_shape(shape, text, run);
+
+    // End the text with a '\n', then keep typing after it.
+    text.push_back('\n');
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 1);
+    check_matches_full_shape(shape, text, run);
+    text.push_back('z');
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 2);
+    check_matches_full_shape(shape, text, run);
+
+    // Delete across paragraphs.
+    text.erase(text.begin() + 8, text.begin() + 20);
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 1);
+    check_matches_full_shape(shape, text, run);
+
+    // Delete everything.
+    std::vector<Unichar> empty;
+    reshape(&shape, empty, run);
+    CHECK(shape.paragraphs().empty());
+    reshape(&shape, text, run);
+    check_matches_full_shape(shape, text, run);
+}
+
+TEST_CASE("reshape starts over when the run or width changes", "[text]")
+{
+    auto font = make_rcp<ParagraphCountingFont>();
+    TextRun run = {font, 10.0f, -1.0f, 0.0f, 0, 0, 0, 0};
+    auto text = unichars("one two three\nfour five\nsix seven eight nine");
+    FullyShapedText shape;
+    reshape(&shape, text, run);
+    CHECK(shape.reshapedParagraphCount() == 3);
+
+    // A new width re-breaks lines, but doesn't reshape.
+    Layout wider;
+    wider.maxWidth = 120.0f;
+    reshape(&shape, text, run, wider);
+    CHECK(shape.reshapedParagraphCount() == 0);
+    check_matches_full_shape(shape, text, run, wider);
+
+    // Auto width lines depend on the widest paragraph.
+    Layout autoWidth;
+    autoWidth.sizing = TextSizing::autoWidth;
+    reshape(&shape, text, run, autoWidth);
+    check_matches_full_shape(shape, text, run, autoWidth);
+    text.insert(text.begin() + 2, 'w');
+    reshape(&shape, text, run, autoWidth);
+    CHECK(shape.reshapedParagraphCount() == 1);
+    check_matches_full_shape(shape, text, run, autoWidth);
+
+    // A new size reshapes everything.
+    run.size = 12.0f;
+    reshape(&shape, text, run, autoWidth);
+    CHECK(shape.reshapedParagraphCount() == 3);
+    check_matches_full_shape(shape, text, run, autoWidth);
+
+    // So does a new font.
+    run.font = make_rcp<ParagraphCountingFont>();
+    reshape(&shape, text, run, autoWidth);
+    CHECK(shape.reshapedParagraphCount() == 3);
+
+    // And shape() forgets what reshape() had.
+    TextRun fullRun = run;
+    fullRun.unicharCount = (uint32_t)text.size();
+    shape.shape(text,
+                Span<TextRun>(&fullRun, 1),
+                TextSizing::autoWidth,
+                0.0f,
+                0.0f,
+                TextAlign::left,
+                TextWrap::wrap,
+                TextOrigin::top,
+                TextOverflow::visible,
+                0.0f);
+    reshape(&shape, text, run, autoWidth);
+    CHECK(shape.reshapedParagraphCount() == 3);
+}
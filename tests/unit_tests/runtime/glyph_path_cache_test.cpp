@@ -0,0 +1,202 @@
+#include "rive/batch_advancer.hpp"
+#include "rive/text/text_style.hpp"
+#include "rive/text/text_value_run.hpp"
+#include "rive/text_engine.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rive;
+
+namespace
+{
+// Outlines glyph N as an N-sided polyline, and counts how many times it was
+// asked to.
+class OutlineCountingFont : public Font
+{
+public:
+    OutlineCountingFont() : Font({-0.8f, 0.2f}) {}
+
+    mutable int pathCount = 0;
+
+    uint16_t getAxisCount() const override { return 0; }
+    Axis getAxis(uint16_t) const override { return {}; }
+    float getAxisValue(uint32_t) const override { return 0; }
+    uint16_t getWeight() const override { return 400; }
+    bool isItalic() const override { return false; }
+    SimpleArray<uint32_t> features() const override { return {}; }
+    bool hasGlyph(const Unichar) const override { return true; }
+    uint32_t getFeatureValue(uint32_t) const override { return (uint32_t)-1; }
+    rcp<Font> withOptions(Span<const Coord>,
+                          Span<const Feature>) const override
+    {
+        return make_rcp<OutlineCountingFont>();
+    }
+    RawPath getPath(GlyphID glyph) const override
+    {
+        ++pathCount;
+        RawPath path;
+        path.moveTo(0, 0);
+        for (int i = 1; i < glyph; ++i)
+        {
+            path.lineTo((float)i, (float)glyph);
+        }
+        path.close();
+        return path;
+    }
+
+protected:
+    SimpleArray<Paragraph> onShapeText(Span<const Unichar>,
+                                       Span<const TextRun>,
+                                       int) const override
+    {
+        return {};
+    }
+};
+} // namespace
+
+TEST_CASE("glyph paths are extracted once per font", "[text]")
+{
+    auto font = make_rcp<OutlineCountingFont>();
+    for (int i = 0; i < 10; ++i)
+    {
+        for (GlyphID glyph : {3, 4, 5})
+        {
+            const RawPath& path = font->glyphPath(glyph);
+            CHECK(path == font->getPath(glyph));
+        }
+    }
+    // 3 misses, plus our 30 calls to getPath() for comparison.
+    CHECK(font->pathCount == 33);
+    const GlyphPathCache::Stats& stats = font->glyphPathCache().stats();
+    CHECK(stats.hits == 27);
+    CHECK(stats.misses == 3);
+    CHECK(stats.evictions == 0);
+    CHECK(font->glyphPathCache().glyphCount() == 3);
+    CHECK(font->glyphPathCache().bytesUsed() > 0);
+
+    // Another variation instance of the font has a cache of its own.
+    auto otherFont = font->withOptions({}, {});
+    otherFont->glyphPath(3);
+    CHECK(otherFont->glyphPathCache().stats().misses == 1);
+    CHECK(font->glyphPathCache().stats().misses == 3);
+
+    font->glyphPathCache().resetStats();
+    CHECK(font->glyphPathCache().stats().hits == 0);
+    font->glyphPathCache().clear();
+    CHECK(font->glyphPathCache().glyphCount() == 0);
+    CHECK(font->glyphPathCache().bytesUsed() == 0);
+}
+
+TEST_CASE("glyph path cache evicts least recently used outlines", "[text]")
+{
+    auto font = make_rcp<OutlineCountingFont>();
+    GlyphPathCache& cache = font->glyphPathCache();
+
+    // Glyphs 8, 9 and 10 each have 1 more point and verb than the last, so a
+    // budget that fits 8 and 10 fits 8 and 9, but not all three.
+    font->glyphPath(8);
+    size_t size8 = cache.bytesUsed();
+    font->glyphPath(10);
+    size_t size10 = cache.bytesUsed() - size8;
+    cache.clear();
+    cache.setBudgetInBytes(size8 + size10);
+    font->glyphPath(8);
+    font->glyphPath(9);
+    CHECK(cache.glyphCount() == 2);
+    cache.resetStats();
+
+    // Touch 8 so 9 is the least recently used.
+    font->glyphPath(8);
+    font->glyphPath(10);
+    CHECK(cache.glyphCount() == 2);
+    CHECK(cache.stats().evictions == 1);
+    int pathCount = font->pathCount;
+    font->glyphPath(8);
+    font->glyphPath(10);
+    CHECK(font->pathCount == pathCount);
+    font->glyphPath(9);
+    CHECK(font->pathCount == pathCount + 1);
+
+    // Outlines bigger than the budget are still returned, just not kept.
+    cache.setBudgetInBytes(size8 - 1);
+    CHECK(cache.glyphCount() == 0);
+    CHECK(font->glyphPath(8) == font->getPath(8));
+    CHECK(cache.glyphCount() == 0);
+
+    // A zero budget turns the cache off.
+    cache.setBudgetInBytes(0);
+    pathCount = font->pathCount;
+    font->glyphPath(3);
+    font->glyphPath(3);
+    CHECK(font->pathCount == pathCount + 2);
+    CHECK(cache.bytesUsed() == 0);
+}
+
+TEST_CASE("glyph paths can be pulled from several threads at once", "[text]")
+{
+    auto font = make_rcp<OutlineCountingFont>();
+    // Small enough that the threads keep evicting each other's outlines.
+    font->visitGlyphPath(8, [](const RawPath&) {});
+    font->glyphPathCache().setBudgetInBytes(
+        font->glyphPathCache().bytesUsed() * 2);
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&font, &mismatches, t]() {
+            for (int i = 0; i < 2000; ++i)
+            {
+                GlyphID glyph = (GlyphID)(3 + (i + t) % 7);
+                font->visitGlyphPath(glyph, [&](const RawPath& path) {
+                    if (path.verbs().size() != (size_t)glyph + 1)
+                    {
+                        ++mismatches;
+                    }
+                });
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    CHECK(mismatches == 0);
+    GlyphPathCache::Stats stats = font->glyphPathCache().stats();
+    CHECK(stats.hits + stats.misses == 8001);
+    CHECK(stats.evictions > 0);
+}
+
+TEST_CASE("instances sharing a font advance in parallel", "[text]")
+{
+    auto file = ReadRiveFile("assets/hello_world.riv");
+    auto first = file->artboardDefault();
+    auto second = file->artboardDefault();
+    auto style = first->find<TextStyle>()[0];
+    REQUIRE(style->font() != nullptr);
+    REQUIRE(style->font() == second->find<TextStyle>()[0]->font());
+    GlyphPathCache& cache = style->font()->glyphPathCache();
+    cache.clear();
+    cache.resetStats();
+
+    BatchAdvancer advancer(2);
+    ArtboardInstance* batch[] = {first.get(), second.get()};
+    auto firstRun = first->find<TextValueRun>()[0];
+    auto secondRun = second->find<TextValueRun>()[0];
+    for (int frame = 0; frame < 50; ++frame)
+    {
+        // New text every frame, so both instances lay out and pull outlines
+        // from the shared font while the other one does.
+        firstRun->text("Hello " + std::to_string(frame));
+        secondRun->text("World " + std::to_string(frame * 7));
+        advancer.advance(batch, 0.0f);
+    }
+    GlyphPathCache::Stats stats = cache.stats();
+    CHECK(stats.misses > 0);
+    CHECK(stats.hits > stats.misses);
+    CHECK(cache.glyphCount() == stats.misses - stats.evictions);
+}
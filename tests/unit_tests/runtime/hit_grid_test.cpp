@@ -0,0 +1,125 @@
+#include <rive/animation/hit_grid.hpp>
+#include <rive/artboard.hpp>
+#include <rive/shapes/rectangle.hpp>
+#include <rive/shapes/shape.hpp>
+#include <utils/no_op_factory.hpp>
+#include <catch.hpp>
+#include <algorithm>
+
+using namespace rive;
+
+namespace
+{
+// Adds a shape holding a size x size rectangle centered on x, y.
+Shape* addSquare(Artboard& artboard, float x, float y, float size)
+{
+    auto shape = new Shape();
+    shape->x(x);
+    shape->y(y);
+    auto rectangle = new Rectangle();
+    rectangle->width(size);
+    rectangle->height(size);
+    auto shapeId = static_cast<uint32_t>(artboard.objects().size());
+    artboard.addObject(shape);
+    artboard.addObject(rectangle);
+    rectangle->parentId(shapeId);
+    return shape;
+}
+
+std::vector<uint32_t> query(HitGrid& grid, Vec2D position)
+{
+    std::vector<uint32_t> entries;
+    grid.update();
+    grid.query(position, entries);
+    std::sort(entries.begin(), entries.end());
+    return entries;
+}
+} // namespace
+
+TEST_CASE("hit grid finds the shapes whose bounds contain a point",
+          "[hittest]")
+{
+    NoOpFactory factory;
+    Artboard artboard(&factory);
+    artboard.addObject(&artboard);
+    std::vector<Shape*> shapes;
+    for (int i = 0; i < 100; i++)
+    {
+        shapes.push_back(
+            addSquare(artboard, (i % 10) * 20.0f, (i / 10) * 20.0f, 10.0f));
+    }
+    // One large shape overlapping everything.
+    shapes.push_back(addSquare(artboard, 90.0f, 90.0f, 200.0f));
+    REQUIRE(artboard.initialize() == StatusCode::Ok);
+    artboard.advance(0.0f);
+
+    HitGrid grid;
+    for (auto shape : shapes)
+    {
+        grid.add(shape);
+    }
+    CHECK(grid.needsRebuild());
+
+    CHECK(query(grid, Vec2D(0.0f, 0.0f)) == std::vector<uint32_t>{0, 100});
+    CHECK(query(grid, Vec2D(44.0f, 25.0f)) == std::vector<uint32_t>{12, 100});
+    CHECK(query(grid, Vec2D(10.0f, 10.0f)) == std::vector<uint32_t>{100});
+    CHECK(query(grid, Vec2D(-20.0f, 0.0f)).empty());
+    CHECK(!grid.needsRebuild());
+
+    // Entries match Shape::hitTestAABB exactly, edges included.
+    int mismatches = 0;
+    for (float x = -15.0f; x <= 200.0f; x += 2.5f)
+    {
+        for (float y = -15.0f; y <= 200.0f; y += 2.5f)
+        {
+            auto entries = query(grid, Vec2D(x, y));
+            for (uint32_t i = 0; i < shapes.size(); i++)
+            {
+                bool found =
+                    std::binary_search(entries.begin(), entries.end(), i);
+                if (found != shapes[i]->hitTestAABB(Vec2D(x, y)) ||
+                    found != grid.wasQueried(i))
+                {
+                    mismatches++;
+                }
+            }
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+TEST_CASE("hit grid refits shapes that move", "[hittest]")
+{
+    NoOpFactory factory;
+    Artboard artboard(&factory);
+    artboard.addObject(&artboard);
+    auto a = addSquare(artboard, 0.0f, 0.0f, 10.0f);
+    auto b = addSquare(artboard, 100.0f, 100.0f, 10.0f);
+    REQUIRE(artboard.initialize() == StatusCode::Ok);
+    artboard.advance(0.0f);
+
+    HitGrid grid;
+    grid.add(a);
+    grid.add(b);
+    CHECK(query(grid, Vec2D(0.0f, 0.0f)) == std::vector<uint32_t>{0});
+
+    // Moving within the grid's extent refits the entry in place.
+    auto counter = artboard.worldBoundsChangeCounter();
+    auto versionA = a->worldBoundsVersion();
+    auto versionB = b->worldBoundsVersion();
+    a->x(50.0f);
+    artboard.advance(0.0f);
+    CHECK(artboard.worldBoundsChangeCounter() != counter);
+    CHECK(a->worldBoundsVersion() != versionA);
+    CHECK(b->worldBoundsVersion() == versionB);
+    CHECK(query(grid, Vec2D(0.0f, 0.0f)).empty());
+    CHECK(query(grid, Vec2D(50.0f, 0.0f)) == std::vector<uint32_t>{0});
+
+    // Moving outside of it rebuilds the cells around the new bounds.
+    b->x(500.0f);
+    b->y(-300.0f);
+    artboard.advance(0.0f);
+    CHECK(query(grid, Vec2D(100.0f, 100.0f)).empty());
+    CHECK(query(grid, Vec2D(500.0f, -300.0f)) == std::vector<uint32_t>{1});
+    CHECK(query(grid, Vec2D(50.0f, 0.0f)) == std::vector<uint32_t>{0});
+}
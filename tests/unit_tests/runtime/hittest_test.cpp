@@ -4,6 +4,8 @@
 
 #include <rive/math/aabb.hpp>
 #include <rive/math/hit_test.hpp>
+#include <rive/math/raw_path.hpp>
+#include <rive/hittest_command_path.hpp>
 #include <rive/nested_artboard.hpp>
 #include <rive/animation/state_machine_instance.hpp>
 #include <rive/animation/state_machine_input_instance.hpp>
@@ -67,6 +69,80 @@ TEST_CASE("hittest-mesh", "[hittest]")
         HitTester::testMesh(area, make_span(verts, 3), make_span(indices, 3)));
 }
 
+TEST_CASE("hittest-polylines", "[hittest]")
+{
+    RawPath path;
+    path.addOval({10, 10, 190, 120});
+    // A hole under nonZero.
+    path.addRect({60, 40, 140, 90}, PathDirection::ccw);
+    // An open contour mixing every verb.
+    path.moveTo(20, 150);
+    path.cubicTo(80, 100, 140, 260, 200, 150);
+    path.quadTo(220, 240, 120, 230);
+    path.lineTo(40, 240);
+    const Mat2D xform(1.2f, 0.3f, -0.2f, 0.9f, 25.0f, -10.0f);
+
+    HitTestPolylines polylines;
+    polylines.addPath(path, xform);
+    REQUIRE(polylines.commit());
+    CHECK(polylines.edgeCount() > 0);
+
+    int mismatches = 0;
+    int hits = 0;
+    for (int y = -10; y < 260; y += 3)
+    {
+        for (int x = -10; x < 280; x += 3)
+        {
+            const IAABB area = {x - 2, y - 2, x + 2, y + 2};
+            for (auto rule : {FillRule::nonZero, FillRule::evenOdd})
+            {
+                HitTestCommandPath tester(area);
+                tester.fillRule(rule);
+                tester.setXform(xform);
+                path.addTo(&tester);
+                bool hit = tester.wasHit();
+                hits += hit;
+                if (hit != polylines.test(area, rule))
+                {
+                    mismatches++;
+                }
+            }
+        }
+    }
+    CHECK(hits > 0);
+    CHECK(mismatches == 0);
+}
+
+TEST_CASE("hittest-polylines-budget", "[hittest]")
+{
+    size_t bytesUsed = HitTestPolylines::BudgetBytesUsed();
+    {
+        RawPath path;
+        path.addOval({0, 0, 100, 100});
+        HitTestPolylines polylines;
+        polylines.addPath(path, Mat2D());
+        REQUIRE(polylines.commit());
+        CHECK(polylines.byteSize() > 0);
+        CHECK(HitTestPolylines::BudgetBytesUsed() ==
+              bytesUsed + polylines.byteSize());
+    }
+    CHECK(HitTestPolylines::BudgetBytesUsed() == bytesUsed);
+
+    // A zig-zag with more edges than a single cache may hold.
+    RawPath path;
+    path.moveTo(0, 0);
+    for (int i = 1; i < 10000; ++i)
+    {
+        path.lineTo((float)i, (float)(i & 1));
+    }
+    HitTestPolylines polylines;
+    polylines.addPath(path, Mat2D());
+    CHECK(!polylines.commit());
+    CHECK(polylines.edgeCount() == 0);
+    CHECK(!polylines.test({0, 0, 4, 4}));
+    CHECK(HitTestPolylines::BudgetBytesUsed() == bytesUsed);
+}
+
 TEST_CASE("hit test on opaque target", "[hittest]")
 {
     // This artboard has two rects of size 200 x 200, "red-activate" at [0, 0,
@@ -1,3 +1,4 @@
+#include <rive/animation/state_machine_instance.hpp>
 #include <rive/file.hpp>
 #include <rive/node.hpp>
 #include <rive/shapes/clipping_shape.hpp>
@@ -67,3 +68,83 @@ TEST_CASE("instancing artboard doesn't clone animations", "[instancing]")
     // Now the animations should've been deleted.
     REQUIRE(rive::LinearAnimation::deleteCount == numberOfAnimations);
 }
+
+TEST_CASE("arena instances match heap instances", "[instancing]")
+{
+    auto file = ReadRiveFile("assets/bullet_man.riv");
+    auto source = file->artboard("Bullet Man");
+    REQUIRE(source != nullptr);
+
+    auto heap = source->instance(nullptr, rive::InstanceAllocation::Heap);
+    auto arena = source->instance(nullptr, rive::InstanceAllocation::Arena);
+    REQUIRE(heap->instanceArena() == nullptr);
+    REQUIRE(arena->instanceArena() != nullptr);
+    REQUIRE(arena->instanceArena()->bytesUsed() > 0);
+    REQUIRE(heap->objects().size() == arena->objects().size());
+    REQUIRE(heap->dataBinds().size() == arena->dataBinds().size());
+    const rive::CoreArena* instanceArena = arena->instanceArena();
+    size_t objectsInArena = 0;
+    for (size_t i = 1; i < arena->objects().size(); ++i)
+    {
+        auto object = arena->objects()[i];
+        if (object != nullptr)
+        {
+            objectsInArena += instanceArena->owns(object);
+            CHECK(!instanceArena->owns(heap->objects()[i]));
+            CHECK(object->coreType() == heap->objects()[i]->coreType());
+            // Plain shallow copies, so they're always placed.
+            if (object->coreType() == rive::NodeBase::typeKey ||
+                object->coreType() == rive::RectangleBase::typeKey)
+            {
+                CHECK(instanceArena->owns(object));
+            }
+        }
+    }
+    CHECK(objectsInArena > 0);
+    CHECK(!instanceArena->owns(arena.get()));
+    // Only the objects themselves are placed in the arena; their data binds
+    // are cloned on the heap.
+    for (auto dataBind : arena->dataBinds())
+    {
+        CHECK(!instanceArena->owns(dataBind));
+    }
+
+    auto heapMachine = heap->stateMachineAt(0);
+    auto arenaMachine = arena->stateMachineAt(0);
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        heapMachine->advanceAndApply(1 / 60.0f);
+        arenaMachine->advanceAndApply(1 / 60.0f);
+        for (size_t i = 0; i < heap->objects().size(); ++i)
+        {
+            auto object = heap->objects()[i];
+            if (object == nullptr || !object->is<rive::Node>())
+            {
+                continue;
+            }
+            auto heapNode = object->as<rive::Node>();
+            auto arenaNode = arena->objects()[i]->as<rive::Node>();
+            for (int j = 0; j < 6; ++j)
+            {
+                CHECK(heapNode->worldTransform()[j] ==
+                      arenaNode->worldTransform()[j]);
+            }
+        }
+    }
+
+    // Later arena instances are sized from the first and fit in one block.
+    auto second = source->instance(nullptr, rive::InstanceAllocation::Arena);
+    REQUIRE(second->instanceArena() != nullptr);
+    CHECK(second->instanceArena()->blockCount() == 1);
+    CHECK(second->instanceArena()->bytesUsed() ==
+          arena->instanceArena()->bytesUsed());
+
+    // Cloning an arena object outside of instancing makes a heap object.
+    rive::Core* clone = arena->objects()[1]->clone();
+    REQUIRE(clone != nullptr);
+    CHECK(!instanceArena->owns(clone));
+    delete clone;
+
+    arenaMachine = nullptr;
+    arena = nullptr;
+}
@@ -1,7 +1,9 @@
 #include <rive/animation/loop.hpp>
 #include <rive/animation/linear_animation.hpp>
 #include <rive/animation/linear_animation_instance.hpp>
+#include <rive/transform_component.hpp>
 #include "utils/no_op_factory.hpp"
+#include "rive_file_reader.hpp"
 #include <catch.hpp>
 #include <cstdio>
 
@@ -413,3 +415,46 @@ TEST_CASE("LinearAnimationInstance override loop", "[animation]")
     delete linearAnimationInstance;
     delete linearAnimation;
 }
+
+TEST_CASE("LinearAnimationInstance applies like its LinearAnimation",
+          "[animation]")
+{
+    auto file = ReadRiveFile("assets/bullet_man.riv");
+    auto source = file->artboard();
+    REQUIRE(source->animationCount() > 0);
+    for (size_t i = 0; i < source->animationCount(); i++)
+    {
+        auto animation = source->animation(i);
+        auto resolved = source->instance();
+        auto direct = source->instance();
+        rive::LinearAnimationInstance instance(animation, resolved.get());
+        auto resolvedNodes = resolved->find<rive::TransformComponent>();
+        auto directNodes = direct->find<rive::TransformComponent>();
+        REQUIRE(resolvedNodes.size() == directNodes.size());
+
+        // Forward, then scrub back and jump around.
+        std::vector<float> times;
+        for (float time = 0; time < animation->durationSeconds();
+             time += 1.0f / 60.0f)
+        {
+            times.push_back(time);
+        }
+        for (float time : {0.5f, 0.25f, 0.0f, 1.0f, 0.1f})
+        {
+            times.push_back(time * animation->durationSeconds());
+        }
+        for (float time : times)
+        {
+            instance.time(time);
+            instance.apply();
+            animation->apply(direct.get(), instance.time());
+            resolved->advance(0.0f);
+            direct->advance(0.0f);
+            for (size_t j = 0; j < resolvedNodes.size(); j++)
+            {
+                REQUIRE(resolvedNodes[j]->worldTransform() ==
+                        directNodes[j]->worldTransform());
+            }
+        }
+    }
+}
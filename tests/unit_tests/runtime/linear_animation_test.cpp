@@ -1,11 +1,14 @@
 #include "rive/artboard.hpp"
 #include "rive/animation/keyed_object.hpp"
+#include "rive/animation/keyed_property.hpp"
+#include "rive/animation/keyframe_double.hpp"
 #include "rive/animation/linear_animation.hpp"
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/animation/keyed_callback_reporter.hpp"
 #include "utils/no_op_factory.hpp"
 #include "rive_file_reader.hpp"
 #include "rive_testing.hpp"
+#include "rive/node.hpp"
 #include "rive/shapes/shape.hpp"
 #include <catch.hpp>
 #include <cstdio>
@@ -207,4 +210,55 @@ TEST_CASE("Looping timeline events load correctly and report", "[events]")
     animationInstance->advance(1.01f, &reporter);
     REQUIRE(animationInstance->time() == Approx(0.01f));
     REQUIRE(reporter.count() == 7);
-}
\ No newline at end of file
+}
+
+TEST_CASE("keyframe cursors find the same keyframes as the binary search",
+          "[animation]")
+{
+    // Keyframes every 3 frames at 10fps with alternating hold and linear
+    // interpolation.
+    rive::KeyedProperty property;
+    property.propertyKey(rive::NodeBase::xPropertyKey);
+    for (int i = 0; i < 20; i++)
+    {
+        auto keyframe = std::make_unique<rive::KeyFrameDouble>();
+        keyframe->frame(i * 3);
+        keyframe->value((float)(i * i));
+        keyframe->interpolationType(i % 2);
+        keyframe->computeSeconds(10);
+        property.addKeyFrame(std::move(keyframe));
+    }
+
+    // Forward and backward playback at and between keyframes, jumps, and
+    // times before the first and after the last keyframe.
+    std::vector<float> times;
+    for (int i = -5; i < 65; i++)
+    {
+        times.push_back(i / 10.0f);
+    }
+    for (int i = 64; i >= -5; i--)
+    {
+        times.push_back(i / 20.0f);
+    }
+    for (float time : {0.3f, 5.7f, 0.0f, 6.0f, 2.95f, 3.0f, 3.05f, -1.0f})
+    {
+        times.push_back(time);
+    }
+
+    rive::Node searched;
+    rive::Node cursored;
+    int cursor = 0;
+    for (float time : times)
+    {
+        property.apply(&searched, time, 1.0f);
+        property.apply(&cursored, time, 1.0f, nullptr, &cursor);
+        REQUIRE(cursored.x() == searched.x());
+    }
+
+    // A stale or out of range cursor is only a hint.
+    cursor = 1000;
+    property.apply(&searched, 4.25f, 1.0f);
+    property.apply(&cursored, 4.25f, 1.0f, nullptr, &cursor);
+    REQUIRE(cursored.x() == searched.x());
+    REQUIRE(cursor == 15);
+}
@@ -247,6 +247,19 @@ TEST_CASE("clz", "[math]")
     }
 }
 
+// Check math::ctz64
+TEST_CASE("ctz", "[math]")
+{
+    CHECK(math::ctz64(1) == 0);
+    CHECK(math::ctz64(-1) == 0);
+    CHECK(math::ctz64(1ull << 63) == 63);
+    for (int i = 0; i < 64; ++i)
+    {
+        CHECK(math::ctz64(1ull << i) == i);
+        CHECK(math::ctz64((1ull << i) | ((uint64_t)rand() << 32 << i)) == i);
+    }
+}
+
 // Check math::rotateleft32
 TEST_CASE("rotateleft32", "[math]")
 {
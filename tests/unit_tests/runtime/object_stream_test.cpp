@@ -150,3 +150,54 @@ TEST_CASE("PODStream -- force deque realloc", "[ObjectStream]")
     }
     CHECK(s.empty());
 }
+
+TEST_CASE("PODStream -- wrap around without growing", "[ObjectStream]")
+{
+    PODStream s;
+    s << int64_t(0);
+    int64_t dst;
+    s >> dst;
+    CHECK(s.empty());
+    size_t capacity = s.capacity();
+    CHECK(capacity > 0);
+
+    // Keep the stream partially full, with oddly sized values, while the read
+    // and write positions lap the ring many times. Every value should come
+    // back out intact, and since the stream never holds more than a few bytes
+    // it shouldn't reallocate.
+    s << int32_t(0);
+    for (int32_t i = 0; i < 10000; ++i)
+    {
+        s << int8_t(7) << int32_t(i + 1);
+        int32_t val;
+        int8_t seven;
+        s >> val >> seven;
+        CHECK(val == i);
+        CHECK(seven == 7);
+    }
+    int32_t last;
+    s >> last;
+    CHECK(last == 10000);
+    CHECK(s.empty());
+    CHECK(s.capacity() == capacity);
+}
+
+TEST_CASE("PODStream -- swap", "[ObjectStream]")
+{
+    PODStream a, b;
+    a << 1 << 2.f;
+    b << true;
+    a.swap(b);
+
+    bool boolean;
+    a >> boolean;
+    CHECK(boolean == true);
+    CHECK(a.empty());
+
+    int i;
+    float f;
+    b >> i >> f;
+    CHECK(i == 1);
+    CHECK(f == 2.f);
+    CHECK(b.empty());
+}
@@ -0,0 +1,275 @@
+#include "rive/text/shaped_paragraph_cache.hpp"
+#include <catch.hpp>
+#include <cstring>
+#include <vector>
+
+using namespace rive;
+
+namespace
+{
+// Shapes each unichar to one glyph of the same id, and counts how many times
+// it was asked to.
+class CountingFont : public Font
+{
+public:
+    CountingFont() : Font({-0.8f, 0.2f}) {}
+
+    mutable int shapeCount = 0;
+    // When set, every glyph is shaped with this font instead, as if it were
+    // a fallback.
+    rcp<Font> fallbackFont;
+
+    uint16_t getAxisCount() const override { return 0; }
+    Axis getAxis(uint16_t) const override { return {}; }
+    float getAxisValue(uint32_t) const override { return 0; }
+    uint16_t getWeight() const override { return 400; }
+    bool isItalic() const override { return false; }
+    SimpleArray<uint32_t> features() const override { return {}; }
+    bool hasGlyph(const Unichar) const override { return true; }
+    uint32_t getFeatureValue(uint32_t) const override { return (uint32_t)-1; }
+    rcp<Font> withOptions(Span<const Coord>,
+                          Span<const Feature>) const override
+    {
+        return make_rcp<CountingFont>();
+    }
+    RawPath getPath(GlyphID) const override { return RawPath(); }
+
+protected:
+    SimpleArray<Paragraph> onShapeText(Span<const Unichar> text,
+                                       Span<const TextRun> runs,
+                                       int) const override
+    {
+        ++shapeCount;
+        SimpleArray<GlyphRun> glyphRuns(runs.size());
+        uint32_t textIndex = 0;
+        for (size_t i = 0; i < runs.size(); ++i)
+        {
+            const TextRun& run = runs[i];
+            GlyphRun glyphRun(run.unicharCount);
+            glyphRun.font = fallbackFont != nullptr ? fallbackFont : run.font;
+            glyphRun.size = run.size;
+            glyphRun.styleId = run.styleId;
+            glyphRun.level = 0;
+            float x = 0;
+            for (uint32_t j = 0; j < run.unicharCount; ++j, ++textIndex)
+            {
+                glyphRun.glyphs[j] = static_cast<GlyphID>(text[textIndex]);
+                glyphRun.textIndices[j] = textIndex;
+                glyphRun.advances[j] = run.size;
+                glyphRun.xpos[j] = x;
+                x += run.size;
+            }
+            glyphRun.xpos[run.unicharCount] = x;
+            glyphRuns[i] = std::move(glyphRun);
+        }
+        SimpleArray<Paragraph> paragraphs(1);
+        paragraphs[0] = {std::move(glyphRuns), 0};
+        return paragraphs;
+    }
+};
+
+std::vector<Unichar> unichars(const char* str)
+{
+    return std::vector<Unichar>(str, str + strlen(str));
+}
+
+TextRun make_run(rcp<Font> font, float size, uint32_t unicharCount)
+{
+    return {std::move(font), size, -1.0f, 0.0f, unicharCount, 0, 0, 0};
+}
+
+void reset_cache()
+{
+    ShapedParagraphCache::setBudgetInBytes(
+        ShapedParagraphCache::kDefaultBudgetInBytes);
+    ShapedParagraphCache::clear();
+    ShapedParagraphCache::resetStats();
+}
+} // namespace
+
+TEST_CASE("shaped paragraph cache shares identical labels", "[text]")
+{
+    reset_cache();
+    auto font = make_rcp<CountingFont>();
+    auto label = unichars("Settings");
+    TextRun run = make_run(font, 16.0f, (uint32_t)label.size());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        SimpleArray<Paragraph> shape =
+            ShapedParagraphCache::shapeText(label, {&run, 1});
+        REQUIRE(shape.size() == 1);
+        REQUIRE(shape[0].runs.size() == 1);
+        const GlyphRun& glyphRun = shape[0].runs[0];
+        CHECK(glyphRun.font.get() == font.get());
+        CHECK(glyphRun.glyphs.size() == label.size());
+        CHECK(glyphRun.glyphs[0] == 'S');
+        CHECK(glyphRun.xpos.back() == 16.0f * label.size());
+        // Font::shapeText() fills in the word breaks after onShapeText().
+        CHECK(!glyphRun.breaks.empty());
+    }
+    CHECK(font->shapeCount == 1);
+
+    ShapedParagraphCache::Stats stats = ShapedParagraphCache::stats();
+    CHECK(stats.hits == 9);
+    CHECK(stats.misses == 1);
+    CHECK(stats.entryCount == 1);
+    CHECK(stats.bytesUsed > 0);
+    reset_cache();
+}
+
+TEST_CASE("shaped paragraph cache keys on the text and every run",
+          "[text]")
+{
+    reset_cache();
+    auto font = make_rcp<CountingFont>();
+    auto otherFont = font->withOptions({}, {});
+    auto label = unichars("Inbox");
+    auto count = (uint32_t)label.size();
+
+    TextRun runs[] = {
+        make_run(font, 16.0f, count),
+        make_run(font, 18.0f, count),
+        make_run(otherFont, 16.0f, count),
+    };
+    TextRun spaced = make_run(font, 16.0f, count);
+    spaced.letterSpacing = 2.0f;
+    TextRun styled = make_run(font, 16.0f, count);
+    styled.styleId = 1;
+
+    for (const TextRun& run : runs)
+    {
+        ShapedParagraphCache::shapeText(label, {&run, 1});
+    }
+    ShapedParagraphCache::shapeText(label, {&spaced, 1});
+    ShapedParagraphCache::shapeText(label, {&styled, 1});
+    auto otherLabel = unichars("Inbax");
+    ShapedParagraphCache::shapeText(otherLabel, {&runs[0], 1});
+    CHECK(ShapedParagraphCache::stats().misses == 6);
+    CHECK(ShapedParagraphCache::stats().hits == 0);
+
+    // Splitting the same text into two runs is a different key too.
+    auto hello = unichars("Hello");
+    TextRun split[] = {make_run(font, 16.0f, 2), make_run(font, 16.0f, 3)};
+    TextRun whole = make_run(font, 16.0f, 5);
+    ShapedParagraphCache::shapeText(hello, split);
+    ShapedParagraphCache::shapeText(hello, {&whole, 1});
+    CHECK(ShapedParagraphCache::stats().misses == 8);
+    SimpleArray<Paragraph> shape =
+        ShapedParagraphCache::shapeText(hello, split);
+    CHECK(ShapedParagraphCache::stats().hits == 1);
+    REQUIRE(shape[0].runs.size() == 2);
+    CHECK(shape[0].runs[1].textIndices[0] == 2);
+
+    // Changing the fallback proc invalidates what was shaped without it.
+    auto prevFallbackProc = Font::gFallbackProc;
+    Font::gFallbackProc = [](const Unichar, const uint32_t, const Font*) {
+        return rcp<Font>();
+    };
+    ShapedParagraphCache::shapeText(hello, split);
+    CHECK(ShapedParagraphCache::stats().misses == 9);
+    Font::gFallbackProc = prevFallbackProc;
+    ShapedParagraphCache::shapeText(hello, split);
+    CHECK(ShapedParagraphCache::stats().hits == 2);
+    reset_cache();
+}
+
+TEST_CASE("shaped paragraph cache evicts least recently used results",
+          "[text]")
+{
+    reset_cache();
+    auto font = make_rcp<CountingFont>();
+    std::vector<std::vector<Unichar>> labels;
+    for (const char* label : {"Zero", "One!", "Two!", "Thre"})
+    {
+        labels.push_back(unichars(label));
+    }
+    TextRun run = make_run(font, 16.0f, 4);
+
+    ShapedParagraphCache::shapeText(labels[0], {&run, 1});
+    size_t entrySize = ShapedParagraphCache::stats().bytesUsed;
+    // Room for 3 labels of the same length.
+    ShapedParagraphCache::setBudgetInBytes(entrySize * 3);
+    ShapedParagraphCache::shapeText(labels[1], {&run, 1});
+    ShapedParagraphCache::shapeText(labels[2], {&run, 1});
+    CHECK(ShapedParagraphCache::stats().entryCount == 3);
+
+    // Touch label 0 so label 1 is the least recently used.
+    ShapedParagraphCache::shapeText(labels[0], {&run, 1});
+    ShapedParagraphCache::shapeText(labels[3], {&run, 1});
+    ShapedParagraphCache::Stats stats = ShapedParagraphCache::stats();
+    CHECK(stats.entryCount == 3);
+    CHECK(stats.evictions == 1);
+    CHECK(stats.bytesUsed == entrySize * 3);
+
+    int shapeCount = font->shapeCount;
+    ShapedParagraphCache::shapeText(labels[0], {&run, 1});
+    ShapedParagraphCache::shapeText(labels[2], {&run, 1});
+    ShapedParagraphCache::shapeText(labels[3], {&run, 1});
+    CHECK(font->shapeCount == shapeCount);
+    ShapedParagraphCache::shapeText(labels[1], {&run, 1});
+    CHECK(font->shapeCount == shapeCount + 1);
+
+    // A zero budget turns the cache off and drops what it held.
+    ShapedParagraphCache::setBudgetInBytes(0);
+    CHECK(ShapedParagraphCache::stats().entryCount == 0);
+    ShapedParagraphCache::shapeText(labels[0], {&run, 1});
+    ShapedParagraphCache::shapeText(labels[0], {&run, 1});
+    CHECK(font->shapeCount == shapeCount + 3);
+    reset_cache();
+}
+
+TEST_CASE("shaped paragraph cache doesn't keep fonts alive", "[text]")
+{
+    reset_cache();
+    auto font = make_rcp<CountingFont>();
+    auto otherFont = make_rcp<CountingFont>();
+    auto label = unichars("Profile");
+    TextRun run = make_run(font, 16.0f, (uint32_t)label.size());
+    TextRun otherRun = make_run(otherFont, 16.0f, (uint32_t)label.size());
+    ShapedParagraphCache::shapeText(label, {&run, 1});
+    ShapedParagraphCache::shapeText(label, {&otherRun, 1});
+    CHECK(ShapedParagraphCache::stats().entryCount == 2);
+    // Only ours and the run's refs are left.
+    CHECK(font->debugging_refcnt() == 2);
+
+    // Hits hand the font back with a ref of its own.
+    {
+        SimpleArray<Paragraph> shape =
+            ShapedParagraphCache::shapeText(label, {&run, 1});
+        CHECK(ShapedParagraphCache::stats().hits == 1);
+        CHECK(shape[0].runs[0].font.get() == font.get());
+        CHECK(font->debugging_refcnt() == 3);
+    }
+    CHECK(font->debugging_refcnt() == 2);
+
+    // Destroying the font drops its results and leaves the others.
+    size_t bytesUsed = ShapedParagraphCache::stats().bytesUsed;
+    run.font = nullptr;
+    font = nullptr;
+    ShapedParagraphCache::Stats stats = ShapedParagraphCache::stats();
+    CHECK(stats.entryCount == 1);
+    CHECK(stats.bytesUsed == bytesUsed / 2);
+    ShapedParagraphCache::shapeText(label, {&otherRun, 1});
+    CHECK(ShapedParagraphCache::stats().hits == 2);
+    reset_cache();
+}
+
+TEST_CASE("shaped paragraph cache skips results with fallback fonts",
+          "[text]")
+{
+    reset_cache();
+    auto font = make_rcp<CountingFont>();
+    font->fallbackFont = make_rcp<CountingFont>();
+    auto label = unichars("Emoji");
+    TextRun run = make_run(font, 16.0f, (uint32_t)label.size());
+    for (int i = 0; i < 2; ++i)
+    {
+        SimpleArray<Paragraph> shape =
+            ShapedParagraphCache::shapeText(label, {&run, 1});
+        CHECK(shape[0].runs[0].font.get() == font->fallbackFont.get());
+    }
+    CHECK(font->shapeCount == 2);
+    CHECK(ShapedParagraphCache::stats().entryCount == 0);
+    reset_cache();
+}
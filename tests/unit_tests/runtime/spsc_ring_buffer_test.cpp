@@ -0,0 +1,124 @@
+/*
+ * Copyright 2025 Rive
+ */
+
+#include "catch.hpp"
+
+#include "rive/spsc_ring_buffer.hpp"
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+using namespace rive;
+
+TEST_CASE("SPSCRingBuffer -- single thread", "[SPSCRingBuffer]")
+{
+    SPSCRingBuffer<int, 4> ring;
+    CHECK(ring.capacity() == 4);
+    CHECK(ring.readable() == 0);
+
+    int dst = -1;
+    CHECK(!ring.tryPop(dst));
+    CHECK(dst == -1);
+
+    // Staged elements aren't visible until they're published.
+    CHECK(ring.tryPush(1));
+    CHECK(ring.tryPush(2));
+    CHECK(ring.readable() == 0);
+    CHECK(!ring.tryPop(dst));
+    ring.publish();
+    CHECK(ring.readable() == 2);
+
+    // Staged elements count against the capacity.
+    CHECK(ring.tryPush(3));
+    CHECK(ring.tryPush(4));
+    CHECK(!ring.tryPush(5));
+    ring.publish();
+    CHECK(ring.readable() == 4);
+
+    // Popped slots aren't handed back to the producer until release().
+    CHECK(ring.tryPop(dst));
+    CHECK(dst == 1);
+    CHECK(ring.tryPop(dst));
+    CHECK(dst == 2);
+    CHECK(!ring.tryPush(5));
+    ring.release();
+    CHECK(ring.tryPushAndPublish(5));
+    CHECK(ring.tryPushAndPublish(6));
+    CHECK(!ring.tryPushAndPublish(7));
+
+    for (int expected = 3; expected <= 6; ++expected)
+    {
+        CHECK(ring.tryPopAndRelease(dst));
+        CHECK(dst == expected);
+    }
+    CHECK(!ring.tryPopAndRelease(dst));
+    CHECK(ring.readable() == 0);
+}
+
+TEST_CASE("SPSCRingBuffer -- failed push leaves value", "[SPSCRingBuffer]")
+{
+    SPSCRingBuffer<std::unique_ptr<int>, 1> ring;
+    auto a = std::make_unique<int>(1);
+    auto b = std::make_unique<int>(2);
+    CHECK(ring.tryPushAndPublish(std::move(a)));
+    CHECK(a == nullptr);
+    CHECK(!ring.tryPushAndPublish(std::move(b)));
+    REQUIRE(b != nullptr);
+    CHECK(*b == 2);
+
+    std::unique_ptr<int> dst;
+    CHECK(ring.tryPopAndRelease(dst));
+    REQUIRE(dst != nullptr);
+    CHECK(*dst == 1);
+}
+
+TEST_CASE("SPSCRingBuffer -- two threads", "[SPSCRingBuffer]")
+{
+    constexpr static uint32_t N = 200000;
+    auto ring = std::make_unique<SPSCRingBuffer<uint32_t, 64>>();
+
+    std::thread producer([&ring]() {
+        uint32_t next = 0;
+        while (next < N)
+        {
+            // Publish in batches of up to 5.
+            uint32_t batchEnd = std::min(next + 5, N);
+            while (next < batchEnd)
+            {
+                uint32_t value = next;
+                if (!ring->tryPush(std::move(value)))
+                {
+                    break;
+                }
+                ++next;
+            }
+            ring->publish();
+            std::this_thread::yield();
+        }
+    });
+
+    uint32_t expected = 0;
+    bool inOrder = true;
+    while (expected < N)
+    {
+        uint32_t value;
+        uint32_t popped = 0;
+        while (ring->tryPop(value))
+        {
+            inOrder = inOrder && value == expected;
+            ++expected;
+            ++popped;
+        }
+        ring->release();
+        if (popped == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    CHECK(inOrder);
+    CHECK(expected == N);
+    CHECK(ring->readable() == 0);
+}
@@ -0,0 +1,157 @@
+#include "rive/viewmodel/runtime/viewmodel_instance_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_runtime.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+
+using namespace rive;
+
+TEST_CASE("View model property handles set values", "[data binding]")
+{
+    auto file = ReadRiveFile("assets/viewmodel_runtime_file.riv");
+    auto instance = file->viewModelByName("vm")->createDefaultInstance();
+    REQUIRE(instance != nullptr);
+
+    auto num = instance->numberHandle("num");
+    auto str = instance->stringHandle("str");
+    auto boo = instance->booleanHandle("boo");
+    auto col = instance->colorHandle("col");
+    auto enu = instance->enumHandle("enu");
+    auto tri = instance->triggerHandle("tri");
+    auto chiNum = instance->numberHandle("chi/chi-num");
+    REQUIRE(num);
+    REQUIRE(str);
+    REQUIRE(boo);
+    REQUIRE(col);
+    REQUIRE(enu);
+    REQUIRE(tri);
+    REQUIRE(chiNum);
+    CHECK(num.property() == instance->propertyNumber("num"));
+    CHECK(instance->isValid(num));
+
+    CHECK(instance->setValue(num, 12.5f));
+    CHECK(instance->setValue(str, "hello"));
+    CHECK(instance->setValue(boo, true));
+    CHECK(instance->setValue(col, 0xFF112233));
+    CHECK(instance->setValue(enu, 2u));
+    CHECK(instance->setValue(chiNum, -3.0f));
+    CHECK(instance->propertyNumber("num")->value() == 12.5f);
+    CHECK(instance->propertyString("str")->value() == "hello");
+    CHECK(instance->propertyBoolean("boo")->value() == true);
+    CHECK(instance->propertyColor("col")->value() == (int)0xFF112233);
+    CHECK(instance->propertyEnum("enu")->valueIndex() == 2);
+    CHECK(instance->propertyNumber("chi/chi-num")->value() == -3.0f);
+
+    instance->propertyTrigger("tri")->clearChanges();
+    CHECK(instance->fire(tri));
+    CHECK(instance->propertyTrigger("tri")->hasChanged());
+
+    // Paths that don't lead to a property of the handle's type give empty
+    // handles, which never set anything.
+    auto wrongType = instance->numberHandle("str");
+    auto missing = instance->numberHandle("nope");
+    CHECK(!wrongType);
+    CHECK(!missing);
+    CHECK(!instance->isValid(wrongType));
+    CHECK(!instance->setValue(missing, 1.0f));
+    CHECK(!instance->setValue(ViewModelNumberHandle(), 1.0f));
+}
+
+TEST_CASE("View model property handles set values in bulk", "[data binding]")
+{
+    auto file = ReadRiveFile("assets/viewmodel_runtime_file.riv");
+    auto instance = file->viewModelByName("vm")->createDefaultInstance();
+    auto other = file->viewModelByName("vm")->createDefaultInstance();
+    REQUIRE(instance != nullptr);
+    REQUIRE(other != nullptr);
+
+    ViewModelNumberUpdate numbers[] = {
+        {instance->numberHandle("num"), 4.0f},
+        {instance->numberHandle("chi/chi-num"), 5.0f},
+        // Resolved by another runtime, so skipped.
+        {other->numberHandle("num"), 6.0f},
+        // Empty, so skipped.
+        {instance->numberHandle("str"), 7.0f},
+    };
+    CHECK(instance->setValues(numbers) == 2);
+    CHECK(instance->propertyNumber("num")->value() == 4.0f);
+    CHECK(instance->propertyNumber("chi/chi-num")->value() == 5.0f);
+    CHECK(other->propertyNumber("num")->value() != 6.0f);
+
+    ViewModelStringUpdate strings[] = {{instance->stringHandle("str"), "a"}};
+    ViewModelBooleanUpdate booleans[] = {
+        {instance->booleanHandle("boo"), true}};
+    ViewModelColorUpdate colors[] = {
+        {instance->colorHandle("col"), 0x7F00FF00}};
+    ViewModelEnumUpdate enums[] = {{instance->enumHandle("enu"), 1u}};
+    CHECK(instance->setValues(strings) == 1);
+    CHECK(instance->setValues(booleans) == 1);
+    CHECK(instance->setValues(colors) == 1);
+    CHECK(instance->setValues(enums) == 1);
+    CHECK(instance->propertyString("str")->value() == "a");
+    CHECK(instance->propertyBoolean("boo")->value() == true);
+    CHECK(instance->propertyColor("col")->value() == 0x7F00FF00);
+    CHECK(instance->propertyEnum("enu")->valueIndex() == 1);
+}
+
+TEST_CASE("Replacing a view model invalidates property handles",
+          "[data binding]")
+{
+    auto file = ReadRiveFile("assets/viewmodel_runtime_file.riv");
+    auto instance = file->viewModelByName("vm")->createDefaultInstance();
+    REQUIRE(instance != nullptr);
+    auto chi = instance->propertyViewModel("chi");
+    REQUIRE(chi != nullptr);
+
+    auto num = instance->numberHandle("num");
+    auto chiNum = instance->numberHandle("chi/chi-num");
+    auto nestedChiNum = chi->numberHandle("chi-num");
+    REQUIRE(chiNum);
+    REQUIRE(nestedChiNum);
+    CHECK(instance->isValid(chiNum));
+    CHECK(chi->isValid(nestedChiNum));
+    // Handles only work with the runtime that resolved them.
+    CHECK(!instance->isValid(nestedChiNum));
+
+    auto replacement =
+        file->viewModelByName(chi->viewModelName())->createDefaultInstance();
+    REQUIRE(instance->replaceViewModel("chi", replacement.get()));
+
+    // "chi/chi-num" now leads to a different property, so every handle
+    // resolved through the old paths is stale, including ones resolved by the
+    // nested runtime.
+    CHECK(!instance->isValid(num));
+    CHECK(!instance->isValid(chiNum));
+    CHECK(!chi->isValid(nestedChiNum));
+    CHECK(!instance->setValue(chiNum, 9.0f));
+    ViewModelNumberUpdate updates[] = {{chiNum, 9.0f}, {num, 9.0f}};
+    CHECK(instance->setValues(updates) == 0);
+
+    // Resolving again picks up the replacement.
+    chiNum = instance->numberHandle("chi/chi-num");
+    CHECK(chiNum.property() == replacement->propertyNumber("chi-num"));
+    CHECK(instance->setValue(chiNum, 9.0f));
+    CHECK(replacement->propertyNumber("chi-num")->value() == 9.0f);
+}
+
+TEST_CASE("Handles don't validate on a runtime reusing a freed address",
+          "[data binding]")
+{
+    auto file = ReadRiveFile("assets/viewmodel_runtime_file.riv");
+    auto viewModel = file->viewModelByName("vm");
+    auto instance = viewModel->createDefaultInstance();
+    const ViewModelInstanceRuntime* freedAddress = instance.get();
+    auto num = instance->numberHandle("num");
+    REQUIRE(instance->isValid(num));
+    instance = nullptr;
+
+    // The allocator usually hands the freed block straight back; either way
+    // the handle belongs to a runtime that is gone.
+    bool reusedAddress = false;
+    for (int i = 0; i < 8 && !reusedAddress; i++)
+    {
+        instance = viewModel->createDefaultInstance();
+        reusedAddress = instance.get() == freedAddress;
+        CHECK(!instance->isValid(num));
+        CHECK(!instance->setValue(num, 1.0f));
+    }
+}
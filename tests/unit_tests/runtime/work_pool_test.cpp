@@ -1,6 +1,9 @@
 
 #include "catch.hpp"
 #include "rive/async/work_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 using namespace rive;
 
@@ -97,6 +100,94 @@ TEST_CASE("WorkPool respects maxCallbacks", "[workpool]")
     CHECK_FALSE(pool.hasPendingWork());
 }
 
+// A task that records the order it ran in, and the order its callback was
+// delivered in.
+class OrderedTask : public WorkTask
+{
+public:
+    OrderedTask(std::vector<int>* executeOrder,
+                std::vector<int>* completeOrder,
+                int id,
+                WorkPriority priority) :
+        m_executeOrder(executeOrder), m_completeOrder(completeOrder), m_id(id)
+    {
+        setPriority(priority);
+    }
+
+    bool execute() override
+    {
+        m_executeOrder->push_back(m_id);
+        return true;
+    }
+    void onComplete() override { m_completeOrder->push_back(m_id); }
+
+private:
+    std::vector<int>* m_executeOrder;
+    std::vector<int>* m_completeOrder;
+    int m_id;
+};
+
+#ifndef WITH_RIVE_THREADING
+TEST_CASE("WorkPool runs higher priorities first", "[workpool]")
+{
+    WorkPool pool;
+    std::vector<int> executeOrder, completeOrder;
+    for (auto [id, priority] : {std::make_pair(0, WorkPriority::Low),
+                                std::make_pair(1, WorkPriority::Normal),
+                                std::make_pair(2, WorkPriority::High),
+                                std::make_pair(3, WorkPriority::Low),
+                                std::make_pair(4, WorkPriority::High)})
+    {
+        pool.submit(make_rcp<OrderedTask>(&executeOrder,
+                                          &completeOrder,
+                                          id,
+                                          priority));
+    }
+
+    CHECK(pool.pollCompletedWork(3) == 3);
+    CHECK(completeOrder == std::vector<int>{2, 4, 1});
+    CHECK(pool.pollCompletedWork(WorkPool::kPollAll) == 2);
+    // Within a priority, tasks run in submission order.
+    CHECK(completeOrder == std::vector<int>{2, 4, 1, 0, 3});
+    CHECK(executeOrder == completeOrder);
+    CHECK_FALSE(pool.hasPendingWork());
+}
+#endif
+
+// A task that submits another task from its callback.
+class ResubmittingTask : public TestTask
+{
+public:
+    ResubmittingTask(WorkPool* pool) : m_pool(pool) {}
+
+    void onComplete() override
+    {
+        TestTask::onComplete();
+        m_child = make_rcp<TestTask>();
+        m_pool->submit(m_child);
+    }
+
+    WorkPool* m_pool;
+    rcp<TestTask> m_child;
+};
+
+TEST_CASE("Tasks submitted during a poll wait for the next poll",
+          "[workpool]")
+{
+    WorkPool pool;
+    auto task = make_rcp<ResubmittingTask>(&pool);
+    pool.submit(task);
+
+    while (!task->completed)
+        pool.pollCompletedWork(WorkPool::kPollAll);
+    REQUIRE(task->m_child != nullptr);
+    CHECK(task->m_child->completed == false);
+
+    while (pool.hasPendingWork())
+        pool.pollCompletedWork(WorkPool::kPollAll);
+    CHECK(task->m_child->completed == true);
+}
+
 // ============================================================================
 // Cancellation
 // ============================================================================
@@ -305,8 +396,171 @@ TEST_CASE("owner-cancel of in-flight task sets status to Cancelled",
     // onComplete should NOT have been called.
     CHECK(task->completed == false);
 }
+
+TEST_CASE("WorkPool thread count is configurable", "[workpool]")
+{
+    CHECK(WorkPool().threadCount() == WorkPool::defaultThreadCount());
+    CHECK(WorkPool(1).threadCount() == 1);
+    CHECK(WorkPool(16).threadCount() == 16);
+}
+
+TEST_CASE("WorkPool worker takes higher priorities first", "[workpool]")
+{
+    // With a single worker, execution order is deterministic once the worker
+    // is held up behind a blocking task.
+    WorkPool pool(1);
+    auto blocker = make_rcp<BlockingTask>();
+    pool.submit(blocker);
+    while (!blocker->executed)
+        std::this_thread::yield();
+
+    std::vector<int> executeOrder, completeOrder;
+    for (auto [id, priority] : {std::make_pair(0, WorkPriority::Low),
+                                std::make_pair(1, WorkPriority::Normal),
+                                std::make_pair(2, WorkPriority::High),
+                                std::make_pair(3, WorkPriority::Low),
+                                std::make_pair(4, WorkPriority::High)})
+    {
+        pool.submit(make_rcp<OrderedTask>(&executeOrder,
+                                          &completeOrder,
+                                          id,
+                                          priority));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(blocker->mtx);
+        blocker->unblock = true;
+    }
+    blocker->cv.notify_one();
+
+    while (pool.hasPendingWork())
+        pool.pollCompletedWork(WorkPool::kPollAll);
+    CHECK(executeOrder == std::vector<int>{2, 4, 1, 0, 3});
+    CHECK(completeOrder.size() == 5);
+}
+
+// A task that fans out into more tasks from its worker thread.
+class FanOutTask : public WorkTask
+{
+public:
+    FanOutTask(WorkPool* pool, int depth, std::atomic<int>* executedCount) :
+        m_pool(pool), m_depth(depth), m_executedCount(executedCount)
+    {}
+
+    bool execute() override
+    {
+        m_executedCount->fetch_add(1);
+        if (m_depth > 0)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                m_pool->submit(
+                    make_rcp<FanOutTask>(m_pool, m_depth - 1, m_executedCount));
+            }
+        }
+        return true;
+    }
+
+private:
+    WorkPool* m_pool;
+    int m_depth;
+    std::atomic<int>* m_executedCount;
+};
+
+TEST_CASE("WorkPool runs work submitted from workers", "[workpool]")
+{
+    // Everything fans out from a single worker's queue, so the other workers
+    // only get anything to do by stealing.
+    WorkPool pool(8);
+    std::atomic<int> executedCount{0};
+    pool.submit(make_rcp<FanOutTask>(&pool, 5, &executedCount));
+
+    uint32_t completed = 0;
+    while (pool.hasPendingWork())
+        completed += pool.pollCompletedWork(WorkPool::kPollAll);
+    // 1 + 4 + 16 + 64 + 256 + 1024
+    CHECK(executedCount == 1365);
+    CHECK(completed == 1365);
+}
+
+TEST_CASE("parallelFor with no helpers stays on the calling thread",
+          "[workpool]")
+{
+    WorkPool pool(4);
+    std::atomic<int> otherThreadCount{0};
+    std::thread::id caller = std::this_thread::get_id();
+    pool.parallelFor(
+        64,
+        [&](size_t) {
+            if (std::this_thread::get_id() != caller)
+                otherThreadCount.fetch_add(1);
+        },
+        0);
+    CHECK(otherThreadCount == 0);
+}
+
+// Runs a parallelFor from a worker while every other worker is blocked.
+class NestedLoopTask : public WorkTask
+{
+public:
+    NestedLoopTask(WorkPool* pool, std::atomic<int>* sum) :
+        m_pool(pool), m_sum(sum)
+    {}
+
+    bool execute() override
+    {
+        m_pool->parallelFor(100, [this](size_t i) {
+            m_sum->fetch_add(static_cast<int>(i));
+        });
+        return true;
+    }
+
+private:
+    WorkPool* m_pool;
+    std::atomic<int>* m_sum;
+};
+
+TEST_CASE("parallelFor finishes from a worker with the rest busy",
+          "[workpool]")
+{
+    WorkPool pool(2);
+    auto blocker = make_rcp<BlockingTask>();
+    pool.submit(blocker);
+    while (!blocker->executed)
+        std::this_thread::yield();
+
+    std::atomic<int> sum{0};
+    pool.submit(make_rcp<NestedLoopTask>(&pool, &sum));
+    while (sum != 4950)
+        std::this_thread::yield();
+
+    {
+        std::lock_guard<std::mutex> lock(blocker->mtx);
+        blocker->unblock = true;
+    }
+    blocker->cv.notify_one();
+    while (pool.hasPendingWork())
+        pool.pollCompletedWork(WorkPool::kPollAll);
+}
 #endif // WITH_RIVE_THREADING
 
+TEST_CASE("parallelFor calls every index once", "[workpool]")
+{
+    WorkPool pool(4);
+    std::vector<std::atomic<int>> calls(1000);
+    pool.parallelFor(calls.size(), [&](size_t i) { calls[i].fetch_add(1); });
+    bool allOnce = std::all_of(calls.begin(),
+                               calls.end(),
+                               [](const std::atomic<int>& c) {
+                                   return c.load() == 1;
+                               });
+    CHECK(allOnce);
+    // The helpers have no callbacks to deliver.
+    CHECK(pool.pollCompletedWork(WorkPool::kPollAll) == 0);
+
+    pool.parallelFor(0, [&](size_t) { FAIL("called for an empty range"); });
+}
+
 // ============================================================================
 // Destructor cleanup
 // ============================================================================